@@ -91,30 +91,20 @@ BEGIN_NAMESPACE
     template < std::size_t N >
     using get_type_t = typename get_type< N >::type;
 
-    // Figure a way to write 1 version of concate that mimics the behaviour of the 4
-    template < std::size_t S1, std::size_t S2 >
-    auto concate(std::bitset< S1 >&& set1, std::bitset< S2 >&& set2) noexcept {
-        std::string s1 = set1.to_string();
-        std::string s2 = set2.to_string();
-        return std::bitset< S1 + S2 >(std::move(s1) + std::move(s2));
-    }
-    template < std::size_t S1, std::size_t S2 >
-    auto concate(const std::bitset< S1 >& set1, std::bitset< S2 >&& set2) noexcept {
-        std::string s1 = set1.to_string();
-        std::string s2 = set2.to_string();
-        return std::bitset< S1 + S2 >(std::move(s1) + std::move(s2));
-    }
-    template < std::size_t S1, std::size_t S2 >
-    auto concate(std::bitset< S1 >&& set1, const std::bitset< S2 >& set2) noexcept {
-        std::string s1 = set1.to_string();
-        std::string s2 = set2.to_string();
-        return std::bitset< S1 + S2 >(std::move(s1) + std::move(s2));
-    }
     template < std::size_t S1, std::size_t S2 >
     auto concate(const std::bitset< S1 >& set1, const std::bitset< S2 >& set2) noexcept {
-        std::string s1 = set1.to_string();
-        std::string s2 = set2.to_string();
-        return std::bitset< S1 + S2 >(std::move(s1) + std::move(s2));
+        if constexpr (S1 + S2 <= 64) {
+            return std::bitset< S1 + S2 >((set1.to_ullong() << S2) | set2.to_ullong());
+        } else {
+            std::bitset< S1 + S2 > return_value;
+            for (std::size_t i = 0; i < S2; ++i) {
+                return_value[i] = set2[i];
+            }
+            for (std::size_t i = 0; i < S1; ++i) {
+                return_value[S2 + i] = set1[i];
+            }
+            return return_value;
+        }
     }
 
 END_NAMESPACE
@@ -92,6 +92,15 @@
         #define ARMEMU_LOG_TYPE ARMEMU_LOG_OTHER
     #endif // ARMEMU_LOG_TYPE
 
+    // Per instruction tracing is compiled out of release builds unless explicitly requested
+    #ifndef ARMEMU_TRACE_INSTRUCTIONS
+        #ifdef NDEBUG
+            #define ARMEMU_TRACE_INSTRUCTIONS 0
+        #else // NDEBUG | !NDEBUG
+            #define ARMEMU_TRACE_INSTRUCTIONS 1
+        #endif // !NDEBUG
+    #endif // ARMEMU_TRACE_INSTRUCTIONS
+
     #if defined(ARMEMU_BUILD_DLL)
         #define ARMEMU_API        ARMEMU_EXPORT
         #define ARMEMU_EXPORT_API 1
@@ -71,13 +71,17 @@ LogType Log::GetLogType() noexcept {
     return logType;
 }
 
+bool Logger::IsEnabled(LogType type) noexcept {
+    return static_cast< bool >(static_cast< std::underlying_type_t< LogType > >(type) &
+                               static_cast< std::underlying_type_t< LogType > >(logType));
+}
+
 std::ostream* Logger::GetLogTarget() noexcept {
     return logStream;
 }
 
 void Logger::LogInternal(LogType type, std::string&& logMsg) const {
-    if (!static_cast< bool >(static_cast< std::underlying_type_t< LogType > >(type) &
-                             static_cast< std::underlying_type_t< LogType > >(logType))) {
+    if (!IsEnabled(type)) {
         return;
     }
 
@@ -93,8 +97,7 @@ void Logger::LogInternal(LogType type, std::string&& logMsg) const {
 
 #ifndef NDEBUG
 void Logger::LogTraceInternal(LogType type, std::string&& logMsg) const {
-    if (!static_cast< bool >(static_cast< std::underlying_type_t< LogType > >(type) &
-                             static_cast< std::underlying_type_t< LogType > >(logType))) {
+    if (!IsEnabled(type)) {
         return;
     }
 
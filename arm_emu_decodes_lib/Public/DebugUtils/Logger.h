@@ -25,8 +25,14 @@ namespace arm_emu {
         [[nodiscard]] Logger(std::string name) : m_name(std::move(name)) {
         }
 
+        // Cheap check against the active log type mask, callers may use it to skip building log arguments
+        [[nodiscard]] ARMEMU_API static bool IsEnabled(LogType type) noexcept;
+
         template < class... Args >
         void Log(LogType type, const char* logMsg, Args&&... args) const {
+            if (!IsEnabled(type)) {
+                return;
+            }
             auto stamp = Clock::Stamp();
             return LogInternal(type, /*Logger::Formatter("{}{}: {}", stamp.m_time,*/
                                Logger::Formatter(logMsg, std::forward< Args >(args)...)) /*)*/;
@@ -35,6 +41,9 @@ namespace arm_emu {
     #ifndef NDEBUG
         template < class... Args >
         void LogTrace(LogType type, const char* logMsg, Args&&... args) const {
+            if (!IsEnabled(type)) {
+                return;
+            }
             return LogTraceInternal(type, Formatter(logMsg, std::forward< Args >(args)...));
         }
     #endif // NDEBUG
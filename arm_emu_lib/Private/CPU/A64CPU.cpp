@@ -1,26 +1,38 @@
 
 #include <CPU/A64CPU.h>
+#include <CPU/LoadBalancer.h>
 #include <Core/A64Core.h>
+#include <Memory/CacheCoherenceDomain.h>
 #include <Memory/CacheMemory.h>
+#include <Memory/FlatMemory.h>
 #include <Memory/MemoryManagementUnit.h>
 #include <Memory/RandomAccessMemory.h>
 #include <Module/A64Module.h>
 #include <ProcessingUnit/A64ProcessingUnit.h>
+#include <ProcessingUnit/HostThreadPool.h>
+#include <ProcessingUnit/WorkStealingDomain.h>
+#include <Program/ResultElementPool.h>
+#include <algorithm>
+#include <iterator>
 #include <memory>
+#include <span>
+#include <utility>
 
 BEGIN_NAMESPACE
 
-// TODO: Add load balancer
-
 class A64CPU::Impl {
   public:
     Impl(Object* logger, const SystemSettings& settings) :
         m_debugObject(*logger),
-        m_ram(ConstructRAM(settings.RamSize)),
-        m_l3Cache(ConstructL3Cache(m_ram.get(), settings.L3CacheSize)),
+        m_ram(ConstructRAM(settings)),
+        m_l3Cache(ConstructL3Cache(m_ram.get(), settings)),
+        m_l1CoherenceDomains(settings.nThreadsPerCore > 1 ? static_cast< std::size_t >(settings.nCores) : 0),
+        m_workStealingDomain(),
+        m_hostThreadPool(static_cast< std::size_t >(settings.nHostThreads)),
         m_cores(static_cast< std::size_t >(settings.nCores)),
         m_mmu(
-            std::allocate_shared< MemoryManagementUnit >(std::pmr::polymorphic_allocator< MemoryManagementUnit > {})) {
+            std::allocate_shared< MemoryManagementUnit >(std::pmr::polymorphic_allocator< MemoryManagementUnit > {})),
+        m_loadBalancer(settings.loadBalancingPolicy) {
 
         std::pmr::vector< UniqueRef< ICacheMemory > > l1Caches { static_cast< std::size_t >(settings.nCores) *
                                                                  static_cast< std::size_t >(settings.nThreadsPerCore) };
@@ -40,34 +52,67 @@ class A64CPU::Impl {
         std::pmr::polymorphic_allocator< A64Module >          moduleAlloc {};
 
         CacheMemory::Config cacheConfig {};
-        cacheConfig.m_cacheWriteStrategy = CacheWriteStrategy::WriteThrough;
+        cacheConfig.m_cacheWriteStrategy = CacheWriteStrategy::WriteBack;
         cacheConfig.m_memoryMapping      = CacheMemoryMapping::DirectMapping;
 
-        for (auto& l2Cache : l2Caches) {
-            l2Cache = allocate_unique< ICacheMemory, CacheMemory >(cacheAlloc, "L2Cache", cacheConfig, m_l3Cache.get(),
-                                                                   settings.L2CacheSize);
-        }
+        // The flat memory model has no caches, cores and modules are built without them
+        const bool isFlatMemory = settings.memoryModel == MemoryModel::Flat;
+
         std::uint64_t cIdx = 0;
-        for (auto& l1Cache : l1Caches) {
-            l1Cache = allocate_unique< ICacheMemory, CacheMemory >(
-                cacheAlloc, "L1Cache", cacheConfig, l2Caches.at(cIdx / settings.nCores).get(), settings.L1CacheSize);
-            ++cIdx;
+        if (!isFlatMemory) {
+            // Threads of a core share its L2 cache, their L1 caches are kept coherent by the domain of the core
+            auto l2CacheConfig       = cacheConfig;
+            l2CacheConfig.m_isShared = settings.nThreadsPerCore > 1;
+
+            for (auto& l2Cache : l2Caches) {
+                l2Cache = allocate_unique< ICacheMemory, CacheMemory >(cacheAlloc, "L2Cache", l2CacheConfig,
+                                                                       m_l3Cache.get(), settings.L2CacheSize);
+            }
+            for (auto& l1Cache : l1Caches) {
+                const auto coreIdx = cIdx / settings.nThreadsPerCore;
+
+                auto l1CacheConfig = cacheConfig;
+                if (!m_l1CoherenceDomains.empty()) {
+                    l1CacheConfig.m_coherenceDomain = &m_l1CoherenceDomains[coreIdx];
+                }
+
+                l1Cache = allocate_unique< ICacheMemory, CacheMemory >(
+                    cacheAlloc, "L1Cache", l1CacheConfig, l2Caches.at(coreIdx).get(), settings.L1CacheSize);
+                ++cIdx;
+            }
         }
 
         const auto processMemorySize = settings.StackSize + settings.HeapSize;
         const auto neededSize        = processMemorySize * processingUnits.size();
 
-        if (neededSize > settings.RamSize) {
+        // Paged processes only take RAM for the pages they touch, so they may overcommit it
+        const bool isPagedMemory = settings.memoryModel == MemoryModel::Paged;
+
+        if (isPagedMemory) {
+            m_mmu->SetPhysicalMemory(m_ram.get(), 0, m_ram->Size());
+        } else if (neededSize > settings.RamSize) {
             throw cpu_creation_failure { "CPU requires more RAM size than specified" };
         }
 
         cIdx = 0;
         for (auto& processingUnit : processingUnits) {
+            const auto flatMemory =
+                isFlatMemory ? static_cast< FlatMemory* >(m_ram.get())->GetRange(cIdx * processMemorySize,
+                                                                                  processMemorySize)
+                             : std::span< IMemory::DataUnit > {};
+
+            // Threads of a core share its L2 cache, they steal the programs of each other first
             processingUnit = allocate_unique< IProcessingUnit, A64ProcessingUnit >(
                 processingUnitAlloc, "ProcessingUnit", l1Caches.at(cIdx).get(), processMemorySize,
-                MemoryManagementUnitProxy { m_mmu });
-
-            m_mmu->AddProcess(processingUnit.get(), cIdx * processMemorySize, (cIdx + 1) * processMemorySize);
+                MemoryManagementUnitProxy { m_mmu }, flatMemory, &m_workStealingDomain,
+                static_cast< std::size_t >(cIdx / settings.nThreadsPerCore), &m_hostThreadPool);
+            processingUnit->SetExecutionMode(settings.executionMode);
+
+            if (isPagedMemory) {
+                m_mmu->AddDemandPagedProcess(processingUnit.get(), processMemorySize);
+            } else {
+                m_mmu->AddProcess(processingUnit.get(), cIdx * processMemorySize, (cIdx + 1) * processMemorySize);
+            }
             ++cIdx;
         }
         cIdx = 0;
@@ -84,7 +129,8 @@ class A64CPU::Impl {
         for (auto& module_ : m_cores) {
             module_ =
                 allocate_unique< IModule, A64Module >(moduleAlloc, "Core", std::move(std::exchange(cores[cIdx], {})),
-                                                      std::move(std::exchange(l2Caches[cIdx], nullptr)));
+                                                      std::move(std::exchange(l2Caches[cIdx], nullptr)),
+                                                      settings.loadBalancingPolicy);
             ++cIdx;
         }
 
@@ -93,19 +139,61 @@ class A64CPU::Impl {
 
     ~Impl() {
         m_cores.clear();
+        m_l1CoherenceDomains.clear();
         m_mmu.reset();
         m_l3Cache.reset();
         m_ram.reset();
     }
 
     Result Run(Program program) {
-        // TODO: load balance
-        return m_cores.at(0)->Run(std::move(program));
+        const auto [coreIdx, threadIdx] = SelectProcessingUnit();
+        return m_cores[coreIdx]->Run(threadIdx, std::move(program));
     }
 
     ControlledResult StepIn(Program program) {
-        // TODO: load balance
-        return m_cores.at(0)->StepIn(std::move(program));
+        const auto [coreIdx, threadIdx] = SelectProcessingUnit();
+        return m_cores[coreIdx]->StepIn(threadIdx, std::move(program));
+    }
+
+    std::pmr::vector< Result > RunBatch(std::span< Program > programs) {
+        std::pmr::vector< Result > results {};
+        if (programs.empty()) {
+            return results;
+        }
+        results.reserve(programs.size());
+
+        // Programs are placed one by one as if submitted separately, the queue depths are read once for the batch
+        // and the programs placed before count towards them
+        const std::size_t               nThreadsPerCore = GetThreadsPerCoreCount();
+        std::pmr::vector< std::size_t > batchSizes(m_cores.size() * nThreadsPerCore, 0);
+        std::pmr::vector< std::size_t > unitDepths(m_cores.size() * nThreadsPerCore, 0);
+        std::pmr::vector< std::size_t > coreDepths(m_cores.size(), 0);
+        ReadQueueDepths(unitDepths, coreDepths);
+        for (std::size_t i = 0; i < programs.size(); ++i) {
+            const auto [coreIdx, threadIdx] = SelectProcessingUnit(unitDepths, coreDepths);
+            const std::size_t unitIdx       = coreIdx * nThreadsPerCore + threadIdx;
+            ++batchSizes[unitIdx];
+            ++unitDepths[unitIdx];
+            ++coreDepths[coreIdx];
+        }
+
+        // Each processing unit gets a contiguous slice, so results come back in the order of the programs
+        ResultElementPool resultPool { programs.size() };
+        std::size_t       first = 0;
+        for (std::size_t unitIdx = 0; unitIdx < batchSizes.size(); ++unitIdx) {
+            if (batchSizes[unitIdx] == 0) {
+                continue;
+            }
+            auto unitResults =
+                m_cores[unitIdx / nThreadsPerCore]->RunBatch(static_cast< std::uint8_t >(unitIdx % nThreadsPerCore),
+                                                            programs.subspan(first, batchSizes[unitIdx]), resultPool);
+            std::move(unitResults.begin(), unitResults.end(), std::back_inserter(results));
+            first += batchSizes[unitIdx];
+        }
+
+        // Units still idle are woken once, they steal from the units that got more than one program
+        m_workStealingDomain.WakeIdleWorkers(programs.size());
+        return results;
     }
 
     void Stop() {
@@ -128,6 +216,11 @@ class A64CPU::Impl {
         return m_cores.at(0)->GetCoreCount();
     }
 
+    const IProcessingUnitWatcher& GetProcessingUnitWatcher(std::uint8_t coreNumber,
+                                                           std::uint8_t threadNumber) const noexcept {
+        return m_cores[coreNumber]->GetProcessingUnitWatcher(threadNumber);
+    }
+
     ArchitectureProfile GetExecutionState() const noexcept {
         return static_cast< ArchitectureProfile >(m_cores.at(0)->GetExecutionState(0));
     }
@@ -158,33 +251,90 @@ class A64CPU::Impl {
     }
 
   private:
-    static UniqueRef< IMemory > ConstructRAM(std::uint64_t ramSize) {
+    static UniqueRef< IMemory > ConstructRAM(const SystemSettings& settings) {
+        if (settings.memoryModel == MemoryModel::Flat) {
+            std::pmr::polymorphic_allocator< FlatMemory > alloc {};
+
+            // Flat memory is allocated upfront, so only the part processing units can address is allocated
+            const auto processMemorySize = settings.StackSize + settings.HeapSize;
+            const auto processingUnitCount =
+                static_cast< std::uint64_t >(settings.nCores) * static_cast< std::uint64_t >(settings.nThreadsPerCore);
+
+            return allocate_unique< IMemory, FlatMemory >(
+                alloc, "RAM", std::min(settings.RamSize, processMemorySize * processingUnitCount));
+        }
+
         std::pmr::polymorphic_allocator< RandomAccessMemory > alloc {};
 
-        return allocate_unique< IMemory, RandomAccessMemory >(alloc, "RAM", ramSize);
+        return allocate_unique< IMemory, RandomAccessMemory >(alloc, "RAM", settings.RamSize);
     }
 
-    static UniqueRef< IMemory > ConstructL3Cache(IMemory* upStream, std::uint64_t L3Size) {
+    static UniqueRef< IMemory > ConstructL3Cache(IMemory* upStream, const SystemSettings& settings) {
+        if (settings.memoryModel == MemoryModel::Flat) {
+            return { nullptr, nullptr };
+        }
+
         std::pmr::polymorphic_allocator< CacheMemory > alloc {};
 
         CacheMemory::Config config {};
-        config.m_cacheWriteStrategy = CacheWriteStrategy::WriteThrough;
+        config.m_cacheWriteStrategy = CacheWriteStrategy::WriteBack;
         config.m_memoryMapping      = CacheMemoryMapping::DirectMapping;
+        config.m_isShared           = settings.nCores * settings.nThreadsPerCore > 1; // Shared by all cores
+
+        return allocate_unique< IMemory, CacheMemory >(alloc, "L3Cache", config, upStream, settings.L3CacheSize);
+    }
 
-        return allocate_unique< IMemory, CacheMemory >(alloc, "L3Cache", config, upStream, L3Size);
+    /// @brief Picks the core and hardware thread of the next program over all processing units of the CPU
+    std::pair< std::size_t, std::uint8_t > SelectProcessingUnit() {
+        std::pmr::vector< std::size_t > unitDepths(m_cores.size() * GetThreadsPerCoreCount(), 0);
+        std::pmr::vector< std::size_t > coreDepths(m_cores.size(), 0);
+        ReadQueueDepths(unitDepths, coreDepths);
+        return SelectProcessingUnit(unitDepths, coreDepths);
+    }
+
+    /// @brief Picks the core and hardware thread of the next program from already read queue depths
+    /// @param unitDepths Queued programs per processing unit
+    /// @param coreDepths Queued programs per core
+    std::pair< std::size_t, std::uint8_t > SelectProcessingUnit(std::span< const std::size_t > unitDepths,
+                                                                std::span< const std::size_t > coreDepths) {
+        const std::size_t nThreadsPerCore = GetThreadsPerCoreCount();
+
+        const std::size_t unit = m_loadBalancer.Select(unitDepths.size(), [&](std::size_t unitIdx) {
+            return LoadBalancer::UnitLoad { unitDepths[unitIdx], coreDepths[unitIdx / nThreadsPerCore] };
+        });
+
+        return { unit / nThreadsPerCore, static_cast< std::uint8_t >(unit % nThreadsPerCore) };
+    }
+
+    /// @brief Reads the queue depth of every processing unit once and sums them per core
+    void ReadQueueDepths(std::span< std::size_t > unitDepths, std::span< std::size_t > coreDepths) {
+        const std::size_t nThreadsPerCore = GetThreadsPerCoreCount();
+        for (std::size_t coreIdx = 0; coreIdx < m_cores.size(); ++coreIdx) {
+            for (std::uint8_t threadIdx = 0; threadIdx < nThreadsPerCore; ++threadIdx) {
+                const std::size_t depth = m_cores[coreIdx]->GetProcessingUnitWatcher(threadIdx).GetQueueDepth();
+                unitDepths[coreIdx * nThreadsPerCore + threadIdx] = depth;
+                coreDepths[coreIdx] += depth;
+            }
+        }
     }
 
     Object&                                  m_debugObject;
     UniqueRef< IMemory >                     m_ram;
     UniqueRef< IMemory >                     m_l3Cache;
+    std::pmr::vector< CacheCoherenceDomain > m_l1CoherenceDomains; // One per core, empty with one thread per core
+    WorkStealingDomain                       m_workStealingDomain; // All processing units of the CPU
+    HostThreadPool                           m_hostThreadPool;     // Runs the processing units, outlives them
     SharedRef< MemoryManagementUnit >        m_mmu;
     std::pmr::vector< UniqueRef< IModule > > m_cores;
+    LoadBalancer                             m_loadBalancer;
 };
 
 template < class ImplDetail >
 UniqueRef< A64CPU::Impl > A64CPU::ConstructCPU(const SystemSettings& settings, ImplDetail myself) {
-    assert(settings.nCores > 0 && settings.nThreadsPerCore > 0 && settings.L1CacheSize > 0 &&
-           settings.L2CacheSize > 0 && settings.L3CacheSize > 0 && settings.RamSize > 0 && settings.StackSize > 0 &&
+    assert(settings.nCores > 0 && settings.nThreadsPerCore > 0 &&
+           (settings.memoryModel == MemoryModel::Flat ||
+            (settings.L1CacheSize > 0 && settings.L2CacheSize > 0 && settings.L3CacheSize > 0)) &&
+           settings.RamSize > 0 && settings.StackSize > 0 &&
            "All CPU system settings has to be larger than 0 for a valid CPU!");
     myself->Log(LogType::Construction,
                 "Constructing CPU with {} cores, {} threads per core, {} L1 cache, {} L2 cache, {} L3 cache, {} ram "
@@ -218,10 +368,13 @@ Result A64CPU::Run(Program program) {
 }
 
 ControlledResult A64CPU::StepIn(Program program) {
-    // TODO: load balance
     return m_cpu->StepIn(std::move(program));
 }
 
+std::pmr::vector< Result > A64CPU::RunBatch(std::span< Program > programs) {
+    return m_cpu->RunBatch(programs);
+}
+
 void A64CPU::Stop() {
     m_cpu->Stop();
 }
@@ -238,6 +391,11 @@ std::uint8_t A64CPU::GetThreadsPerCoreCount() const noexcept {
     return m_cpu->GetThreadsPerCoreCount();
 }
 
+const IProcessingUnitWatcher& A64CPU::GetProcessingUnitWatcher(std::uint8_t coreNumber,
+                                                               std::uint8_t threadNumber) const noexcept {
+    return m_cpu->GetProcessingUnitWatcher(coreNumber, threadNumber);
+}
+
 ArchitectureProfile A64CPU::GetExecutionState() const noexcept {
     return m_cpu->GetExecutionState();
 }
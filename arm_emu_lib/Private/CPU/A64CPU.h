@@ -5,6 +5,7 @@
     #include <CPU/ICPU.h>
     #include <CPU/SystemSettings.h>
     #include <DebugUtils/Object.h>
+    #include <ProcessingUnit/IProcessingUnitWatcher.h>
     #include <Utility/UniqueRef.h>
     #include <vector>
 
@@ -28,11 +29,18 @@ class [[nodiscard]] A64CPU : public ICPU, public Object {
     Result           Run(Program program) final;
     ControlledResult StepIn(Program program) final;
     void             Stop() final;
+
+    std::pmr::vector< Result > RunBatch(std::span< Program > programs) final;
+
     void             Reset() noexcept final;
 
     [[nodiscard]] std::uint8_t GetCoreCount() const noexcept final;
     [[nodiscard]] std::uint8_t GetThreadsPerCoreCount() const noexcept final;
 
+    /// @brief Watcher of the processing unit running hardware thread threadNumber of core coreNumber
+    [[nodiscard]] const IProcessingUnitWatcher& GetProcessingUnitWatcher(std::uint8_t coreNumber,
+                                                                         std::uint8_t threadNumber) const noexcept;
+
     [[nodiscard]] ArchitectureProfile                 GetExecutionState() const noexcept final;
     [[nodiscard]] InstructionSet                      GetInstructionSet() const noexcept final;
     [[nodiscard]] ExtensionVersion                    GetCurrentExtensionVersion() const noexcept final;
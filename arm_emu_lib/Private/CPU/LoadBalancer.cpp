@@ -0,0 +1,20 @@
+#include <CPU/LoadBalancer.h>
+
+BEGIN_NAMESPACE
+
+LoadBalancer::LoadBalancer(LoadBalancingPolicy policy) noexcept : m_policy(policy), m_nextUnit(0) {
+}
+
+LoadBalancingPolicy LoadBalancer::GetPolicy() const noexcept {
+    return m_policy;
+}
+
+bool LoadBalancer::IsLessLoaded(const UnitLoad& load, const UnitLoad& other) noexcept {
+    // An idle hardware thread on a busy core still shares its pipeline, prefer idle cores on equal depth
+    if (load.m_queueDepth != other.m_queueDepth) {
+        return load.m_queueDepth < other.m_queueDepth;
+    }
+    return load.m_coreQueueDepth < other.m_coreQueueDepth;
+}
+
+END_NAMESPACE
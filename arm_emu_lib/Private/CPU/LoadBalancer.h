@@ -0,0 +1,69 @@
+#if !defined(LOADBALANCER_H_INCLUDED_B8B7D133_B6BD_4F59_91F8_8738FD7BFDCB)
+    #define LOADBALANCER_H_INCLUDED_B8B7D133_B6BD_4F59_91F8_8738FD7BFDCB
+
+    #include <API/Api.h>
+    #include <API/HiddenAPI.h>
+    #include <CPU/LoadBalancingPolicy.h>
+    #include <atomic>
+    #include <cassert>
+    #include <cstddef>
+
+BEGIN_NAMESPACE
+
+/// <summary>
+/// Picks the processing unit a submitted program is queued on.
+/// Units are addressed by a flat index, the caller maps it back to its module and thread.
+/// </summary>
+class [[nodiscard]] LoadBalancer {
+  public:
+    struct [[nodiscard]] UnitLoad {
+        std::size_t m_queueDepth;     // Programs queued on the processing unit
+        std::size_t m_coreQueueDepth; // Programs queued on all processing units of its core
+    };
+
+    explicit LoadBalancer(LoadBalancingPolicy policy) noexcept;
+    DELETE_COPY_CLASS(LoadBalancer)
+    DELETE_MOVE_CLASS(LoadBalancer)
+    DEFAULT_DTOR(LoadBalancer)
+
+    [[nodiscard]] LoadBalancingPolicy GetPolicy() const noexcept;
+
+    /// @brief Returns the index of the unit the next program goes to
+    /// @param loadOf callable returning the UnitLoad of a unit index, only queried by LeastLoaded
+    /// @note Thread safe, concurrent selections may land on the same unit when loads are equal
+    template < class LoadOf >
+    [[nodiscard]] std::size_t Select(std::size_t unitCount, LoadOf&& loadOf) {
+        assert(unitCount > 0 && "Can't balance load over 0 processing units!");
+
+        switch (m_policy) {
+            case LoadBalancingPolicy::LeastLoaded: {
+                std::size_t selected     = 0;
+                UnitLoad    selectedLoad = loadOf(std::size_t { 0 });
+                // An idle unit on an idle core can't be beaten, stop scanning there
+                for (std::size_t unit = 1; unit < unitCount && selectedLoad.m_coreQueueDepth > 0; ++unit) {
+                    const UnitLoad load = loadOf(unit);
+                    if (IsLessLoaded(load, selectedLoad)) {
+                        selected     = unit;
+                        selectedLoad = load;
+                    }
+                }
+                return selected;
+            }
+            case LoadBalancingPolicy::RoundRobin:
+                return m_nextUnit.fetch_add(1, std::memory_order_relaxed) % unitCount;
+            case LoadBalancingPolicy::FirstProcessingUnit:
+            default:
+                return 0;
+        }
+    }
+
+  private:
+    [[nodiscard]] static bool IsLessLoaded(const UnitLoad& load, const UnitLoad& other) noexcept;
+
+    LoadBalancingPolicy        m_policy;
+    std::atomic< std::size_t > m_nextUnit;
+};
+
+END_NAMESPACE
+
+#endif // !defined(LOADBALANCER_H_INCLUDED_B8B7D133_B6BD_4F59_91F8_8738FD7BFDCB)
@@ -66,10 +66,13 @@ Result A64Core::Run(Program program) {
 }
 
 ControlledResult A64Core::StepIn(Program program) {
-    // TODO: balance load
     return m_processingUnit->StepIn(std::move(program));
 }
 
+std::pmr::vector< Result > A64Core::RunBatch(std::span< Program > programs, ResultElementPool& resultPool) {
+    return m_processingUnit->RunBatch(programs, resultPool);
+}
+
 void A64Core::Stop() {
     m_processingUnit->Stop();
 }
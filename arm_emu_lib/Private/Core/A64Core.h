@@ -38,6 +38,8 @@ class [[nodiscard]] A64Core : public ICore {
     void             Stop() final;
     void             Reset() noexcept final;
 
+    std::pmr::vector< Result > RunBatch(std::span< Program > programs, ResultElementPool& resultPool) final;
+
   private:
     UniqueRef< ICacheMemory >    m_memory;
     UniqueRef< IProcessingUnit > m_processingUnit;
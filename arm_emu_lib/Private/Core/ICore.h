@@ -35,6 +35,8 @@ class [[nodiscard]] ICore : public Object {
     virtual ControlledResult StepIn(Program program) = 0;
     virtual void             Stop()                  = 0;
     virtual void             Reset() noexcept        = 0;
+
+    virtual std::pmr::vector< Result > RunBatch(std::span< Program > programs, ResultElementPool& resultPool) = 0;
 };
 
 END_NAMESPACE
@@ -0,0 +1,65 @@
+#include <Memory/CacheCoherenceDomain.h>
+#include <algorithm>
+#include <cassert>
+
+BEGIN_NAMESPACE
+
+CacheCoherenceDomain::CacheCoherenceDomain() :
+    m_members(), m_lockStripes(), m_readBroadcasts(0), m_invalidateBroadcasts(0) {
+}
+
+CacheCoherenceDomain::~CacheCoherenceDomain() {
+    assert(m_members.empty() && "Caches have to leave their coherence domain before it is destroyed!");
+}
+
+void CacheCoherenceDomain::Join(ISnooper* member) {
+    assert(std::find(m_members.begin(), m_members.end(), member) == m_members.end());
+    assert((m_members.empty() || m_members.front()->SetCount() == member->SetCount()) &&
+           "Members of a coherence domain have to share their geometry!");
+    m_members.push_back(member);
+}
+
+void CacheCoherenceDomain::Leave(ISnooper* member) noexcept {
+    m_members.erase(std::remove(m_members.begin(), m_members.end(), member), m_members.end());
+}
+
+bool CacheCoherenceDomain::BroadcastRead(const ISnooper* requester, IMemory::Address lineAddress) {
+    m_readBroadcasts.fetch_add(1, std::memory_order_relaxed);
+
+    // Every member is snooped, all of them downgrade their copy
+    bool isShared = false;
+    for (auto* member : m_members) {
+        if (member != requester) {
+            isShared |= member->SnoopRead(lineAddress);
+        }
+    }
+    return isShared;
+}
+
+void CacheCoherenceDomain::BroadcastInvalidate(const ISnooper* requester, IMemory::Address lineAddress) {
+    m_invalidateBroadcasts.fetch_add(1, std::memory_order_relaxed);
+
+    for (auto* member : m_members) {
+        if (member != requester) {
+            (void)member->SnoopInvalidate(lineAddress);
+        }
+    }
+}
+
+CacheCoherenceDomain::LockStripes& CacheCoherenceDomain::GetLockStripes() noexcept {
+    return m_lockStripes;
+}
+
+std::size_t CacheCoherenceDomain::GetMemberCount() const noexcept {
+    return m_members.size();
+}
+
+std::size_t CacheCoherenceDomain::GetReadBroadcastCount() const noexcept {
+    return m_readBroadcasts.load(std::memory_order_relaxed);
+}
+
+std::size_t CacheCoherenceDomain::GetInvalidateBroadcastCount() const noexcept {
+    return m_invalidateBroadcasts.load(std::memory_order_relaxed);
+}
+
+END_NAMESPACE
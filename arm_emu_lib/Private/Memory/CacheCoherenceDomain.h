@@ -0,0 +1,78 @@
+#if !defined(CACHECOHERENCEDOMAIN_H_INCLUDED_72C2E1D8_4EFD_4C90_8077_01D449064509)
+    #define CACHECOHERENCEDOMAIN_H_INCLUDED_72C2E1D8_4EFD_4C90_8077_01D449064509
+
+    #include <API/Api.h>
+    #include <API/HiddenAPI.h>
+    #include <Memory/ICacheMemory.h>
+    #include <array>
+    #include <atomic>
+    #include <cstddef>
+    #include <memory_resource>
+    #include <mutex>
+    #include <vector>
+
+BEGIN_NAMESPACE
+
+/// <summary>
+/// Snooping bus of the caches sharing an upstream cache, typically the L1 caches of the threads of a core.
+/// Members keep their copies of a line coherent with the MESI protocol: a read miss downgrades the copies of the
+/// other members to Shared, a write invalidates them, modified copies are written back upstream first.
+/// Members lock the stripes of the domain instead of their own, so that a snoop never races with an access of the
+/// snooped cache.
+/// </summary>
+class [[nodiscard]] CacheCoherenceDomain {
+  public:
+    static constexpr std::size_t Lock_stripe_count = 64;
+    using LockStripes                              = std::array< std::mutex, Lock_stripe_count >;
+
+    /// <summary>
+    /// Cache answering the snoops of the other members of its domain
+    /// </summary>
+    class [[nodiscard]] ISnooper {
+      public:
+        ISnooper() = default;
+        DELETE_COPY_CLASS(ISnooper)
+        DELETE_MOVE_CLASS(ISnooper)
+        virtual ~ISnooper() = default;
+
+        /// @brief Number of sets, all members of a domain need the same geometry to share lock stripes
+        [[nodiscard]] virtual std::size_t SetCount() const noexcept = 0;
+
+        /// @brief Another member reads the line, returns whether a copy is kept
+        virtual bool SnoopRead(IMemory::Address lineAddress) = 0;
+
+        /// @brief Another member writes the line, returns whether a copy was dropped
+        virtual bool SnoopInvalidate(IMemory::Address lineAddress) = 0;
+    };
+
+    CacheCoherenceDomain();
+    DELETE_COPY_CLASS(CacheCoherenceDomain)
+    DELETE_MOVE_CLASS(CacheCoherenceDomain)
+    ~CacheCoherenceDomain();
+
+    /// @note Members join and leave while no access is running
+    void Join(ISnooper* member);
+    void Leave(ISnooper* member) noexcept;
+
+    /// @brief Snoops a read miss of requester, returns whether another member keeps a copy of the line
+    [[nodiscard]] bool BroadcastRead(const ISnooper* requester, IMemory::Address lineAddress);
+
+    /// @brief Snoops a write of requester, the copies of the other members are dropped
+    void BroadcastInvalidate(const ISnooper* requester, IMemory::Address lineAddress);
+
+    [[nodiscard]] LockStripes& GetLockStripes() noexcept;
+
+    [[nodiscard]] std::size_t GetMemberCount() const noexcept;
+    [[nodiscard]] std::size_t GetReadBroadcastCount() const noexcept;
+    [[nodiscard]] std::size_t GetInvalidateBroadcastCount() const noexcept;
+
+  private:
+    std::pmr::vector< ISnooper* > m_members;
+    LockStripes                   m_lockStripes;
+    std::atomic< std::size_t >    m_readBroadcasts;
+    std::atomic< std::size_t >    m_invalidateBroadcasts;
+};
+
+END_NAMESPACE
+
+#endif // !defined(CACHECOHERENCEDOMAIN_H_INCLUDED_72C2E1D8_4EFD_4C90_8077_01D449064509)
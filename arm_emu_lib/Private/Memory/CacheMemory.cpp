@@ -1,53 +1,271 @@
 /*
-Please note this implementation is meant for single thread access.
-TODO: Implement multi threading access
+Please note the cache implementations are meant for single thread access, shared caches and members of a coherence
+domain are guarded by CacheMemory::StripeGuard which locks the sets touched by an access.
 */
 
+#include <Memory/CacheCoherenceDomain.h>
 #include <Memory/CacheMemory.h>
 #include <Memory/MemoryWatcher.h>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <bitset>
 #include <memory_resource>
+#include <mutex>
+#include <random>
 
 BEGIN_NAMESPACE
 
 namespace {
     static const std::pmr::vector< CacheWriteStrategy > supportedCacheWriteStrategies {
-        CacheWriteStrategy::WriteThrough
+        CacheWriteStrategy::WriteThrough, CacheWriteStrategy::WriteBack
     };
-    static const std::pmr::vector< CacheMemoryMapping > supportedMemoryMappings { CacheMemoryMapping::DirectMapping };
+    static const std::pmr::vector< CacheMemoryMapping > supportedMemoryMappings {
+        CacheMemoryMapping::DirectMapping, CacheMemoryMapping::FullyAssociative, CacheMemoryMapping::SetAssociative
+    };
+
+    // Replacement policies of associative caches, ways of a set are numbered from 0 to ways - 1
+    class DirectMappedPolicy {
+      public:
+        DirectMappedPolicy(std::size_t /*setCount*/, [[maybe_unused]] std::size_t ways) {
+            assert(ways == 1 && "Direct mapped caches have a single way!");
+        }
+
+        void Touch(std::size_t /*set*/, std::size_t /*way*/) noexcept {
+        }
+
+        [[nodiscard]] std::size_t Victim(std::size_t /*set*/) noexcept {
+            return 0;
+        }
+
+        void Reset() noexcept {
+        }
+    };
+
+    class LeastRecentlyUsedPolicy {
+      public:
+        LeastRecentlyUsedPolicy(std::size_t setCount, std::size_t ways) :
+            m_ways(ways), m_lastUse(setCount * ways, 0), m_clocks(setCount, 0) {
+        }
+
+        void Touch(std::size_t set, std::size_t way) noexcept {
+            m_lastUse[set * m_ways + way] = ++m_clocks[set];
+        }
+
+        [[nodiscard]] std::size_t Victim(std::size_t set) noexcept {
+            const auto setBegin = m_lastUse.begin() + set * m_ways;
+            return static_cast< std::size_t >(std::min_element(setBegin, setBegin + m_ways) - setBegin);
+        }
+
+        void Reset() noexcept {
+            std::fill(m_lastUse.begin(), m_lastUse.end(), 0);
+            std::fill(m_clocks.begin(), m_clocks.end(), 0);
+        }
+
+      private:
+        std::size_t                       m_ways;
+        std::pmr::vector< std::uint64_t > m_lastUse;
+        std::pmr::vector< std::uint64_t > m_clocks; // Sets age independently, accesses to distinct sets never race
+    };
+
+    class PseudoLeastRecentlyUsedPolicy {
+      public:
+        PseudoLeastRecentlyUsedPolicy(std::size_t setCount, std::size_t ways) :
+            m_ways(ways), m_levels(std::countr_zero(ways)), m_tree(setCount * ways, 0) {
+            assert(std::has_single_bit(ways) && "Tree PLRU needs a power of two associativity!");
+        }
+
+        // Every node on the path of the way points away from it
+        void Touch(std::size_t set, std::size_t way) noexcept {
+            auto* const tree = m_tree.data() + set * m_ways;
+            std::size_t node = 1;
+            for (auto level = m_levels; level-- > 0;) {
+                const auto bit = (way >> level) & 1;
+                tree[node]     = static_cast< std::uint8_t >(bit ^ 1);
+                node           = 2 * node + bit;
+            }
+        }
+
+        [[nodiscard]] std::size_t Victim(std::size_t set) noexcept {
+            const auto* const tree = m_tree.data() + set * m_ways;
+            std::size_t       node = 1;
+            std::size_t       way  = 0;
+            for (auto level = m_levels; level-- > 0;) {
+                const auto bit = static_cast< std::size_t >(tree[node]);
+                way            = (way << 1) | bit;
+                node           = 2 * node + bit;
+            }
+            return way;
+        }
+
+        void Reset() noexcept {
+            std::fill(m_tree.begin(), m_tree.end(), 0);
+        }
+
+      private:
+        std::size_t                      m_ways;
+        std::size_t                      m_levels;
+        std::pmr::vector< std::uint8_t > m_tree; // Nodes 1 to ways - 1 of each set, node 0 is unused
+    };
+
+    class RandomPolicy {
+      public:
+        RandomPolicy(std::size_t setCount, std::size_t ways) : m_ways(ways), m_engines(setCount) {
+            Reset();
+        }
+
+        void Touch(std::size_t /*set*/, std::size_t /*way*/) noexcept {
+        }
+
+        [[nodiscard]] std::size_t Victim(std::size_t set) noexcept {
+            return m_engines[set]() % m_ways;
+        }
+
+        void Reset() noexcept {
+            for (std::size_t set = 0; set < m_engines.size(); ++set) {
+                m_engines[set].seed(static_cast< std::minstd_rand::result_type >(set + 1));
+            }
+        }
+
+      private:
+        std::size_t                          m_ways;
+        std::pmr::vector< std::minstd_rand > m_engines; // One engine per set, accesses to distinct sets never race
+    };
+
+    // Copies the part of a cache line overlapping the block starting at blockStart
+    void CopyLineToBlock(ICacheMemory::Address lineAddress, const ICacheMemory::DataUnit* lineData,
+                         ICacheMemory::Address blockStart, std::span< ICacheMemory::DataUnit > block) {
+        const auto lineStart = lineAddress * ICacheMemory::Cache_line_size;
+        const auto from      = std::max(lineStart, blockStart);
+        const auto to        = std::min(lineStart + ICacheMemory::Cache_line_size, blockStart + block.size());
+
+        std::copy(lineData + (from - lineStart), lineData + (to - lineStart), block.data() + (from - blockStart));
+    }
+
+    // Copies the part of the block starting at blockStart overlapping a cache line
+    void CopyBlockToLine(ICacheMemory::Address blockStart, std::span< const ICacheMemory::DataUnit > block,
+                         ICacheMemory::Address lineAddress, ICacheMemory::DataUnit* lineData) {
+        const auto lineStart = lineAddress * ICacheMemory::Cache_line_size;
+        const auto from      = std::max(lineStart, blockStart);
+        const auto to        = std::min(lineStart + ICacheMemory::Cache_line_size, blockStart + block.size());
+
+        std::copy(block.data() + (from - blockStart), block.data() + (to - blockStart), lineData + (from - lineStart));
+    }
 } // namespace
 
-// Direct Mapping implementation
-enum class State {
-    Empty,
-    Clean,
-    Modified,
-};
+// Direct Mapping implementation, lines are fetched whole so a single state covers them
 struct CacheLineData {
     ICacheMemory::Address                                               m_segmentLocInUpstream { 0 };
     std::array< ICacheMemory::DataUnit, ICacheMemory::Cache_line_size > m_data {};
-    std::array< State, ICacheMemory::Cache_line_size >                  m_state {};
+    CacheCoherenceState                                                 m_state { CacheCoherenceState::Invalid };
 };
 
-// Interface for different cache types
-class [[nodiscard]] CacheMemory::Impl {
+// Interface for different cache types, every cache answers the snoops of its coherence domain
+class [[nodiscard]] CacheMemory::Impl : public CacheCoherenceDomain::ISnooper {
   public:
+    static constexpr std::size_t Lock_stripe_count = CacheCoherenceDomain::Lock_stripe_count;
+    using LockStripes                              = CacheCoherenceDomain::LockStripes;
+
     Impl() = default;
-    DEFAULT_MOVE_CLASS(Impl)
+    DELETE_MOVE_CLASS(Impl)
     DELETE_COPY_CLASS(Impl)
-    virtual ~Impl() = default;
+    virtual ~Impl() {
+        LeaveCoherenceDomain();
+    }
+
+    [[nodiscard]] virtual DataUnit Read(Address address) noexcept                       = 0;
+    virtual void                   ReadBlock(Address start, std::span< DataUnit > data) = 0;
 
-    [[nodiscard]] virtual DataUnit              Read(Address address) noexcept                        = 0;
-    [[nodiscard]] virtual DataBlock< DataUnit > ReadBlock(Address start, std::uint64_t dataUnitCount) = 0;
+    /// @brief Cached data units of a block that does not cross a cache line, valid until the next access
+    [[nodiscard]] virtual std::span< const DataUnit > ViewLine(Address start, std::uint64_t dataUnitCount) = 0;
 
-    virtual void Write(Address address, DataUnit data)                        = 0;
-    virtual void WriteBlock(Address start, const DataBlock< DataUnit >& data) = 0;
+    virtual void Write(Address address, DataUnit data)                       = 0;
+    virtual void WriteBlock(Address start, std::span< const DataUnit > data) = 0;
 
     [[nodiscard]] virtual Address Size() const noexcept = 0;
 
     [[nodiscard]] virtual const MemoryWatcher& GetMemoryWatcher() const noexcept  = 0;
     [[nodiscard]] virtual const IMemory* const GetUpStreamMemory() const noexcept = 0;
 
-    virtual void ClearCache() noexcept = 0;
+    virtual void ClearCache() = 0;
+    virtual void FlushCache() = 0;
+
+    void JoinCoherenceDomain(CacheCoherenceDomain* coherenceDomain) {
+        assert(m_coherenceDomain == nullptr);
+        if (coherenceDomain != nullptr) {
+            coherenceDomain->Join(this);
+            m_coherenceDomain = coherenceDomain;
+        }
+    }
+
+    void LeaveCoherenceDomain() noexcept {
+        if (m_coherenceDomain != nullptr) {
+            m_coherenceDomain->Leave(this);
+            m_coherenceDomain = nullptr;
+        }
+    }
+
+    // Members of a coherence domain lock its stripes, a snoop then holds the stripe of the snooped set
+    [[nodiscard]] LockStripes& GetLockStripes() noexcept {
+        return m_coherenceDomain != nullptr ? m_coherenceDomain->GetLockStripes() : m_lockStripes;
+    }
+
+  protected:
+    [[nodiscard]] bool HasCoherenceDomain() const noexcept {
+        return m_coherenceDomain != nullptr;
+    }
+
+    // Returns whether another member of the domain keeps a copy of the line
+    [[nodiscard]] bool BroadcastRead(Address lineAddress) {
+        return m_coherenceDomain != nullptr && m_coherenceDomain->BroadcastRead(this, lineAddress);
+    }
+
+    void BroadcastInvalidate(Address lineAddress) {
+        if (m_coherenceDomain != nullptr) {
+            m_coherenceDomain->BroadcastInvalidate(this, lineAddress);
+        }
+    }
+
+  private:
+    // Set s is guarded by stripe s % Lock_stripe_count, only locked by shared caches
+    LockStripes           m_lockStripes;
+    CacheCoherenceDomain* m_coherenceDomain { nullptr };
+};
+
+class [[nodiscard]] CacheMemory::StripeGuard {
+  public:
+    using Stripes = std::bitset< Impl::Lock_stripe_count >;
+
+    // Private caches are not locked
+    StripeGuard() noexcept : m_lockStripes(nullptr), m_locked() {
+    }
+
+    // Stripes are locked in ascending order so that accesses locking several of them cannot deadlock
+    StripeGuard(Impl::LockStripes& lockStripes, Stripes locked) : m_lockStripes(&lockStripes), m_locked(locked) {
+        for (std::size_t stripe = 0; stripe < m_locked.size(); ++stripe) {
+            if (m_locked.test(stripe)) {
+                (*m_lockStripes)[stripe].lock();
+            }
+        }
+    }
+
+    DELETE_COPY_CLASS(StripeGuard)
+    DELETE_MOVE_CLASS(StripeGuard)
+
+    ~StripeGuard() {
+        if (m_lockStripes == nullptr) {
+            return;
+        }
+        for (std::size_t stripe = 0; stripe < m_locked.size(); ++stripe) {
+            if (m_locked.test(stripe)) {
+                (*m_lockStripes)[stripe].unlock();
+            }
+        }
+    }
+
+  private:
+    Impl::LockStripes* m_lockStripes;
+    Stripes            m_locked;
 };
 
 class [[nodiscard]] CacheMemory::DirectAccessWriteThroughCacheMemory final : public CacheMemory::Impl {
@@ -75,71 +293,38 @@ class [[nodiscard]] CacheMemory::DirectAccessWriteThroughCacheMemory final : pub
         const auto& cacheLine       = m_cache.at(cacheLineEntry);
         const auto  isRequestedData = cacheLine.m_segmentLocInUpstream == segmentLoc;
 
-        if (isRequestedData) {
-            const auto isValid = cacheLine.m_state.at(dataUnitEntry) == State::Clean;
-
-            if (isValid) {
-                m_watcher.RecordAccessResult(MemoryAccessResult::Hit);
-                m_watcher.RecordAccessType(MemoryAccessType::Read);
-                return cacheLine.m_data.at(dataUnitEntry);
-            }
+        if (isRequestedData && cacheLine.m_state != CacheCoherenceState::Invalid) {
+            m_watcher.RecordAccessResult(MemoryAccessResult::Hit);
+            m_watcher.RecordAccessType(MemoryAccessType::Read);
+            return cacheLine.m_data.at(dataUnitEntry);
         }
 
         m_watcher.RecordAccessResult(MemoryAccessResult::Miss);
 
-        const auto blockStartAddr  = (address / Cache_line_size) * Cache_line_size;
-        const auto correctDataUnit = m_upStreamMemory->ReadBlock(blockStartAddr, Cache_line_size);
-        m_watcher.RecordAccessType(MemoryAccessType::UpStreamReadBlock);
-
-        WriteBlockFromUpStreamToCacheOnly(segmentLoc, cacheLineEntry, correctDataUnit);
+        const auto blockStartAddr = (address / Cache_line_size) * Cache_line_size;
+        FetchLineFromUpStream(segmentLoc, cacheLineEntry, blockStartAddr);
         const auto& cacheLineModified = m_cache.at(cacheLineEntry);
         m_watcher.RecordAccessType(MemoryAccessType::Read);
 
         return cacheLineModified.m_data.at(dataUnitEntry);
     }
 
-    [[nodiscard]] DataBlock< DataUnit > ReadBlock(Address start, std::uint64_t dataUnitCount) final {
+    void ReadBlock(Address start, std::span< DataUnit > data) final {
         m_debugObject.LogTrace(LogType::Other, "ReadBlock of memory starting from address: {} with length: {}", start,
-                               dataUnitCount);
-
-        const auto endBlockAddr  = start + dataUnitCount - 1;
-        const auto segmentLoc    = (start / m_size) % m_segmentCount;
-        const auto endSegmentLoc = (endBlockAddr / m_size) % m_segmentCount;
-
-        assert(segmentLoc < m_segmentCount);
-        assert(segmentLoc == endSegmentLoc); // Assume only requesting one cache line per call
-
-        const auto  cacheLineEntry     = (start / Cache_line_size) % m_cache.size();
-        const auto  startDataUnitEntry = start % Cache_line_size;
-        const auto& cacheLine          = m_cache.at(cacheLineEntry);
+                               data.size());
 
-        const auto isRequestedData = cacheLine.m_segmentLocInUpstream == segmentLoc;
+        for (Address idx = 0; idx < data.size();) {
+            const auto lineEnd = ((start + idx) / Cache_line_size + 1) * Cache_line_size;
+            const auto count   = std::min< Address >(lineEnd - (start + idx), data.size() - idx);
+            const auto line    = ReadLine(start + idx, count);
 
-        if (isRequestedData) {
-            const auto isInvalid =
-                std::any_of(cacheLine.m_state.begin() + startDataUnitEntry,
-                            cacheLine.m_state.begin() + startDataUnitEntry + dataUnitCount,
-                            [](auto& state) { return state == State::Modified || state == State::Empty; });
-
-            if (!isInvalid) {
-                m_watcher.RecordAccessResult(MemoryAccessResult::Hit);
-                m_watcher.RecordAccessType(MemoryAccessType::ReadBlock);
-
-                return DataBlock< DataUnit > { dataUnitCount, cacheLine.m_data.data() + startDataUnitEntry };
-            }
+            std::copy(line, line + count, data.data() + idx);
+            idx += count;
         }
+    }
 
-        m_watcher.RecordAccessResult(MemoryAccessResult::Miss);
-
-        const auto blockStartAddr  = (start / Cache_line_size) * Cache_line_size;
-        const auto correctDataUnit = m_upStreamMemory->ReadBlock(blockStartAddr, Cache_line_size);
-        m_watcher.RecordAccessType(MemoryAccessType::UpStreamReadBlock);
-
-        WriteBlockFromUpStreamToCacheOnly(segmentLoc, cacheLineEntry, correctDataUnit);
-        const auto& cacheLineModified = m_cache.at(cacheLineEntry);
-        m_watcher.RecordAccessType(MemoryAccessType::ReadBlock);
-
-        return DataBlock< DataUnit > { dataUnitCount, cacheLineModified.m_data.data() + startDataUnitEntry };
+    [[nodiscard]] std::span< const DataUnit > ViewLine(Address start, std::uint64_t dataUnitCount) final {
+        return { ReadLine(start, dataUnitCount), dataUnitCount };
     }
 
     void Write(Address address, DataUnit data) final {
@@ -148,53 +333,39 @@ class [[nodiscard]] CacheMemory::DirectAccessWriteThroughCacheMemory final : pub
         const auto segmentLoc = (address / m_size) % m_segmentCount;
         assert(segmentLoc < m_segmentCount);
 
+        // Copies held by the other members of the domain become stale
+        BroadcastInvalidate(address / Cache_line_size);
+
         const auto cacheLineEntry = (address / Cache_line_size) % m_cache.size();
-        const auto dataUnitEntry  = address % Cache_line_size;
+        auto&      cacheLine      = m_cache.at(cacheLineEntry);
 
-        if (m_cache.at(cacheLineEntry).m_segmentLocInUpstream != segmentLoc) {
+        // Write misses do not allocate
+        if (cacheLine.m_segmentLocInUpstream != segmentLoc || cacheLine.m_state == CacheCoherenceState::Invalid) {
             m_upStreamMemory->Write(address, data);
             m_watcher.RecordAccessType(MemoryAccessType::UpStreamWrite);
             return;
         }
 
         WriteToCacheOnly(address, data);
-        const auto blockStartAddr = (address / Cache_line_size) * Cache_line_size;
 
-        m_upStreamMemory->WriteBlock(blockStartAddr, { Cache_line_size, m_cache.at(cacheLineEntry).m_data.data() });
-        m_cache.at(cacheLineEntry).m_state.at(dataUnitEntry) = State::Clean;
+        // Only the written data unit goes upstream, the rest of the line is already in sync
+        m_upStreamMemory->Write(address, data);
+        cacheLine.m_state = CacheCoherenceState::Exclusive;
 
-        m_watcher.RecordAccessType(MemoryAccessType::UpStreamWriteBlock);
+        m_watcher.RecordAccessType(MemoryAccessType::UpStreamWrite);
     }
 
-    void WriteBlock(Address start, const DataBlock< DataUnit >& data) final {
+    void WriteBlock(Address start, std::span< const DataUnit > data) final {
         m_debugObject.LogTrace(LogType::Other, "WriteBlock of DataUnits of size: {} starting from address: {}",
-                               data.Size(), start);
-
-        const auto endBlockAddr  = start + data.Size() - 1;
-        const auto segmentLoc    = (start / m_size) % m_segmentCount;
-        const auto endSegmentLoc = (endBlockAddr / m_size) % m_segmentCount;
-
-        assert(segmentLoc < m_segmentCount);
-        assert(segmentLoc == endSegmentLoc); // Assume only requesting one cache line per call
+                               data.size(), start);
 
-        const auto cacheLineEntry = (start / Cache_line_size) % m_cache.size();
-        const auto dataUnitEntry  = start % Cache_line_size;
+        for (Address idx = 0; idx < data.size();) {
+            const auto lineEnd = ((start + idx) / Cache_line_size + 1) * Cache_line_size;
+            const auto count   = std::min< Address >(lineEnd - (start + idx), data.size() - idx);
 
-        if (m_cache.at(cacheLineEntry).m_segmentLocInUpstream != segmentLoc) {
-            m_upStreamMemory->WriteBlock(start, data);
-            m_watcher.RecordAccessType(MemoryAccessType::UpStreamWriteBlock);
-            return;
+            WriteLine(start + idx, data.subspan(idx, count));
+            idx += count;
         }
-
-        WriteBlockFromDownStreamToCacheOnly(segmentLoc, cacheLineEntry, dataUnitEntry, data);
-        const auto blockStartAddr = (start / Cache_line_size) * Cache_line_size;
-
-        m_upStreamMemory->WriteBlock(blockStartAddr, { Cache_line_size, m_cache.at(cacheLineEntry).m_data.data() });
-
-        const auto stateBegin = m_cache.at(cacheLineEntry).m_state.begin() + dataUnitEntry;
-        std::fill(stateBegin, stateBegin + data.Size(), State::Clean);
-
-        m_watcher.RecordAccessType(MemoryAccessType::UpStreamWriteBlock);
     }
 
     [[nodiscard]] Address Size() const noexcept final {
@@ -209,11 +380,106 @@ class [[nodiscard]] CacheMemory::DirectAccessWriteThroughCacheMemory final : pub
         return m_upStreamMemory;
     }
 
-    void ClearCache() noexcept final {
+    void ClearCache() final {
         std::memset(m_cache.data(), 0, m_cache.size() * sizeof(decltype(m_cache)::value_type));
     }
 
+    void FlushCache() final {
+    }
+
+    [[nodiscard]] std::size_t SetCount() const noexcept final {
+        return m_cache.size();
+    }
+
+    // Write-through lines are never modified, snoops only change their state
+    bool SnoopRead(Address lineAddress) final {
+        auto* const cacheLine = FindLine(lineAddress);
+        if (cacheLine == nullptr) {
+            return false;
+        }
+
+        if (cacheLine->m_state == CacheCoherenceState::Exclusive) {
+            cacheLine->m_state = CacheCoherenceState::Shared;
+            m_watcher.RecordCoherenceEvent(CoherenceEvent::Downgrade);
+        }
+        return true;
+    }
+
+    bool SnoopInvalidate(Address lineAddress) final {
+        auto* const cacheLine = FindLine(lineAddress);
+        if (cacheLine == nullptr) {
+            return false;
+        }
+
+        cacheLine->m_state = CacheCoherenceState::Invalid;
+        m_watcher.RecordCoherenceEvent(CoherenceEvent::Invalidation);
+        return true;
+    }
+
   private:
+    // Returns the cached data units of a block that does not cross a cache line
+    [[nodiscard]] const DataUnit* ReadLine(Address start, std::uint64_t dataUnitCount) {
+        const auto endBlockAddr  = start + dataUnitCount - 1;
+        const auto segmentLoc    = (start / m_size) % m_segmentCount;
+        const auto endSegmentLoc = (endBlockAddr / m_size) % m_segmentCount;
+
+        assert(segmentLoc < m_segmentCount);
+        assert(segmentLoc == endSegmentLoc); // Blocks are split at cache line boundaries by the callers
+
+        const auto  cacheLineEntry     = (start / Cache_line_size) % m_cache.size();
+        const auto  startDataUnitEntry = start % Cache_line_size;
+        const auto& cacheLine          = m_cache.at(cacheLineEntry);
+
+        const auto isRequestedData = cacheLine.m_segmentLocInUpstream == segmentLoc;
+
+        if (isRequestedData && cacheLine.m_state != CacheCoherenceState::Invalid) {
+            m_watcher.RecordAccessResult(MemoryAccessResult::Hit);
+            m_watcher.RecordAccessType(MemoryAccessType::ReadBlock);
+
+            return cacheLine.m_data.data() + startDataUnitEntry;
+        }
+
+        m_watcher.RecordAccessResult(MemoryAccessResult::Miss);
+
+        const auto blockStartAddr = (start / Cache_line_size) * Cache_line_size;
+        FetchLineFromUpStream(segmentLoc, cacheLineEntry, blockStartAddr);
+        const auto& cacheLineModified = m_cache.at(cacheLineEntry);
+        m_watcher.RecordAccessType(MemoryAccessType::ReadBlock);
+
+        return cacheLineModified.m_data.data() + startDataUnitEntry;
+    }
+
+    // Writes a block that does not cross a cache line
+    void WriteLine(Address start, std::span< const DataUnit > data) {
+        const auto endBlockAddr  = start + data.size() - 1;
+        const auto segmentLoc    = (start / m_size) % m_segmentCount;
+        const auto endSegmentLoc = (endBlockAddr / m_size) % m_segmentCount;
+
+        assert(segmentLoc < m_segmentCount);
+        assert(segmentLoc == endSegmentLoc); // Blocks are split at cache line boundaries by the callers
+
+        // Copies held by the other members of the domain become stale
+        BroadcastInvalidate(start / Cache_line_size);
+
+        const auto cacheLineEntry = (start / Cache_line_size) % m_cache.size();
+        const auto dataUnitEntry  = start % Cache_line_size;
+        auto&      cacheLine      = m_cache.at(cacheLineEntry);
+
+        // Write misses do not allocate
+        if (cacheLine.m_segmentLocInUpstream != segmentLoc || cacheLine.m_state == CacheCoherenceState::Invalid) {
+            m_upStreamMemory->WriteBlock(start, data);
+            m_watcher.RecordAccessType(MemoryAccessType::UpStreamWriteBlock);
+            return;
+        }
+
+        WriteBlockToCacheOnly(cacheLineEntry, dataUnitEntry, data);
+
+        m_upStreamMemory->WriteBlock(start, data);
+        cacheLine.m_state = CacheCoherenceState::Exclusive;
+
+        m_watcher.RecordAccessType(MemoryAccessType::UpStreamWriteBlock);
+    }
+
     static std::pmr::vector< CacheLineData > BuildInitialMemory(Address size) {
         return std::pmr::vector< CacheLineData >(size / Cache_line_size, CacheLineData {});
     }
@@ -229,33 +495,38 @@ class [[nodiscard]] CacheMemory::DirectAccessWriteThroughCacheMemory final : pub
         const auto cacheLineEntry = (address / Cache_line_size) % m_cache.size();
         const auto dataUnitEntry  = address % Cache_line_size;
 
-        m_cache.at(cacheLineEntry).m_data.at(dataUnitEntry)  = std::move(data);
-        m_cache.at(cacheLineEntry).m_state.at(dataUnitEntry) = State::Modified;
+        m_cache.at(cacheLineEntry).m_data.at(dataUnitEntry) = std::move(data);
         m_watcher.RecordAccessType(MemoryAccessType::Write);
     }
 
-    void WriteBlockFromUpStreamToCacheOnly /*Clean write*/ (std::uint64_t segment, std::uint64_t cacheLineEntry,
-                                                            const DataBlock< DataUnit >& data) {
-        CacheLineData cacheLineData {};
-        cacheLineData.m_segmentLocInUpstream = segment;
-        cacheLineData.m_state.fill(State::Clean);
-        std::copy(data.Begin(), data.End(), cacheLineData.m_data.data());
+    // Reads the line straight into the cache storage
+    void FetchLineFromUpStream /*Clean write*/ (std::uint64_t segment, std::uint64_t cacheLineEntry,
+                                               Address blockStartAddr) {
+        const auto isShared = BroadcastRead(blockStartAddr / Cache_line_size);
+
+        auto& cacheLine = m_cache.at(cacheLineEntry);
+        m_upStreamMemory->ReadBlock(blockStartAddr, std::span< DataUnit > { cacheLine.m_data });
+        m_watcher.RecordAccessType(MemoryAccessType::UpStreamReadBlock);
 
-        m_cache.at(cacheLineEntry) = std::move(cacheLineData);
+        cacheLine.m_segmentLocInUpstream = segment;
+        cacheLine.m_state                = isShared ? CacheCoherenceState::Shared : CacheCoherenceState::Exclusive;
         m_watcher.RecordAccessType(MemoryAccessType::WriteBlock);
     }
-    void WriteBlockFromDownStreamToCacheOnly /*Modified write*/ (std::uint64_t segment, std::uint64_t cacheLineEntry,
-                                                                 Address start, const DataBlock< DataUnit >& data) {
-        CacheLineData cacheLineData {};
-        cacheLineData.m_segmentLocInUpstream = segment;
-        cacheLineData.m_state.fill(State::Clean);
-        cacheLineData.m_data = std::move(m_cache.at(cacheLineEntry).m_data);
-        std::copy(data.Begin(), data.End(), cacheLineData.m_data.data() + start);
-
-        m_cache.at(cacheLineEntry) = std::move(cacheLineData);
+    void WriteBlockToCacheOnly(std::uint64_t cacheLineEntry, Address start, std::span< const DataUnit > data) {
+        std::copy(data.begin(), data.end(), m_cache.at(cacheLineEntry).m_data.data() + start);
         m_watcher.RecordAccessType(MemoryAccessType::WriteBlock);
     }
 
+    // Returns the valid cache line holding lineAddress, if any
+    [[nodiscard]] CacheLineData* FindLine(Address lineAddress) noexcept {
+        const auto segmentLoc = (lineAddress * Cache_line_size / m_size) % m_segmentCount;
+        auto&      cacheLine  = m_cache[lineAddress % m_cache.size()];
+
+        const auto isValid =
+            cacheLine.m_segmentLocInUpstream == segmentLoc && cacheLine.m_state != CacheCoherenceState::Invalid;
+        return isValid ? &cacheLine : nullptr;
+    }
+
     Address                           m_size;
     std::pmr::vector< CacheLineData > m_cache;
     IMemory*                          m_upStreamMemory;
@@ -264,52 +535,411 @@ class [[nodiscard]] CacheMemory::DirectAccessWriteThroughCacheMemory final : pub
     Object&                           m_debugObject;
 };
 
+template < class ReplacementPolicy, CacheWriteStrategy Write_strategy >
+class [[nodiscard]] CacheMemory::SetAssociativeCacheMemory final : public CacheMemory::Impl {
+  public:
+    SetAssociativeCacheMemory(Object* logger, IMemory* upStreamMemory, Address addressableSize, std::size_t ways) :
+        m_size(addressableSize),
+        m_ways(ways),
+        m_setCount(m_size / Cache_line_size / m_ways),
+        m_tags(m_setCount * m_ways, Invalid_tag),
+        m_states(m_setCount * m_ways, CacheCoherenceState::Invalid),
+        m_data(m_setCount * m_ways * Cache_line_size, Empty_data_unit),
+        m_policy(m_setCount, m_ways),
+        m_upStreamMemory(upStreamMemory),
+        m_watcher(MemoryWatcher::Hint::CacheMemory),
+        m_debugObject(*logger) {
+        assert(m_ways > 0 && m_setCount > 0 && "Cache has to hold at least one line per way!");
+        m_debugObject.Log(LogType::Construction, "Memory construction with {} sets of {} ways {}!", m_setCount, m_ways,
+                          m_tags.size() > 0 ? "succeeded" : "failed");
+    }
+
+    [[nodiscard]] DataUnit Read(Address address) noexcept final {
+        m_debugObject.LogTrace(LogType::Other, "Read memory at address: {}", address);
+
+        const auto line = Access(address / Cache_line_size, AccessIntent::Read);
+        m_watcher.RecordAccessType(MemoryAccessType::Read);
+
+        return m_data[line * Cache_line_size + address % Cache_line_size];
+    }
+
+    void ReadBlock(Address start, std::span< DataUnit > data) final {
+        m_debugObject.LogTrace(LogType::Other, "ReadBlock of memory starting from address: {} with length: {}", start,
+                               data.size());
+
+        const auto endLineAddress = (start + data.size() - 1) / Cache_line_size + 1;
+
+        for (auto lineAddress = start / Cache_line_size; lineAddress < endLineAddress;) {
+            const auto line = FindLine(lineAddress);
+            if (line != No_line) {
+                m_watcher.RecordAccessResult(MemoryAccessResult::Hit);
+                m_policy.Touch(lineAddress % m_setCount, line % m_ways);
+                CopyLineToBlock(lineAddress, m_data.data() + line * Cache_line_size, start, data);
+                ++lineAddress;
+                continue;
+            }
+
+            // The other members of the domain are snooped before each line is read, misses are not coalesced
+            if (HasCoherenceDomain()) {
+                const auto newLine = Access(lineAddress, AccessIntent::Read);
+                CopyLineToBlock(lineAddress, m_data.data() + newLine * Cache_line_size, start, data);
+                ++lineAddress;
+                continue;
+            }
+
+            auto missEnd = lineAddress + 1;
+            while (missEnd < endLineAddress && FindLine(missEnd) == No_line) {
+                ++missEnd;
+            }
+
+            // Consecutive missing lines covered by the whole block are fetched with a single upstream request
+            // straight into it, the partially covered lines at both ends are filled on their own
+            const auto coveredStart = std::max(lineAddress, (start + Cache_line_size - 1) / Cache_line_size);
+            const auto coveredEnd   = std::min(missEnd, (start + data.size()) / Cache_line_size);
+            if (coveredStart < coveredEnd) {
+                m_upStreamMemory->ReadBlock(coveredStart * Cache_line_size,
+                                            data.subspan(coveredStart * Cache_line_size - start,
+                                                         (coveredEnd - coveredStart) * Cache_line_size));
+                m_watcher.RecordAccessType(MemoryAccessType::UpStreamReadBlock);
+            }
+
+            for (; lineAddress < missEnd; ++lineAddress) {
+                m_watcher.RecordAccessResult(MemoryAccessResult::Miss);
+
+                const auto set       = lineAddress % m_setCount;
+                const auto isCovered = coveredStart <= lineAddress && lineAddress < coveredEnd;
+                const auto newLine =
+                    isCovered ? Allocate(set, lineAddress) : Fill(set, lineAddress, AccessIntent::Read);
+                auto* const lineData = m_data.data() + newLine * Cache_line_size;
+
+                if (isCovered) {
+                    const auto* blockLine = data.data() + (lineAddress * Cache_line_size - start);
+                    std::copy(blockLine, blockLine + Cache_line_size, lineData);
+                    m_states[newLine] = CacheCoherenceState::Exclusive;
+                    m_watcher.RecordAccessType(MemoryAccessType::WriteBlock);
+                } else {
+                    CopyLineToBlock(lineAddress, lineData, start, data);
+                }
+                m_policy.Touch(set, newLine % m_ways);
+            }
+        }
+
+        m_watcher.RecordAccessType(MemoryAccessType::ReadBlock);
+    }
+
+    [[nodiscard]] std::span< const DataUnit > ViewLine(Address start, std::uint64_t dataUnitCount) final {
+        assert(start / Cache_line_size == (start + dataUnitCount - 1) / Cache_line_size);
+
+        const auto line = Access(start / Cache_line_size, AccessIntent::Read);
+        m_watcher.RecordAccessType(MemoryAccessType::ReadBlock);
+
+        return { m_data.data() + line * Cache_line_size + start % Cache_line_size, dataUnitCount };
+    }
+
+    // Write-through caches do not allocate on a write miss, write-back caches allocate and defer the upstream write
+    void Write(Address address, DataUnit data) final {
+        m_debugObject.LogTrace(LogType::Other, "Write DataUnit: {} at address: {}", data, address);
+
+        const auto lineAddress = address / Cache_line_size;
+        if constexpr (Is_write_back) {
+            const auto line = Access(lineAddress, AccessIntent::Write);
+
+            m_data[line * Cache_line_size + address % Cache_line_size] = data;
+            m_states[line]                                             = CacheCoherenceState::Modified;
+            m_watcher.RecordAccessType(MemoryAccessType::Write);
+            return;
+        }
+
+        // Copies held by the other members of the domain become stale
+        BroadcastInvalidate(lineAddress);
+
+        const auto line = FindLine(lineAddress);
+        if (line != No_line) {
+            m_data[line * Cache_line_size + address % Cache_line_size] = data;
+            m_states[line]                                             = CacheCoherenceState::Exclusive;
+            m_policy.Touch(lineAddress % m_setCount, line % m_ways);
+            m_watcher.RecordAccessType(MemoryAccessType::Write);
+        }
+
+        m_upStreamMemory->Write(address, data);
+        m_watcher.RecordAccessType(MemoryAccessType::UpStreamWrite);
+    }
+
+    void WriteBlock(Address start, std::span< const DataUnit > data) final {
+        m_debugObject.LogTrace(LogType::Other, "WriteBlock of DataUnits of size: {} starting from address: {}",
+                               data.size(), start);
+
+        const auto endLineAddress = (start + data.size() - 1) / Cache_line_size + 1;
+
+        for (auto lineAddress = start / Cache_line_size; lineAddress < endLineAddress; ++lineAddress) {
+            if constexpr (Is_write_back) {
+                // A block covering the whole line overwrites it, no need to fetch it on a miss
+                const auto isWholeLine = start <= lineAddress * Cache_line_size &&
+                                         (lineAddress + 1) * Cache_line_size <= start + data.size();
+                const auto line = Access(lineAddress, isWholeLine ? AccessIntent::Overwrite : AccessIntent::Write);
+
+                CopyBlockToLine(start, data, lineAddress, m_data.data() + line * Cache_line_size);
+                m_states[line] = CacheCoherenceState::Modified;
+                m_watcher.RecordAccessType(MemoryAccessType::WriteBlock);
+            } else {
+                BroadcastInvalidate(lineAddress);
+
+                const auto line = FindLine(lineAddress);
+                if (line != No_line) {
+                    CopyBlockToLine(start, data, lineAddress, m_data.data() + line * Cache_line_size);
+                    m_states[line] = CacheCoherenceState::Exclusive;
+                    m_policy.Touch(lineAddress % m_setCount, line % m_ways);
+                    m_watcher.RecordAccessType(MemoryAccessType::WriteBlock);
+                }
+            }
+        }
+
+        if constexpr (!Is_write_back) {
+            m_upStreamMemory->WriteBlock(start, data);
+            m_watcher.RecordAccessType(MemoryAccessType::UpStreamWriteBlock);
+        }
+    }
+
+    [[nodiscard]] Address Size() const noexcept final {
+        return m_size;
+    }
+
+    [[nodiscard]] const MemoryWatcher& GetMemoryWatcher() const noexcept final {
+        return m_watcher;
+    }
+
+    [[nodiscard]] const IMemory* const GetUpStreamMemory() const noexcept final {
+        return m_upStreamMemory;
+    }
+
+    void ClearCache() final {
+        FlushCache();
+        std::fill(m_tags.begin(), m_tags.end(), Invalid_tag);
+        std::fill(m_states.begin(), m_states.end(), CacheCoherenceState::Invalid);
+        m_policy.Reset();
+    }
+
+    // A modified line is the only copy in its domain, once written back it is exclusive
+    void FlushCache() final {
+        if constexpr (Is_write_back) {
+            for (std::size_t line = 0; line < m_tags.size(); ++line) {
+                if (m_states[line] == CacheCoherenceState::Modified) {
+                    WriteBackLine(line);
+                    m_states[line] = CacheCoherenceState::Exclusive;
+                }
+            }
+        }
+    }
+
+    [[nodiscard]] std::size_t SetCount() const noexcept final {
+        return m_setCount;
+    }
+
+    bool SnoopRead(Address lineAddress) final {
+        const auto line = FindLine(lineAddress);
+        if (line == No_line) {
+            return false;
+        }
+
+        if (m_states[line] == CacheCoherenceState::Modified) {
+            WriteBackLine(line);
+            m_watcher.RecordCoherenceEvent(CoherenceEvent::SnoopWriteBack);
+        }
+        if (m_states[line] != CacheCoherenceState::Shared) {
+            m_states[line] = CacheCoherenceState::Shared;
+            m_watcher.RecordCoherenceEvent(CoherenceEvent::Downgrade);
+        }
+        return true;
+    }
+
+    bool SnoopInvalidate(Address lineAddress) final {
+        const auto line = FindLine(lineAddress);
+        if (line == No_line) {
+            return false;
+        }
+
+        if (m_states[line] == CacheCoherenceState::Modified) {
+            WriteBackLine(line);
+            m_watcher.RecordCoherenceEvent(CoherenceEvent::SnoopWriteBack);
+        }
+        m_tags[line]   = Invalid_tag;
+        m_states[line] = CacheCoherenceState::Invalid;
+        m_watcher.RecordCoherenceEvent(CoherenceEvent::Invalidation);
+        return true;
+    }
+
+  private:
+    enum class AccessIntent
+    {
+        Read,
+        Write,
+        Overwrite, // The whole line is written, a miss does not fetch it
+    };
+
+    static constexpr bool        Is_write_back = Write_strategy == CacheWriteStrategy::WriteBack;
+    static constexpr Address     Invalid_tag   = ~Address { 0 };
+    static constexpr std::size_t No_line       = ~std::size_t { 0 };
+
+    // Tags of a set are contiguous, a lookup scans ways adjacent entries
+    [[nodiscard]] std::size_t FindLine(Address lineAddress) const noexcept {
+        const auto  set     = lineAddress % m_setCount;
+        const auto* setTags = m_tags.data() + set * m_ways;
+
+        for (std::size_t way = 0; way < m_ways; ++way) {
+            if (setTags[way] == lineAddress) {
+                return set * m_ways + way;
+            }
+        }
+        return No_line;
+    }
+
+    // Returns the line caching lineAddress, allocating it on a miss. Lines accessed to be written are exclusive to
+    // this cache on return, the caller marks them modified.
+    [[nodiscard]] std::size_t Access(Address lineAddress, AccessIntent intent) {
+        const auto set  = lineAddress % m_setCount;
+        auto       line = FindLine(lineAddress);
+
+        if (line != No_line) {
+            m_watcher.RecordAccessResult(MemoryAccessResult::Hit);
+
+            if (intent != AccessIntent::Read && m_states[line] == CacheCoherenceState::Shared) {
+                BroadcastInvalidate(lineAddress);
+                m_states[line] = CacheCoherenceState::Exclusive;
+            }
+        } else {
+            m_watcher.RecordAccessResult(MemoryAccessResult::Miss);
+            line = Fill(set, lineAddress, intent);
+        }
+
+        m_policy.Touch(set, line % m_ways);
+        return line;
+    }
+
+    [[nodiscard]] std::size_t Fill(std::size_t set, Address lineAddress, AccessIntent intent) {
+        // Modified copies of the other members are written back before the line is read upstream
+        bool isShared = false;
+        if (intent == AccessIntent::Read) {
+            isShared = BroadcastRead(lineAddress);
+        } else {
+            BroadcastInvalidate(lineAddress);
+        }
+
+        const auto line = Allocate(set, lineAddress);
+        m_states[line]  = isShared ? CacheCoherenceState::Shared : CacheCoherenceState::Exclusive;
+
+        if (intent != AccessIntent::Overwrite) {
+            // Read straight into the line storage
+            m_upStreamMemory->ReadBlock(
+                lineAddress * Cache_line_size,
+                std::span< DataUnit > { m_data.data() + line * Cache_line_size, Cache_line_size });
+            m_watcher.RecordAccessType(MemoryAccessType::UpStreamReadBlock);
+            m_watcher.RecordAccessType(MemoryAccessType::WriteBlock);
+        }
+        return line;
+    }
+
+    // Picks the way of the set receiving lineAddress, the caller fills its data
+    [[nodiscard]] std::size_t Allocate(std::size_t set, Address lineAddress) {
+        const auto setBegin   = m_tags.begin() + set * m_ways;
+        const auto invalidWay = std::find(setBegin, setBegin + m_ways, Invalid_tag);
+        const auto way  = invalidWay != setBegin + m_ways ? static_cast< std::size_t >(invalidWay - setBegin)
+                                                          : m_policy.Victim(set);
+        const auto line = set * m_ways + way;
+
+        if constexpr (Is_write_back) {
+            if (m_states[line] == CacheCoherenceState::Modified) {
+                WriteBackLine(line);
+            }
+        }
+        m_tags[line] = lineAddress;
+        return line;
+    }
+
+    void WriteBackLine(std::size_t line) {
+        m_upStreamMemory->WriteBlock(
+            m_tags[line] * Cache_line_size,
+            std::span< const DataUnit > { m_data.data() + line * Cache_line_size, Cache_line_size });
+        m_watcher.RecordAccessType(MemoryAccessType::UpStreamWriteBlock);
+    }
+
+    Address                                 m_size;
+    std::size_t                             m_ways;
+    std::size_t                             m_setCount;
+    std::pmr::vector< Address >             m_tags;   // Line address cached by each way, set after set
+    std::pmr::vector< CacheCoherenceState > m_states; // MESI state of each way, a byte each so sets never share a word
+    std::pmr::vector< DataUnit >            m_data;   // Cache_line_size data units per way, laid out like the tags
+    ReplacementPolicy                       m_policy;
+    IMemory*                                m_upStreamMemory;
+    mutable MemoryWatcher                   m_watcher;
+    Object&                                 m_debugObject;
+};
+
+template < class ReplacementPolicy, CacheWriteStrategy Write_strategy, class ImplDetail >
+UniqueRef< CacheMemory::Impl > CacheMemory::ConstructSetAssociativeMemory(IMemory* upStreamMemory, Address size,
+                                                                          std::size_t ways, ImplDetail detail) {
+    using SetAssociativeMemory = CacheMemory::SetAssociativeCacheMemory< ReplacementPolicy, Write_strategy >;
+    std::pmr::polymorphic_allocator< SetAssociativeMemory > alloc {};
+
+    return allocate_unique< CacheMemory::Impl, SetAssociativeMemory >(alloc, detail, upStreamMemory, size, ways);
+}
+
+template < CacheWriteStrategy Write_strategy, class ImplDetail >
+UniqueRef< CacheMemory::Impl > CacheMemory::ConstructAssociativeMemory(IMemory* upStreamMemory, Address size,
+                                                                       const Config& config, ImplDetail detail) {
+    if (config.m_memoryMapping == CacheMemoryMapping::DirectMapping) {
+        return ConstructSetAssociativeMemory< DirectMappedPolicy, Write_strategy >(upStreamMemory, size, 1, detail);
+    }
+
+    const auto ways = config.m_memoryMapping == CacheMemoryMapping::FullyAssociative
+                          ? static_cast< std::size_t >(size / Cache_line_size)
+                          : static_cast< std::size_t >(config.m_associativity);
+
+    switch (config.m_replacementPolicy) {
+        case CacheReplacementPolicy::LeastRecentlyUsed:
+            return ConstructSetAssociativeMemory< LeastRecentlyUsedPolicy, Write_strategy >(upStreamMemory, size,
+                                                                                            ways, detail);
+        case CacheReplacementPolicy::PseudoLeastRecentlyUsed:
+            return ConstructSetAssociativeMemory< PseudoLeastRecentlyUsedPolicy, Write_strategy >(
+                upStreamMemory, size, ways, detail);
+        case CacheReplacementPolicy::Random:
+            return ConstructSetAssociativeMemory< RandomPolicy, Write_strategy >(upStreamMemory, size, ways, detail);
+    }
+    assert(false && "Unreachable code path!");
+    std::terminate();
+}
+
 template < class ImplDetail >
 UniqueRef< CacheMemory::Impl > CacheMemory::ConstructMemory(IMemory* upStreamMemory, Address size, const Config& config,
                                                             ImplDetail detail) {
     detail->Log(LogType::Construction, "Constructing Memory of size {} Addresses!", size);
+    if (config.m_cacheWriteStrategy == CacheWriteStrategy::WriteThrough &&
+        config.m_memoryMapping == CacheMemoryMapping::DirectMapping) {
+        std::pmr::polymorphic_allocator< CacheMemory::DirectAccessWriteThroughCacheMemory > alloc {};
+
+        return allocate_unique< CacheMemory::Impl, CacheMemory::DirectAccessWriteThroughCacheMemory >(
+            alloc, detail, upStreamMemory, size);
+    }
+
     if (config.m_cacheWriteStrategy == CacheWriteStrategy::WriteThrough) {
-        if (config.m_memoryMapping == CacheMemoryMapping::DirectMapping) {
-            std::pmr::polymorphic_allocator< CacheMemory::DirectAccessWriteThroughCacheMemory > alloc {};
-
-            return allocate_unique< CacheMemory::Impl, CacheMemory::DirectAccessWriteThroughCacheMemory >(
-                alloc, detail, upStreamMemory, size);
-        } else if (config.m_memoryMapping == CacheMemoryMapping::FullyAssociative) {
-            assert(false && "Unreachable code path!");
-            return {};
-        } else if (config.m_memoryMapping == CacheMemoryMapping::SetAssociative) {
-            assert(false && "Unreachable code path!");
-            return {};
-        }
-        assert(false && "Unreachable code path!");
-        std::terminate();
-    } else if (config.m_cacheWriteStrategy == CacheWriteStrategy::WriteThrough) {
-        if (config.m_memoryMapping == CacheMemoryMapping::DirectMapping) {
-            assert(false && "Unreachable code path!");
-            return {};
-        } else if (config.m_memoryMapping == CacheMemoryMapping::FullyAssociative) {
-            assert(false && "Unreachable code path!");
-            return {};
-
-        } else if (config.m_memoryMapping == CacheMemoryMapping::SetAssociative) {
-            assert(false && "Unreachable code path!");
-            return {};
-        }
-        assert(false && "Unreachable code path!");
-        std::terminate();
+        return ConstructAssociativeMemory< CacheWriteStrategy::WriteThrough >(upStreamMemory, size, config, detail);
+    } else if (config.m_cacheWriteStrategy == CacheWriteStrategy::WriteBack) {
+        return ConstructAssociativeMemory< CacheWriteStrategy::WriteBack >(upStreamMemory, size, config, detail);
     }
     assert(false && "Unreachable code path!");
     std::terminate();
 }
 
 CacheMemory::CacheMemory(Config config, IMemory* upStreamMemory, Address cacheSize) :
-    ICacheMemory(Default_name), m_memory(ConstructMemory(upStreamMemory, cacheSize, config, this)) {
-    assert(cacheSize <= Max_cache_size);
+    CacheMemory(Default_name, config, upStreamMemory, cacheSize) {
 }
 
+// Members of a coherence domain are snooped by the other members, they lock like shared caches
 CacheMemory::CacheMemory(std::string name, Config config, IMemory* upStreamMemory, Address cacheSize) :
-    ICacheMemory(std::move(name)), m_memory(ConstructMemory(upStreamMemory, cacheSize, config, this)) {
+    ICacheMemory(std::move(name)),
+    m_memory(ConstructMemory(upStreamMemory, cacheSize, config, this)),
+    m_isShared(config.m_isShared || config.m_coherenceDomain != nullptr) {
     assert(cacheSize <= Max_cache_size);
+    m_memory->JoinCoherenceDomain(config.m_coherenceDomain);
 }
 
 CacheMemory::CacheMemory(CacheMemory&&) noexcept = default;
@@ -320,22 +950,102 @@ CacheMemory::~CacheMemory() {
     Log(LogType::Destruction, "Destroying memory of size {} Addresses!", m_memory->Size());
 }
 
+// Public members lock before forwarding to m_memory and never call each other, the stripes are not recursive
 IMemory::DataUnit CacheMemory::Read(Address address) const noexcept {
+    const auto guard = LockLines(address, 1);
     return m_memory->Read(address);
 }
 
 DataBlock< IMemory::DataUnit > CacheMemory::ReadBlock(Address start, std::uint64_t dataUnitCount) const {
-    return m_memory->ReadBlock(start, dataUnitCount);
+    auto data = DataBlock< DataUnit >(dataUnitCount, Empty_data_unit);
+
+    const auto guard = LockLines(start, dataUnitCount);
+    m_memory->ReadBlock(start, std::span< DataUnit > { data.Data(), data.Size() });
+    return data;
+}
+
+void CacheMemory::ReadBlock(Address start, std::span< DataUnit > data) const {
+    const auto guard = LockLines(start, data.size());
+    return m_memory->ReadBlock(start, data);
+}
+
+DataView< IMemory::DataUnit > CacheMemory::ViewBlock(Address start, std::uint64_t dataUnitCount) const {
+    if (!m_isShared && start / Cache_line_size == (start + dataUnitCount - 1) / Cache_line_size) {
+        return DataView< DataUnit > { m_memory->ViewLine(start, dataUnitCount) };
+    }
+    // Lines of a longer block are not contiguous in the cache storage
+    return DataView< DataUnit > { ReadBlock(start, dataUnitCount) };
 }
 
 void CacheMemory::Write(IMemory::Address address, DataUnit data) {
+    const auto guard = LockLines(address, 1);
     return m_memory->Write(address, data);
 }
 
 void CacheMemory::WriteBlock(Address start, const DataBlock< DataUnit >& data) {
+    const auto guard = LockLines(start, data.Size());
+    return m_memory->WriteBlock(start, std::span< const DataUnit > { data.Data(), data.Size() });
+}
+
+void CacheMemory::WriteBlock(Address start, std::span< const DataUnit > data) {
+    const auto guard = LockLines(start, data.size());
     return m_memory->WriteBlock(start, data);
 }
 
+void CacheMemory::ReadBytes(Address byteAddress, std::span< std::byte > data) const {
+    if (data.empty()) {
+        return;
+    }
+
+    const auto unitAddress = byteAddress / sizeof(DataUnit);
+    const auto unitOffset  = static_cast< std::size_t >(byteAddress % sizeof(DataUnit));
+    const auto unitCount   = (unitOffset + data.size() + sizeof(DataUnit) - 1) / sizeof(DataUnit);
+
+    const auto guard = LockLines(unitAddress, unitCount);
+    if (unitAddress / Cache_line_size == (unitAddress + unitCount - 1) / Cache_line_size) {
+        // The line cannot be evicted while its set is locked
+        LoadBytes(m_memory->ViewLine(unitAddress, unitCount), unitOffset, data);
+        return;
+    }
+
+    auto block = DataBlock< DataUnit >(unitCount, Empty_data_unit);
+    m_memory->ReadBlock(unitAddress, std::span< DataUnit > { block.Data(), block.Size() });
+    LoadBytes(std::span< const DataUnit > { block.Data(), block.Size() }, unitOffset, data);
+}
+
+void CacheMemory::WriteBytes(Address byteAddress, std::span< const std::byte > data) {
+    if (data.empty()) {
+        return;
+    }
+
+    const auto unitAddress = byteAddress / sizeof(DataUnit);
+    const auto unitOffset  = static_cast< std::size_t >(byteAddress % sizeof(DataUnit));
+    const auto unitCount   = (unitOffset + data.size() + sizeof(DataUnit) - 1) / sizeof(DataUnit);
+
+    // Accesses of up to a quadword are assembled on the stack
+    std::array< DataUnit, Small_block_size > smallBlock {};
+    DataBlock< DataUnit >                    largeBlock {};
+    if (unitCount > Small_block_size) {
+        largeBlock = DataBlock< DataUnit >(unitCount, Empty_data_unit);
+    }
+    const auto block = unitCount > Small_block_size ? std::span< DataUnit > { largeBlock.Data(), unitCount }
+                                                    : std::span< DataUnit > { smallBlock }.first(unitCount);
+
+    // The read-modify-write of the edge data units happens under a single lock
+    const auto guard = LockLines(unitAddress, unitCount);
+
+    // Only the partially written data units at both ends need their current value
+    if (unitOffset != 0) {
+        block.front() = m_memory->Read(unitAddress);
+    }
+    if ((unitOffset + data.size()) % sizeof(DataUnit) != 0) {
+        block.back() = m_memory->Read(unitAddress + unitCount - 1);
+    }
+
+    StoreBytes(block, unitOffset, data);
+    m_memory->WriteBlock(unitAddress, block);
+}
+
 CacheMemory::Address CacheMemory::Size() const noexcept {
     return m_memory->Size();
 }
@@ -348,10 +1058,44 @@ const IMemory* const CacheMemory::GetUpStreamMemory() const noexcept {
     return m_memory->GetUpStreamMemory();
 }
 
-void CacheMemory::ClearCache() noexcept {
+void CacheMemory::ClearCache() {
+    const auto guard = LockAllLines();
     m_memory->ClearCache();
 }
 
+void CacheMemory::FlushCache() {
+    const auto guard = LockAllLines();
+    m_memory->FlushCache();
+}
+
+CacheMemory::StripeGuard CacheMemory::LockLines(Address start, std::uint64_t dataUnitCount) const {
+    if (!m_isShared) {
+        return StripeGuard {};
+    }
+
+    const auto setCount  = m_memory->SetCount();
+    const auto firstLine = start / Cache_line_size;
+    const auto endLine   = (start + std::max< std::uint64_t >(dataUnitCount, 1) - 1) / Cache_line_size + 1;
+
+    // Blocks touching as many sets as there are stripes lock them all
+    if (endLine - firstLine >= std::min< std::size_t >(setCount, Impl::Lock_stripe_count)) {
+        return LockAllLines();
+    }
+
+    StripeGuard::Stripes stripes {};
+    for (auto lineAddress = firstLine; lineAddress < endLine; ++lineAddress) {
+        stripes.set((lineAddress % setCount) % Impl::Lock_stripe_count);
+    }
+    return StripeGuard { m_memory->GetLockStripes(), stripes };
+}
+
+CacheMemory::StripeGuard CacheMemory::LockAllLines() const {
+    if (!m_isShared) {
+        return StripeGuard {};
+    }
+    return StripeGuard { m_memory->GetLockStripes(), StripeGuard::Stripes {}.set() };
+}
+
 constexpr const std::pmr::vector< CacheWriteStrategy >& CacheMemory::GetSupportedWriteStrategies() noexcept {
     return supportedCacheWriteStrategies;
 }
@@ -5,14 +5,28 @@
     #include <Memory/ICacheMemory.h>
     #include <Utility/UniqueRef.h>
     #include <functional>
+    #include <span>
 
 BEGIN_NAMESPACE
 
+class CacheCoherenceDomain;
+
 class [[nodiscard]] CacheMemory final : public ICacheMemory {
   public:
     struct Config {
         CacheWriteStrategy m_cacheWriteStrategy;
         CacheMemoryMapping m_memoryMapping;
+
+        // Only used by associative mappings, a fully associative cache has as many ways as lines
+        CacheReplacementPolicy m_replacementPolicy { CacheReplacementPolicy::LeastRecentlyUsed };
+        std::uint32_t          m_associativity { 8 };
+
+        // Caches accessed by several processing units lock the sets they touch, private caches do not lock
+        bool m_isShared { false };
+
+        // Caches sharing an upstream cache keep their lines coherent through a common domain, which has to outlive
+        // them
+        CacheCoherenceDomain* m_coherenceDomain { nullptr };
     };
 
     static constexpr const char* Default_name = "CacheMemory";
@@ -28,49 +42,69 @@ class [[nodiscard]] CacheMemory final : public ICacheMemory {
 
     [[nodiscard]] DataUnit Read(Address address) const noexcept final;
 
-    /// <summary>
-    /// Block has to be equal to one cache line
-    /// TODO: Fix that
-    /// </summary>
-    /// <param name="start"></param>
-    /// <param name="dataUnitCount"></param>
-    /// <returns></returns>
+    /// @brief Reads a block spanning any number of cache lines, consecutive missing lines are fetched from the
+    /// upstream memory with a single request
     [[nodiscard]] DataBlock< DataUnit > ReadBlock(Address start, std::uint64_t dataUnitCount) const final;
+    void                                ReadBlock(Address start, std::span< DataUnit > data) const final;
+
+    /// @brief Borrows the cache line storage for blocks within one cache line of a private cache, copies longer
+    /// blocks and blocks of shared caches as their lines might be evicted by another processing unit
+    [[nodiscard]] DataView< DataUnit > ViewBlock(Address start, std::uint64_t dataUnitCount) const final;
 
     void Write(Address address, DataUnit data) final;
 
-    /// <summary>
-    /// Block has to be equal to one cache line
-    /// TODO: Fix that
-    /// </summary>
-    /// <param name="start"></param>
-    /// <param name="data"></param>
+    /// @brief Writes a block spanning any number of cache lines
     void WriteBlock(Address start, const DataBlock< DataUnit >& data) final;
+    void WriteBlock(Address start, std::span< const DataUnit > data) final;
+
+    /// @brief Reads the data units covering the bytes with a single ReadBlock
+    void ReadBytes(Address byteAddress, std::span< std::byte > data) const final;
+
+    /// @brief Writes the data units covering the bytes with a single WriteBlock, partially written data units are read
+    /// first
+    void WriteBytes(Address byteAddress, std::span< const std::byte > data) final;
 
     [[nodiscard]] Address Size() const noexcept final;
 
     [[nodiscard]] const MemoryWatcher& GetMemoryWatcher() const noexcept final;
     [[nodiscard]] const IMemory* const GetUpStreamMemory() const noexcept final;
-    void                               ClearCache() noexcept final;
+    void                               ClearCache() final;
+    void                               FlushCache() final;
 
     [[nodiscard]] static constexpr const std::pmr::vector< CacheWriteStrategy >& GetSupportedWriteStrategies() noexcept;
     [[nodiscard]] static constexpr const std::pmr::vector< CacheMemoryMapping >& GetSupportedMemoryMappings() noexcept;
 
   private:
+    // Data units of the largest byte access, a quadword at any byte offset
+    static constexpr std::size_t Small_block_size = 8;
+
     class Impl;
     UniqueRef< Impl > m_memory;
+    bool              m_isShared;
+
+    // Holds the lock stripes of the sets caching a range of lines for the duration of an access
+    class StripeGuard;
+    [[nodiscard]] StripeGuard LockLines(Address start, std::uint64_t dataUnitCount) const;
+    [[nodiscard]] StripeGuard LockAllLines() const;
 
     template < class ImplDetail >
     [[nodiscard]] static UniqueRef< Impl > ConstructMemory(IMemory* upstreamMemory, Address size, const Config& config,
                                                            ImplDetail detail);
 
+    template < class ReplacementPolicy, CacheWriteStrategy Write_strategy, class ImplDetail >
+    [[nodiscard]] static UniqueRef< Impl > ConstructSetAssociativeMemory(IMemory* upstreamMemory, Address size,
+                                                                         std::size_t ways, ImplDetail detail);
+
+    // Associative and write-back caches, a direct mapped write-back cache is a set associative cache of one way
+    template < CacheWriteStrategy Write_strategy, class ImplDetail >
+    [[nodiscard]] static UniqueRef< Impl > ConstructAssociativeMemory(IMemory* upstreamMemory, Address size,
+                                                                      const Config& config, ImplDetail detail);
+
     // Forward declaration of cache memory types
     class DirectAccessWriteThroughCacheMemory;
-    // class FullyAssociativeWriteThroughCacheMemory;
-    // class SetAssociativeWriteThroughCacheMemory;
-    // class DirectAccessWriteBackCacheMemory;
-    // class FullyAssociativeWriteBackCacheMemory;
-    // class SetAssociativeWriteBackCacheMemory;
+    // Fully associative caches are modelled as a single set, direct mapped write-back caches as single way sets
+    template < class ReplacementPolicy, CacheWriteStrategy Write_strategy >
+    class SetAssociativeCacheMemory;
 };
 
 END_NAMESPACE
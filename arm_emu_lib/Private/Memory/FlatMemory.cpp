@@ -0,0 +1,202 @@
+#include <Memory/FlatMemory.h>
+#include <Memory/MemoryWatcher.h>
+#include <algorithm>
+#include <memory_resource>
+#include <vector>
+
+BEGIN_NAMESPACE
+
+class FlatMemory::Impl final {
+  public:
+    Impl(Object* logger, Address addressableSize) :
+        m_memory(addressableSize, Empty_data_unit), m_watcher(), m_debugObject(*logger) {
+        m_debugObject.Log(LogType::Construction, "Memory construction {}!",
+                          m_memory.size() == addressableSize ? "succeeded" : "failed");
+    }
+
+    DataUnit Read(Address address) noexcept {
+        m_debugObject.LogTrace(LogType::Other, "Read memory at address: {}", address);
+        Preconditions(address);
+
+        m_watcher.RecordAccessType(MemoryAccessType::Read);
+
+        if (address >= m_memory.size()) {
+            return Empty_data_unit;
+        }
+        return m_memory[address];
+    }
+
+    void ReadBlock(Address start, std::span< DataUnit > data) {
+        m_debugObject.LogTrace(LogType::Other, "ReadBlock of memory starting from address: {} with length: {}", start,
+                               data.size());
+        Preconditions(start + data.size() - 1);
+
+        m_watcher.RecordAccessType(MemoryAccessType::ReadBlock);
+
+        const auto readRange = GetRange(start, data.size());
+        std::copy(readRange.begin(), readRange.end(), data.begin());
+        std::fill(data.begin() + readRange.size(), data.end(), Empty_data_unit);
+    }
+
+    DataView< DataUnit > ViewBlock(Address start, std::uint64_t dataUnitCount) {
+        m_debugObject.LogTrace(LogType::Other, "ViewBlock of memory starting from address: {} with length: {}", start,
+                               dataUnitCount);
+        Preconditions(start + dataUnitCount - 1);
+
+        m_watcher.RecordAccessType(MemoryAccessType::ReadBlock);
+
+        const auto readRange = GetRange(start, dataUnitCount);
+        if (readRange.size() == dataUnitCount) {
+            return DataView< DataUnit > { std::span< const DataUnit > { readRange } };
+        }
+
+        auto data = DataBlock< DataUnit >(dataUnitCount, Empty_data_unit);
+        std::copy(readRange.begin(), readRange.end(), data.Data());
+        return DataView< DataUnit > { std::move(data) };
+    }
+
+    void Write(Address address, DataUnit data) noexcept {
+        m_debugObject.LogTrace(LogType::Other, "Write DataUnit: {} at address: {}", data, address);
+        Preconditions(address);
+
+        if (address < m_memory.size()) {
+            m_memory[address] = data;
+        }
+        m_watcher.RecordAccessType(MemoryAccessType::Write);
+    }
+
+    void WriteBlock(Address start, std::span< const DataUnit > data) {
+        m_debugObject.LogTrace(LogType::Other, "WriteBlock of DataUnits of size: {} starting from address: {}",
+                               data.size(), start);
+        Preconditions(start + data.size() - 1);
+
+        const auto writeRange = GetRange(start, data.size());
+        std::copy(data.begin(), data.begin() + writeRange.size(), writeRange.begin());
+        m_watcher.RecordAccessType(MemoryAccessType::WriteBlock);
+    }
+
+    void ReadBytes(Address byteAddress, std::span< std::byte > data) noexcept {
+        m_debugObject.LogTrace(LogType::Other, "Read {} bytes of memory at byte address: {}", data.size(), byteAddress);
+        Preconditions((byteAddress + data.size() - 1) / sizeof(DataUnit));
+
+        m_watcher.RecordAccessType(MemoryAccessType::Read);
+
+        const auto memoryBytes = m_memory.size() * sizeof(DataUnit);
+        const auto copiedBytes = byteAddress < memoryBytes ? std::min(data.size(), memoryBytes - byteAddress) : 0;
+        std::fill(data.begin() + copiedBytes, data.end(), std::byte { 0 });
+        LoadBytes(m_memory, byteAddress, data.first(copiedBytes));
+    }
+
+    void WriteBytes(Address byteAddress, std::span< const std::byte > data) noexcept {
+        m_debugObject.LogTrace(LogType::Other, "Write {} bytes of memory at byte address: {}", data.size(), byteAddress);
+        Preconditions((byteAddress + data.size() - 1) / sizeof(DataUnit));
+
+        const auto memoryBytes = m_memory.size() * sizeof(DataUnit);
+        if (byteAddress < memoryBytes) {
+            StoreBytes(m_memory, byteAddress, data.first(std::min(data.size(), memoryBytes - byteAddress)));
+        }
+        m_watcher.RecordAccessType(MemoryAccessType::Write);
+    }
+
+    Address Size() const noexcept {
+        return m_memory.size();
+    }
+
+    const MemoryWatcher& GetMemoryWatcher() const noexcept {
+        return m_watcher;
+    }
+
+    std::span< DataUnit > GetRange(Address start, std::uint64_t dataUnitCount) noexcept {
+        // Ranges are clamped to the memory, so out of bound accesses through them are caught by the caller
+        if (start >= m_memory.size()) {
+            return {};
+        }
+        return std::span< DataUnit > { m_memory }.subspan(start, std::min(dataUnitCount, m_memory.size() - start));
+    }
+
+  private:
+    void Preconditions([[maybe_unused]] Address addr) const noexcept {
+        assert(addr < m_memory.size() && "Out of memory bound access, undefined behavior!");
+    }
+
+    // Allocated once and never resized, processing units hold pointers into it
+    std::pmr::vector< DataUnit > m_memory;
+    mutable MemoryWatcher        m_watcher;
+    Object&                      m_debugObject;
+};
+
+template < class ImplDetail >
+UniqueRef< FlatMemory::Impl > FlatMemory::ConstructMemory(Address arg, ImplDetail myself) {
+    myself->Log(LogType::Construction, "Constructing memory of size {} Addresses!", arg);
+    std::pmr::polymorphic_allocator< FlatMemory::Impl > alloc {};
+
+    return allocate_unique< FlatMemory::Impl >(alloc, myself, arg);
+}
+
+FlatMemory::FlatMemory(Address addressableSize) :
+    IMemory(Default_name), m_memory(ConstructMemory(addressableSize, this)) {
+}
+
+FlatMemory::FlatMemory(std::string name, Address addressableSize) :
+    IMemory(std::move(name)), m_memory(ConstructMemory(addressableSize, this)) {
+}
+
+FlatMemory::FlatMemory(FlatMemory&&) noexcept = default;
+
+FlatMemory& FlatMemory::operator=(FlatMemory&&) noexcept = default;
+
+FlatMemory::~FlatMemory() {
+    Log(LogType::Destruction, "Destroying memory of size {} Addresses!", m_memory->Size());
+}
+
+FlatMemory::DataUnit FlatMemory::Read(Address address) const noexcept {
+    return m_memory->Read(address);
+}
+
+DataBlock< FlatMemory::DataUnit > FlatMemory::ReadBlock(Address start, std::uint64_t dataUnitCount) const {
+    auto data = DataBlock< DataUnit >(dataUnitCount, Empty_data_unit);
+    m_memory->ReadBlock(start, std::span< DataUnit > { data.Data(), data.Size() });
+    return data;
+}
+
+void FlatMemory::ReadBlock(Address start, std::span< DataUnit > data) const {
+    return m_memory->ReadBlock(start, data);
+}
+
+DataView< FlatMemory::DataUnit > FlatMemory::ViewBlock(Address start, std::uint64_t dataUnitCount) const {
+    return m_memory->ViewBlock(start, dataUnitCount);
+}
+
+void FlatMemory::Write(Address address, DataUnit data) noexcept {
+    return m_memory->Write(address, data);
+}
+
+void FlatMemory::WriteBlock(Address start, const DataBlock< DataUnit >& data) {
+    return m_memory->WriteBlock(start, std::span< const DataUnit > { data.Data(), data.Size() });
+}
+
+void FlatMemory::WriteBlock(Address start, std::span< const DataUnit > data) {
+    return m_memory->WriteBlock(start, data);
+}
+
+void FlatMemory::ReadBytes(Address byteAddress, std::span< std::byte > data) const {
+    return m_memory->ReadBytes(byteAddress, data);
+}
+
+void FlatMemory::WriteBytes(Address byteAddress, std::span< const std::byte > data) {
+    return m_memory->WriteBytes(byteAddress, data);
+}
+
+FlatMemory::Address FlatMemory::Size() const noexcept {
+    return m_memory->Size();
+}
+
+const MemoryWatcher& FlatMemory::GetMemoryWatcher() const noexcept {
+    return m_memory->GetMemoryWatcher();
+}
+
+std::span< FlatMemory::DataUnit > FlatMemory::GetRange(Address start, std::uint64_t dataUnitCount) noexcept {
+    return m_memory->GetRange(start, dataUnitCount);
+}
+
+END_NAMESPACE
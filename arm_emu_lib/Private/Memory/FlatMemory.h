@@ -0,0 +1,59 @@
+#if !defined(FLATMEMORY_H_INCLUDED_100688CE_64C8_4486_BE03_C247AEF223F0)
+    #define FLATMEMORY_H_INCLUDED_100688CE_64C8_4486_BE03_C247AEF223F0
+
+    #include <API/Api.h>
+    #include <Memory/IMemory.h>
+    #include <Utility/UniqueRef.h>
+    #include <span>
+
+BEGIN_NAMESPACE
+
+/// <summary>
+/// Fixed size memory laid out contiguously in host memory, for the flat memory model.
+/// Processing units access their range directly through GetRange, those accesses are not recorded by the watcher.
+/// </summary>
+class [[nodiscard]] FlatMemory final : public IMemory {
+  private:
+    static constexpr const char* Default_name = "FlatMemory";
+
+  public:
+    FlatMemory(Address addressableSize);
+    FlatMemory(std::string name, Address addressableSize);
+
+    FlatMemory(FlatMemory&&) noexcept;
+    FlatMemory& operator=(FlatMemory&&) noexcept;
+    virtual ~FlatMemory();
+
+    FlatMemory(const FlatMemory&)            = delete;
+    FlatMemory& operator=(const FlatMemory&) = delete;
+
+    [[nodiscard]] DataUnit              Read(Address address) const noexcept final;
+    [[nodiscard]] DataBlock< DataUnit > ReadBlock(Address start, std::uint64_t dataUnitCount) const final;
+    void                                ReadBlock(Address start, std::span< DataUnit > data) const final;
+    [[nodiscard]] DataView< DataUnit >  ViewBlock(Address start, std::uint64_t dataUnitCount) const final;
+
+    void Write(Address address, DataUnit data) noexcept final;
+    void WriteBlock(Address start, const DataBlock< DataUnit >& data) final;
+    void WriteBlock(Address start, std::span< const DataUnit > data) final;
+
+    void ReadBytes(Address byteAddress, std::span< std::byte > data) const final;
+    void WriteBytes(Address byteAddress, std::span< const std::byte > data) final;
+
+    [[nodiscard]] Address Size() const noexcept final;
+
+    [[nodiscard]] const MemoryWatcher& GetMemoryWatcher() const noexcept final;
+
+    /// @brief Host view of the dataUnitCount data units starting at start, stable for the lifetime of the memory
+    [[nodiscard]] std::span< DataUnit > GetRange(Address start, std::uint64_t dataUnitCount) noexcept;
+
+  private:
+    class Impl;
+    UniqueRef< Impl > m_memory;
+
+    template < class ImplDetail >
+    [[nodiscard]] static UniqueRef< Impl > ConstructMemory(Address arg, ImplDetail detail);
+};
+
+END_NAMESPACE
+
+#endif // !defined(FLATMEMORY_H_INCLUDED_100688CE_64C8_4486_BE03_C247AEF223F0)
@@ -4,6 +4,7 @@
     #include <API/Api.h>
     #include <Memory/IMemory.h>
     #include <array>
+    #include <cstdint>
     #include <vector>
 
 BEGIN_NAMESPACE
@@ -21,8 +22,25 @@ enum class CacheMemoryMapping
     SetAssociative,
 };
 
+/// @brief Line evicted on a miss in a full set of an associative cache
+enum class CacheReplacementPolicy
+{
+    LeastRecentlyUsed,
+    PseudoLeastRecentlyUsed, // Tree based, the associativity has to be a power of two
+    Random,
+};
+
+/// @brief MESI state of a cache line, caches outside of a coherence domain only use Exclusive and Modified
+enum class CacheCoherenceState : std::uint8_t
+{
+    Invalid,
+    Shared,    // Clean, other caches of the domain might hold the line
+    Exclusive, // Clean, no other cache of the domain holds the line
+    Modified,  // Dirty, no other cache of the domain holds the line
+};
+
 /// <summary>
-/// Will implement Write-through for now
+/// Cache level in front of an upstream memory, either write-through or write-back
 /// </summary>
 class [[nodiscard]] ICacheMemory : public IMemory {
   public:
@@ -40,7 +58,13 @@ class [[nodiscard]] ICacheMemory : public IMemory {
     ICacheMemory& operator=(const ICacheMemory&) = delete;
 
     [[nodiscard]] virtual const IMemory* const GetUpStreamMemory() const noexcept = 0;
-    virtual void                               ClearCache() noexcept              = 0;
+
+    /// @brief Drops every cached line, dirty lines are written back first
+    virtual void ClearCache() = 0;
+
+    /// @brief Writes dirty lines back to the upstream memory and keeps them cached, no-op for write-through caches
+    /// @note Only this level is flushed, upstream caches have to be flushed by the caller
+    virtual void FlushCache() = 0;
 };
 
 END_NAMESPACE
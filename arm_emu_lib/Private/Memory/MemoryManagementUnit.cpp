@@ -1,9 +1,60 @@
 
 #include <Memory/MemoryManagementUnit.h>
+#include <algorithm>
 
 BEGIN_NAMESPACE
 
-MemoryManagementUnit::MemoryManagementUnit(std::string name) : Object(std::move(name)), m_mappings() {
+namespace {
+    // Stage 1 translation with a 4 KiB granule
+    constexpr std::uint64_t Granule_bits     = 12;
+    constexpr std::uint64_t Granule_bytes    = std::uint64_t { 1 } << Granule_bits;
+    constexpr std::uint64_t Table_index_bits = 9;
+    constexpr std::uint64_t Table_entries    = std::uint64_t { 1 } << Table_index_bits;
+    constexpr std::uint64_t Last_level       = 3;
+
+    constexpr std::uint64_t Descriptor_valid      = 0b01;
+    constexpr std::uint64_t Descriptor_table      = 0b10; // Table at levels 0 - 2, page at level 3, block when clear
+    constexpr std::uint64_t Descriptor_access     = std::uint64_t { 1 } << 10;
+    constexpr std::uint64_t Output_address_mask   = 0x0000'FFFF'FFFF'F000;
+    constexpr std::uint64_t Last_level_table_bits = Granule_bits + Table_index_bits;
+
+    static_assert(MemoryManagementUnit::Page_size * sizeof(IMemory::DataUnit) == Granule_bytes);
+
+    [[nodiscard]] constexpr std::uint64_t StartLevel(std::uint64_t virtualAddressBits) noexcept {
+        return Last_level - (virtualAddressBits - Granule_bits - 1) / Table_index_bits;
+    }
+
+    [[nodiscard]] constexpr std::uint64_t LevelShift(std::uint64_t level) noexcept {
+        return Granule_bits + Table_index_bits * (Last_level - level);
+    }
+
+    [[nodiscard]] constexpr std::uint64_t DescriptorAddress(std::uint64_t table, std::uint64_t virtualByteAddress,
+                                                            std::uint64_t level) noexcept {
+        const auto index = (virtualByteAddress >> LevelShift(level)) & (Table_entries - 1);
+        return table + index * sizeof(std::uint64_t);
+    }
+} // namespace
+
+MemoryManagementUnit::MemoryManagementUnit(std::string name) :
+    Object(std::move(name)),
+    m_mappings(),
+    m_demandPagedSpaces(),
+    m_generation(0),
+    m_physicalMemory(nullptr),
+    m_nextFrame(0),
+    m_framePoolEnd(0),
+    m_frameMutex() {
+}
+
+void MemoryManagementUnit::SetPhysicalMemory(IMemory* physicalMemory, IMemory::Address framePoolStart,
+                                             IMemory::Address framePoolEnd) {
+    Log(LogType::MMU, "Using physical memory {} with a frame pool of start address {} and end address {}",
+        static_cast< void* >(physicalMemory), framePoolStart, framePoolEnd);
+
+    std::scoped_lock lock { m_frameMutex };
+    m_physicalMemory = physicalMemory;
+    m_nextFrame      = (framePoolStart + Page_size - 1) / Page_size * Page_size;
+    m_framePoolEnd   = framePoolEnd;
 }
 
 void MemoryManagementUnit::AddProcess(void* processAddress, IMemory::Address startAddressSpace,
@@ -11,36 +62,245 @@ void MemoryManagementUnit::AddProcess(void* processAddress, IMemory::Address sta
     Log(LogType::MMU, "Tracking process {} with a memory space of start address {} and end address {}", processAddress,
         startAddressSpace, endAddressSpace);
 
+    if (m_demandPagedSpaces.contains(processAddress)) {
+        throw processing_unit_already_tracked {};
+    }
+
     auto [_, success] = m_mappings.try_emplace(processAddress, startAddressSpace, endAddressSpace);
 
     if (!success) {
         throw processing_unit_already_tracked {};
     }
+    m_generation.fetch_add(1, std::memory_order_release);
+}
+
+void MemoryManagementUnit::AddDemandPagedProcess(void* processAddress, IMemory::Address virtualSize) {
+    Log(LogType::MMU, "Tracking demand paged process {} with a virtual memory space of size {}", processAddress,
+        virtualSize);
+
+    if (m_mappings.contains(processAddress) || m_demandPagedSpaces.contains(processAddress)) {
+        throw processing_unit_already_tracked {};
+    }
+
+    std::optional< std::uint64_t > tableBase;
+    {
+        std::scoped_lock lock { m_frameMutex };
+        tableBase = AllocateFrame();
+    }
+    if (!tableBase) {
+        throw invalid_physical_memory_access {};
+    }
+
+    m_demandPagedSpaces.try_emplace(processAddress, *tableBase, virtualSize);
+    m_generation.fetch_add(1, std::memory_order_release);
 }
 
-IMemory::Address MemoryManagementUnit::Translate(void* processAddress, IMemory::Address virtualAddress) const {
+bool MemoryManagementUnit::SetupTranslationRegisters(void* processAddress, SystemRegisters& registers) const noexcept {
+    const auto space = m_demandPagedSpaces.find(processAddress);
+
+    if (space == m_demandPagedSpaces.end()) {
+        return false;
+    }
+
+    registers.m_TTBR0_EL1 = space->second.m_tableBase;
+    registers.m_TCR_EL1   = (registers.m_TCR_EL1 & ~std::uint64_t { 0b11'1111 }) | Demand_paged_T0SZ;
+    registers.m_SCTLR_EL1 |= 0b1;
+    return true;
+}
+
+Translation MemoryManagementUnit::TryTranslate(void* processAddress, IMemory::Address virtualAddress,
+                                               IMemory::Address unitCount) const noexcept {
     LogTrace(LogType::MMU, "Translating virtual address {} from process {}", virtualAddress, processAddress);
 
     auto mapping = m_mappings.find(processAddress);
 
     if (mapping == m_mappings.end()) {
-        throw untracked_processing_unit {};
+        return { 0, TranslationFault::UntrackedProcessingUnit };
     }
 
     auto physicalAddress = virtualAddress + mapping->second.m_start;
 
-    if (physicalAddress >= mapping->second.m_end) {
-        throw invalid_physical_memory_access {};
+    if (physicalAddress + unitCount > mapping->second.m_end) {
+        return { 0, TranslationFault::InvalidPhysicalMemoryAccess };
     }
 
     LogTrace(LogType::MMU, "Translated virtual address {} from process {} to physical address {}", virtualAddress,
              processAddress, physicalAddress);
 
-    return physicalAddress;
+    return { physicalAddress, TranslationFault::None };
+}
+
+PageTranslation MemoryManagementUnit::TryTranslatePage(void*            processAddress,
+                                                       IMemory::Address virtualAddress) const noexcept {
+    const auto pageAddress = virtualAddress - virtualAddress % Page_size;
+    const auto translation = TryTranslate(processAddress, pageAddress);
+
+    if (translation.m_fault != TranslationFault::None) {
+        return { 0, 0, translation.m_fault };
+    }
+
+    // The mapping may end inside the page
+    const auto& mapping = m_mappings.find(processAddress)->second;
+    return { translation.m_physicalAddress, std::min(Page_size, mapping.m_end - translation.m_physicalAddress),
+             TranslationFault::None };
+}
+
+PageTranslation MemoryManagementUnit::TryTranslatePage(void* processAddress, IMemory::Address virtualAddress,
+                                                       const SystemRegisters& registers,
+                                                       PageWalkCache&         walkCache) noexcept {
+    const auto translation = LookupPage(processAddress, virtualAddress, registers, walkCache);
+
+    if (translation.m_fault != TranslationFault::UnmappedVirtualAddress) {
+        return translation;
+    }
+
+    // Only the tables the MMU built for the process are demand paged
+    const auto space = m_demandPagedSpaces.find(processAddress);
+    if (space == m_demandPagedSpaces.end() || virtualAddress >= space->second.m_virtualSize ||
+        registers.GetTranslationTableBase() != space->second.m_tableBase ||
+        registers.GetT0SZ() != Demand_paged_T0SZ) {
+        return translation;
+    }
+
+    {
+        std::scoped_lock lock { m_frameMutex };
+        if (!MapPage(space->second.m_tableBase, virtualAddress * sizeof(IMemory::DataUnit))) {
+            return { 0, 0, TranslationFault::InvalidPhysicalMemoryAccess };
+        }
+    }
+
+    LogTrace(LogType::MMU, "Mapped page of virtual address {} for process {}", virtualAddress, processAddress);
+
+    return WalkTables(virtualAddress, registers, walkCache);
+}
+
+PageTranslation MemoryManagementUnit::LookupPage(void* processAddress, IMemory::Address virtualAddress,
+                                                 const SystemRegisters& registers,
+                                                 PageWalkCache&         walkCache) const noexcept {
+    if (!registers.IsStage1Enabled()) {
+        return TryTranslatePage(processAddress, virtualAddress);
+    }
+    return WalkTables(virtualAddress, registers, walkCache);
 }
 
 IMemory::Address MemoryManagementUnit::Count() const noexcept {
     return m_mappings.size();
 }
 
+std::uint64_t MemoryManagementUnit::GetGeneration() const noexcept {
+    return m_generation.load(std::memory_order_acquire);
+}
+
+PageTranslation MemoryManagementUnit::WalkTables(IMemory::Address virtualAddress, const SystemRegisters& registers,
+                                                 PageWalkCache& walkCache) const noexcept {
+    constexpr PageTranslation unmapped { 0, 0, TranslationFault::UnmappedVirtualAddress };
+    constexpr PageTranslation invalid { 0, 0, TranslationFault::InvalidPhysicalMemoryAccess };
+
+    if (m_physicalMemory == nullptr) {
+        return invalid;
+    }
+
+    // T0SZ values outside of [16, 39] are not valid for a 4 KiB granule
+    const auto t0sz = registers.GetT0SZ();
+    if (t0sz < 16 || t0sz > 39) {
+        return unmapped;
+    }
+
+    const auto virtualAddressBits = 64 - t0sz;
+    const auto virtualByteAddress = virtualAddress * sizeof(IMemory::DataUnit);
+    if ((virtualByteAddress >> virtualAddressBits) != 0) {
+        return unmapped;
+    }
+
+    const auto physicalBytes = m_physicalMemory->Size() * sizeof(IMemory::DataUnit);
+    const auto region        = virtualByteAddress >> Last_level_table_bits;
+    auto&      cachedTable   = walkCache.m_entries[region % PageWalkCache::Entry_count];
+
+    auto level = StartLevel(virtualAddressBits);
+    auto table = registers.GetTranslationTableBase();
+    if (level < Last_level && cachedTable.m_region == region) {
+        level = Last_level;
+        table = cachedTable.m_tableAddress;
+    }
+
+    for (;; ++level) {
+        const auto descriptorAddress = DescriptorAddress(table, virtualByteAddress, level);
+        if (descriptorAddress + sizeof(std::uint64_t) > physicalBytes) {
+            return invalid;
+        }
+
+        const auto descriptor    = m_physicalMemory->Read< std::uint64_t >(descriptorAddress);
+        const auto outputAddress = descriptor & Output_address_mask;
+        const auto isTableOrPage = (descriptor & Descriptor_table) != 0;
+
+        if ((descriptor & Descriptor_valid) == 0) {
+            return unmapped;
+        }
+
+        if (level < Last_level && isTableOrPage) {
+            table = outputAddress;
+            if (level == Last_level - 1) {
+                cachedTable = { region, table };
+            }
+            continue;
+        }
+
+        // Level 0 blocks and level 3 block encodings are reserved
+        if (level == 0 || (level == Last_level && !isTableOrPage)) {
+            return unmapped;
+        }
+
+        // Pages of a block are contiguous, pick the one holding the virtual address
+        const auto blockMask   = (std::uint64_t { 1 } << LevelShift(level)) - 1;
+        const auto pageAddress = (outputAddress & ~blockMask) | (virtualByteAddress & blockMask & ~(Granule_bytes - 1));
+
+        if (pageAddress + Granule_bytes > physicalBytes) {
+            return invalid;
+        }
+        return { pageAddress / sizeof(IMemory::DataUnit), Page_size, TranslationFault::None };
+    }
+}
+
+std::optional< std::uint64_t > MemoryManagementUnit::AllocateFrame() noexcept {
+    static constexpr std::array< std::byte, Granule_bytes > zeroFrame {};
+
+    if (m_physicalMemory == nullptr || m_nextFrame + Page_size > m_framePoolEnd) {
+        return std::nullopt;
+    }
+
+    const auto frame = m_nextFrame * sizeof(IMemory::DataUnit);
+    m_nextFrame += Page_size;
+
+    // New tables have to start out with invalid descriptors only
+    m_physicalMemory->WriteBytes(frame, zeroFrame);
+    return frame;
+}
+
+bool MemoryManagementUnit::MapPage(std::uint64_t tableBase, std::uint64_t virtualByteAddress) noexcept {
+    auto table = tableBase;
+
+    for (auto level = StartLevel(64 - Demand_paged_T0SZ); level <= Last_level; ++level) {
+        const auto descriptorAddress = DescriptorAddress(table, virtualByteAddress, level);
+        auto       descriptor        = m_physicalMemory->Read< std::uint64_t >(descriptorAddress);
+
+        if ((descriptor & Descriptor_valid) == 0) {
+            const auto frame = AllocateFrame();
+            if (!frame) {
+                return false;
+            }
+
+            descriptor = *frame | Descriptor_valid | Descriptor_table;
+            if (level == Last_level) {
+                descriptor |= Descriptor_access;
+            }
+            m_physicalMemory->Write< std::uint64_t >(descriptorAddress, descriptor);
+        } else if ((descriptor & Descriptor_table) == 0) {
+            return true; // Already covered by a block
+        }
+
+        table = descriptor & Output_address_mask;
+    }
+    return true;
+}
+
 END_NAMESPACE
@@ -4,8 +4,14 @@
     #include <API/Api.h>
     #include <DebugUtils/Object.h>
     #include <Memory/IMemory.h>
+    #include <ProcessingUnit/A64Registers/SystemRegisters.h>
+    #include <array>
+    #include <atomic>
+    #include <cstdint>
     #include <exception>
     #include <memory_resource>
+    #include <mutex>
+    #include <optional>
     #include <unordered_map>
 
 BEGIN_NAMESPACE
@@ -16,18 +22,57 @@ class invalid_physical_memory_access : public std::exception {
     }
 };
 
-class untracked_processing_unit : public std::exception {
+class processing_unit_already_tracked : public std::exception {
     [[nodiscard]] virtual const char* what() const noexcept override {
-        return "Untracked processing unit";
+        return "Processing unit is already tracked";
     }
 };
 
-class processing_unit_already_tracked : public std::exception {
-    [[nodiscard]] virtual const char* what() const noexcept override {
-        return "Processing unit is already tracked";
+enum class TranslationFault : std::uint32_t
+{
+    None,
+    UntrackedProcessingUnit,
+    InvalidPhysicalMemoryAccess,
+    UnmappedVirtualAddress,
+};
+
+struct [[nodiscard]] Translation {
+    IMemory::Address m_physicalAddress;
+    TranslationFault m_fault;
+};
+
+/// @brief Translation of a whole virtual page, only the first m_unitCount addresses of the page are mapped
+struct [[nodiscard]] PageTranslation {
+    IMemory::Address m_physicalAddress;
+    IMemory::Address m_unitCount;
+    TranslationFault m_fault;
+};
+
+/// <summary>
+/// Last level translation tables of recently walked 2 MiB regions, owned by the walking processing unit.
+/// Has to be flushed along with the TLB whenever the translation registers change.
+/// </summary>
+struct PageWalkCache {
+    static constexpr std::size_t      Entry_count    = 16;
+    static constexpr IMemory::Address Invalid_region = ~IMemory::Address { 0 };
+
+    struct Entry {
+        IMemory::Address m_region { Invalid_region };
+        IMemory::Address m_tableAddress { 0 };
+    };
+
+    void Flush() noexcept {
+        m_entries.fill(Entry {});
     }
+
+    std::array< Entry, Entry_count > m_entries {};
 };
 
+/// <summary>
+/// Translates the virtual addresses of processing units. A process either owns a fixed physical range (base and
+/// bound) or, once its SCTLR_EL1.M bit is set, is translated by a stage 1 walk of its 4 KiB granule tables.
+/// Demand paged processes get their pages and tables allocated from the frame pool on first touch.
+/// </summary>
 class [[nodiscard]] MemoryManagementUnit final : public Object {
     static constexpr const char* Default_name = "MemoryManagementUnit";
 
@@ -39,7 +84,21 @@ class [[nodiscard]] MemoryManagementUnit final : public Object {
         }
     };
 
+    struct DemandPagedSpace {
+        std::uint64_t    m_tableBase; // Byte address of the first level table
+        IMemory::Address m_virtualSize;
+
+        DemandPagedSpace(std::uint64_t tableBase, IMemory::Address virtualSize) :
+            m_tableBase(tableBase), m_virtualSize(virtualSize) {
+        }
+    };
+
   public:
+    static constexpr IMemory::Address Page_size = 4_KB;
+
+    // Demand paged processes use a 39 bit virtual address space, walked from level 1
+    static constexpr std::uint64_t Demand_paged_T0SZ = 64 - 39;
+
     MemoryManagementUnit(std::string name = Default_name);
     DELETE_COPY_CLASS(MemoryManagementUnit)
     DEFAULT_MOVE_CLASS(MemoryManagementUnit)
@@ -48,14 +107,57 @@ class [[nodiscard]] MemoryManagementUnit final : public Object {
     /// @brief Add a process to be tracked by MMU
     void AddProcess(void* processAddress, IMemory::Address startAddressSpace, IMemory::Address endAddressSpace);
 
-    /// @brief Translates virtual address to the physical address in storage
-    [[nodiscard]] IMemory::Address Translate(void* processAddress, IMemory::Address virtualAddress) const;
+    /// @brief Sets the memory holding the translation tables, frames of demand paged processes are allocated from
+    /// the physical range [framePoolStart, framePoolEnd) of it
+    void SetPhysicalMemory(IMemory* physicalMemory, IMemory::Address framePoolStart, IMemory::Address framePoolEnd);
+
+    /// @brief Add a process whose virtual range [0, virtualSize) is mapped page by page on first access
+    void AddDemandPagedProcess(void* processAddress, IMemory::Address virtualSize);
+
+    /// @brief Points the translation registers of a demand paged process at its tables
+    /// @return false if the process is not demand paged, registers are left untouched
+    bool SetupTranslationRegisters(void* processAddress, SystemRegisters& registers) const noexcept;
+
+    /// @brief Translates virtual address to the physical address in storage, reporting failures through the fault
+    /// @note All unitCount addresses starting at virtualAddress have to be mapped for the translation to succeed
+    [[nodiscard]] Translation TryTranslate(void* processAddress, IMemory::Address virtualAddress,
+                                           IMemory::Address unitCount = 1) const noexcept;
+
+    /// @brief Translates the page holding virtualAddress, used to fill translation lookaside buffers
+    [[nodiscard]] PageTranslation TryTranslatePage(void* processAddress, IMemory::Address virtualAddress) const noexcept;
+
+    /// @brief Translates the page holding virtualAddress with the stage 1 tables of registers if enabled, mapping
+    /// missing pages of demand paged processes
+    [[nodiscard]] PageTranslation TryTranslatePage(void* processAddress, IMemory::Address virtualAddress,
+                                                   const SystemRegisters& registers,
+                                                   PageWalkCache&         walkCache) noexcept;
+
+    /// @brief Same as TryTranslatePage, without mapping missing pages
+    [[nodiscard]] PageTranslation LookupPage(void* processAddress, IMemory::Address virtualAddress,
+                                             const SystemRegisters& registers,
+                                             PageWalkCache&         walkCache) const noexcept;
 
     /// @brief Returns number of mappings
     [[nodiscard]] std::size_t Count() const noexcept;
 
+    /// @brief Incremented whenever a mapping changes, cached translations of older generations are stale
+    [[nodiscard]] std::uint64_t GetGeneration() const noexcept;
+
   private:
+    [[nodiscard]] PageTranslation WalkTables(IMemory::Address virtualAddress, const SystemRegisters& registers,
+                                             PageWalkCache& walkCache) const noexcept;
+
+    [[nodiscard]] std::optional< std::uint64_t > AllocateFrame() noexcept;
+    [[nodiscard]] bool MapPage(std::uint64_t tableBase, std::uint64_t virtualByteAddress) noexcept;
+
     std::pmr::unordered_map< void*, PhysicalAddressRange > m_mappings;
+    std::pmr::unordered_map< void*, DemandPagedSpace >     m_demandPagedSpaces;
+    std::atomic< std::uint64_t >                           m_generation;
+
+    IMemory*         m_physicalMemory;
+    IMemory::Address m_nextFrame;
+    IMemory::Address m_framePoolEnd;
+    std::mutex       m_frameMutex; // Guards frame allocation and the tables of demand paged processes
 };
 
 END_NAMESPACE
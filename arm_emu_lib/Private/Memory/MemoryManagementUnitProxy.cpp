@@ -1,18 +1,90 @@
-
 #include <Memory/MemoryManagementUnitProxy.h>
+#include <bit>
 
 BEGIN_NAMESPACE
 
+static_assert(std::has_single_bit(MemoryManagementUnit::Page_size), "Page size has to be a power of two!");
+static_assert(std::has_single_bit(MemoryManagementUnitProxy::Tlb_entry_count), "TLB size has to be a power of two!");
+
 MemoryManagementUnitProxy::MemoryManagementUnitProxy(SharedRef< MemoryManagementUnit > mmu) :
-    m_mmu(std::move(mmu)), m_processAddress(nullptr) {
+    m_mmu(std::move(mmu)),
+    m_processAddress(nullptr),
+    m_registers(nullptr),
+    m_tlb(),
+    m_walkCache(),
+    m_tlbGeneration(m_mmu->GetGeneration()) {
 }
 
 void MemoryManagementUnitProxy::Attach(void* processAddress) noexcept {
     m_processAddress = processAddress;
+    FlushTlb();
+}
+
+void MemoryManagementUnitProxy::AttachRegisters(const SystemRegisters* registers) noexcept {
+    m_registers = registers;
+    FlushTlb();
+}
+
+PageTranslation MemoryManagementUnitProxy::LookupPage(IMemory::Address virtualAddress) const noexcept {
+    if (m_registers != nullptr) {
+        return m_mmu->LookupPage(m_processAddress, virtualAddress, *m_registers, m_walkCache);
+    }
+    return m_mmu->TryTranslatePage(m_processAddress, virtualAddress);
+}
+
+bool MemoryManagementUnitProxy::SetupTranslationRegisters(SystemRegisters& registers) const noexcept {
+    return m_mmu->SetupTranslationRegisters(m_processAddress, registers);
+}
+
+Translation MemoryManagementUnitProxy::TryTranslate(IMemory::Address virtualAddress,
+                                                    IMemory::Address unitCount) const noexcept {
+    constexpr auto pageShift = std::countr_zero(MemoryManagementUnit::Page_size);
+
+    const auto  virtualPage = virtualAddress >> pageShift;
+    const auto  pageOffset  = virtualAddress & (MemoryManagementUnit::Page_size - 1);
+    const auto& entry       = m_tlb[virtualPage & (Tlb_entry_count - 1)];
+
+    if (entry.m_virtualPage == virtualPage && pageOffset + unitCount <= entry.m_unitCount &&
+        m_tlbGeneration == m_mmu->GetGeneration()) [[likely]] {
+        return { entry.m_physicalAddress + pageOffset, TranslationFault::None };
+    }
+    return TranslateOnMiss(virtualAddress, unitCount);
+}
+
+void MemoryManagementUnitProxy::FlushTlb() const noexcept {
+    m_tlb.fill(TlbEntry {});
+    m_walkCache.Flush();
+    m_tlbGeneration = m_mmu->GetGeneration();
+}
+
+Translation MemoryManagementUnitProxy::TranslateOnMiss(IMemory::Address virtualAddress,
+                                                       IMemory::Address unitCount) const noexcept {
+    if (m_tlbGeneration != m_mmu->GetGeneration()) {
+        FlushTlb();
+    }
+
+    const auto page = TranslatePage(virtualAddress);
+    if (page.m_fault != TranslationFault::None) {
+        return { 0, page.m_fault };
+    }
+
+    const auto virtualPage = virtualAddress / MemoryManagementUnit::Page_size;
+    const auto pageOffset  = virtualAddress % MemoryManagementUnit::Page_size;
+
+    m_tlb[virtualPage & (Tlb_entry_count - 1)] = { virtualPage, page.m_physicalAddress, page.m_unitCount };
+
+    // Callers split accesses at page boundaries, frames of consecutive pages need not be physically contiguous
+    if (pageOffset + unitCount > page.m_unitCount) {
+        return { 0, TranslationFault::InvalidPhysicalMemoryAccess };
+    }
+    return { page.m_physicalAddress + pageOffset, TranslationFault::None };
 }
 
-IMemory::Address MemoryManagementUnitProxy::Translate(IMemory::Address virtualAddress) const {
-    return m_mmu->Translate(m_processAddress, virtualAddress);
+PageTranslation MemoryManagementUnitProxy::TranslatePage(IMemory::Address virtualAddress) const noexcept {
+    if (m_registers != nullptr) {
+        return m_mmu->TryTranslatePage(m_processAddress, virtualAddress, *m_registers, m_walkCache);
+    }
+    return m_mmu->TryTranslatePage(m_processAddress, virtualAddress);
 }
 
 END_NAMESPACE
@@ -4,19 +4,56 @@
     #include <API/Api.h>
     #include <Memory/MemoryManagementUnit.h>
     #include <Utility/UniqueRef.h>
+    #include <array>
 
 BEGIN_NAMESPACE
 
+/// <summary>
+/// Per processing unit view of the MMU. Page translations are cached in a small direct mapped TLB, so the common
+/// translation is a mask and a compare. The TLB is flushed on Attach and whenever the MMU mappings change, the
+/// processing unit flushes it when its translation registers change.
+/// </summary>
 class [[nodiscard]] MemoryManagementUnitProxy {
   public:
+    static constexpr std::size_t Tlb_entry_count = 64;
+
     MemoryManagementUnitProxy(SharedRef< MemoryManagementUnit > mmu);
 
-    void                           Attach(void* processAddress) noexcept;
-    [[nodiscard]] IMemory::Address Translate(IMemory::Address virtualAddress) const;
+    void Attach(void* processAddress) noexcept;
+    void AttachRegisters(const SystemRegisters* registers) noexcept;
+
+    /// @note The unitCount addresses have to lie in one page, callers split accesses crossing a page boundary
+    [[nodiscard]] Translation TryTranslate(IMemory::Address virtualAddress,
+                                           IMemory::Address unitCount = 1) const noexcept;
+
+    /// @brief Translates the page holding virtualAddress without going through the TLB or mapping missing pages
+    [[nodiscard]] PageTranslation LookupPage(IMemory::Address virtualAddress) const noexcept;
+
+    /// @brief Points registers at the translation tables of a demand paged process
+    bool SetupTranslationRegisters(SystemRegisters& registers) const noexcept;
+
+    /// @brief Drops all cached translations and walks
+    void FlushTlb() const noexcept;
 
   private:
-    SharedRef< MemoryManagementUnit > m_mmu;
-    void*                             m_processAddress;
+    struct TlbEntry {
+        static constexpr IMemory::Address Invalid_page = ~IMemory::Address { 0 };
+
+        IMemory::Address m_virtualPage { Invalid_page };
+        IMemory::Address m_physicalAddress { 0 };
+        IMemory::Address m_unitCount { 0 };
+    };
+
+    [[nodiscard]] Translation     TranslateOnMiss(IMemory::Address virtualAddress,
+                                                  IMemory::Address unitCount) const noexcept;
+    [[nodiscard]] PageTranslation TranslatePage(IMemory::Address virtualAddress) const noexcept;
+
+    SharedRef< MemoryManagementUnit >               m_mmu;
+    void*                                           m_processAddress;
+    const SystemRegisters*                          m_registers;
+    mutable std::array< TlbEntry, Tlb_entry_count > m_tlb;
+    mutable PageWalkCache                           m_walkCache;
+    mutable std::uint64_t                           m_tlbGeneration;
 };
 
 END_NAMESPACE
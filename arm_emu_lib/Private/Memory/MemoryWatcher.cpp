@@ -4,7 +4,15 @@
 
 BEGIN_NAMESPACE
 
-MemoryWatcher::MemoryWatcher(Hint hint) : m_hits(0), m_misses(0), m_memory(), m_upStreamMemory(), m_hint(hint) {
+MemoryWatcher::MemoryWatcher(Hint hint) :
+    m_hits(),
+    m_misses(),
+    m_memory(),
+    m_upStreamMemory(),
+    m_hint(hint),
+    m_invalidations(),
+    m_downgrades(),
+    m_snoopWriteBacks() {
     assert((hint == Hint::RandomAccessMemory) || (hint == Hint::CacheMemory) && "Undefined MemoryWatcherHint");
 }
 
@@ -17,28 +25,28 @@ MemoryWatcher::~MemoryWatcher() = default;
 void MemoryWatcher::RecordAccessType(MemoryAccessType type) {
     switch (type) {
         case MemoryAccessType::Read:
-            ++m_memory.m_readCount;
+            m_memory.m_readCount.Increment();
             break;
         case MemoryAccessType::ReadBlock:
-            ++m_memory.m_readBlockCount;
+            m_memory.m_readBlockCount.Increment();
             break;
         case MemoryAccessType::Write:
-            ++m_memory.m_writeCount;
+            m_memory.m_writeCount.Increment();
             break;
         case MemoryAccessType::WriteBlock:
-            ++m_memory.m_writeBlockCount;
+            m_memory.m_writeBlockCount.Increment();
             break;
         case MemoryAccessType::UpStreamRead:
-            ++m_upStreamMemory.m_readCount;
+            m_upStreamMemory.m_readCount.Increment();
             break;
         case MemoryAccessType::UpStreamReadBlock:
-            ++m_upStreamMemory.m_readBlockCount;
+            m_upStreamMemory.m_readBlockCount.Increment();
             break;
         case MemoryAccessType::UpStreamWrite:
-            ++m_upStreamMemory.m_writeCount;
+            m_upStreamMemory.m_writeCount.Increment();
             break;
         case MemoryAccessType::UpStreamWriteBlock:
-            ++m_upStreamMemory.m_writeBlockCount;
+            m_upStreamMemory.m_writeBlockCount.Increment();
             break;
         default:
             assert(false && "Invalid MemoryAccessType!");
@@ -48,16 +56,32 @@ void MemoryWatcher::RecordAccessType(MemoryAccessType type) {
 void MemoryWatcher::RecordAccessResult(MemoryAccessResult result) {
     switch (result) {
         case MemoryAccessResult::Hit:
-            ++m_hits;
+            m_hits.Increment();
             break;
         case MemoryAccessResult::Miss:
-            ++m_misses;
+            m_misses.Increment();
             break;
         default:
             assert(false && "Invalid MemoryAccessResult!");
     }
 }
 
+void MemoryWatcher::RecordCoherenceEvent(CoherenceEvent event) {
+    switch (event) {
+        case CoherenceEvent::Invalidation:
+            m_invalidations.Increment();
+            break;
+        case CoherenceEvent::Downgrade:
+            m_downgrades.Increment();
+            break;
+        case CoherenceEvent::SnoopWriteBack:
+            m_snoopWriteBacks.Increment();
+            break;
+        default:
+            assert(false && "Invalid CoherenceEvent!");
+    }
+}
+
 std::size_t MemoryWatcher::GetHitCount() const noexcept {
     return m_hits;
 }
@@ -67,11 +91,13 @@ std::size_t MemoryWatcher::GetMissCount() const noexcept {
 }
 
 double MemoryWatcher::GetMissRatio() const noexcept {
-    return m_misses / static_cast< double >(m_hits + m_misses);
+    const std::size_t misses = m_misses;
+    return misses / static_cast< double >(m_hits + misses);
 }
 
 double MemoryWatcher::GetHitRatio() const noexcept {
-    return m_hits / static_cast< double >(m_hits + m_misses);
+    const std::size_t hits = m_hits;
+    return hits / static_cast< double >(hits + m_misses);
 }
 
 std::size_t MemoryWatcher::GetReadCount() const noexcept {
@@ -136,4 +162,16 @@ std::size_t MemoryWatcher::GetMemoryAccessCount() const noexcept {
     }
 }
 
+std::size_t MemoryWatcher::GetInvalidationCount() const noexcept {
+    return m_invalidations;
+}
+
+std::size_t MemoryWatcher::GetDowngradeCount() const noexcept {
+    return m_downgrades;
+}
+
+std::size_t MemoryWatcher::GetSnoopWriteBackCount() const noexcept {
+    return m_snoopWriteBacks;
+}
+
 END_NAMESPACE
\ No newline at end of file
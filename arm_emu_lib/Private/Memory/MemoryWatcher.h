@@ -2,6 +2,7 @@
     #define MEMORYWATCHER_H_INCLUDED_ED19DE87_72CE_4C3C_9085_32F4320E8570
 
     #include <API/Api.h>
+    #include <atomic>
     #include <cstddef>
     #include <cstdint>
 
@@ -26,13 +27,45 @@ enum class MemoryAccessType
     UpStreamWriteBlock,
 };
 
+/// @brief Coherence actions applied to a line of a cache by the accesses of its siblings
+enum class CoherenceEvent
+{
+    Invalidation,   // A sibling wrote to the line
+    Downgrade,      // A sibling read the line, an exclusive or modified copy became shared
+    SnoopWriteBack, // A modified copy was written back to serve a sibling
+};
+
 class [[nodiscard]] MemoryWatcher {
 
+    // Shared memories are updated concurrently by several processing units, statistics need no ordering
+    class Counter {
+      public:
+        Counter() noexcept = default;
+        Counter(Counter&& other) noexcept : m_value(other) {
+        }
+        Counter& operator=(Counter&& other) noexcept {
+            m_value.store(other, std::memory_order_relaxed);
+            return *this;
+        }
+        ~Counter() = default;
+
+        void Increment() noexcept {
+            m_value.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        operator std::size_t() const noexcept {
+            return m_value.load(std::memory_order_relaxed);
+        }
+
+      private:
+        std::atomic< std::size_t > m_value { 0 };
+    };
+
     struct MemoryAccessTypeCounter {
-        std::size_t m_readCount { 0 };
-        std::size_t m_readBlockCount { 0 };
-        std::size_t m_writeCount { 0 };
-        std::size_t m_writeBlockCount { 0 };
+        Counter m_readCount {};
+        Counter m_readBlockCount {};
+        Counter m_writeCount {};
+        Counter m_writeBlockCount {};
     };
 
   public:
@@ -56,6 +89,7 @@ class [[nodiscard]] MemoryWatcher {
 
     void RecordAccessType(MemoryAccessType type);
     void RecordAccessResult(MemoryAccessResult result);
+    void RecordCoherenceEvent(CoherenceEvent event);
 
     [[nodiscard]] std::size_t GetHitCount() const noexcept;
     [[nodiscard]] std::size_t GetMissCount() const noexcept;
@@ -78,13 +112,21 @@ class [[nodiscard]] MemoryWatcher {
 
     [[nodiscard]] std::size_t GetMemoryAccessCount() const noexcept;
 
+    [[nodiscard]] std::size_t GetInvalidationCount() const noexcept;
+    [[nodiscard]] std::size_t GetDowngradeCount() const noexcept;
+    [[nodiscard]] std::size_t GetSnoopWriteBackCount() const noexcept;
+
   private:
-    std::size_t m_hits;
-    std::size_t m_misses;
+    Counter m_hits;
+    Counter m_misses;
 
     MemoryAccessTypeCounter m_memory;
     MemoryAccessTypeCounter m_upStreamMemory;
     Hint                    m_hint;
+
+    Counter m_invalidations;
+    Counter m_downgrades;
+    Counter m_snoopWriteBacks;
 };
 
 END_NAMESPACE
@@ -1,7 +1,10 @@
 
 #include <Memory/MemoryWatcher.h>
 #include <Memory/RandomAccessMemory.h>
+#include <algorithm>
 #include <memory_resource>
+#include <mutex>
+#include <shared_mutex>
 #include <vector>
 
 BEGIN_NAMESPACE
@@ -20,75 +23,101 @@ class RandomAccessMemory::Impl final {
 
         m_watcher.RecordAccessType(MemoryAccessType::Read);
 
-        if (m_memory.size() < address) {
+        std::shared_lock lock { m_growthMutex };
+        if (address >= m_memory.size()) {
             return Empty_data_unit;
         }
 
         return m_memory[address];
     }
 
-    DataBlock< DataUnit > ReadBlock(Address start, std::uint64_t dataUnitCount) {
+    void ReadBlock(Address start, std::span< DataUnit > data) {
         m_debugObject.LogTrace(LogType::Other, "ReadBlock of memory starting from address: {} with length: {}", start,
-                               dataUnitCount);
+                               data.size());
 
-        auto data = DataBlock< DataUnit >(dataUnitCount, Empty_data_unit);
+        Preconditions(start + data.size() - 1);
 
-        // Adjust reading range in order not to overflow
-        const auto currentSize  = m_memory.size();
-        const auto blockEndAddr = start + dataUnitCount;
+        m_watcher.RecordAccessType(MemoryAccessType::ReadBlock);
 
-        Preconditions(blockEndAddr - 1);
+        std::shared_lock lock { m_growthMutex };
+        CopyAllocated(start, data);
+    }
+
+    DataView< DataUnit > ViewBlock(Address start, std::uint64_t dataUnitCount) {
+        m_debugObject.LogTrace(LogType::Other, "ViewBlock of memory starting from address: {} with length: {}", start,
+                               dataUnitCount);
+        Preconditions(start + dataUnitCount - 1);
 
         m_watcher.RecordAccessType(MemoryAccessType::ReadBlock);
 
-        if (start >= currentSize) {
-            return data; // Empty memory location
+        // Growing the storage moves it, so it is only lent out once the memory reached its full size
+        std::shared_lock lock { m_growthMutex };
+        if (m_memory.size() == m_size) {
+            return DataView< DataUnit > { std::span< const DataUnit > { m_memory.data() + start, dataUnitCount } };
         }
 
-        auto startCopyLoc = m_memory.begin() + start;
-        if (blockEndAddr < currentSize) {
-            std::copy(startCopyLoc, startCopyLoc + dataUnitCount, data.Data());
-        } else {
-            std::copy(startCopyLoc, m_memory.end(), data.Data());
-        }
-        return data;
+        auto data = DataBlock< DataUnit >(dataUnitCount, Empty_data_unit);
+        CopyAllocated(start, std::span< DataUnit > { data.Data(), data.Size() });
+        return DataView< DataUnit > { std::move(data) };
     }
 
     void Write(Address address, DataUnit data) noexcept {
         m_debugObject.LogTrace(LogType::Other, "Write DataUnit: {} at address: {}", data, address);
         Preconditions(address);
 
-        if (address > m_memory.size()) {
-            m_memory.resize(address + 1, Empty_data_unit);
-        }
-
-        m_memory.at(address) = data;
+        auto lock = LockForWrite(address + 1);
+        m_memory[address] = data;
 
         // Wait until the end of the write because resize might throw
         m_watcher.RecordAccessType(MemoryAccessType::Write);
     }
 
-    void WriteBlock(Address start, const DataBlock< DataUnit >& data) {
+    void WriteBlock(Address start, std::span< const DataUnit > data) {
         m_debugObject.LogTrace(LogType::Other, "WriteBlock of DataUnits of size: {} starting from address: {}",
-                               data.Size(), start);
+                               data.size(), start);
 
-        const auto dataSize     = data.Size();
+        const auto dataSize     = data.size();
         const auto blockEndAddr = start + dataSize;
 
         // TODO: think about adding a Singleton<ErrorTracer> (?) to hold all possible error at runtime, and print stack
         // trace
         Preconditions(blockEndAddr - 1);
 
-        if (blockEndAddr > m_memory.size()) {
-            m_memory.resize(blockEndAddr, Empty_data_unit);
-        }
-
-        std::copy(begin(data), end(data), m_memory.begin() + start);
+        auto lock = LockForWrite(blockEndAddr);
+        std::copy(data.begin(), data.end(), m_memory.begin() + start);
 
         // Wait until the end of the write because resize might throw
         m_watcher.RecordAccessType(MemoryAccessType::WriteBlock);
     }
 
+    void ReadBytes(Address byteAddress, std::span< std::byte > data) noexcept {
+        m_debugObject.LogTrace(LogType::Other, "Read {} bytes of memory at byte address: {}", data.size(), byteAddress);
+        Preconditions((byteAddress + data.size() - 1) / sizeof(DataUnit));
+
+        m_watcher.RecordAccessType(MemoryAccessType::Read);
+
+        // Bytes past the allocated part of the memory were never written
+        std::shared_lock lock { m_growthMutex };
+        const auto       allocatedBytes = m_memory.size() * sizeof(DataUnit);
+        const auto       copiedBytes =
+            byteAddress < allocatedBytes ? std::min(data.size(), allocatedBytes - byteAddress) : 0;
+        std::fill(data.begin() + copiedBytes, data.end(), std::byte { 0 });
+        LoadBytes(m_memory, byteAddress, data.first(copiedBytes));
+    }
+
+    void WriteBytes(Address byteAddress, std::span< const std::byte > data) {
+        m_debugObject.LogTrace(LogType::Other, "Write {} bytes of memory at byte address: {}", data.size(), byteAddress);
+
+        const auto endAddr = (byteAddress + data.size() + sizeof(DataUnit) - 1) / sizeof(DataUnit);
+        Preconditions(endAddr - 1);
+
+        auto lock = LockForWrite(endAddr);
+        StoreBytes(m_memory, byteAddress, data);
+
+        // Wait until the end of the write because resize might throw
+        m_watcher.RecordAccessType(MemoryAccessType::Write);
+    }
+
     Address Size() const noexcept {
         return m_size;
     }
@@ -102,6 +131,34 @@ class RandomAccessMemory::Impl final {
         assert(addr < m_size && "Out of memory bound access, undefined behavior!");
     }
 
+    /// @brief Copies the data units starting at start, the caller holds the growth lock
+    void CopyAllocated(Address start, std::span< DataUnit > data) const noexcept {
+        // Data units past the allocated part of the memory were never written
+        const auto currentSize = m_memory.size();
+        const auto copiedCount = start < currentSize ? std::min< Address >(data.size(), currentSize - start) : 0;
+        if (copiedCount > 0) {
+            std::copy_n(m_memory.begin() + start, copiedCount, data.begin());
+        }
+        std::fill(data.begin() + copiedCount, data.end(), Empty_data_unit);
+    }
+
+    // Accesses share the lock, only growing the storage excludes them. Shared caches never write the same data
+    // unit from two processing units at once, each line being owned by one locked set.
+    [[nodiscard]] std::shared_lock< std::shared_mutex > LockForWrite(Address endAddr) {
+        std::shared_lock lock { m_growthMutex };
+        if (endAddr > m_memory.size()) {
+            lock.unlock();
+            {
+                std::unique_lock growthLock { m_growthMutex };
+                if (endAddr > m_memory.size()) {
+                    m_memory.resize(endAddr, Empty_data_unit);
+                }
+            }
+            lock.lock();
+        }
+        return lock;
+    }
+
     static std::pmr::vector< DataUnit > BuildInitialMemory(Address size) {
         if (size < Maximum_first_allocation_size) {
             return std::pmr::vector< DataUnit >(size, Empty_data_unit);
@@ -114,6 +171,7 @@ class RandomAccessMemory::Impl final {
 
     Address                      m_size;
     std::pmr::vector< DataUnit > m_memory;
+    std::shared_mutex            m_growthMutex;
     mutable MemoryWatcher        m_watcher;
     Object&                      m_debugObject;
 };
@@ -144,7 +202,18 @@ RandomAccessMemory::DataUnit RandomAccessMemory::Read(Address address) const noe
 
 DataBlock< RandomAccessMemory::DataUnit > RandomAccessMemory::ReadBlock(Address       start,
                                                                         std::uint64_t dataUnitCount) const {
-    return m_memory->ReadBlock(start, dataUnitCount);
+    auto data = DataBlock< DataUnit >(dataUnitCount, Empty_data_unit);
+    m_memory->ReadBlock(start, std::span< DataUnit > { data.Data(), data.Size() });
+    return data;
+}
+
+void RandomAccessMemory::ReadBlock(Address start, std::span< DataUnit > data) const {
+    return m_memory->ReadBlock(start, data);
+}
+
+DataView< RandomAccessMemory::DataUnit > RandomAccessMemory::ViewBlock(Address       start,
+                                                                       std::uint64_t dataUnitCount) const {
+    return m_memory->ViewBlock(start, dataUnitCount);
 }
 
 void RandomAccessMemory::Write(Address address, DataUnit data) noexcept {
@@ -152,9 +221,21 @@ void RandomAccessMemory::Write(Address address, DataUnit data) noexcept {
 }
 
 void RandomAccessMemory::WriteBlock(Address start, const DataBlock< DataUnit >& data) {
+    return m_memory->WriteBlock(start, std::span< const DataUnit > { data.Data(), data.Size() });
+}
+
+void RandomAccessMemory::WriteBlock(Address start, std::span< const DataUnit > data) {
     return m_memory->WriteBlock(start, data);
 }
 
+void RandomAccessMemory::ReadBytes(Address byteAddress, std::span< std::byte > data) const {
+    return m_memory->ReadBytes(byteAddress, data);
+}
+
+void RandomAccessMemory::WriteBytes(Address byteAddress, std::span< const std::byte > data) {
+    return m_memory->WriteBytes(byteAddress, data);
+}
+
 RandomAccessMemory::Address RandomAccessMemory::Size() const noexcept {
     return m_memory->Size();
 }
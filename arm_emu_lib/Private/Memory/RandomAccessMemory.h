@@ -5,6 +5,7 @@
     #include <Memory/IMemory.h>
     #include <Utility/UniqueRef.h>
     #include <memory>
+    #include <span>
 
 BEGIN_NAMESPACE
 
@@ -25,9 +26,15 @@ class [[nodiscard]] RandomAccessMemory final : public IMemory {
 
     [[nodiscard]] DataUnit              Read(Address address) const noexcept final;
     [[nodiscard]] DataBlock< DataUnit > ReadBlock(Address start, std::uint64_t dataUnitCount) const final;
+    void                                ReadBlock(Address start, std::span< DataUnit > data) const final;
+    [[nodiscard]] DataView< DataUnit >  ViewBlock(Address start, std::uint64_t dataUnitCount) const final;
 
     void Write(Address address, DataUnit data) noexcept final;
     void WriteBlock(Address start, const DataBlock< DataUnit >& data) final;
+    void WriteBlock(Address start, std::span< const DataUnit > data) final;
+
+    void ReadBytes(Address byteAddress, std::span< std::byte > data) const final;
+    void WriteBytes(Address byteAddress, std::span< const std::byte > data) final;
 
     [[nodiscard]] Address Size() const noexcept final;
 
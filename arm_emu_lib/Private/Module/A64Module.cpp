@@ -1,4 +1,5 @@
 
+#include <CPU/LoadBalancer.h>
 #include <Module/A64Module.h>
 #include <cassert>
 
@@ -6,29 +7,34 @@ BEGIN_NAMESPACE
 
 struct A64Module::A64CoreControl {
   public:
-    std::pmr::vector< std::uint32_t > m_load { 0 };
+    explicit A64CoreControl(LoadBalancingPolicy loadBalancingPolicy) noexcept : m_loadBalancer(loadBalancingPolicy) {
+    }
+
+    LoadBalancer m_loadBalancer;
 };
 
-[[nodiscard]] UniqueRef< A64Module::A64CoreControl > A64Module::ConstructCoreController() {
+[[nodiscard]] UniqueRef< A64Module::A64CoreControl >
+    A64Module::ConstructCoreController(LoadBalancingPolicy loadBalancingPolicy) {
     std::pmr::polymorphic_allocator< A64Module::A64CoreControl > alloc {};
 
-    return allocate_unique< A64Module::A64CoreControl >(alloc);
+    return allocate_unique< A64Module::A64CoreControl >(alloc, loadBalancingPolicy);
 }
 
-A64Module::A64Module(std::pmr::vector< UniqueRef< ICore > >&& cores, UniqueRef< ICacheMemory > cacheMemory) :
+A64Module::A64Module(std::pmr::vector< UniqueRef< ICore > >&& cores, UniqueRef< ICacheMemory > cacheMemory,
+                     LoadBalancingPolicy loadBalancingPolicy) :
     IModule(Default_name),
     m_cores(std::move(cores)),
     m_cacheMemory(std::move(cacheMemory)),
-    m_coreControl(ConstructCoreController()) {
+    m_coreControl(ConstructCoreController(loadBalancingPolicy)) {
     assert(m_cores.size() > 0 && "Can't construct a core with 0 processing units!");
 }
 
 A64Module::A64Module(std::string name, std::pmr::vector< UniqueRef< ICore > >&& cores,
-                     UniqueRef< ICacheMemory > cacheMemory) :
+                     UniqueRef< ICacheMemory > cacheMemory, LoadBalancingPolicy loadBalancingPolicy) :
     IModule(std::move(name)),
     m_cores(std::move(cores)),
     m_cacheMemory(std::move(cacheMemory)),
-    m_coreControl(ConstructCoreController()) {
+    m_coreControl(ConstructCoreController(loadBalancingPolicy)) {
     assert(m_cores.size() > 0 && "Can't construct a core with 0 processing units!");
 }
 
@@ -95,13 +101,27 @@ const IProcessingUnitWatcher& A64Module::GetProcessingUnitWatcher(std::uint8_t t
 }
 
 Result A64Module::Run(Program program) {
-    // TODO: load balance
-    return m_cores.at(0)->Run(std::move(program));
+    return Run(SelectThread(), std::move(program));
+}
+
+Result A64Module::Run(std::uint8_t threadNumber, Program program) {
+    CorePreConditions(threadNumber);
+    return m_cores.at(threadNumber)->Run(std::move(program));
 }
 
 ControlledResult A64Module::StepIn(Program program) {
-    // TODO: load balance
-    return m_cores.at(0)->StepIn(std::move(program));
+    return StepIn(SelectThread(), std::move(program));
+}
+
+ControlledResult A64Module::StepIn(std::uint8_t threadNumber, Program program) {
+    CorePreConditions(threadNumber);
+    return m_cores.at(threadNumber)->StepIn(std::move(program));
+}
+
+std::pmr::vector< Result > A64Module::RunBatch(std::uint8_t threadNumber, std::span< Program > programs,
+                                               ResultElementPool& resultPool) {
+    CorePreConditions(threadNumber);
+    return m_cores.at(threadNumber)->RunBatch(programs, resultPool);
 }
 
 void A64Module::Stop() {
@@ -124,4 +144,15 @@ void A64Module::CorePreConditions(std::uint8_t threadNumber) const noexcept {
     assert(m_cores.size() > threadNumber && threadNumber >= 0 && "Invalid core index!");
 }
 
+std::uint8_t A64Module::SelectThread() {
+    std::size_t coreQueueDepth = 0;
+    for (const auto& core : m_cores) {
+        coreQueueDepth += core->GetProcessingUnitWatcher().GetQueueDepth();
+    }
+
+    return static_cast< std::uint8_t >(m_coreControl->m_loadBalancer.Select(m_cores.size(), [&](std::size_t thread) {
+        return LoadBalancer::UnitLoad { m_cores[thread]->GetProcessingUnitWatcher().GetQueueDepth(), coreQueueDepth };
+    }));
+}
+
 END_NAMESPACE
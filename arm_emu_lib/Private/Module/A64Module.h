@@ -2,6 +2,7 @@
     #define A64MODULE_H_INCLUDED_E6D110A7_1B71_4E06_B788_DB8396E50CB3
 
     #include <API/Api.h>
+    #include <CPU/LoadBalancingPolicy.h>
     #include <Core/ICore.h>
     #include <Module/IModule.h>
     #include <Utility/UniqueRef.h>
@@ -15,8 +16,10 @@ class [[nodiscard]] A64Module : public IModule {
   public:
     static constexpr const char* Default_name = "A64Module";
 
-    A64Module(std::pmr::vector< UniqueRef< ICore > >&& cores, UniqueRef< ICacheMemory > cacheMemory);
-    A64Module(std::string name, std::pmr::vector< UniqueRef< ICore > >&& cores, UniqueRef< ICacheMemory > cacheMemory);
+    A64Module(std::pmr::vector< UniqueRef< ICore > >&& cores, UniqueRef< ICacheMemory > cacheMemory,
+              LoadBalancingPolicy loadBalancingPolicy = LoadBalancingPolicy::LeastLoaded);
+    A64Module(std::string name, std::pmr::vector< UniqueRef< ICore > >&& cores, UniqueRef< ICacheMemory > cacheMemory,
+              LoadBalancingPolicy loadBalancingPolicy = LoadBalancingPolicy::LeastLoaded);
     A64Module(A64Module&&) noexcept;
     A64Module& operator=(A64Module&&) noexcept;
     virtual ~A64Module();
@@ -43,21 +46,27 @@ class [[nodiscard]] A64Module : public IModule {
         GetCurrentProcessState(std::uint8_t threadNumber) const noexcept final;
 
     Result           Run(Program program) final;
+    Result           Run(std::uint8_t threadNumber, Program program) final;
     ControlledResult StepIn(Program program) final;
+    ControlledResult StepIn(std::uint8_t threadNumber, Program program) final;
     void             Stop() final;
     void             Reset() noexcept final;
 
+    std::pmr::vector< Result > RunBatch(std::uint8_t threadNumber, std::span< Program > programs,
+                                        ResultElementPool& resultPool) final;
+
     [[nodiscard]] std::uint8_t GetCoreCount() const noexcept final;
 
   private:
-    void CorePreConditions(std::uint8_t threadNumber) const noexcept;
+    void                       CorePreConditions(std::uint8_t threadNumber) const noexcept;
+    [[nodiscard]] std::uint8_t SelectThread();
 
     struct A64CoreControl;
     std::pmr::vector< UniqueRef< ICore > > m_cores;
     UniqueRef< ICacheMemory >              m_cacheMemory;
     UniqueRef< A64CoreControl >            m_coreControl;
 
-    [[nodiscard]] static UniqueRef< A64CoreControl > ConstructCoreController();
+    [[nodiscard]] static UniqueRef< A64CoreControl > ConstructCoreController(LoadBalancingPolicy loadBalancingPolicy);
 };
 
 END_NAMESPACE
@@ -37,10 +37,15 @@ class [[nodiscard]] IModule : public Object {
     [[nodiscard]] virtual const IProcessingUnitWatcher&
         GetProcessingUnitWatcher(std::uint8_t coreNumber) const noexcept = 0;
 
-    virtual Result           Run(Program program)    = 0;
-    virtual ControlledResult StepIn(Program program) = 0;
-    virtual void             Stop()                  = 0;
-    virtual void             Reset() noexcept        = 0;
+    virtual Result           Run(Program program)                             = 0;
+    virtual Result           Run(std::uint8_t coreNumber, Program program)    = 0;
+    virtual ControlledResult StepIn(Program program)                          = 0;
+    virtual ControlledResult StepIn(std::uint8_t coreNumber, Program program) = 0;
+    virtual void             Stop()                                           = 0;
+    virtual void             Reset() noexcept                                 = 0;
+
+    virtual std::pmr::vector< Result > RunBatch(std::uint8_t coreNumber, std::span< Program > programs,
+                                                ResultElementPool& resultPool) = 0;
 
     [[nodiscard]] virtual std::uint8_t GetCoreCount() const noexcept = 0;
 };
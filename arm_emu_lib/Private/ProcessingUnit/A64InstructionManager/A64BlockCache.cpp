@@ -0,0 +1,82 @@
+#include <Memory/MemoryWatcher.h>
+#include <ProcessingUnit/A64InstructionManager/A64BlockCache.h>
+#include <algorithm>
+#include <cassert>
+#include <variant>
+
+BEGIN_NAMESPACE
+
+A64BlockCache::A64BlockCache() noexcept : m_programMemory(nullptr), m_programWriteCount(0), m_blocks() {
+}
+
+void A64BlockCache::Attach(const IMemory* programMemory) {
+    m_programMemory = programMemory;
+    m_blocks.clear();
+    m_blocks.resize(programMemory ? programMemory->Size() : 0);
+    Invalidate();
+}
+
+A64BasicBlock* A64BlockCache::Fetch(IMemory::Address address, A64BasicBlock* predecessor) {
+    assert(m_programMemory && "Fetching from a block cache that is not attached to a program!");
+
+    // Program memory got written to since the last fetch, blocks and the chains between them might be stale
+    if (GetProgramWriteCount() != m_programWriteCount) {
+        Invalidate();
+        predecessor = nullptr;
+    }
+
+    if (predecessor) {
+        for (const auto& chain : predecessor->m_chains) {
+            if (chain.m_block && chain.m_address == address) {
+                return chain.m_block;
+            }
+        }
+    }
+
+    // Addresses outside the program are not worth caching, they are left for the caller to run one by one
+    if (address >= m_blocks.size()) {
+        return nullptr;
+    }
+
+    auto& block = m_blocks[address];
+    if (!block) {
+        block.emplace(Discover(address));
+    }
+
+    if (predecessor) {
+        predecessor->m_chains[1] = predecessor->m_chains[0];
+        predecessor->m_chains[0] = { address, std::addressof(*block) };
+    }
+    return std::addressof(*block);
+}
+
+void A64BlockCache::Invalidate() noexcept {
+    // Blocks are reset in place so the storage, and the chains pointing into it, stay put for the attached program
+    std::fill(m_blocks.begin(), m_blocks.end(), std::nullopt);
+    m_programWriteCount = m_programMemory ? GetProgramWriteCount() : 0;
+}
+
+std::size_t A64BlockCache::GetProgramWriteCount() const noexcept {
+    return m_programMemory->GetMemoryWatcher().GetAllWriteCount();
+}
+
+A64BasicBlock A64BlockCache::Discover(IMemory::Address address) const {
+    A64BasicBlock block { address, {}, {} };
+
+    for (auto current = address; current < m_blocks.size() && block.m_instructions.size() < Max_block_size;
+         ++current) {
+        const auto decodedInstruction =
+            A64InstructionManager::Decode(Instruction { m_programMemory->Read(current) });
+
+        block.m_instructions.push_back(decodedInstruction);
+
+        // The block ends after branches and after instructions that can't be decoded, the latter always fault
+        if (decodedInstruction.m_decodeGroup == A64DecodeGroup::BranchExceptionSystem ||
+            std::holds_alternative< A64ReservedGroup >(decodedInstruction.m_instructionType)) {
+            break;
+        }
+    }
+    return block;
+}
+
+END_NAMESPACE
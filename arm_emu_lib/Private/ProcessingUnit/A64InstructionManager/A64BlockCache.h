@@ -0,0 +1,73 @@
+#if !defined(A64BLOCKCACHE_H_INCLUDED_9B89008F_9DD9_442E_99D1_5A80AC388110)
+    #define A64BLOCKCACHE_H_INCLUDED_9B89008F_9DD9_442E_99D1_5A80AC388110
+
+    #include <API/Api.h>
+    #include <API/HiddenAPI.h>
+    #include <Memory/IMemory.h>
+    #include <ProcessingUnit/A64InstructionManager/A64InstructionManager.h>
+    #include <array>
+    #include <cstddef>
+    #include <cstdint>
+    #include <memory_resource>
+    #include <optional>
+    #include <vector>
+
+BEGIN_NAMESPACE
+
+/// @brief Straight line run of decoded instructions, ending at the first branch, exception or system instruction
+struct A64BasicBlock {
+    /// @brief Resolved link from the exit of a block to the block that followed it
+    struct Chain {
+        IMemory::Address m_address;
+        A64BasicBlock*   m_block;
+    };
+
+    IMemory::Address                          m_address;
+    std::pmr::vector< A64DecodedInstruction > m_instructions;
+    std::array< Chain, 2 >                    m_chains; // Most recent exits first, usually taken and not taken
+
+    // Host code of the block once it got hot, covering its first m_nativeCount instructions
+    std::uint32_t    m_executionCount { 0 };
+    const std::byte* m_nativeCode { nullptr };
+    std::size_t      m_nativeCount { 0 };
+};
+
+/// <summary>
+/// Per program cache of basic blocks, indexed by the program address of their first instruction.
+/// Blocks are discovered on first fetch, chained to their successors as they get resolved and dropped whenever the
+/// program memory is written to.
+/// </summary>
+class [[nodiscard]] A64BlockCache {
+  public:
+    /// @brief Upper bound on the instructions in a block, bounds the time between two interrupt checks
+    static constexpr std::size_t Max_block_size = 256;
+
+    A64BlockCache() noexcept;
+    DELETE_COPY_CLASS(A64BlockCache)
+    DEFAULT_MOVE_CLASS(A64BlockCache)
+    DEFAULT_DTOR(A64BlockCache)
+
+    /// @brief Binds the cache to a program memory, dropping all blocks
+    void Attach(const IMemory* programMemory);
+
+    /// @brief Returns the block starting at address, following the chains of predecessor when possible
+    /// @return nullptr if address is outside of the program
+    /// @note Blocks stay valid until the next invalidation, predecessor must come from the same cache
+    [[nodiscard]] A64BasicBlock* Fetch(IMemory::Address address, A64BasicBlock* predecessor = nullptr);
+
+    /// @brief Drops all blocks
+    void Invalidate() noexcept;
+
+  private:
+    [[nodiscard]] std::size_t GetProgramWriteCount() const noexcept;
+
+    [[nodiscard]] A64BasicBlock Discover(IMemory::Address address) const;
+
+    const IMemory*                                     m_programMemory;
+    std::size_t                                        m_programWriteCount;
+    std::pmr::vector< std::optional< A64BasicBlock > > m_blocks;
+};
+
+END_NAMESPACE
+
+#endif // !defined(A64BLOCKCACHE_H_INCLUDED_9B89008F_9DD9_442E_99D1_5A80AC388110)
@@ -0,0 +1,51 @@
+
+#include <Memory/MemoryWatcher.h>
+#include <ProcessingUnit/A64InstructionManager/A64DecodeCache.h>
+#include <algorithm>
+#include <cassert>
+
+BEGIN_NAMESPACE
+
+A64DecodeCache::A64DecodeCache() noexcept :
+    m_programMemory(nullptr), m_programWriteCount(0), m_entries(), m_outOfRangeEntry() {
+}
+
+void A64DecodeCache::Attach(const IMemory* programMemory) {
+    m_programMemory = programMemory;
+    m_entries.clear();
+    m_entries.resize(programMemory ? programMemory->Size() : 0);
+    Invalidate();
+}
+
+const A64DecodedInstruction& A64DecodeCache::Fetch(IMemory::Address address) {
+    assert(m_programMemory && "Fetching from a decode cache that is not attached to a program!");
+
+    // Program memory got written to since the last fetch, previously decoded entries might be stale
+    if (GetProgramWriteCount() != m_programWriteCount) {
+        Invalidate();
+    }
+
+    // Addresses outside the program are not worth caching, they are decoded on every fetch
+    if (address >= m_entries.size()) {
+        m_outOfRangeEntry.emplace(A64InstructionManager::Decode(Instruction { m_programMemory->Read(address) }));
+        return *m_outOfRangeEntry;
+    }
+
+    auto& entry = m_entries[address];
+    if (!entry) {
+        entry.emplace(A64InstructionManager::Decode(Instruction { m_programMemory->Read(address) }));
+    }
+    return *entry;
+}
+
+void A64DecodeCache::Invalidate() noexcept {
+    // Entries are reset in place so the storage, and references to it, stay put for the attached program
+    std::fill(m_entries.begin(), m_entries.end(), std::nullopt);
+    m_programWriteCount = m_programMemory ? GetProgramWriteCount() : 0;
+}
+
+std::size_t A64DecodeCache::GetProgramWriteCount() const noexcept {
+    return m_programMemory->GetMemoryWatcher().GetAllWriteCount();
+}
+
+END_NAMESPACE
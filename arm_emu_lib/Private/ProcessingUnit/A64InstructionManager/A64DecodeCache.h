@@ -0,0 +1,47 @@
+#if !defined(A64DECODECACHE_H_INCLUDED_B7B2954B_0023_47A8_A4C8_8E45801B8662)
+    #define A64DECODECACHE_H_INCLUDED_B7B2954B_0023_47A8_A4C8_8E45801B8662
+
+    #include <API/Api.h>
+    #include <API/HiddenAPI.h>
+    #include <Memory/IMemory.h>
+    #include <ProcessingUnit/A64InstructionManager/A64InstructionManager.h>
+    #include <cstdint>
+    #include <memory_resource>
+    #include <optional>
+    #include <vector>
+
+BEGIN_NAMESPACE
+
+/// <summary>
+/// Per program cache of decoded instructions, indexed by program address.
+/// Entries are decoded on first fetch and dropped whenever the program memory is written to.
+/// </summary>
+class [[nodiscard]] A64DecodeCache {
+  public:
+    A64DecodeCache() noexcept;
+    DELETE_COPY_CLASS(A64DecodeCache)
+    DEFAULT_MOVE_CLASS(A64DecodeCache)
+    DEFAULT_DTOR(A64DecodeCache)
+
+    /// @brief Binds the cache to a program memory, dropping all decoded entries
+    void Attach(const IMemory* programMemory);
+
+    /// @brief Returns the decoded instruction at address, reading and decoding it on a miss
+    /// @note For addresses inside the program, the returned reference stays valid until the next invalidation
+    [[nodiscard]] const A64DecodedInstruction& Fetch(IMemory::Address address);
+
+    /// @brief Drops all decoded entries
+    void Invalidate() noexcept;
+
+  private:
+    [[nodiscard]] std::size_t GetProgramWriteCount() const noexcept;
+
+    const IMemory*                                             m_programMemory;
+    std::size_t                                                m_programWriteCount;
+    std::pmr::vector< std::optional< A64DecodedInstruction > > m_entries;
+    std::optional< A64DecodedInstruction >                     m_outOfRangeEntry;
+};
+
+END_NAMESPACE
+
+#endif // !defined(A64DECODECACHE_H_INCLUDED_B7B2954B_0023_47A8_A4C8_8E45801B8662)
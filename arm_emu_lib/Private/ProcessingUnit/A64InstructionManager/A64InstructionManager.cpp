@@ -1,176 +1,103 @@
 
 #include <ProcessingUnit/A64InstructionManager/A64InstructionManager.h>
+#include <algorithm>
+#include <array>
+#include <utility>
 
 BEGIN_NAMESPACE
 
-Bitset A64InstructionManager::Get(const Instruction& instruction, Tag tag) noexcept {
-    switch (tag) {
-        case Tag::DecodeFields: {
-            return Bitset { 8, static_cast< std::uint8_t >(static_cast< std::uint32_t >(0b1111) &
-                                                           (instruction.Get() >> 25)) };
-        } break;
-        case Tag::Cond: {
-            return Bitset { 4, static_cast< std::uint8_t >(static_cast< std::uint32_t >(0b1111) &
-                                                           (instruction.Get() >> 0)) };
-        } break;
-        case Tag::Imm3: {
-            return Bitset { 3, static_cast< std::uint8_t >(static_cast< std::uint32_t >(0b111) &
-                                                           (instruction.Get() >> 10)) };
-        } break;
-        case Tag::Imm5: {
-            return Bitset { 5, static_cast< std::uint8_t >(static_cast< std::uint32_t >(0b11111) &
-                                                           (instruction.Get() >> 16)) };
-        } break;
-        case Tag::Imm6: {
-            return Bitset { 6, static_cast< std::uint8_t >(static_cast< std::uint32_t >(0b111111) &
-                                                           (instruction.Get() >> 10)) };
-        } break;
-        case Tag::Imm9: {
-            return Bitset { 9, static_cast< std::uint16_t >(static_cast< std::uint32_t >(0x1FF) &
-                                                            (instruction.Get() >> 12)) };
-        } break;
-        case Tag::Imm12: {
-            return Bitset { 12, static_cast< std::uint16_t >(static_cast< std::uint32_t >(0xFFF) &
-                                                             (instruction.Get() >> 10)) };
-        } break;
-        case Tag::Imm16: {
-            return Bitset { 16, static_cast< std::uint16_t >(static_cast< std::uint32_t >(0xFFFF) &
-                                                             (instruction.Get() >> 5)) };
-        } break;
-        case Tag::Imm19: {
-            return Bitset { 19, static_cast< std::uint32_t >(static_cast< std::uint32_t >(0x7FFFF) &
-                                                             (instruction.Get() >> 5)) };
-        } break;
-        case Tag::Imm26: {
-            return Bitset { 26, static_cast< std::uint32_t >(static_cast< std::uint32_t >(0x3FFFFFF) &
-                                                             (instruction.Get() >> 0)) };
-        } break;
-        case Tag::Immhi: {
-            return Bitset { 19, static_cast< std::uint32_t >(static_cast< std::uint32_t >(0x7FFFF) &
-                                                             (instruction.Get() >> 5)) };
-        } break;
-        case Tag::Immlo: {
-            return Bitset { 2, static_cast< std::uint8_t >(static_cast< std::uint32_t >(0b11) &
-                                                           (instruction.Get() >> 29)) };
-        } break;
-        case Tag::Imms: {
-            return Bitset { 6, static_cast< std::uint8_t >(static_cast< std::uint32_t >(0b111111) &
-                                                           (instruction.Get() >> 10)) };
-        } break;
-        case Tag::Immr: {
-            return Bitset { 6, static_cast< std::uint8_t >(static_cast< std::uint32_t >(0b111111) &
-                                                           (instruction.Get() >> 16)) };
-        } break;
-        case Tag::UImm4: {
-            return Bitset { 4, static_cast< std::uint8_t >(static_cast< std::uint32_t >(0b1111) &
-                                                           (instruction.Get() >> 10)) };
-        } break;
-        case Tag::UImm6: {
-            return Bitset { 6, static_cast< std::uint8_t >(static_cast< std::uint32_t >(0b111111) &
-                                                           (instruction.Get() >> 16)) };
-        } break;
-        case Tag::Hw: {
-            return Bitset { 2, static_cast< std::uint8_t >(static_cast< std::uint32_t >(0b11) &
-                                                           (instruction.Get() >> 21)) };
-        } break;
-        case Tag::Ra: {
-            return Bitset { 5, static_cast< std::uint8_t >(static_cast< std::uint32_t >(0b11111) &
-                                                           (instruction.Get() >> 10)) };
-        } break;
-        case Tag::Rd: {
-            return Bitset { 5, static_cast< std::uint8_t >(static_cast< std::uint32_t >(0b11111) &
-                                                           (instruction.Get() >> 0)) };
-        } break;
-        case Tag::Rm: {
-            return Bitset { 5, static_cast< std::uint8_t >(static_cast< std::uint32_t >(0b11111) &
-                                                           (instruction.Get() >> 0)) };
-        } break;
-        case Tag::Rn: {
-            return Bitset { 5, static_cast< std::uint8_t >(static_cast< std::uint32_t >(0b11111) &
-                                                           (instruction.Get() >> 5)) };
-        } break;
-        case Tag::Rt: {
-            return Bitset { 5, static_cast< std::uint8_t >(static_cast< std::uint32_t >(0b11111) &
-                                                           (instruction.Get() >> 0)) };
-        } break;
-        case Tag::Xd: {
-            return Bitset { 5, static_cast< std::uint8_t >(static_cast< std::uint32_t >(0b11111) &
-                                                           (instruction.Get() >> 0)) };
-        } break;
-        case Tag::Xn: {
-            return Bitset { 5, static_cast< std::uint8_t >(static_cast< std::uint32_t >(0b11111) &
-                                                           (instruction.Get() >> 5)) };
-        } break;
-        case Tag::Sh: {
-            return Bitset { 1, instruction.ReadBit(22) };
-        } break;
-        case Tag::CRm: {
-            return Bitset { 4, static_cast< std::uint8_t >(static_cast< std::uint32_t >(0b1111) &
-                                                           (instruction.Get() >> 8)) };
-        } break;
-        case Tag::CRn: {
-            return Bitset { 4, static_cast< std::uint8_t >(static_cast< std::uint32_t >(0b1111) &
-                                                           (instruction.Get() >> 12)) };
-        } break;
-        case Tag::Size: {
-            return Bitset { 2, static_cast< std::uint8_t >(static_cast< std::uint32_t >(0b11) &
-                                                           (instruction.Get() >> 30)) };
-        } break;
-        case Tag::Option: {
-            return Bitset { 3, static_cast< std::uint8_t >(static_cast< std::uint32_t >(0b111) &
-                                                           (instruction.Get() >> 13)) };
-        } break;
-        case Tag::Shift: {
-            return Bitset { 2, static_cast< std::uint8_t >(static_cast< std::uint32_t >(0b11) &
-                                                           (instruction.Get() >> 22)) };
-        } break;
-        case Tag::NZCV: {
-            return Bitset { 4, static_cast< std::uint8_t >(static_cast< std::uint32_t >(0b1111) &
-                                                           (instruction.Get() >> 0)) };
-        } break;
-        case Tag::A: {
-            return Bitset { 1, instruction.ReadBit(11) };
-        } break;
-        case Tag::L: {
-            return Bitset { 1, instruction.ReadBit(21) };
-        } break;
-        case Tag::M: {
-            return Bitset { 1, instruction.ReadBit(10) };
-        } break;
-        case Tag::N: {
-            return Bitset { 1, instruction.ReadBit(22) };
-        } break;
-        case Tag::S: {
-            return Bitset { 1, instruction.ReadBit(12) };
-        } break;
-        case Tag::Z: {
-            return Bitset { 1, instruction.ReadBit(24) };
-        } break;
-        case Tag::Op1: {
-            return Bitset { 3, static_cast< std::uint8_t >(static_cast< std::uint32_t >(0b111) &
-                                                           (instruction.Get() >> 16)) };
-        } break;
-        case Tag::Op2: {
-            return Bitset { 3, static_cast< std::uint8_t >(static_cast< std::uint32_t >(0b111) &
-                                                           (instruction.Get() >> 16)) };
-        } break;
-        case Tag::Opc: {
-            return Bitset { 2, static_cast< std::uint8_t >(static_cast< std::uint32_t >(0b11) &
-                                                           (instruction.Get() >> 10)) };
-        } break;
-        case Tag::O0: {
-            return Bitset { 1, instruction.ReadBit(19) };
-        } break;
-        default:
-            assert(false && "This code path should not be reachable!");
-            std::terminate();
+namespace {
+
+    using DecodeFunction = A64InstructionType (*)(const Instruction&);
+
+    template < class GroupType, auto InstructionClass >
+    A64InstructionType DecodeInstructionClass(const Instruction& instruction) {
+        return GroupType::GetInstance().template GetInstructionType< InstructionClass >(instruction);
+    }
+
+    template < class GroupType, std::size_t... InstructionClasses >
+    constexpr auto BuildDecodeTable(std::index_sequence< InstructionClasses... >) noexcept {
+        using InstructionGroup = typename GroupType::InstructionGroup;
+
+        return std::array< DecodeFunction, sizeof...(InstructionClasses) > {
+            &DecodeInstructionClass< GroupType, static_cast< InstructionGroup >(InstructionClasses) >...
+        };
+    }
+
+    template < class GroupType >
+    A64InstructionType DecodeInstructionType(const Instruction& instruction) {
+        using InstructionGroup = typename GroupType::InstructionGroup;
+
+        static constexpr auto decodeTable =
+            BuildDecodeTable< GroupType >(std::make_index_sequence< enum_size_v< InstructionGroup > > {});
+
+        const auto instructionClass =
+            static_cast< std::size_t >(GroupType::GetInstance().GetInstructionClass(instruction));
+
+        if (instructionClass >= decodeTable.size()) {
+            return A64ReservedGroup::Undefined;
+        }
+        return decodeTable[instructionClass](instruction);
     }
+
+} // namespace
+
+Bitset A64InstructionManager::Get(const Instruction& instruction, Tag tag) noexcept {
+    const auto layout = GetFieldLayout(tag);
+    const auto mask   = (static_cast< std::uint32_t >(1) << layout.m_width) - 1;
+
+    return Bitset { layout.m_width, (instruction.Get() >> layout.m_offset) & mask };
 }
 
 A64DecodeGroup A64InstructionManager::GetDecodeGroup(const Instruction& instruction) noexcept {
-    auto bits = Get(instruction, Tag::DecodeFields);
-    assert(bits.Size() == 8);
-    return A64DecodeGroupTable.Lookup(static_cast< std::uint8_t >(bits.ToULong()));
+    return A64DecodeGroupTable.Lookup(static_cast< std::uint8_t >(Extract< Tag::DecodeFields >(instruction)));
+}
+
+A64DecodedInstruction A64InstructionManager::Decode(const Instruction& instruction) noexcept {
+    const auto decodeGroup     = GetDecodeGroup(instruction);
+    const auto instructionType = [&]() -> A64InstructionType {
+        switch (decodeGroup) {
+            case A64DecodeGroup::Reserved: {
+                return ReservedGroup::GetInstance().GetInstructionClass(instruction);
+            } break;
+            case A64DecodeGroup::ScalableVectorExtension: {
+                // Faults as a not implemented feature once executed
+                return A64ReservedGroup::Undefined;
+            } break;
+            case A64DecodeGroup::DataProcessingImmediate: {
+                return DecodeInstructionType< DataProcessingImmediateGroup >(instruction);
+            } break;
+            case A64DecodeGroup::BranchExceptionSystem: {
+                return DecodeInstructionType< BranchExceptionSystemGroup >(instruction);
+            } break;
+            case A64DecodeGroup::LoadStore: {
+                return DecodeInstructionType< LoadStoreGroup >(instruction);
+            } break;
+            case A64DecodeGroup::DataProcessingRegister: {
+                return DecodeInstructionType< DataProcessingRegisterGroup >(instruction);
+            } break;
+            case A64DecodeGroup::DataProcessingScalarFloatingPointAdvancedSIMD: {
+                return DecodeInstructionType< DataProcessingScalarFloatingPointAdvancedSIMDGroup >(instruction);
+            } break;
+            default: {
+                return A64ReservedGroup::Undefined;
+            } break;
+        }
+    }();
+
+    return { instruction, decodeGroup, instructionType, GetIndex(instructionType) };
+}
+
+std::size_t A64InstructionManager::GetIndex(const A64InstructionType& instructionType) noexcept {
+    return std::visit(
+        [&](auto type) {
+            using InstructionType = decltype(type);
+
+            // Every undefined value of a leaf instruction class shares the last index of its class
+            const auto value = std::min(static_cast< std::size_t >(type), Index_count_of< InstructionType > - 1);
+            return Index_offsets[instructionType.index()] + value;
+        },
+        instructionType);
 }
 
 END_NAMESPACE
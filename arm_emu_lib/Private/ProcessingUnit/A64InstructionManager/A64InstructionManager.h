@@ -5,10 +5,120 @@
     #include <Instruction/Instruction.h>
     #include <InstructionSet/A64InstructionSet.h>
     #include <Utility/Bitset.h>
+    #include <array>
+    #include <cassert>
     #include <concepts>
+    #include <cstddef>
+    #include <cstdint>
+    #include <exception>
+    #include <utility>
+    #include <variant>
 
 BEGIN_NAMESPACE
 
+/// @brief Fully resolved instruction type, one alternative per leaf instruction class
+using A64InstructionType = std::variant<
+    A64ReservedGroup,
+    DataProcessingImmediateGroup::PCRelativeAddressing,
+    DataProcessingImmediateGroup::AddSubtractImmediate,
+    DataProcessingImmediateGroup::AddSubtractImmediateTag,
+    DataProcessingImmediateGroup::LogicalImmediate,
+    DataProcessingImmediateGroup::MoveWideImmediate,
+    DataProcessingImmediateGroup::Bitfield,
+    DataProcessingImmediateGroup::Extract,
+    BranchExceptionSystemGroup::ConditionalBranching,
+    BranchExceptionSystemGroup::ExceptionGeneration,
+    BranchExceptionSystemGroup::Hints,
+    BranchExceptionSystemGroup::Barriers,
+    BranchExceptionSystemGroup::PState,
+    BranchExceptionSystemGroup::SystemInstruction,
+    BranchExceptionSystemGroup::SystemRegisterMove,
+    BranchExceptionSystemGroup::UnconditionalBranchRegister,
+    BranchExceptionSystemGroup::UnconditionalBranchImmediate,
+    BranchExceptionSystemGroup::CompareAndBranchImmediate,
+    BranchExceptionSystemGroup::TestAndBranchImmediate,
+    LoadStoreGroup::AdvancedSIMDLoadStoreMultipleStructures,
+    LoadStoreGroup::AdvancedSIMDLoadStoreMultipleStructuresPostIndexed,
+    LoadStoreGroup::AdvancedSIMDLoadStoreSingleStructure,
+    LoadStoreGroup::AdvancedSIMDLoadStoreSingleStructurePostIndexed,
+    LoadStoreGroup::LoadStoreMemoryTag,
+    LoadStoreGroup::LoadStoreExclusive,
+    LoadStoreGroup::LdaprStlrUnscaledImmediate,
+    LoadStoreGroup::LoadRegisterLiteral,
+    LoadStoreGroup::LoadStoreNoAllocatePairOffset,
+    LoadStoreGroup::LoadStoreRegisterPairPostIndexed,
+    LoadStoreGroup::LoadStoreRegisterPairOffset,
+    LoadStoreGroup::LoadStoreRegisterPairPreIndexed,
+    LoadStoreGroup::LoadStoreRegisterUnscaledImmediate,
+    LoadStoreGroup::LoadStoreRegisterImmediatePostIndexed,
+    LoadStoreGroup::LoadStoreRegisterUnprivileged,
+    LoadStoreGroup::LoadStoreRegisterImmediatePreIndexed,
+    LoadStoreGroup::AtomicMemoryOperation,
+    LoadStoreGroup::LoadStoreRegisterRegisterOffset,
+    LoadStoreGroup::LoadStoreRegisterPAC,
+    LoadStoreGroup::LoadStoreRegisterUnsignedImmediate,
+    DataProcessingRegisterGroup::DataProcessingTwoSource,
+    DataProcessingRegisterGroup::DataProcessingOneSource,
+    DataProcessingRegisterGroup::LogicalShiftedRegister,
+    DataProcessingRegisterGroup::AddSubtractShiftedRegister,
+    DataProcessingRegisterGroup::AddSubtractExtendedRegister,
+    DataProcessingRegisterGroup::AddSubtractCarry,
+    DataProcessingRegisterGroup::RotateRightIntoFlags,
+    DataProcessingRegisterGroup::EvaluateIntoFlags,
+    DataProcessingRegisterGroup::ConditionalCompareRegister,
+    DataProcessingRegisterGroup::ConditionalCompareImmediate,
+    DataProcessingRegisterGroup::ConditionalSelect,
+    DataProcessingRegisterGroup::DataProcessingThreeSource,
+    DataProcessingScalarFloatingPointAdvancedSIMDGroup::CryptographicAES,
+    DataProcessingScalarFloatingPointAdvancedSIMDGroup::CryptographicThreeRegisterSHA,
+    DataProcessingScalarFloatingPointAdvancedSIMDGroup::CryptographicTwoRegisterSHA,
+    DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDScalarCopy,
+    DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDScalarThreeSameFP16,
+    DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDScalarTwoRegisterMiscellaneousFP16,
+    DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDScalarThreeSameExtraction,
+    DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDScalarTwoRegisterMiscellaneous,
+    DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDScalarPairwise,
+    DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDScalarThreeDifferent,
+    DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDScalarThreeSame,
+    DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDScalarShiftByImmediate,
+    DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDScalarXIndexedElement,
+    DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDTableLookup,
+    DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDPermute,
+    DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDExtract,
+    DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDCopy,
+    DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDThreeSameFP16,
+    DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDTwoRegisterMiscellaneousFP16,
+    DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDThreeRegisterExtension,
+    DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDTwoRegisterMiscellaneous,
+    DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDAcrossLanes,
+    DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDThreeDifferent,
+    DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDThreeSame,
+    DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDModifiedImmediate,
+    DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDShiftByImmediate,
+    DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDVectorXIndexedElement,
+    DataProcessingScalarFloatingPointAdvancedSIMDGroup::CryptographicThreeRegisterIMM2,
+    DataProcessingScalarFloatingPointAdvancedSIMDGroup::CryptographicThreeRegisterSHA512,
+    DataProcessingScalarFloatingPointAdvancedSIMDGroup::CryptographicFourRegister,
+    DataProcessingScalarFloatingPointAdvancedSIMDGroup::XAR,
+    DataProcessingScalarFloatingPointAdvancedSIMDGroup::CryptographicTwoRegisterSHA512,
+    DataProcessingScalarFloatingPointAdvancedSIMDGroup::ConversionFloatingPointAndFixedPoint,
+    DataProcessingScalarFloatingPointAdvancedSIMDGroup::ConversionFloatingPointAndInteger,
+    DataProcessingScalarFloatingPointAdvancedSIMDGroup::FloatingPointDataProcessingOneSource,
+    DataProcessingScalarFloatingPointAdvancedSIMDGroup::FloatingPointCompare,
+    DataProcessingScalarFloatingPointAdvancedSIMDGroup::FloatingPointImmediate,
+    DataProcessingScalarFloatingPointAdvancedSIMDGroup::FloatingPointConditionalCompare,
+    DataProcessingScalarFloatingPointAdvancedSIMDGroup::FloatingPointDataProcessingTwoSource,
+    DataProcessingScalarFloatingPointAdvancedSIMDGroup::FloatingPointConditionalSelect,
+    DataProcessingScalarFloatingPointAdvancedSIMDGroup::FloatingPointDataProcessingThreeSource >;
+
+/// @brief Result of decoding an instruction down to its leaf instruction type
+struct A64DecodedInstruction {
+    Instruction        m_instruction;
+    A64DecodeGroup     m_decodeGroup;
+    A64InstructionType m_instructionType;
+    std::size_t        m_instructionIndex; // Flat index of m_instructionType, see A64InstructionManager::GetIndex
+};
+
 struct A64InstructionManager {
     STATIC_CLASS(A64InstructionManager)
 
@@ -17,6 +127,7 @@ struct A64InstructionManager {
         DecodeFields,
 
         Cond,
+        CondHi,
 
         Imm3,
         Imm5,
@@ -69,9 +180,143 @@ struct A64InstructionManager {
         O0,
     };
 
+    /// @brief Position of a Tag field inside an instruction
+    struct FieldLayout {
+        std::uint32_t m_offset;
+        std::uint32_t m_width;
+    };
+
+    [[nodiscard]] static constexpr FieldLayout GetFieldLayout(Tag tag) noexcept {
+        switch (tag) {
+            case Tag::DecodeFields:
+                return { 25, 4 };
+            case Tag::Cond:
+                return { 0, 4 };
+            case Tag::CondHi: // cond of the conditional compare and select forms
+                return { 12, 4 };
+            case Tag::Imm3:
+                return { 10, 3 };
+            case Tag::Imm5:
+                return { 16, 5 };
+            case Tag::Imm6:
+                return { 10, 6 };
+            case Tag::Imm9:
+                return { 12, 9 };
+            case Tag::Imm12:
+                return { 10, 12 };
+            case Tag::Imm16:
+                return { 5, 16 };
+            case Tag::Imm19:
+                return { 5, 19 };
+            case Tag::Imm26:
+                return { 0, 26 };
+            case Tag::Immhi:
+                return { 5, 19 };
+            case Tag::Immlo:
+                return { 29, 2 };
+            case Tag::Imms:
+                return { 10, 6 };
+            case Tag::Immr:
+                return { 16, 6 };
+            case Tag::UImm4:
+                return { 10, 4 };
+            case Tag::UImm6:
+                return { 16, 6 };
+            case Tag::Hw:
+                return { 21, 2 };
+            case Tag::Ra:
+                return { 10, 5 };
+            case Tag::Rd:
+                return { 0, 5 };
+            case Tag::Rm:
+                return { 16, 5 };
+            case Tag::Rn:
+                return { 5, 5 };
+            case Tag::Rt:
+                return { 0, 5 };
+            case Tag::Xd:
+                return { 0, 5 };
+            case Tag::Xn:
+                return { 5, 5 };
+            case Tag::Sh:
+                return { 22, 1 };
+            case Tag::CRm:
+                return { 8, 4 };
+            case Tag::CRn:
+                return { 12, 4 };
+            case Tag::Size:
+                return { 30, 2 };
+            case Tag::Option:
+                return { 13, 3 };
+            case Tag::Shift:
+                return { 22, 2 };
+            case Tag::NZCV:
+                return { 0, 4 };
+            case Tag::A:
+                return { 11, 1 };
+            case Tag::L:
+                return { 21, 1 };
+            case Tag::M:
+                return { 10, 1 };
+            case Tag::N:
+                return { 22, 1 };
+            case Tag::S:
+                return { 12, 1 };
+            case Tag::Z:
+                return { 24, 1 };
+            case Tag::Op1:
+                return { 16, 3 };
+            case Tag::Op2:
+                return { 5, 3 };
+            case Tag::Opc:
+                return { 10, 2 };
+            case Tag::O0:
+                return { 19, 1 };
+            default:
+                assert(false && "This code path should not be reachable!");
+                std::terminate();
+        }
+    }
+
+    /// @brief Extracts a Tag field as a plain integer, the field position is resolved at compile time
+    template < Tag FieldTag >
+    [[nodiscard]] static constexpr std::uint32_t Extract(const Instruction& instruction) noexcept {
+        constexpr auto Layout = GetFieldLayout(FieldTag);
+        constexpr auto Mask   = (static_cast< std::uint32_t >(1) << Layout.m_width) - 1;
+
+        return (instruction.Get() >> Layout.m_offset) & Mask;
+    }
+
+    /// @brief Extracts a Tag field as a Bitset sized to the field, prefer Extract on the execution path
     [[nodiscard]] static Bitset Get(const Instruction& instruction, Tag tag) noexcept;
 
     [[nodiscard]] static A64DecodeGroup GetDecodeGroup(const Instruction& instruction) noexcept;
+
+    /// @brief Resolves the instruction down to its leaf instruction type, A64ReservedGroup::Undefined if it can't be
+    /// resolved
+    [[nodiscard]] static A64DecodedInstruction Decode(const Instruction& instruction) noexcept;
+
+    /// @brief Number of indices reserved for a leaf instruction class, the last one is for its Undefined type
+    template < class InstructionType >
+    static constexpr std::size_t Index_count_of = static_cast< std::size_t >(enum_size_v< InstructionType >) + 1;
+
+    /// @brief First index reserved for each alternative of A64InstructionType
+    static constexpr auto Index_offsets = []< std::size_t... Alternatives >(std::index_sequence< Alternatives... >) {
+        std::array< std::size_t, sizeof...(Alternatives) + 1 > offsets {};
+        std::size_t                                            offset      = 0;
+        std::size_t                                            alternative = 0;
+        ((offsets[alternative++] = std::exchange(
+              offset, offset + Index_count_of< std::variant_alternative_t< Alternatives, A64InstructionType > >)),
+         ...);
+        offsets[alternative] = offset;
+        return offsets;
+    }(std::make_index_sequence< std::variant_size_v< A64InstructionType > > {});
+
+    /// @brief Number of distinct flat instruction indices
+    static constexpr std::size_t Index_count = Index_offsets.back();
+
+    /// @brief Maps a leaf instruction type to a flat index in [0, Index_count)
+    [[nodiscard]] static std::size_t GetIndex(const A64InstructionType& instructionType) noexcept;
 };
 
 END_NAMESPACE
@@ -0,0 +1,72 @@
+#include <ProcessingUnit/A64Jit/ExecutableMemory.h>
+#include <cstring>
+
+#if defined(ARMEMU_OS_LINUX)
+    #include <sys/mman.h>
+#endif
+
+BEGIN_NAMESPACE
+
+ExecutableMemory::ExecutableMemory(std::size_t capacity) noexcept : m_base(nullptr), m_capacity(capacity), m_size(0) {
+}
+
+ExecutableMemory::~ExecutableMemory() {
+    if (!m_base) {
+        return;
+    }
+#if defined(ARMEMU_OS_WINDOWS)
+    ::VirtualFree(m_base, 0, MEM_RELEASE);
+#else
+    ::munmap(m_base, m_capacity);
+#endif
+}
+
+const std::byte* ExecutableMemory::Append(std::span< const std::byte > code) noexcept {
+    if ((!m_base && !Map()) || code.size() > m_capacity - m_size || !Protect(false)) {
+        return nullptr;
+    }
+
+    auto* start = m_base + m_size;
+    std::memcpy(start, code.data(), code.size());
+    m_size += code.size();
+
+    // Should the arena stay writable, nothing can run from it anyway
+    if (!Protect(true)) {
+        return nullptr;
+    }
+#if defined(ARMEMU_OS_WINDOWS)
+    ::FlushInstructionCache(::GetCurrentProcess(), start, code.size());
+#endif
+    return start;
+}
+
+void ExecutableMemory::Clear() noexcept {
+    m_size = 0;
+}
+
+bool ExecutableMemory::Map() noexcept {
+#if defined(ARMEMU_OS_WINDOWS)
+    auto* base = ::VirtualAlloc(nullptr, m_capacity, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+    if (!base) {
+        return false;
+    }
+#else
+    auto* base = ::mmap(nullptr, m_capacity, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED) {
+        return false;
+    }
+#endif
+    m_base = static_cast< std::byte* >(base);
+    return true;
+}
+
+bool ExecutableMemory::Protect(bool executable) noexcept {
+#if defined(ARMEMU_OS_WINDOWS)
+    DWORD previous;
+    return ::VirtualProtect(m_base, m_capacity, executable ? PAGE_EXECUTE_READ : PAGE_READWRITE, &previous) != 0;
+#else
+    return ::mprotect(m_base, m_capacity, executable ? PROT_READ | PROT_EXEC : PROT_READ | PROT_WRITE) == 0;
+#endif
+}
+
+END_NAMESPACE
@@ -0,0 +1,42 @@
+#if !defined(EXECUTABLEMEMORY_H_INCLUDED_D259AEC1_8076_4F01_B5F1_55DCEB73157B)
+    #define EXECUTABLEMEMORY_H_INCLUDED_D259AEC1_8076_4F01_B5F1_55DCEB73157B
+
+    #include <API/Api.h>
+    #include <API/HiddenAPI.h>
+    #include <cstddef>
+    #include <span>
+
+BEGIN_NAMESPACE
+
+/// <summary>
+/// Arena of host code, mapped on first use and never writable and executable at the same time.
+/// Code is only appended, it all goes at once when the arena is cleared.
+/// </summary>
+class [[nodiscard]] ExecutableMemory {
+  public:
+    static constexpr std::size_t Default_capacity = 1 << 20;
+
+    explicit ExecutableMemory(std::size_t capacity = Default_capacity) noexcept;
+    DELETE_COPY_CLASS(ExecutableMemory)
+    DELETE_MOVE_CLASS(ExecutableMemory)
+    ~ExecutableMemory();
+
+    /// @brief Copies code to the end of the arena
+    /// @return Start of the executable copy, nullptr if the arena is full or the host refused the mapping
+    [[nodiscard]] const std::byte* Append(std::span< const std::byte > code) noexcept;
+
+    /// @brief Drops all code, pointers returned by Append are dangling afterwards
+    void Clear() noexcept;
+
+  private:
+    [[nodiscard]] bool Map() noexcept;
+    [[nodiscard]] bool Protect(bool executable) noexcept;
+
+    std::byte*  m_base;
+    std::size_t m_capacity;
+    std::size_t m_size;
+};
+
+END_NAMESPACE
+
+#endif // !defined(EXECUTABLEMEMORY_H_INCLUDED_D259AEC1_8076_4F01_B5F1_55DCEB73157B)
@@ -0,0 +1,229 @@
+#include <ProcessingUnit/A64Jit/X64Assembler.h>
+#include <cassert>
+#include <limits>
+
+BEGIN_NAMESPACE
+
+namespace {
+
+    [[nodiscard]] constexpr std::uint8_t Encoding(X64Assembler::Reg reg) noexcept {
+        return static_cast< std::uint8_t >(reg);
+    }
+
+    // SPL, BPL, SIL and DIL are only reachable with a REX prefix, without it their encodings name AH, CH, DH and BH
+    [[nodiscard]] constexpr bool NeedsRexForByte(std::uint8_t reg) noexcept {
+        return reg >= 4 && reg < 8;
+    }
+
+    [[nodiscard]] constexpr bool FitsInt8(std::int32_t value) noexcept {
+        return value >= std::numeric_limits< std::int8_t >::min() && value <= std::numeric_limits< std::int8_t >::max();
+    }
+
+} // namespace
+
+X64Assembler::X64Assembler() noexcept : m_code(), m_labels(), m_fixups() {
+}
+
+void X64Assembler::Load(Width width, Reg destination, Reg base, std::int32_t displacement) {
+    assert(width != Width::Bits8 && "Byte loads are not encoded!");
+    EmitMemory(0x8B, width, Encoding(destination), base, displacement);
+}
+
+void X64Assembler::Store(Width width, Reg base, std::int32_t displacement, Reg source) {
+    EmitMemory(width == Width::Bits8 ? 0x88 : 0x89, width, Encoding(source), base, displacement);
+}
+
+void X64Assembler::StoreImmediate(Width width, Reg base, std::int32_t displacement, std::int32_t immediate) {
+    if (width == Width::Bits8) {
+        EmitMemory(0xC6, width, 0, base, displacement);
+        EmitByte(static_cast< std::uint8_t >(immediate));
+    } else {
+        EmitMemory(0xC7, width, 0, base, displacement);
+        EmitDword(static_cast< std::uint32_t >(immediate));
+    }
+}
+
+void X64Assembler::LoadAddress(Reg destination, Reg base, std::int32_t displacement) {
+    EmitMemory(0x8D, Width::Bits64, Encoding(destination), base, displacement);
+}
+
+void X64Assembler::MoveImmediate(Reg destination, std::uint64_t immediate) {
+    const auto reg = Encoding(destination);
+    if (immediate <= std::numeric_limits< std::uint32_t >::max()) {
+        // Writing the low half clears the upper one
+        EmitRex(Width::Bits32, 0, reg);
+        EmitByte(0xB8 + (reg & 7));
+        EmitDword(static_cast< std::uint32_t >(immediate));
+    } else if (const auto value = static_cast< std::int64_t >(immediate);
+               value >= std::numeric_limits< std::int32_t >::min() && value < 0) {
+        EmitRegister(0xC7, Width::Bits64, 0, destination);
+        EmitDword(static_cast< std::uint32_t >(immediate));
+    } else {
+        EmitRex(Width::Bits64, 0, reg);
+        EmitByte(0xB8 + (reg & 7));
+        EmitDword(static_cast< std::uint32_t >(immediate));
+        EmitDword(static_cast< std::uint32_t >(immediate >> 32));
+    }
+}
+
+void X64Assembler::Move(Width width, Reg destination, Reg source) {
+    EmitRegister(0x89, width, Encoding(source), destination);
+}
+
+void X64Assembler::MoveSignExtend(Width width, Reg destination, Reg source, std::uint32_t bits) {
+    switch (bits) {
+        case 8:
+            EmitRegister(0x0FBE, width, Encoding(destination), source, NeedsRexForByte(Encoding(source)));
+            break;
+        case 16:
+            EmitRegister(0x0FBF, width, Encoding(destination), source);
+            break;
+        case 32:
+            assert(width == Width::Bits64 && "Sign extending 32 bits into 32 bits!");
+            EmitRegister(0x63, width, Encoding(destination), source);
+            break;
+        default:
+            assert(false && "Unreachable code path!");
+            break;
+    }
+}
+
+void X64Assembler::Alu(AluOp op, Width width, Reg destination, Reg source) {
+    EmitRegister(static_cast< std::uint8_t >(static_cast< std::uint8_t >(op) << 3 | 0x01), width, Encoding(source),
+                 destination);
+}
+
+void X64Assembler::AluImmediate(AluOp op, Width width, Reg destination, std::int32_t immediate) {
+    if (FitsInt8(immediate)) {
+        EmitRegister(0x83, width, static_cast< std::uint8_t >(op), destination);
+        EmitByte(static_cast< std::uint8_t >(immediate));
+    } else {
+        EmitRegister(0x81, width, static_cast< std::uint8_t >(op), destination);
+        EmitDword(static_cast< std::uint32_t >(immediate));
+    }
+}
+
+void X64Assembler::Shift(ShiftOp op, Width width, Reg destination, std::uint8_t amount) {
+    EmitRegister(0xC1, width, static_cast< std::uint8_t >(op), destination);
+    EmitByte(amount);
+}
+
+void X64Assembler::Not(Width width, Reg destination) {
+    EmitRegister(0xF7, width, 2, destination);
+}
+
+void X64Assembler::Negate(Width width, Reg destination) {
+    EmitRegister(0xF7, width, 3, destination);
+}
+
+void X64Assembler::Multiply(Width width, Reg destination, Reg source) {
+    EmitRegister(0x0FAF, width, Encoding(destination), source);
+}
+
+void X64Assembler::Test(Width width, Reg first, Reg second) {
+    const bool forceRex =
+        width == Width::Bits8 && (NeedsRexForByte(Encoding(first)) || NeedsRexForByte(Encoding(second)));
+    EmitRegister(width == Width::Bits8 ? 0x84 : 0x85, width, Encoding(second), first, forceRex);
+}
+
+void X64Assembler::Push(Reg source) {
+    EmitRex(Width::Bits32, 0, Encoding(source));
+    EmitByte(0x50 + (Encoding(source) & 7));
+}
+
+void X64Assembler::Pop(Reg destination) {
+    EmitRex(Width::Bits32, 0, Encoding(destination));
+    EmitByte(0x58 + (Encoding(destination) & 7));
+}
+
+void X64Assembler::Call(Reg target) {
+    EmitRegister(0xFF, Width::Bits32, 2, target);
+}
+
+void X64Assembler::Return() {
+    EmitByte(0xC3);
+}
+
+X64Assembler::Label X64Assembler::CreateLabel() {
+    m_labels.push_back(Unbound);
+    return Label { m_labels.size() - 1 };
+}
+
+void X64Assembler::Bind(Label label) {
+    assert(m_labels[label.m_index] == Unbound && "Label is bound twice!");
+    m_labels[label.m_index] = m_code.size();
+}
+
+void X64Assembler::Jump(Label label) {
+    EmitByte(0xE9);
+    EmitBranch(label);
+}
+
+void X64Assembler::Jump(Condition condition, Label label) {
+    EmitByte(0x0F);
+    EmitByte(0x80 | static_cast< std::uint8_t >(condition));
+    EmitBranch(label);
+}
+
+std::span< const std::byte > X64Assembler::Finish() {
+    for (const auto& [offset, index] : m_fixups) {
+        const auto target = m_labels[index];
+        if (target == Unbound) {
+            return {};
+        }
+
+        // Displacements are relative to the end of the branch, which ends with them
+        const auto displacement = static_cast< std::uint32_t >(static_cast< std::int64_t >(target) -
+                                                               static_cast< std::int64_t >(offset + 4));
+        for (std::size_t i = 0; i < 4; ++i) {
+            m_code[offset + i] = static_cast< std::byte >(displacement >> (8 * i));
+        }
+    }
+    m_fixups.clear();
+    return m_code;
+}
+
+void X64Assembler::EmitByte(std::uint8_t byte) {
+    m_code.push_back(static_cast< std::byte >(byte));
+}
+
+void X64Assembler::EmitDword(std::uint32_t dword) {
+    for (std::size_t i = 0; i < 4; ++i) {
+        EmitByte(static_cast< std::uint8_t >(dword >> (8 * i)));
+    }
+}
+
+void X64Assembler::EmitRex(Width width, std::uint8_t reg, std::uint8_t rm, bool forceRex) {
+    const std::uint8_t rex = 0x40 | (width == Width::Bits64 ? 0x08 : 0) | ((reg >> 3) & 1) << 2 | ((rm >> 3) & 1);
+    if (rex != 0x40 || forceRex) {
+        EmitByte(rex);
+    }
+}
+
+void X64Assembler::EmitRegister(std::uint16_t opcode, Width width, std::uint8_t reg, Reg rm, bool forceRex) {
+    EmitRex(width, reg, Encoding(rm), forceRex);
+    if (opcode > 0xFF) {
+        EmitByte(static_cast< std::uint8_t >(opcode >> 8));
+    }
+    EmitByte(static_cast< std::uint8_t >(opcode));
+    EmitByte(0xC0 | (reg & 7) << 3 | (Encoding(rm) & 7));
+}
+
+void X64Assembler::EmitMemory(std::uint8_t opcode, Width width, std::uint8_t reg, Reg base,
+                              std::int32_t displacement) {
+    EmitRex(width, reg, Encoding(base), width == Width::Bits8 && NeedsRexForByte(reg));
+    EmitByte(opcode);
+    EmitByte(0x80 | (reg & 7) << 3 | (Encoding(base) & 7));
+    // RSP and R12 as a base take a SIB byte
+    if ((Encoding(base) & 7) == 4) {
+        EmitByte(0x24);
+    }
+    EmitDword(static_cast< std::uint32_t >(displacement));
+}
+
+void X64Assembler::EmitBranch(Label label) {
+    m_fixups.emplace_back(m_code.size(), label.m_index);
+    EmitDword(0);
+}
+
+END_NAMESPACE
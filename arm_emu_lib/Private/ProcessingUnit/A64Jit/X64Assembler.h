@@ -0,0 +1,134 @@
+#if !defined(X64ASSEMBLER_H_INCLUDED_64235C6C_C4ED_454A_946A_8058FC2ED5CE)
+    #define X64ASSEMBLER_H_INCLUDED_64235C6C_C4ED_454A_946A_8058FC2ED5CE
+
+    #include <API/Api.h>
+    #include <API/HiddenAPI.h>
+    #include <cstddef>
+    #include <cstdint>
+    #include <memory_resource>
+    #include <span>
+    #include <utility>
+    #include <vector>
+
+    // Only x86-64 hosts run translated code, elsewhere the translator is never reached
+    #if defined(__x86_64__) || defined(_M_X64)
+        #define ARMEMU_JIT_X64
+    #endif
+
+BEGIN_NAMESPACE
+
+/// <summary>
+/// Encoder for the handful of x86-64 instructions the A64 block translator needs. Memory operands are always a base
+/// register plus a 32-bit displacement, branches always take a 32-bit displacement resolved once their label is bound.
+/// </summary>
+class [[nodiscard]] X64Assembler {
+  public:
+    enum class Reg : std::uint8_t
+    {
+        Rax,
+        Rcx,
+        Rdx,
+        Rbx,
+        Rsp,
+        Rbp,
+        Rsi,
+        Rdi,
+        R8,
+        R9,
+        R10,
+        R11,
+    };
+
+    // Operand size, 32-bit operations clear the upper half of their destination
+    enum class Width : std::uint8_t
+    {
+        Bits8,
+        Bits32,
+        Bits64,
+    };
+
+    // Values are the /digit of the 0x81 group, the register form opcode is derived from them
+    enum class AluOp : std::uint8_t
+    {
+        Add = 0,
+        Or  = 1,
+        And = 4,
+        Sub = 5,
+        Xor = 6,
+    };
+
+    // Values are the /digit of the 0xC1 group
+    enum class ShiftOp : std::uint8_t
+    {
+        Ror = 1,
+        Shl = 4,
+        Shr = 5,
+        Sar = 7,
+    };
+
+    enum class Condition : std::uint8_t
+    {
+        Zero    = 0x4,
+        NotZero = 0x5,
+    };
+
+    struct Label {
+        std::size_t m_index;
+    };
+
+    X64Assembler() noexcept;
+    DELETE_COPY_CLASS(X64Assembler)
+    DEFAULT_MOVE_CLASS(X64Assembler)
+    DEFAULT_DTOR(X64Assembler)
+
+    void Load(Width width, Reg destination, Reg base, std::int32_t displacement);
+    void Store(Width width, Reg base, std::int32_t displacement, Reg source);
+    void StoreImmediate(Width width, Reg base, std::int32_t displacement, std::int32_t immediate);
+    void LoadAddress(Reg destination, Reg base, std::int32_t displacement);
+
+    /// @brief Picks the shortest encoding of the 64-bit immediate
+    void MoveImmediate(Reg destination, std::uint64_t immediate);
+    void Move(Width width, Reg destination, Reg source);
+    /// @brief Sign extends the low bits of source into the width bits of destination
+    void MoveSignExtend(Width width, Reg destination, Reg source, std::uint32_t bits);
+
+    void Alu(AluOp op, Width width, Reg destination, Reg source);
+    void AluImmediate(AluOp op, Width width, Reg destination, std::int32_t immediate);
+    void Shift(ShiftOp op, Width width, Reg destination, std::uint8_t amount);
+    void Not(Width width, Reg destination);
+    void Negate(Width width, Reg destination);
+    void Multiply(Width width, Reg destination, Reg source);
+    void Test(Width width, Reg first, Reg second);
+
+    void Push(Reg source);
+    void Pop(Reg destination);
+    void Call(Reg target);
+    void Return();
+
+    [[nodiscard]] Label CreateLabel();
+    void                Bind(Label label);
+    void                Jump(Label label);
+    void                Jump(Condition condition, Label label);
+
+    /// @brief Resolves the branches and returns the encoded instructions
+    /// @return Empty if a branch targets a label that was never bound
+    [[nodiscard]] std::span< const std::byte > Finish();
+
+  private:
+    void EmitByte(std::uint8_t byte);
+    void EmitDword(std::uint32_t dword);
+    void EmitRex(Width width, std::uint8_t reg, std::uint8_t rm, bool forceRex = false);
+    void EmitRegister(std::uint16_t opcode, Width width, std::uint8_t reg, Reg rm, bool forceRex = false);
+    void EmitMemory(std::uint8_t opcode, Width width, std::uint8_t reg, Reg base, std::int32_t displacement);
+    void EmitBranch(Label label);
+
+    static constexpr std::size_t Unbound = static_cast< std::size_t >(-1);
+
+    std::pmr::vector< std::byte >                             m_code;
+    std::pmr::vector< std::size_t >                           m_labels; // Offset of each label, Unbound until bound
+    std::pmr::vector< std::pair< std::size_t, std::size_t > > m_fixups; // Offset of a displacement and its label
+};
+
+END_NAMESPACE
+
+#endif // !defined(X64ASSEMBLER_H_INCLUDED_64235C6C_C4ED_454A_946A_8058FC2ED5CE)
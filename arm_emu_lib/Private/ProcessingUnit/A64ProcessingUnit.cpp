@@ -2,18 +2,33 @@
 #include <Instruction/Instruction.h>
 #include <Interrupt/Interrupt.h>
 #include <Memory/MemoryManagementUnit.h>
+#include <ProcessingUnit/A64InstructionManager/A64BlockCache.h>
+#include <ProcessingUnit/A64InstructionManager/A64DecodeCache.h>
 #include <ProcessingUnit/A64InstructionManager/A64InstructionManager.h>
+#include <ProcessingUnit/A64Jit/ExecutableMemory.h>
+#include <ProcessingUnit/A64Jit/X64Assembler.h>
 #include <ProcessingUnit/A64ProcessingUnit.h>
 #include <ProcessingUnit/A64ProcessingUnitWatcher.h>
 #include <ProcessingUnit/A64Registers/GeneralRegisters.h>
 #include <ProcessingUnit/A64Registers/SystemRegisters.h>
+#include <ProcessingUnit/HostThreadPool.h>
+#include <ProcessingUnit/ProgramQueue.h>
+#include <ProcessingUnit/WorkStealingDomain.h>
 #include <Program/ResultElement.h>
-#include <Utility/Exceptions.h>
+#include <Program/ResultElementPool.h>
 #include <Utility/StreamableEnum.h>
+#include <algorithm>
+#include <array>
 #include <atomic>
+#include <bit>
+#include <concepts>
 #include <condition_variable>
-#include <queue>
+#include <cstddef>
+#include <optional>
 #include <set>
+#include <span>
+#include <utility>
+#include <variant>
 
 BEGIN_NAMESPACE
 
@@ -35,101 +50,197 @@ namespace {
 
     static constexpr const char* instructionLogStatement = "Executing instruction {} as {} from {} group!";
 
+    [[nodiscard]] constexpr IProcessingUnit::Fault ToFault(TranslationFault fault) noexcept {
+        switch (fault) {
+            case TranslationFault::None:
+                return IProcessingUnit::Fault::None;
+            case TranslationFault::UntrackedProcessingUnit:
+                return IProcessingUnit::Fault::UntrackedProcessingUnit;
+            case TranslationFault::UnmappedVirtualAddress:
+                return IProcessingUnit::Fault::TranslationFault;
+            case TranslationFault::InvalidPhysicalMemoryAccess:
+            default:
+                return IProcessingUnit::Fault::InvalidPhysicalMemoryAccess;
+        }
+    }
+
 } // namespace
 
 struct A64ProcessState : public A64ProcessingUnit::ProcessState {
   private:
-    struct ProgramState {
-        Program                        m_program;
-        bool                           m_stepIn;
-        std::weak_ptr< ResultElement > m_result;
+    static constexpr std::uint64_t Return_from_program = std::numeric_limits< std::uint64_t >::max();
+
+    using Fault = IProcessingUnit::Fault;
 
-        ProgramState(Program program, bool stepIn, std::weak_ptr< ResultElement > result) :
-            m_program(std::move(program)), m_stepIn(stepIn), m_result(result) {
+    /// @brief Data side memory port of the processing unit. Accesses go through the MMU and the cache hierarchy, or in
+    /// the flat memory model straight into the host buffer backing the process address space.
+    struct MemoryPort {
+
+        MemoryPort(ICacheMemory* const upStreamMemory, MemoryManagementUnitProxy* const mmu,
+                   std::span< IMemory::DataUnit > flatMemory, Fault* const fault) noexcept :
+            m_upStreamMemory(upStreamMemory), m_mmu(mmu), m_flatMemory(flatMemory), m_fault(fault) {
         }
+        ~MemoryPort() = default;
 
-        DEFAULT_MOVE_CLASS(ProgramState)
-        DEFAULT_DTOR(ProgramState)
-    };
+        [[nodiscard]] bool IsFlat() const noexcept {
+            return !m_flatMemory.empty();
+        }
 
-    static constexpr std::uint64_t Return_from_program = std::numeric_limits< std::uint64_t >::max();
+        [[nodiscard]] std::span< const IMemory::DataUnit > GetFlatMemory() const noexcept {
+            return m_flatMemory;
+        }
 
-    struct GPRegistersProxy : public GPRegisters {
+        /// @brief Reads the sizeof(T) bytes at the virtual byte address, nullopt if it faulted
+        template < class T >
+        [[nodiscard]] std::optional< T > Read(IMemory::Address virtualAddress) const {
+            if (IsFlat()) {
+                if (!IsInFlatMemory(virtualAddress, sizeof(T))) {
+                    return std::nullopt;
+                }
+                std::array< std::byte, sizeof(T) > bytes;
+                IMemory::LoadBytes(m_flatMemory, virtualAddress, bytes);
+                return IMemory::FromBytes< T >(bytes);
+            }
+
+            const auto firstCount = BytesInPage(virtualAddress, sizeof(T));
+            const auto first      = Translate(virtualAddress, firstCount);
+            if (!first) {
+                return std::nullopt;
+            }
+            if (firstCount == sizeof(T)) [[likely]] {
+                return m_upStreamMemory->Read< T >(*first);
+            }
 
-        GPRegistersProxy(const IProcessingUnit::ProcessState& PE, IMemory* const upStreamMemory,
-                         MemoryManagementUnitProxy* const mmu) :
-            GPRegisters(PE), m_upStreamMemory(upStreamMemory), m_mmu(mmu) {
+            // The rest of the access lies in the next page, which has a frame of its own
+            const auto second = Translate(virtualAddress + firstCount, sizeof(T) - firstCount);
+            if (!second) {
+                return std::nullopt;
+            }
+            std::array< std::byte, sizeof(T) > bytes;
+            const std::span< std::byte >       data { bytes };
+            m_upStreamMemory->ReadBytes(*first, data.first(firstCount));
+            m_upStreamMemory->ReadBytes(*second, data.subspan(firstCount));
+            return IMemory::FromBytes< T >(bytes);
         }
-        ~GPRegistersProxy() = default;
 
-        [[nodiscard]] auto X(const Bitset& loc) const {
-            if (loc == 31) {
-                return std::bitset< 64 >(
-                    static_cast< std::uint64_t >(m_upStreamMemory->Read(m_mmu->Translate(SP().to_ullong()))));
+        /// @brief Writes the sizeof(T) bytes at the virtual byte address, false if it faulted
+        template < class T >
+        bool Write(IMemory::Address virtualAddress, std::type_identity_t< T > data) {
+            if (IsFlat()) {
+                if (!IsInFlatMemory(virtualAddress, sizeof(T))) {
+                    return false;
+                }
+                IMemory::StoreBytes(m_flatMemory, virtualAddress, IMemory::ToBytes< T >(data));
+                return true;
             }
-            return GPRegisters::X(loc);
+
+            const auto firstCount = BytesInPage(virtualAddress, sizeof(T));
+            const auto first      = Translate(virtualAddress, firstCount);
+            if (!first) {
+                return false;
+            }
+            if (firstCount == sizeof(T)) [[likely]] {
+                m_upStreamMemory->Write< T >(*first, data);
+                return true;
+            }
+
+            // Both pages are translated before any byte is written, so a faulting store leaves memory untouched
+            const auto second = Translate(virtualAddress + firstCount, sizeof(T) - firstCount);
+            if (!second) {
+                return false;
+            }
+            const auto                         bytes = IMemory::ToBytes< T >(data);
+            const std::span< const std::byte > view { bytes };
+            m_upStreamMemory->WriteBytes(*first, view.first(firstCount));
+            m_upStreamMemory->WriteBytes(*second, view.subspan(firstCount));
+            return true;
         }
 
-        [[nodiscard]] auto W(const Bitset& loc) noexcept {
-            if (loc == 31) {
-                return std::bitset< 32 >(static_cast< std::uint32_t >(
-                    m_upStreamMemory->Read(m_mmu->Translate(SP().to_ullong())) & 0x00000000FFFFFFFF));
+      private:
+        [[nodiscard]] bool IsInFlatMemory(IMemory::Address virtualAddress, std::size_t byteCount) const noexcept {
+            // Guest addresses near the top of the address space would wrap the sum around
+            const auto size = m_flatMemory.size_bytes();
+            if (byteCount > size || virtualAddress > size - byteCount) {
+                RaiseFault(Fault::InvalidPhysicalMemoryAccess);
+                return false;
             }
-            return GPRegisters::W(loc);
+            return true;
         }
 
-        auto write(std::uint8_t loc, const std::uint64_t data) noexcept {
-            if (loc == 31) {
-                m_upStreamMemory->Write(m_mmu->Translate(SP().to_ullong()), data);
-                return;
+        /// @brief Bytes of the access in the page of its first byte, an access crossing into the next page is split
+        /// since the frames of consecutive pages need not be physically contiguous
+        [[nodiscard]] static std::size_t BytesInPage(IMemory::Address virtualAddress, std::size_t byteCount) noexcept {
+            constexpr auto pageBytes = MemoryManagementUnit::Page_size * sizeof(IMemory::DataUnit);
+            return std::min< std::size_t >(byteCount, pageBytes - virtualAddress % pageBytes);
+        }
+
+        /// @brief Translates the virtual byte address, the MMU maps the whole data units the access touches
+        [[nodiscard]] std::optional< IMemory::Address > Translate(IMemory::Address virtualAddress,
+                                                                  std::size_t      byteCount) const noexcept {
+            constexpr auto unitSize   = sizeof(IMemory::DataUnit);
+            const auto     unitOffset = virtualAddress % unitSize;
+            const auto     unitCount  = (unitOffset + byteCount + unitSize - 1) / unitSize;
+
+            const auto translation = m_mmu->TryTranslate(virtualAddress / unitSize, unitCount);
+            if (translation.m_fault != TranslationFault::None) {
+                RaiseFault(ToFault(translation.m_fault));
+                return std::nullopt;
             }
-            return GPRegisters::write(loc, data);
+            return translation.m_physicalAddress * unitSize + unitOffset;
         }
-        auto write(const Bitset& loc, const std::uint64_t data) noexcept {
-            auto mLoc = loc.ToULong();
-            if (mLoc == 31) {
-                m_upStreamMemory->Write(m_mmu->Translate(SP().to_ullong()), data);
-                return;
+
+        // Only the first fault of an instruction is kept, later ones are consequences of it. The faulting access
+        // returns a neutral value and the handler goes on, so its register writes still land in the final frame.
+        void RaiseFault(Fault fault) const noexcept {
+            if (*m_fault == Fault::None) {
+                *m_fault = fault;
             }
-            return GPRegisters::write(loc, data);
         }
-        auto write(const Bitset& loc, std::bitset< 64 > data) noexcept {
-            auto mLoc = loc.ToULong();
-            if (mLoc == 31) {
-                m_upStreamMemory->Write(m_mmu->Translate(SP().to_ullong()), data.to_ullong());
-                return;
+
+        ICacheMemory* const              m_upStreamMemory { nullptr };
+        MemoryManagementUnitProxy* const m_mmu { nullptr };
+        std::span< IMemory::DataUnit >   m_flatMemory {};
+        Fault* const                     m_fault { nullptr };
+    };
+
+    struct GPRegistersProxy : public GPRegisters {
+
+        GPRegistersProxy(const IProcessingUnit::ProcessState& PE, MemoryPort* const memory) :
+            GPRegisters(PE), m_memory(memory) {
+        }
+        ~GPRegistersProxy() = default;
+
+        [[nodiscard]] std::uint64_t X(std::uint32_t loc) const {
+            if (loc == 31) {
+                return m_memory->Read< std::uint64_t >(SP()).value_or(0);
             }
-            return GPRegisters::write(loc, data);
+            return GPRegisters::X(loc);
         }
-        auto write(const Bitset& loc, const std::uint32_t data) noexcept {
-            auto mLoc = loc.ToULong();
-            if (mLoc == 31) {
-                m_upStreamMemory->Write(m_mmu->Translate(SP().to_ullong()), static_cast< std::uint64_t >(data));
-                return;
+
+        [[nodiscard]] std::uint32_t W(std::uint32_t loc) const noexcept {
+            if (loc == 31) {
+                return m_memory->Read< std::uint32_t >(SP()).value_or(0);
             }
-            return GPRegisters::write(loc, data);
+            return GPRegisters::W(loc);
         }
-        auto write(const Bitset& loc, const std::bitset< 32 >& data) noexcept {
-            auto mLoc = loc.ToULong();
-            if (mLoc == 31) {
-                m_upStreamMemory->Write(m_mmu->Translate(SP().to_ullong()), data.to_ullong());
+
+        auto write(std::uint32_t loc, const std::uint64_t data) noexcept {
+            if (loc == 31) {
+                m_memory->Write< std::uint64_t >(SP(), data);
                 return;
             }
             return GPRegisters::write(loc, data);
         }
-        auto write(const Bitset& loc, const Bitset& data) noexcept {
-            auto mLoc = loc.ToULong();
-            if (mLoc == 31) {
-                assert(data.Size() <= 64);
-                m_upStreamMemory->Write(m_mmu->Translate(SP().to_ullong()), data.ToULLong());
+        auto write(std::uint32_t loc, const std::uint32_t data) noexcept {
+            if (loc == 31) {
+                m_memory->Write< std::uint32_t >(SP(), data);
                 return;
             }
             return GPRegisters::write(loc, data);
         }
 
       private:
-        IMemory* const                   m_upStreamMemory { nullptr };
-        MemoryManagementUnitProxy* const m_mmu { nullptr };
+        MemoryPort* const m_memory { nullptr };
     };
 
     decltype(auto) PC() {
@@ -156,188 +267,181 @@ struct A64ProcessState : public A64ProcessingUnit::ProcessState {
         m_gpRegisters.WSP(data);
     }
 
-    void WSP(const std::bitset< 32 >& data) noexcept {
-        m_gpRegisters.WSP(data);
+    std::uint32_t NZCV() const noexcept {
+        return m_gpRegisters.NZCV();
+    }
+
+    void SetNZCV(std::uint32_t nzcv) noexcept {
+        m_gpRegisters.SetNZCV(nzcv);
+    }
+
+    // Formatting the trace is skipped unless instruction logging is compiled in and enabled
+    template < typename InstructionType >
+    void LogInstruction(const Instruction& instruction, InstructionType instructionType,
+                        A64DecodeGroup decodeGroup) const {
+#if ARMEMU_TRACE_INSTRUCTIONS
+        if (Logger::IsEnabled(LogType::Instruction)) {
+            m_debugObject.Log(LogType::Instruction, instructionLogStatement,
+                              std::bitset< 32 > { instruction.Get() }.to_string(), Enum::ToChar(instructionType),
+                              Enum::ToChar(decodeGroup));
+        }
+#else  // ARMEMU_TRACE_INSTRUCTIONS
+        (void)instruction;
+        (void)instructionType;
+        (void)decodeGroup;
+#endif // ARMEMU_TRACE_INSTRUCTIONS
+    }
+
+    // Only the first fault of an instruction is kept, later ones are consequences of it.
+    // Raising a fault does not stop the handler, the run loop only checks it once the instruction is done: handlers
+    // return right after it, while register writes following a faulting helper call still land.
+    void RaiseFault(Fault fault) noexcept {
+        if (m_fault == Fault::None) {
+            m_fault = fault;
+        }
     }
 
-    std::bitset< 4 > NZCV() {
-        std::bitset< 4 > NZCV { 0000 };
-        NZCV.set(0, V[0]);
-        NZCV.set(1, C[0]);
-        NZCV.set(2, Z[0]);
-        NZCV.set(3, N[0]);
+    [[nodiscard]] bool CarryFlag() const noexcept {
+        return (m_gpRegisters.NZCV() >> 1) & 1;
+    }
 
-        return NZCV;
+    // AddWithCarry() for flag setting instructions, NZCV is evaluated lazily from the recorded operands
+    template < std::size_t N >
+    [[nodiscard]] std::uint64_t AddWithCarrySetFlags(std::uint64_t x, std::uint64_t y, bool carry_in) noexcept {
+        return m_gpRegisters.SetNZCVFromAdd(N, x, y, carry_in);
     }
 
-    void SetNZCV(const std::bitset< 4 >& nzcv) noexcept {
-        N.set(0, nzcv[3]);
-        Z.set(0, nzcv[2]);
-        C.set(0, nzcv[1]);
-        V.set(0, nzcv[0]);
+    template < std::size_t N >
+    void SetLogicalFlags(std::uint64_t result) noexcept {
+        m_gpRegisters.SetNZCVFromLogical(N, result);
     }
 
     void Execute(Instruction&& instruction, DataProcessingImmediateGroup::PCRelativeAddressing instructionType) {
-        const auto Rd    = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rd);
-        auto       immhi = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Immhi); // 19bits
-        auto       immlo = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Immlo); // 2bits
+        const auto Rd    = A64InstructionManager::Extract< A64InstructionManager::Tag::Rd >(instruction);
+        auto       immhi = A64InstructionManager::Extract< A64InstructionManager::Tag::Immhi >(instruction); // 19bits
+        auto       immlo = A64InstructionManager::Extract< A64InstructionManager::Tag::Immlo >(instruction); // 2bits
 
         switch (instructionType) {
             case DataProcessingImmediateGroup::PCRelativeAddressing::ADR: { // P.879
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingImmediateGroup::PCRelativeAddressing::ADR),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingImmediate));
+                LogInstruction(instruction, DataProcessingImmediateGroup::PCRelativeAddressing::ADR,
+                               A64DecodeGroup::DataProcessingImmediate);
 
-                std::bitset< 64 > imm;
-                std::bitset< 21 > temp_imm = Concat(immhi, immlo).ToULong();
-                imm                        = SignExtend< 64 >(temp_imm);
-
-                std::bitset< 64 > base     = PC();
-                std::uint64_t     new_addr = base.to_ullong() + imm.to_ullong();
+                const auto    imm      = SignExtend< 64 >((immhi << 2) | immlo, 21);
+                const auto    base     = PC();
+                std::uint64_t new_addr = base + imm;
                 m_gpRegisters.write(Rd, new_addr);
             } break;
             case DataProcessingImmediateGroup::PCRelativeAddressing::ADRP: { // P.880
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingImmediateGroup::PCRelativeAddressing::ADRP),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingImmediate));
-
-                std::bitset< 64 >      imm;
-                std::bitset< 21 + 12 > temp_imm = concate< 21, 12 >(Concat(immhi, immlo).ToULong(), 0);
-                imm                             = SignExtend< 64 >(temp_imm);
-
-                std::bitset< 64 > base = PC();
-                for (auto i = 0; i <= 11; i++) {
-                    base[i] = 0;
-                }
-                std::uint64_t new_addr = base.to_ullong() + imm.to_ullong();
+                LogInstruction(instruction, DataProcessingImmediateGroup::PCRelativeAddressing::ADRP,
+                               A64DecodeGroup::DataProcessingImmediate);
+
+                const auto    temp_imm = static_cast< std::uint64_t >((immhi << 2) | immlo) << 12;
+                const auto    imm      = SignExtend< 64 >(temp_imm, 21 + 12);
+                const auto    base     = PC() & ~Ones(12);
+                std::uint64_t new_addr = base + imm;
                 m_gpRegisters.write(Rd, new_addr);
             } break;
             default: {
-                throw undefined_instruction {};
+                return RaiseFault(Fault::UndefinedInstruction);
             } break;
         }
     }
     void Execute(Instruction&& instruction, DataProcessingImmediateGroup::AddSubtractImmediate instructionType) {
-        auto Rd    = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rd);
-        auto Rn    = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rn);
-        auto imm12 = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Imm12);
-        auto shift = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Sh);
+        auto Rd    = A64InstructionManager::Extract< A64InstructionManager::Tag::Rd >(instruction);
+        auto Rn    = A64InstructionManager::Extract< A64InstructionManager::Tag::Rn >(instruction);
+        auto imm12 = A64InstructionManager::Extract< A64InstructionManager::Tag::Imm12 >(instruction);
+        auto shift = A64InstructionManager::Extract< A64InstructionManager::Tag::Sh >(instruction);
 
         switch (instructionType) {
             case DataProcessingImmediateGroup::AddSubtractImmediate::ADDi_32BIT: { // P.867
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingImmediateGroup::AddSubtractImmediate::ADDi_32BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingImmediate));
+                LogInstruction(instruction, DataProcessingImmediateGroup::AddSubtractImmediate::ADDi_32BIT,
+                               A64DecodeGroup::DataProcessingImmediate);
 
                 constexpr auto datasize = 32;
 
-                std::bitset< datasize > imm;
+                std::uint64_t imm = 0;
                 if (shift) {
-                    imm = ZeroExtend< datasize >(concate< 12, 12 >(imm12.ToULong(), 0));
+                    imm = ZeroExtend< datasize >(imm12 << 12, 12 + 12);
                 } else {
-                    imm = ZeroExtend< datasize, 12 >(imm12.ToULong());
+                    imm = ZeroExtend< datasize >(imm12, 12);
                 }
                 const auto operand1 = Rn == 31 ? WSP() : m_gpRegisters.W(Rn);
-                auto [result, _]    = AddWithCarry(operand1, imm, 0);
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
+                auto [result, _]    = AddWithCarry< datasize >(operand1, imm, 0);
 
                 if (Rd == 31) {
-                    WSP(result);
+                    WSP(static_cast< std::uint32_t >(result));
                 } else {
-                    m_gpRegisters.write(Rd, result);
+                    m_gpRegisters.write(Rd, static_cast< std::uint32_t >(result));
                 }
             } break;
             case DataProcessingImmediateGroup::AddSubtractImmediate::ADDSi_32BIT: { // P.875
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingImmediateGroup::AddSubtractImmediate::ADDSi_32BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingImmediate));
+                LogInstruction(instruction, DataProcessingImmediateGroup::AddSubtractImmediate::ADDSi_32BIT,
+                               A64DecodeGroup::DataProcessingImmediate);
 
                 constexpr auto datasize = 32;
 
-                std::bitset< datasize > imm;
+                std::uint64_t imm = 0;
                 if (shift) {
-                    imm = ZeroExtend< datasize >(concate< 12, 12 >(imm12.ToULong(), 0));
+                    imm = ZeroExtend< datasize >(imm12 << 12, 12 + 12);
                 } else {
-                    imm = ZeroExtend< datasize, 12 >(imm12.ToULong());
+                    imm = ZeroExtend< datasize >(imm12, 12);
                 }
                 const auto operand1 = Rn == 31 ? WSP() : m_gpRegisters.W(Rn);
-                auto [result, nzcv] = AddWithCarry(operand1, imm, 0);
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
-                static_assert(std::is_same_v< decltype(nzcv), std::bitset< 4 > >);
-
-                SetNZCV(nzcv);
-                m_gpRegisters.write(Rd, result);
+                auto       result   = AddWithCarrySetFlags< datasize >(operand1, imm, 0);
+                m_gpRegisters.write(Rd, static_cast< std::uint32_t >(result));
             } break;
             case DataProcessingImmediateGroup::AddSubtractImmediate::SUBi_32BIT: { // P.1439
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingImmediateGroup::AddSubtractImmediate::SUBi_32BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingImmediate));
+                LogInstruction(instruction, DataProcessingImmediateGroup::AddSubtractImmediate::SUBi_32BIT,
+                               A64DecodeGroup::DataProcessingImmediate);
 
                 constexpr auto datasize = 32;
 
-                std::bitset< datasize > imm;
+                std::uint64_t imm = 0;
                 if (shift) {
-                    imm = ZeroExtend< datasize >(concate< 12, 12 >(imm12.ToULong(), 0));
+                    imm = ZeroExtend< datasize >(imm12 << 12, 12 + 12);
                 } else {
-                    imm = ZeroExtend< datasize, 12 >(imm12.ToULong());
+                    imm = ZeroExtend< datasize >(imm12, 12);
                 }
-                auto operand1 = Rn == 31 ? WSP() : m_gpRegisters.W(Rn);
-                auto operand2 = imm;
-                operand2.flip();
-                auto [result, _] = AddWithCarry(operand1, operand2, static_cast< std::uint32_t >(1));
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
+                auto operand1    = Rn == 31 ? WSP() : m_gpRegisters.W(Rn);
+                auto operand2    = NOT< datasize >(imm);
+                auto [result, _] = AddWithCarry< datasize >(operand1, operand2, static_cast< std::uint32_t >(1));
                 if (Rd == 31) {
-                    WSP(result);
+                    WSP(static_cast< std::uint32_t >(result));
                 } else {
-                    m_gpRegisters.write(Rd, result);
+                    m_gpRegisters.write(Rd, static_cast< std::uint32_t >(result));
                 }
             } break;
             case DataProcessingImmediateGroup::AddSubtractImmediate::SUBSi_32BIT: { // P.1449
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingImmediateGroup::AddSubtractImmediate::SUBSi_32BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingImmediate));
+                LogInstruction(instruction, DataProcessingImmediateGroup::AddSubtractImmediate::SUBSi_32BIT,
+                               A64DecodeGroup::DataProcessingImmediate);
 
                 constexpr auto datasize = 32;
 
-                std::bitset< datasize > imm;
+                std::uint64_t imm = 0;
                 if (shift) {
-                    imm = ZeroExtend< datasize >(concate< 12, 12 >(imm12.ToULong(), 0));
+                    imm = ZeroExtend< datasize >(imm12 << 12, 12 + 12);
                 } else {
-                    imm = ZeroExtend< datasize, 12 >(imm12.ToULong());
+                    imm = ZeroExtend< datasize >(imm12, 12);
                 }
                 const auto operand1 = Rn == 31 ? WSP() : m_gpRegisters.W(Rn);
-                auto       operand2 = imm;
-                operand2.flip();
-                auto [result, nzcv] = AddWithCarry(operand1, operand2, static_cast< std::uint32_t >(1));
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
-                static_assert(std::is_same_v< decltype(nzcv), std::bitset< 4 > >);
-
-                SetNZCV(nzcv);
-                m_gpRegisters.write(Rd, result);
+                const auto operand2 = NOT< datasize >(imm);
+                auto       result   = AddWithCarrySetFlags< datasize >(operand1, operand2, 1);
+                m_gpRegisters.write(Rd, static_cast< std::uint32_t >(result));
             } break;
             case DataProcessingImmediateGroup::AddSubtractImmediate::ADDi_64BIT: { // P.867
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingImmediateGroup::AddSubtractImmediate::ADDi_64BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingImmediate));
+                LogInstruction(instruction, DataProcessingImmediateGroup::AddSubtractImmediate::ADDi_64BIT,
+                               A64DecodeGroup::DataProcessingImmediate);
 
                 constexpr auto datasize = 64;
 
-                std::bitset< datasize > imm;
+                std::uint64_t imm = 0;
                 if (shift) {
-                    imm = ZeroExtend< datasize >(concate< 12, 12 >(imm12.ToULong(), 0));
+                    imm = ZeroExtend< datasize >(imm12 << 12, 12 + 12);
                 } else {
-                    imm = ZeroExtend< datasize, 12 >(imm12.ToULong());
+                    imm = ZeroExtend< datasize >(imm12, 12);
                 }
                 const auto operand1 = Rn == 31 ? SP() : m_gpRegisters.X(Rn);
-                auto [result, _]    = AddWithCarry(operand1, imm, 0);
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
+                auto [result, _]    = AddWithCarry< datasize >(operand1, imm, 0);
 
                 if (Rd == 31) {
                     SP() = result;
@@ -346,47 +450,37 @@ struct A64ProcessState : public A64ProcessingUnit::ProcessState {
                 }
             } break;
             case DataProcessingImmediateGroup::AddSubtractImmediate::ADDSi_64BIT: { // P.875
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingImmediateGroup::AddSubtractImmediate::ADDSi_64BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingImmediate));
+                LogInstruction(instruction, DataProcessingImmediateGroup::AddSubtractImmediate::ADDSi_64BIT,
+                               A64DecodeGroup::DataProcessingImmediate);
 
                 constexpr auto datasize = 64;
 
-                std::bitset< datasize > imm;
+                std::uint64_t imm = 0;
                 if (shift) {
-                    imm = ZeroExtend< datasize >(concate< 12, 12 >(imm12.ToULong(), 0));
+                    imm = ZeroExtend< datasize >(imm12 << 12, 12 + 12);
                 } else {
-                    imm = ZeroExtend< datasize, 12 >(imm12.ToULong());
+                    imm = ZeroExtend< datasize >(imm12, 12);
                 }
                 const auto operand1 = Rn == 31 ? SP() : m_gpRegisters.X(Rn);
 
-                const auto [result, nzcv] = AddWithCarry(operand1, imm, 0);
-                static_assert(std::is_same_v< decltype(result), const std::bitset< datasize > >);
-                static_assert(std::is_same_v< decltype(nzcv), const std::bitset< 4 > >);
-
-                SetNZCV(nzcv);
+                const auto result = AddWithCarrySetFlags< datasize >(operand1, imm, 0);
                 m_gpRegisters.write(Rd, result);
             } break;
             case DataProcessingImmediateGroup::AddSubtractImmediate::SUBi_64BIT: { // P.1439
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingImmediateGroup::AddSubtractImmediate::SUBi_64BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingImmediate));
+                LogInstruction(instruction, DataProcessingImmediateGroup::AddSubtractImmediate::SUBi_64BIT,
+                               A64DecodeGroup::DataProcessingImmediate);
 
                 constexpr auto datasize = 64;
 
-                std::bitset< datasize > imm;
+                std::uint64_t imm = 0;
                 if (shift) {
-                    imm = ZeroExtend< datasize >(concate< 12, 12 >(imm12.ToULong(), 0));
+                    imm = ZeroExtend< datasize >(imm12 << 12, 12 + 12);
                 } else {
-                    imm = ZeroExtend< datasize, 12 >(imm12.ToULong());
+                    imm = ZeroExtend< datasize >(imm12, 12);
                 }
-                auto operand1 = Rn == 31 ? SP() : m_gpRegisters.X(Rn);
-                auto operand2 = imm;
-                operand2.flip();
-                const auto [result, _] = AddWithCarry(operand1, operand2, static_cast< std::uint64_t >(1));
-                static_assert(std::is_same_v< decltype(result), const std::bitset< datasize > >);
+                auto       operand1    = Rn == 31 ? SP() : m_gpRegisters.X(Rn);
+                auto       operand2    = NOT< datasize >(imm);
+                const auto [result, _] = AddWithCarry< datasize >(operand1, operand2, static_cast< std::uint64_t >(1));
 
                 if (Rd == 31) {
                     SP() = result;
@@ -395,155 +489,127 @@ struct A64ProcessState : public A64ProcessingUnit::ProcessState {
                 }
             } break;
             case DataProcessingImmediateGroup::AddSubtractImmediate::SUBSi_64BIT: { // P.1449
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingImmediateGroup::AddSubtractImmediate::SUBSi_64BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingImmediate));
+                LogInstruction(instruction, DataProcessingImmediateGroup::AddSubtractImmediate::SUBSi_64BIT,
+                               A64DecodeGroup::DataProcessingImmediate);
 
                 constexpr auto datasize = 64;
 
-                std::bitset< datasize > imm;
+                std::uint64_t imm = 0;
                 if (shift) {
-                    imm = ZeroExtend< datasize >(concate< 12, 12 >(imm12.ToULong(), 0));
-                } else
-                    imm = ZeroExtend< datasize, 12 >(imm12.ToULong());
-                auto operand1 = Rn == 31 ? SP() : m_gpRegisters.X(Rn);
-                auto operand2 = imm;
-                operand2.flip();
-                const auto [result, nzcv] = AddWithCarry(operand1, imm, static_cast< std::uint64_t >(1));
-                static_assert(std::is_same_v< decltype(result), const std::bitset< datasize > >);
-                static_assert(std::is_same_v< decltype(nzcv), const std::bitset< 4 > >);
-
-                SetNZCV(nzcv);
+                    imm = ZeroExtend< datasize >(imm12 << 12, 12 + 12);
+                } else {
+                    imm = ZeroExtend< datasize >(imm12, 12);
+                }
+                const auto operand1 = Rn == 31 ? SP() : m_gpRegisters.X(Rn);
+                const auto operand2 = NOT< datasize >(imm);
+                const auto result   = AddWithCarrySetFlags< datasize >(operand1, operand2, 1);
                 m_gpRegisters.write(Rd, result);
             } break;
             default: {
-                throw undefined_instruction {};
+                return RaiseFault(Fault::UndefinedInstruction);
             } break;
         }
     }
     void Execute(Instruction&& instruction, DataProcessingImmediateGroup::AddSubtractImmediateTag instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&& instruction, DataProcessingImmediateGroup::LogicalImmediate instructionType) {
-        auto Rd   = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rd);
-        auto Rn   = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rn);
-        auto imms = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Imms);
-        auto immr = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Immr);
-        auto N    = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::N);
+        auto Rd   = A64InstructionManager::Extract< A64InstructionManager::Tag::Rd >(instruction);
+        auto Rn   = A64InstructionManager::Extract< A64InstructionManager::Tag::Rn >(instruction);
+        auto imms = A64InstructionManager::Extract< A64InstructionManager::Tag::Imms >(instruction);
+        auto immr = A64InstructionManager::Extract< A64InstructionManager::Tag::Immr >(instruction);
+        auto N    = A64InstructionManager::Extract< A64InstructionManager::Tag::N >(instruction);
 
         switch (instructionType) {
             case DataProcessingImmediateGroup::LogicalImmediate::AND_32BIT: { // P.881
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingImmediateGroup::LogicalImmediate::AND_32BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingImmediate));
+                LogInstruction(instruction, DataProcessingImmediateGroup::LogicalImmediate::AND_32BIT,
+                               A64DecodeGroup::DataProcessingImmediate);
 
                 if (N != 0) {
-                    throw undefined_behaviour {};
+                    return RaiseFault(Fault::UndefinedBehaviour);
                 }
                 constexpr auto datasize = 32;
 
                 auto [imm, _] = DecodeBitMasks< datasize >(static_cast< bool >(N), imms, immr, true);
-                static_assert(std::is_same_v< decltype(imm), std::bitset< datasize > >);
                 auto operand1 = m_gpRegisters.W(Rn);
                 auto result   = operand1 & imm;
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
                 if (Rd == 31) {
-                    WSP(result);
+                    WSP(static_cast< std::uint32_t >(result));
                 } else {
-                    m_gpRegisters.write(Rd, result);
+                    m_gpRegisters.write(Rd, static_cast< std::uint32_t >(result));
                 }
             } break;
             case DataProcessingImmediateGroup::LogicalImmediate::ORR_32BIT: { // P.1240
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingImmediateGroup::LogicalImmediate::ORR_32BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingImmediate));
+                LogInstruction(instruction, DataProcessingImmediateGroup::LogicalImmediate::ORR_32BIT,
+                               A64DecodeGroup::DataProcessingImmediate);
 
                 if (N != 0) {
-                    throw undefined_behaviour {};
+                    return RaiseFault(Fault::UndefinedBehaviour);
                 }
                 constexpr auto datasize = 32;
 
                 auto [imm, _] = DecodeBitMasks< datasize >(static_cast< bool >(N), imms, immr, true);
 
-                static_assert(std::is_same_v< decltype(imm), std::bitset< datasize > >);
-
                 auto operand1 = m_gpRegisters.W(Rn);
                 auto result   = operand1 | imm;
 
                 if (Rd == 31) {
-                    WSP(result);
+                    WSP(static_cast< std::uint32_t >(result));
                 } else {
-                    m_gpRegisters.write(Rd, result);
+                    m_gpRegisters.write(Rd, static_cast< std::uint32_t >(result));
                 }
             } break;
             case DataProcessingImmediateGroup::LogicalImmediate::EOR_32BIT: { // P.1006
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingImmediateGroup::LogicalImmediate::EOR_32BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingImmediate));
+                LogInstruction(instruction, DataProcessingImmediateGroup::LogicalImmediate::EOR_32BIT,
+                               A64DecodeGroup::DataProcessingImmediate);
 
                 if (N != 0) {
-                    throw undefined_behaviour {};
+                    return RaiseFault(Fault::UndefinedBehaviour);
                 }
                 constexpr auto datasize = 32;
 
                 auto [imm, _] = DecodeBitMasks< datasize >(static_cast< bool >(N), imms, immr, true);
 
-                static_assert(std::is_same_v< decltype(imm), std::bitset< datasize > >);
-
                 auto operand1 = m_gpRegisters.W(Rn);
                 auto result   = operand1 xor imm;
 
                 if (Rd == 31) {
-                    WSP(result);
+                    WSP(static_cast< std::uint32_t >(result));
                 } else {
-                    m_gpRegisters.write(Rd, result);
+                    m_gpRegisters.write(Rd, static_cast< std::uint32_t >(result));
                 }
             } break;
             case DataProcessingImmediateGroup::LogicalImmediate::ANDS_32BIT: { // P.885
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingImmediateGroup::LogicalImmediate::ANDS_32BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingImmediate));
+                LogInstruction(instruction, DataProcessingImmediateGroup::LogicalImmediate::ANDS_32BIT,
+                               A64DecodeGroup::DataProcessingImmediate);
 
                 if (N == 0) {
-                    throw undefined_behaviour {};
+                    return RaiseFault(Fault::UndefinedBehaviour);
                 }
                 constexpr auto datasize = 32;
 
                 auto [imm, _] = DecodeBitMasks< datasize >(static_cast< bool >(N), imms, immr, true);
-                static_assert(std::is_same_v< decltype(imm), std::bitset< datasize > >);
 
                 auto operand1 = m_gpRegisters.W(Rn);
                 auto result   = operand1 & imm;
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
 
-                std::bitset< 4 > nzcv = concate< 2, 2 >(concate< 1, 1 >(result[31] ? 1 : 0, result == 0 ? 1 : 0), 0);
-                SetNZCV(nzcv);
+                SetLogicalFlags< datasize >(result);
                 if (Rd == 31) { // Documentation does not state SP as an option to Rd
-                    WSP(result);
+                    WSP(static_cast< std::uint32_t >(result));
                 } else {
-                    m_gpRegisters.write(Rd, result);
+                    m_gpRegisters.write(Rd, static_cast< std::uint32_t >(result));
                 }
             } break;
             case DataProcessingImmediateGroup::LogicalImmediate::AND_64BIT: { // P.881
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingImmediateGroup::LogicalImmediate::AND_64BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingImmediate));
+                LogInstruction(instruction, DataProcessingImmediateGroup::LogicalImmediate::AND_64BIT,
+                               A64DecodeGroup::DataProcessingImmediate);
 
                 constexpr auto datasize = 64;
 
                 auto [imm, _] = DecodeBitMasks< datasize >(static_cast< bool >(N), imms, immr, true);
 
-                static_assert(std::is_same_v< decltype(imm), std::bitset< datasize > >);
-
-                std::bitset< datasize > operand1 = m_gpRegisters.X(Rn);
-                auto                    result   = operand1 & imm;
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
+                auto operand1 = m_gpRegisters.X(Rn);
+                auto result   = operand1 & imm;
 
                 if (Rd == 31) {
                     SP() = result;
@@ -552,19 +618,15 @@ struct A64ProcessState : public A64ProcessingUnit::ProcessState {
                 }
             } break;
             case DataProcessingImmediateGroup::LogicalImmediate::ORR_64BIT: { // P.1240
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingImmediateGroup::LogicalImmediate::ORR_64BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingImmediate));
+                LogInstruction(instruction, DataProcessingImmediateGroup::LogicalImmediate::ORR_64BIT,
+                               A64DecodeGroup::DataProcessingImmediate);
 
                 constexpr auto datasize = 64;
 
                 auto [imm, _] = DecodeBitMasks< datasize >(static_cast< bool >(N), imms, immr, true);
 
-                static_assert(std::is_same_v< decltype(imm), std::bitset< datasize > >);
-
-                std::bitset< datasize > operand1 = m_gpRegisters.X(Rn);
-                auto                    result   = operand1 | imm;
+                auto operand1 = m_gpRegisters.X(Rn);
+                auto result   = operand1 | imm;
 
                 if (Rd == 31) {
                     SP() = result;
@@ -573,19 +635,15 @@ struct A64ProcessState : public A64ProcessingUnit::ProcessState {
                 }
             } break;
             case DataProcessingImmediateGroup::LogicalImmediate::EOR_64BIT: { // P.1006
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingImmediateGroup::LogicalImmediate::EOR_64BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingImmediate));
+                LogInstruction(instruction, DataProcessingImmediateGroup::LogicalImmediate::EOR_64BIT,
+                               A64DecodeGroup::DataProcessingImmediate);
 
                 constexpr auto datasize = 64;
 
                 auto [imm, _] = DecodeBitMasks< datasize >(static_cast< bool >(N), imms, immr, true);
 
-                static_assert(std::is_same_v< decltype(imm), std::bitset< datasize > >);
-
-                std::bitset< datasize > operand1 = m_gpRegisters.X(Rn);
-                auto                    result   = operand1 xor imm;
+                auto operand1 = m_gpRegisters.X(Rn);
+                auto result   = operand1 xor imm;
 
                 if (Rd == 31) {
                     SP() = result;
@@ -594,23 +652,18 @@ struct A64ProcessState : public A64ProcessingUnit::ProcessState {
                 }
             } break;
             case DataProcessingImmediateGroup::LogicalImmediate::ANDS_64BIT: { // // P.885
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingImmediateGroup::LogicalImmediate::ANDS_64BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingImmediate));
+                LogInstruction(instruction, DataProcessingImmediateGroup::LogicalImmediate::ANDS_64BIT,
+                               A64DecodeGroup::DataProcessingImmediate);
 
                 constexpr auto datasize = 64;
 
                 auto [imm, _] = DecodeBitMasks< datasize >(static_cast< bool >(N), imms, immr, true);
-                static_assert(std::is_same_v< decltype(imm), std::bitset< datasize > >);
 
-                std::bitset< datasize > operand1 = m_gpRegisters.X(Rn);
-                auto                    result   = operand1 & imm;
+                auto operand1 = m_gpRegisters.X(Rn);
+                auto result   = operand1 & imm;
 
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
 
-                std::bitset< 4 > nzcv = concate< 2, 2 >(concate< 1, 1 >(result[63] ? 1 : 0, result == 0 ? 1 : 0), 0);
-                SetNZCV(nzcv);
+                SetLogicalFlags< datasize >(result);
                 if (Rd == 31) { // Documentation does not state SP as an option to Rd
                     SP() = result;
                 } else {
@@ -618,780 +671,676 @@ struct A64ProcessState : public A64ProcessingUnit::ProcessState {
                 }
             } break;
             default: {
-                throw undefined_instruction {};
+                return RaiseFault(Fault::UndefinedInstruction);
             } break;
         }
     }
     void Execute(Instruction&& instruction, DataProcessingImmediateGroup::MoveWideImmediate instructionType) {
-        auto Rd    = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rd);
-        auto imm16 = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Imm16);
-        auto hw    = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Hw);
+        auto Rd    = A64InstructionManager::Extract< A64InstructionManager::Tag::Rd >(instruction);
+        auto imm16 = A64InstructionManager::Extract< A64InstructionManager::Tag::Imm16 >(instruction);
+        auto hw    = A64InstructionManager::Extract< A64InstructionManager::Tag::Hw >(instruction);
 
         switch (instructionType) {
             case DataProcessingImmediateGroup::MoveWideImmediate::MOVN_32BIT: { // P.1215
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingImmediateGroup::MoveWideImmediate::MOVN_32BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingImmediate));
+                LogInstruction(instruction, DataProcessingImmediateGroup::MoveWideImmediate::MOVN_32BIT,
+                               A64DecodeGroup::DataProcessingImmediate);
 
-                if (hw.ToULong() >= 2) {
-                    throw undefined_behaviour {};
+                if (hw >= 2) {
+                    return RaiseFault(Fault::UndefinedBehaviour);
                 }
                 constexpr auto datasize = 32;
 
-                const std::uint8_t      pos = hw.ToULong() << 4;
-                std::bitset< datasize > result { 0 };
-                const auto              imm16_ = imm16.ToULong();
-                for (auto i = pos; i < pos + 16; i++) {
-                    result[i] = static_cast< bool >((static_cast< std::uint16_t >(1) << (i - pos)) & imm16_);
-                }
-                result.flip();
+                const std::uint8_t pos    = hw << 4;
+                const auto         result = NOT< datasize >(static_cast< std::uint64_t >(imm16) << pos);
 
-                m_gpRegisters.write(Rd, result);
+                m_gpRegisters.write(Rd, static_cast< std::uint32_t >(result));
             } break;
             case DataProcessingImmediateGroup::MoveWideImmediate::MOVZ_32BIT: { // P.1217
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingImmediateGroup::MoveWideImmediate::MOVZ_32BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingImmediate));
+                LogInstruction(instruction, DataProcessingImmediateGroup::MoveWideImmediate::MOVZ_32BIT,
+                               A64DecodeGroup::DataProcessingImmediate);
 
-                if (hw.ToULong() >= 2) {
-                    throw undefined_behaviour {};
+                if (hw >= 2) {
+                    return RaiseFault(Fault::UndefinedBehaviour);
                 }
-                constexpr auto datasize = 32;
-
-                const std::uint8_t      pos = hw.ToULong() << 4;
-                std::bitset< datasize > result(0);
-                const auto              imm16_ = imm16.ToULong();
-                for (auto i = pos; i < pos + 16; i++) {
-                    result[i] = static_cast< bool >((static_cast< std::uint16_t >(1) << (i - pos)) & imm16_);
-                }
-                m_gpRegisters.write(Rd, result);
+                const std::uint8_t pos    = hw << 4;
+                const auto         result = static_cast< std::uint64_t >(imm16) << pos;
+                m_gpRegisters.write(Rd, static_cast< std::uint32_t >(result));
             } break;
             case DataProcessingImmediateGroup::MoveWideImmediate::MOVK_32BIT: { // P.1213
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingImmediateGroup::MoveWideImmediate::MOVK_32BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingImmediate));
+                LogInstruction(instruction, DataProcessingImmediateGroup::MoveWideImmediate::MOVK_32BIT,
+                               A64DecodeGroup::DataProcessingImmediate);
 
-                if (hw.ToULong() >= 2) {
-                    throw undefined_behaviour {};
+                if (hw >= 2) {
+                    return RaiseFault(Fault::UndefinedBehaviour);
                 }
                 constexpr auto datasize = 32;
 
-                const std::uint8_t pos    = hw.ToULong() << 4;
-                auto               result = m_gpRegisters.W(Rd);
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
-                const auto imm16_ = imm16.ToULong();
-                for (auto i = pos; i < pos + 16; i++) {
-                    result[i] = static_cast< bool >((static_cast< std::uint16_t >(1) << (i - pos)) & imm16_);
-                }
-                m_gpRegisters.write(Rd, result);
+                const std::uint8_t pos    = hw << 4;
+                const auto         result = (m_gpRegisters.W(Rd) & NOT< datasize >(Ones(16) << pos)) |
+                                            (static_cast< std::uint64_t >(imm16) << pos);
+                m_gpRegisters.write(Rd, static_cast< std::uint32_t >(result));
             } break;
             case DataProcessingImmediateGroup::MoveWideImmediate::MOVN_64BIT: { // P.1215
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingImmediateGroup::MoveWideImmediate::MOVN_64BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingImmediate));
+                LogInstruction(instruction, DataProcessingImmediateGroup::MoveWideImmediate::MOVN_64BIT,
+                               A64DecodeGroup::DataProcessingImmediate);
 
                 constexpr auto datasize = 64;
 
-                const std::uint8_t      pos = hw.ToULong() << 4;
-                std::bitset< datasize > result { 0 };
-                const auto              imm16_ = imm16.ToULLong();
-                for (auto i = pos; i < pos + 16; i++) {
-                    result[i] = static_cast< bool >(
-                        (static_cast< std::uint64_t >(static_cast< std::uint16_t >(1)) << (i - pos)) & imm16_);
-                }
-                result.flip();
+                const std::uint8_t pos    = hw << 4;
+                const auto         result = NOT< datasize >(static_cast< std::uint64_t >(imm16) << pos);
 
                 m_gpRegisters.write(Rd, result);
             } break;
             case DataProcessingImmediateGroup::MoveWideImmediate::MOVZ_64BIT: { // P.1217
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingImmediateGroup::MoveWideImmediate::MOVZ_64BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingImmediate));
-
-                constexpr auto datasize = 64;
+                LogInstruction(instruction, DataProcessingImmediateGroup::MoveWideImmediate::MOVZ_64BIT,
+                               A64DecodeGroup::DataProcessingImmediate);
 
-                const std::uint8_t      pos = hw.ToULong() << 4;
-                std::bitset< datasize > result(0);
-                const auto              imm16_ = imm16.ToULLong();
-                for (auto i = pos; i < pos + 16; i++) {
-                    result[i] = static_cast< bool >(
-                        (static_cast< std::uint64_t >(static_cast< std::uint16_t >(1)) << (i - pos)) & imm16_);
-                }
+                const std::uint8_t pos    = hw << 4;
+                const auto         result = static_cast< std::uint64_t >(imm16) << pos;
                 m_gpRegisters.write(Rd, result);
             } break;
             case DataProcessingImmediateGroup::MoveWideImmediate::MOVK_64BIT: { // P.1213
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingImmediateGroup::MoveWideImmediate::MOVK_64BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingImmediate));
+                LogInstruction(instruction, DataProcessingImmediateGroup::MoveWideImmediate::MOVK_64BIT,
+                               A64DecodeGroup::DataProcessingImmediate);
 
                 constexpr auto datasize = 64;
 
-                const std::uint8_t pos    = hw.ToULong() << 4;
-                auto               result = m_gpRegisters.X(Rd);
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
-                const auto imm16_ = imm16.ToULLong();
-                for (auto i = pos; i < pos + 16; i++) {
-                    result[i] = static_cast< bool >(
-                        (static_cast< std::uint64_t >(static_cast< std::uint16_t >(1)) << (i - pos)) & imm16_);
-                }
+                const std::uint8_t pos    = hw << 4;
+                const auto         result = (m_gpRegisters.X(Rd) & NOT< datasize >(Ones(16) << pos)) |
+                                            (static_cast< std::uint64_t >(imm16) << pos);
                 m_gpRegisters.write(Rd, result);
             } break;
             default: {
-                throw undefined_instruction {};
+                return RaiseFault(Fault::UndefinedInstruction);
             } break;
         }
     }
     void Execute(Instruction&& instruction, DataProcessingImmediateGroup::Bitfield instructionType) {
-        auto Rd   = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rd);
-        auto Rn   = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rn);
-        auto imms = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Imms);
-        auto immr = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Immr);
-        auto N    = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::N);
+        auto Rd   = A64InstructionManager::Extract< A64InstructionManager::Tag::Rd >(instruction);
+        auto Rn   = A64InstructionManager::Extract< A64InstructionManager::Tag::Rn >(instruction);
+        auto imms = A64InstructionManager::Extract< A64InstructionManager::Tag::Imms >(instruction);
+        auto immr = A64InstructionManager::Extract< A64InstructionManager::Tag::Immr >(instruction);
+        auto N    = A64InstructionManager::Extract< A64InstructionManager::Tag::N >(instruction);
 
         switch (instructionType) {
             case DataProcessingImmediateGroup::Bitfield::SBFM_32BIT: { // P.1288
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingImmediateGroup::Bitfield::SBFM_32BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingImmediate));
+                LogInstruction(instruction, DataProcessingImmediateGroup::Bitfield::SBFM_32BIT,
+                               A64DecodeGroup::DataProcessingImmediate);
 
                 constexpr auto datasize = 32;
 
-                auto R = static_cast< int >(immr.ToULong());
-                auto S = static_cast< int >(imms.ToULong());
+                auto R = static_cast< int >(immr);
+                auto S = static_cast< int >(imms);
 
                 auto [wmask, tmask] = DecodeBitMasks< datasize >(static_cast< bool >(Rn), imms, immr, false);
 
                 auto src = m_gpRegisters.W(Rn);
-                static_assert(std::is_same_v< decltype(src), std::bitset< datasize > >);
 
                 // perform bitfield move on low bits
                 auto bot = ROR< datasize >(src, R) & wmask;
 
                 // determine extension bits (sign, zero or dest register)
-                auto top = Replicate< datasize, 1 >(std::bitset< 1 > { src[S] });
+                auto top = Replicate((src >> S) & 1, 1, datasize);
 
                 // combine extension bits and result bits
-                auto bot_AND_tmask = bot & tmask;
-                tmask.flip();
-                auto top_AND_NOT_tmask = top & tmask;
+                auto bot_AND_tmask     = bot & tmask;
+                auto top_AND_NOT_tmask = top & NOT< datasize >(tmask);
 
-                m_gpRegisters.write(Rd, bot_AND_tmask | top_AND_NOT_tmask);
+                m_gpRegisters.write(Rd, static_cast< std::uint32_t >(bot_AND_tmask | top_AND_NOT_tmask));
             } break;
             case DataProcessingImmediateGroup::Bitfield::BFM_32BIT: { // P.910
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingImmediateGroup::Bitfield::BFM_32BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingImmediate));
+                LogInstruction(instruction, DataProcessingImmediateGroup::Bitfield::BFM_32BIT,
+                               A64DecodeGroup::DataProcessingImmediate);
 
-                if (N != 0 || immr[5] != 0 || imms[5] != 0)
-                    throw undefined_behaviour {};
+                if (N != 0 || (immr >> 5) != 0 || (imms >> 5) != 0)
+                    return RaiseFault(Fault::UndefinedBehaviour);
                 constexpr auto datasize = 32;
 
-                Bitset R = immr;
+                auto R = immr;
 
                 auto [wmask, tmask] = DecodeBitMasks< datasize >(static_cast< bool >(N), imms, immr, false);
-                static_assert(std::is_same_v< decltype(wmask), std::bitset< datasize > >);
-                static_assert(std::is_same_v< decltype(tmask), std::bitset< datasize > >);
 
-                std::bitset< datasize > dst = m_gpRegisters.W(Rd);
-                std::bitset< datasize > src = m_gpRegisters.W(Rn);
+                const auto dst = m_gpRegisters.W(Rd);
+                const auto src = m_gpRegisters.W(Rn);
 
-                std::bitset< datasize > bot = (dst & ~wmask) | (ROR< datasize >(src, R.ToULong()) & wmask);
+                const auto bot = (dst & NOT< datasize >(wmask)) | (ROR< datasize >(src, R) & wmask);
 
-                m_gpRegisters.write(Rd, (dst & ~tmask) | (bot & tmask));
+                m_gpRegisters.write(Rd, static_cast< std::uint32_t >((dst & NOT< datasize >(tmask)) | (bot & tmask)));
             } break;
             case DataProcessingImmediateGroup::Bitfield::UBFM_32BIT: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case DataProcessingImmediateGroup::Bitfield::SBFM_64BIT: { // P.1288
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingImmediateGroup::Bitfield::SBFM_64BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingImmediate));
+                LogInstruction(instruction, DataProcessingImmediateGroup::Bitfield::SBFM_64BIT,
+                               A64DecodeGroup::DataProcessingImmediate);
 
                 constexpr auto datasize = 64;
 
-                auto R = static_cast< int >(immr.ToULong());
-                auto S = static_cast< int >(imms.ToULong());
+                auto R = static_cast< int >(immr);
+                auto S = static_cast< int >(imms);
 
                 auto [wmask, tmask] = DecodeBitMasks< datasize >(static_cast< bool >(Rn), imms, immr, false);
 
                 auto src = m_gpRegisters.X(Rn);
-                static_assert(std::is_same_v< decltype(src), std::bitset< datasize > >);
 
                 // perform bitfield move on low bits
                 auto bot = ROR< datasize >(src, R) & wmask;
 
                 // determine extension bits (sign, zero or dest register)
-                auto top = Replicate< datasize, 1 >(std::bitset< 1 > { src[S] });
+                auto top = Replicate((src >> S) & 1, 1, datasize);
 
                 // combine extension bits and result bits
-                auto bot_AND_tmask = bot & tmask;
-                tmask.flip();
-                auto top_AND_NOT_tmask = top & tmask;
+                auto bot_AND_tmask     = bot & tmask;
+                auto top_AND_NOT_tmask = top & NOT< datasize >(tmask);
 
                 m_gpRegisters.write(Rd, bot_AND_tmask | top_AND_NOT_tmask);
             } break;
             case DataProcessingImmediateGroup::Bitfield::BFM_64BIT: { // P.910
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingImmediateGroup::Bitfield::BFM_64BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingImmediate));
+                LogInstruction(instruction, DataProcessingImmediateGroup::Bitfield::BFM_64BIT,
+                               A64DecodeGroup::DataProcessingImmediate);
 
                 if (N != 1)
-                    throw undefined_behaviour {};
+                    return RaiseFault(Fault::UndefinedBehaviour);
                 constexpr auto datasize = 64;
 
-                Bitset R = immr;
+                auto R = immr;
 
                 auto [wmask, tmask] = DecodeBitMasks< datasize >(static_cast< bool >(N), imms, immr, false);
-                static_assert(std::is_same_v< decltype(wmask), std::bitset< datasize > >);
-                static_assert(std::is_same_v< decltype(tmask), std::bitset< datasize > >);
 
-                std::bitset< datasize > dst = m_gpRegisters.X(Rd);
-                std::bitset< datasize > src = m_gpRegisters.X(Rn);
+                const auto dst = m_gpRegisters.X(Rd);
+                const auto src = m_gpRegisters.X(Rn);
 
-                std::bitset< datasize > bot = (dst & ~wmask) | (ROR< datasize >(src, static_cast< bool >(R)) & wmask);
+                const auto bot =
+                    (dst & NOT< datasize >(wmask)) | (ROR< datasize >(src, static_cast< bool >(R)) & wmask);
 
-                m_gpRegisters.write(Rd, (dst & ~tmask) | (bot & tmask));
+                m_gpRegisters.write(Rd, (dst & NOT< datasize >(tmask)) | (bot & tmask));
             } break;
             case DataProcessingImmediateGroup::Bitfield::UBFM_64BIT: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             default:
-                throw undefined_instruction {};
+                return RaiseFault(Fault::UndefinedInstruction);
                 break;
         }
     }
     void Execute(Instruction&& instruction, DataProcessingImmediateGroup::Extract instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
 
     void Execute(Instruction&& instruction, BranchExceptionSystemGroup::ConditionalBranching instructionType) {
-        auto cond  = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Cond);
-        auto imm19 = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Imm19);
+        auto cond  = A64InstructionManager::Extract< A64InstructionManager::Tag::Cond >(instruction);
+        auto imm19 = A64InstructionManager::Extract< A64InstructionManager::Tag::Imm19 >(instruction);
 
         switch (instructionType) {
             case BranchExceptionSystemGroup::ConditionalBranching::BCond: { // P.904
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(BranchExceptionSystemGroup::ConditionalBranching::BCond),
-                                  Enum::ToChar(A64DecodeGroup::BranchExceptionSystem));
+                LogInstruction(instruction, BranchExceptionSystemGroup::ConditionalBranching::BCond,
+                               A64DecodeGroup::BranchExceptionSystem);
 
-                std::bitset< 64 > offset =
-                    SignExtend< 64, 21 >(imm19.Concat(Bitset { 2, 0 }).ToULLong() / sizeof(IMemory::DataUnit));
+                // PC counts instructions, imm19 is already the offset in instructions
+                const auto offset = SignExtend< 64 >(imm19, 19);
                 const auto pc = PC() - 1;
                 if (ConditionHolds(cond, NZCV())) {
-                    BranchTo(pc + offset.to_ullong(), IProcessingUnit::BranchType::Dir);
+                    BranchTo(pc + offset, IProcessingUnit::BranchType::Dir);
                 }
             } break;
             default: {
-                throw undefined_instruction {};
+                return RaiseFault(Fault::UndefinedInstruction);
             } break;
         }
     }
     void Execute(Instruction&& instruction, BranchExceptionSystemGroup::ExceptionGeneration instructionType) {
-        auto imm16 = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Imm16);
+        auto imm16 = A64InstructionManager::Extract< A64InstructionManager::Tag::Imm16 >(instruction);
 
         switch (instructionType) {
             case BranchExceptionSystemGroup::ExceptionGeneration::SVC: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case BranchExceptionSystemGroup::ExceptionGeneration::HVC: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case BranchExceptionSystemGroup::ExceptionGeneration::SMC: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case BranchExceptionSystemGroup::ExceptionGeneration::BRK: { // P.925
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(BranchExceptionSystemGroup::ExceptionGeneration::BRK),
-                                  Enum::ToChar(A64DecodeGroup::BranchExceptionSystem));
+                LogInstruction(instruction, BranchExceptionSystemGroup::ExceptionGeneration::BRK,
+                               A64DecodeGroup::BranchExceptionSystem);
 
                 // TODO
                 // if (AArch64::HaveBTIExt()) always false
                 // SetBTypeCompatible(TRUE);
-                SoftwareBreakpoint(imm16.ToULong());
+                SoftwareBreakpoint(imm16);
             } break;
             case BranchExceptionSystemGroup::ExceptionGeneration::HLT: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case BranchExceptionSystemGroup::ExceptionGeneration::DCPS1: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case BranchExceptionSystemGroup::ExceptionGeneration::DCPS2: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case BranchExceptionSystemGroup::ExceptionGeneration::DCPS3: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             default: {
-                throw undefined_instruction {};
+                return RaiseFault(Fault::UndefinedInstruction);
             } break;
         }
     }
     void Execute(Instruction&& instruction, BranchExceptionSystemGroup::Hints instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&& instruction, BranchExceptionSystemGroup::Barriers instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&& instruction, BranchExceptionSystemGroup::PState instructionType) {
 
         switch (instructionType) {
             case BranchExceptionSystemGroup::PState::CFINV: {
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(BranchExceptionSystemGroup::PState::CFINV),
-                                  Enum::ToChar(A64DecodeGroup::BranchExceptionSystem));
+                LogInstruction(instruction, BranchExceptionSystemGroup::PState::CFINV,
+                               A64DecodeGroup::BranchExceptionSystem);
 
                 if (!HaveFlagManipulateExt()) {
-                    throw unsupported_instruction {};
+                    return RaiseFault(Fault::UnsupportedInstruction);
                 }
 
-                C = C;
+                m_gpRegisters.InvertCarryFlag();
             } break;
             case BranchExceptionSystemGroup::PState::XAFLAG: {
 
             } break;
             case BranchExceptionSystemGroup::PState::AXFLAG: {
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(BranchExceptionSystemGroup::PState::AXFLAG),
-                                  Enum::ToChar(A64DecodeGroup::BranchExceptionSystem));
+                LogInstruction(instruction, BranchExceptionSystemGroup::PState::AXFLAG,
+                               A64DecodeGroup::BranchExceptionSystem);
 
                 if (!HaveFlagManipulateExt())
-                    throw unsupported_instruction {};
+                    return RaiseFault(Fault::UnsupportedInstruction);
 
-                bool Z_ = (Z | V).any();
-                bool C_ = (C & ~V).any();
+                const auto nzcv = NZCV();
+                const bool Z_   = ((nzcv >> 2) & 1) || (nzcv & 1);
+                const bool C_   = ((nzcv >> 1) & 1) && !(nzcv & 1);
 
-                N = 0;
-                Z = Z_;
-                C = C_;
-                V = 0;
+                m_gpRegisters.SetNZCV(static_cast< std::uint32_t >(Z_) << 2 | static_cast< std::uint32_t >(C_) << 1);
             } break;
             default: {
-                throw undefined_instruction {};
+                return RaiseFault(Fault::UndefinedInstruction);
             } break;
         }
     }
     void Execute(Instruction&& instruction, BranchExceptionSystemGroup::SystemInstruction instructionType) {
-        auto Rt  = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rt);
-        auto op2 = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Op2);
-        auto CRm = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::CRm);
-        auto CRn = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::CRn);
-        auto op1 = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Op1);
-        auto L   = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::L);
+        auto Rt  = A64InstructionManager::Extract< A64InstructionManager::Tag::Rt >(instruction);
+        auto op2 = A64InstructionManager::Extract< A64InstructionManager::Tag::Op2 >(instruction);
+        auto CRm = A64InstructionManager::Extract< A64InstructionManager::Tag::CRm >(instruction);
+        auto CRn = A64InstructionManager::Extract< A64InstructionManager::Tag::CRn >(instruction);
+        auto op1 = A64InstructionManager::Extract< A64InstructionManager::Tag::Op1 >(instruction);
+        auto L   = A64InstructionManager::Extract< A64InstructionManager::Tag::L >(instruction);
 
         switch (instructionType) {
             case BranchExceptionSystemGroup::SystemInstruction::SYS: { // P.1465
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(BranchExceptionSystemGroup::SystemInstruction::SYS),
-                                  Enum::ToChar(A64DecodeGroup::BranchExceptionSystem));
+                LogInstruction(instruction, BranchExceptionSystemGroup::SystemInstruction::SYS,
+                               A64DecodeGroup::BranchExceptionSystem);
 
-                AArch64CheckSystemAccess(0b01, op1.ToULong(), CRn.ToULong(), CRm.ToULong(), op2.ToULong(), Rt.ToULong(),
-                                         L.ToULong());
+                AArch64CheckSystemAccess(0b01, op1, CRn, CRm, op2, Rt,
+                                         L);
 
-                std::uint32_t sys_op1 = static_cast< std::uint32_t >(op1.ToULong());
-                std::uint32_t sys_op2 = static_cast< std::uint32_t >(op2.ToULong());
-                std::uint32_t sys_crn = static_cast< std::uint32_t >(CRn.ToULong());
-                std::uint32_t sys_crm = static_cast< std::uint32_t >(CRm.ToULong());
+                std::uint32_t sys_op1 = static_cast< std::uint32_t >(op1);
+                std::uint32_t sys_op2 = static_cast< std::uint32_t >(op2);
+                std::uint32_t sys_crn = static_cast< std::uint32_t >(CRn);
+                std::uint32_t sys_crm = static_cast< std::uint32_t >(CRm);
 
                 SysInstr(1, sys_op1, sys_crn, sys_crm, sys_op2, m_gpRegisters.X(Rt));
             } break;
             case BranchExceptionSystemGroup::SystemInstruction::SYSL: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             default: {
-                throw undefined_instruction {};
+                return RaiseFault(Fault::UndefinedInstruction);
             } break;
         }
     }
     void Execute(Instruction&& instruction, BranchExceptionSystemGroup::SystemRegisterMove instructionType) {
-        auto Rt  = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rt);
-        auto op2 = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Op2);
-        auto CRm = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::CRm);
-        auto CRn = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::CRn);
-        auto op1 = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Op1);
-        auto o0  = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::O0);
-        auto L   = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::L);
+        auto Rt  = A64InstructionManager::Extract< A64InstructionManager::Tag::Rt >(instruction);
+        auto op2 = A64InstructionManager::Extract< A64InstructionManager::Tag::Op2 >(instruction);
+        auto CRm = A64InstructionManager::Extract< A64InstructionManager::Tag::CRm >(instruction);
+        auto CRn = A64InstructionManager::Extract< A64InstructionManager::Tag::CRn >(instruction);
+        auto op1 = A64InstructionManager::Extract< A64InstructionManager::Tag::Op1 >(instruction);
+        auto o0  = A64InstructionManager::Extract< A64InstructionManager::Tag::O0 >(instruction);
+        auto L   = A64InstructionManager::Extract< A64InstructionManager::Tag::L >(instruction);
 
         switch (instructionType) {
             case BranchExceptionSystemGroup::SystemRegisterMove::MSRr: { // P.1223
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(BranchExceptionSystemGroup::SystemRegisterMove::MSRr),
-                                  Enum::ToChar(A64DecodeGroup::BranchExceptionSystem));
+                LogInstruction(instruction, BranchExceptionSystemGroup::SystemRegisterMove::MSRr,
+                               A64DecodeGroup::BranchExceptionSystem);
 
                 auto op0 = static_cast< std::uint8_t >(2) + static_cast< std::uint8_t >(o0);
 
-                AArch64CheckSystemAccess(op0, op1.ToULong(), CRn.ToULong(), CRm.ToULong(), op2.ToULong(), Rt.ToULong(),
-                                         L.ToULong());
+                AArch64CheckSystemAccess(op0, op1, CRn, CRm, op2, Rt,
+                                         L);
+                if (m_fault != Fault::None) {
+                    return;
+                }
 
-                SysRegWrite(op0, op1.ToULong(), CRn.ToULong(), CRm.ToULong(), op2.ToULong(), m_gpRegisters.X(Rt));
+                SysRegWrite(op0, op1, CRn, CRm, op2, m_gpRegisters.X(Rt));
             } break;
             case BranchExceptionSystemGroup::SystemRegisterMove::MRS: { // P.1219
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(BranchExceptionSystemGroup::SystemRegisterMove::MRS),
-                                  Enum::ToChar(A64DecodeGroup::BranchExceptionSystem));
+                LogInstruction(instruction, BranchExceptionSystemGroup::SystemRegisterMove::MRS,
+                               A64DecodeGroup::BranchExceptionSystem);
 
                 auto op0 = static_cast< std::uint8_t >(2) + static_cast< std::uint8_t >(o0);
 
-                m_gpRegisters.write(Rt, SysRegRead(op0, op1.ToULong(), CRn.ToULong(), CRm.ToULong(), op2.ToULong()));
+                m_gpRegisters.write(Rt, SysRegRead(op0, op1, CRn, CRm, op2));
             } break;
             default: {
-                throw undefined_instruction {};
+                return RaiseFault(Fault::UndefinedInstruction);
             } break;
         }
     }
     void Execute(Instruction&& instruction, BranchExceptionSystemGroup::UnconditionalBranchRegister instructionType) {
-        auto Rn = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rn);
-        auto Rm = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rm);
-        auto A  = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::A);
-        auto M  = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::M);
-        auto Z  = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Z);
+        auto Rn = A64InstructionManager::Extract< A64InstructionManager::Tag::Rn >(instruction);
 
         switch (instructionType) {
             case BranchExceptionSystemGroup::UnconditionalBranchRegister::BR: { // P.922
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(BranchExceptionSystemGroup::UnconditionalBranchRegister::BR),
-                                  Enum::ToChar(A64DecodeGroup::BranchExceptionSystem));
+                LogInstruction(instruction, BranchExceptionSystemGroup::UnconditionalBranchRegister::BR,
+                               A64DecodeGroup::BranchExceptionSystem);
 
-                const auto& target = m_gpRegisters.X(Rn);
-                static_assert(std::is_same_v< std::remove_cvref_t< decltype(target) >, std::bitset< 64 > >);
+                const auto target = m_gpRegisters.X(Rn);
 
-                BranchTo(target.to_ullong(), IProcessingUnit::BranchType::IndCall);
+                BranchTo(target, IProcessingUnit::BranchType::IndCall);
             } break;
             case BranchExceptionSystemGroup::UnconditionalBranchRegister::BRAAZ: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case BranchExceptionSystemGroup::UnconditionalBranchRegister::BRABZ: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case BranchExceptionSystemGroup::UnconditionalBranchRegister::BLR: { // P.919
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(BranchExceptionSystemGroup::UnconditionalBranchRegister::BLR),
-                                  Enum::ToChar(A64DecodeGroup::BranchExceptionSystem));
+                LogInstruction(instruction, BranchExceptionSystemGroup::UnconditionalBranchRegister::BLR,
+                               A64DecodeGroup::BranchExceptionSystem);
 
-                const auto& target = m_gpRegisters.X(Rn);
-                static_assert(std::is_same_v< std::remove_cvref_t< decltype(target) >, std::bitset< 64 > >);
+                const auto target = m_gpRegisters.X(Rn);
 
                 const auto pc = PC();
                 m_gpRegisters.write(30, pc + 4);
-                BranchTo(target.to_ullong(), IProcessingUnit::BranchType::IndCall);
+                BranchTo(target, IProcessingUnit::BranchType::IndCall);
             } break;
             case BranchExceptionSystemGroup::UnconditionalBranchRegister::BLRAAZ: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case BranchExceptionSystemGroup::UnconditionalBranchRegister::BLRABZ: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case BranchExceptionSystemGroup::UnconditionalBranchRegister::RET: { // P.1265
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(BranchExceptionSystemGroup::UnconditionalBranchRegister::RET),
-                                  Enum::ToChar(A64DecodeGroup::BranchExceptionSystem));
+                LogInstruction(instruction, BranchExceptionSystemGroup::UnconditionalBranchRegister::RET,
+                               A64DecodeGroup::BranchExceptionSystem);
 
-                const auto& target = m_gpRegisters.X(Rn);
-                static_assert(std::is_same_v< std::remove_cvref_t< decltype(target) >, std::bitset< 64 > >);
-                BranchTo(target.to_ullong(), IProcessingUnit::BranchType::Ret);
+                const auto target = m_gpRegisters.X(Rn);
+                BranchTo(target, IProcessingUnit::BranchType::Ret);
             } break;
             case BranchExceptionSystemGroup::UnconditionalBranchRegister::RETAA: { // P.1266
                 /*if constexpr (HasArchVersion(ArchVersion::ARMv8p3)) {
-                    throw not_implemented_feature {};
+                    return RaiseFault(Fault::NotImplementedFeature);
                 } else {
-                    throw unsupported_instruction {};
+                    return RaiseFault(Fault::UnsupportedInstruction);
                 }*/
             } break;
             case BranchExceptionSystemGroup::UnconditionalBranchRegister::RETAB: { // P.1266
                 /*if constexpr (HasArchVersion(ArchVersion::ARMv8p3)) {
-                    throw not_implemented_feature {};
+                    return RaiseFault(Fault::NotImplementedFeature);
                 } else {
-                    throw unsupported_instruction {};
+                    return RaiseFault(Fault::UnsupportedInstruction);
                 }*/
             } break;
             case BranchExceptionSystemGroup::UnconditionalBranchRegister::ERET: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case BranchExceptionSystemGroup::UnconditionalBranchRegister::ERETAA: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case BranchExceptionSystemGroup::UnconditionalBranchRegister::ERETAB: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case BranchExceptionSystemGroup::UnconditionalBranchRegister::DRPS: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case BranchExceptionSystemGroup::UnconditionalBranchRegister::BRAA: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case BranchExceptionSystemGroup::UnconditionalBranchRegister::BRAB: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case BranchExceptionSystemGroup::UnconditionalBranchRegister::BLRAA: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case BranchExceptionSystemGroup::UnconditionalBranchRegister::BLRAB: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             default: {
-                throw undefined_instruction {};
+                return RaiseFault(Fault::UndefinedInstruction);
             } break;
         }
     }
     void Execute(Instruction&& instruction, BranchExceptionSystemGroup::UnconditionalBranchImmediate instructionType) {
-        auto imm26 = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Imm26);
+        auto imm26 = A64InstructionManager::Extract< A64InstructionManager::Tag::Imm26 >(instruction);
 
         switch (instructionType) {
             case BranchExceptionSystemGroup::UnconditionalBranchImmediate::B: { // P.905
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(BranchExceptionSystemGroup::UnconditionalBranchImmediate::B),
-                                  Enum::ToChar(A64DecodeGroup::BranchExceptionSystem));
+                LogInstruction(instruction, BranchExceptionSystemGroup::UnconditionalBranchImmediate::B,
+                               A64DecodeGroup::BranchExceptionSystem);
 
-                std::bitset< 64 > offset =
-                    (SignExtend< 64 >(concate< 26, 2 >(imm26.ToULong(), 0)).to_ullong() / sizeof(IMemory::DataUnit));
+                const auto offset =
+                    SignExtend< 64 >(static_cast< std::uint64_t >(imm26) << 2, 26 + 2) / sizeof(IMemory::DataUnit);
                 const auto pc = PC();
-                BranchTo(pc + offset.to_ullong(), IProcessingUnit::BranchType::Dir);
+                BranchTo(pc + offset, IProcessingUnit::BranchType::Dir);
             } break;
             case BranchExceptionSystemGroup::UnconditionalBranchImmediate::BL: { // P.918
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(BranchExceptionSystemGroup::UnconditionalBranchImmediate::BL),
-                                  Enum::ToChar(A64DecodeGroup::BranchExceptionSystem));
+                LogInstruction(instruction, BranchExceptionSystemGroup::UnconditionalBranchImmediate::BL,
+                               A64DecodeGroup::BranchExceptionSystem);
 
-                std::bitset< 64 > offset =
-                    (SignExtend< 64 >(concate< 26, 2 >(imm26.ToULong(), 0)).to_ullong() / sizeof(IMemory::DataUnit));
+                const auto offset =
+                    SignExtend< 64 >(static_cast< std::uint64_t >(imm26) << 2, 26 + 2) / sizeof(IMemory::DataUnit);
                 const auto pc = PC();
                 m_gpRegisters.write(30, pc + 4);
-                BranchTo(pc + offset.to_ullong(), IProcessingUnit::BranchType::DirCall);
+                BranchTo(pc + offset, IProcessingUnit::BranchType::DirCall);
             } break;
             default: {
-                throw undefined_instruction {};
+                return RaiseFault(Fault::UndefinedInstruction);
             } break;
         }
     }
     void Execute(Instruction&& instruction, BranchExceptionSystemGroup::CompareAndBranchImmediate instructionType) {
-        auto Rt    = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rt);
-        auto imm19 = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Imm19);
+        auto Rt    = A64InstructionManager::Extract< A64InstructionManager::Tag::Rt >(instruction);
+        auto imm19 = A64InstructionManager::Extract< A64InstructionManager::Tag::Imm19 >(instruction);
 
         switch (instructionType) {
             case BranchExceptionSystemGroup::CompareAndBranchImmediate::CBZ_32BIT: { // P.939
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(BranchExceptionSystemGroup::CompareAndBranchImmediate::CBZ_32BIT),
-                                  Enum::ToChar(A64DecodeGroup::BranchExceptionSystem));
+                LogInstruction(instruction, BranchExceptionSystemGroup::CompareAndBranchImmediate::CBZ_32BIT,
+                               A64DecodeGroup::BranchExceptionSystem);
 
                 constexpr auto datasize = 32;
 
-                auto offset = SignExtend< 64 >(concate< 19, 2 >(imm19.ToULong(), 0));
+                auto offset = SignExtend< 64 >(static_cast< std::uint64_t >(imm19) << 2, 19 + 2);
 
                 auto operand1 = m_gpRegisters.W(Rt);
-                static_assert(std::is_same_v< decltype(operand1), std::bitset< datasize > >);
 
                 const auto pc = PC();
                 if (operand1 == 0) {
-                    BranchTo(pc + offset.to_ullong(), IProcessingUnit::BranchType::Dir);
+                    BranchTo(pc + offset, IProcessingUnit::BranchType::Dir);
                 }
             } break;
             case BranchExceptionSystemGroup::CompareAndBranchImmediate::CBNZ_32BIT: { // P.938
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(BranchExceptionSystemGroup::CompareAndBranchImmediate::CBNZ_32BIT),
-                                  Enum::ToChar(A64DecodeGroup::BranchExceptionSystem));
+                LogInstruction(instruction, BranchExceptionSystemGroup::CompareAndBranchImmediate::CBNZ_32BIT,
+                               A64DecodeGroup::BranchExceptionSystem);
 
                 constexpr auto datasize = 32;
 
-                auto offset = SignExtend< 64 >(concate< 19, 2 >(imm19.ToULong(), 0));
+                auto offset = SignExtend< 64 >(static_cast< std::uint64_t >(imm19) << 2, 19 + 2);
 
                 auto operand1 = m_gpRegisters.W(Rt);
-                static_assert(std::is_same_v< decltype(operand1), std::bitset< datasize > >);
 
                 const auto pc = PC();
                 if (operand1 != 0) {
-                    BranchTo(pc + offset.to_ullong(), IProcessingUnit::BranchType::Dir);
+                    BranchTo(pc + offset, IProcessingUnit::BranchType::Dir);
                 }
             } break;
             case BranchExceptionSystemGroup::CompareAndBranchImmediate::CBZ_64BIT: { // P.939
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(BranchExceptionSystemGroup::CompareAndBranchImmediate::CBZ_64BIT),
-                                  Enum::ToChar(A64DecodeGroup::BranchExceptionSystem));
+                LogInstruction(instruction, BranchExceptionSystemGroup::CompareAndBranchImmediate::CBZ_64BIT,
+                               A64DecodeGroup::BranchExceptionSystem);
 
                 constexpr auto datasize = 64;
 
-                auto offset = SignExtend< 64 >(concate< 19, 2 >(imm19.ToULong(), 0));
+                auto offset = SignExtend< 64 >(static_cast< std::uint64_t >(imm19) << 2, 19 + 2);
 
                 auto operand1 = m_gpRegisters.X(Rt);
-                static_assert(std::is_same_v< decltype(operand1), std::bitset< datasize > >);
 
                 const auto pc = PC();
                 if (operand1 == 0) {
-                    BranchTo(pc + offset.to_ullong(), IProcessingUnit::BranchType::Dir);
+                    BranchTo(pc + offset, IProcessingUnit::BranchType::Dir);
                 }
             } break;
             case BranchExceptionSystemGroup::CompareAndBranchImmediate::CBNZ_64BIT: { // P.938
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(BranchExceptionSystemGroup::CompareAndBranchImmediate::CBNZ_64BIT),
-                                  Enum::ToChar(A64DecodeGroup::BranchExceptionSystem));
+                LogInstruction(instruction, BranchExceptionSystemGroup::CompareAndBranchImmediate::CBNZ_64BIT,
+                               A64DecodeGroup::BranchExceptionSystem);
 
                 constexpr auto datasize = 64;
 
-                auto offset = SignExtend< 64 >(concate< 19, 2 >(imm19.ToULong(), 0));
+                auto offset = SignExtend< 64 >(static_cast< std::uint64_t >(imm19) << 2, 19 + 2);
 
                 auto operand1 = m_gpRegisters.X(Rt);
-                static_assert(std::is_same_v< decltype(operand1), std::bitset< datasize > >);
 
                 const auto pc = PC();
                 if (operand1 != 0) {
-                    BranchTo(pc + offset.to_ullong(), IProcessingUnit::BranchType::Dir);
+                    BranchTo(pc + offset, IProcessingUnit::BranchType::Dir);
                 }
             } break;
             default:
-                throw undefined_instruction {};
+                return RaiseFault(Fault::UndefinedInstruction);
                 break;
         }
     }
     void Execute(Instruction&& instruction, BranchExceptionSystemGroup::TestAndBranchImmediate instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
 
     void Execute(Instruction&& instruction, LoadStoreGroup::AdvancedSIMDLoadStoreMultipleStructures instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&&                                                      instruction,
                  LoadStoreGroup::AdvancedSIMDLoadStoreMultipleStructuresPostIndexed instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&& instruction, LoadStoreGroup::AdvancedSIMDLoadStoreSingleStructure instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&&                                                   instruction,
                  LoadStoreGroup::AdvancedSIMDLoadStoreSingleStructurePostIndexed instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&& instruction, LoadStoreGroup::LoadStoreMemoryTag instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&& instruction, LoadStoreGroup::LoadStoreExclusive instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&& instruction, LoadStoreGroup::LdaprStlrUnscaledImmediate instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&& instruction, LoadStoreGroup::LoadRegisterLiteral instructionType) {
-        auto Rt    = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rt);
-        auto imm19 = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Imm19);
+        auto Rt    = A64InstructionManager::Extract< A64InstructionManager::Tag::Rt >(instruction);
+        auto imm19 = A64InstructionManager::Extract< A64InstructionManager::Tag::Imm19 >(instruction);
         (void)Rt;
         (void)imm19;
 
         switch (instructionType) {
             case LoadStoreGroup::LoadRegisterLiteral::LDR_32BIT_LITERAL: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadRegisterLiteral::LDR_32BIT_LITERAL_SIMD: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadRegisterLiteral::LDR_64BIT_LITERAL: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadRegisterLiteral::LDR_64BIT_LITERAL_SIMD: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadRegisterLiteral::LDRSW_LITERAL: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadRegisterLiteral::LDR_128BIT_LITERAL_SIMD: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadRegisterLiteral::PRFM_LITERAL: { // P.1255
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(LoadStoreGroup::LoadRegisterLiteral::PRFM_LITERAL),
-                                  Enum::ToChar(A64DecodeGroup::LoadStore));
+                LogInstruction(instruction, LoadStoreGroup::LoadRegisterLiteral::PRFM_LITERAL,
+                               A64DecodeGroup::LoadStore);
                 // No-op
                 // This system emulation is depending on O(1) memory access, no operation is needed to pre-fetch
             } break;
             default: {
-                throw undefined_instruction {};
+                return RaiseFault(Fault::UndefinedInstruction);
             } break;
         }
     }
     void Execute(Instruction&& instruction, LoadStoreGroup::LoadStoreNoAllocatePairOffset instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&& instruction, LoadStoreGroup::LoadStoreRegisterPairPostIndexed instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&& instruction, LoadStoreGroup::LoadStoreRegisterPairOffset instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&& instruction, LoadStoreGroup::LoadStoreRegisterPairPreIndexed instructionType) {
 
         switch (instructionType) {
             case LoadStoreGroup::LoadStoreRegisterPairPreIndexed::STP_32BIT: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterPairPreIndexed::LDP_32BIT: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterPairPreIndexed::STP_32BIT_SIMD: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterPairPreIndexed::LDP_32BIT_SIMD: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterPairPreIndexed::STGP: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterPairPreIndexed::LDPSW: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterPairPreIndexed::STP_64BIT_SIMD: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterPairPreIndexed::LDP_64BIT_SIMD: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterPairPreIndexed::STP_64BIT: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterPairPreIndexed::LDP_64BIT: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterPairPreIndexed::STP_128BIT_SIMD: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterPairPreIndexed::LDP_128BIT_SIMD: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             default: {
-                throw undefined_instruction {};
+                return RaiseFault(Fault::UndefinedInstruction);
             } break;
         }
     }
     void Execute(Instruction&& instruction, LoadStoreGroup::LoadStoreRegisterUnscaledImmediate instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&& instruction, LoadStoreGroup::LoadStoreRegisterImmediatePostIndexed instructionType) {
-        auto Rt   = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rt);
-        auto Rn   = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rn);
-        auto imm9 = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Imm9);
-        auto size = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Size);
+        auto Rt   = A64InstructionManager::Extract< A64InstructionManager::Tag::Rt >(instruction);
+        auto Rn   = A64InstructionManager::Extract< A64InstructionManager::Tag::Rn >(instruction);
+        auto imm9 = A64InstructionManager::Extract< A64InstructionManager::Tag::Imm9 >(instruction);
+        auto size = A64InstructionManager::Extract< A64InstructionManager::Tag::Size >(instruction);
         (void)Rt;
         (void)Rn;
         (void)imm9;
@@ -1399,240 +1348,270 @@ struct A64ProcessState : public A64ProcessingUnit::ProcessState {
 
         switch (instructionType) {
             case LoadStoreGroup::LoadStoreRegisterImmediatePostIndexed::STRBi: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterImmediatePostIndexed::LDRBi: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterImmediatePostIndexed::LDRSBi_64BIT: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterImmediatePostIndexed::LDRSBi_32BIT: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterImmediatePostIndexed::STRi_8BIT_SIMD: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterImmediatePostIndexed::LDRi_8BIT_SIMD: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterImmediatePostIndexed::STRi_128BIT_SIMD: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterImmediatePostIndexed::LDRi_128BIT_SIMD: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterImmediatePostIndexed::STRHi: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterImmediatePostIndexed::LDRHi: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterImmediatePostIndexed::LDRSHi_64BIT: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterImmediatePostIndexed::LDRSHi_32BIT: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterImmediatePostIndexed::STRi_16BIT_SIMD: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterImmediatePostIndexed::LDRi_16BIT_SIMD: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterImmediatePostIndexed::STRi_32BIT: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterImmediatePostIndexed::LDRi_32BIT: {
-                throw not_implemented_feature {};
-                /* incomplete if (size == 0b10) throw undefined_behaviour {};
+                return RaiseFault(Fault::NotImplementedFeature);
+                /* incomplete if (size == 0b10) return RaiseFault(Fault::UndefinedBehaviour);
                  bool wback     = true;
                  bool postindex = true;
 
-                 std::bitset< 64 > offset = SignExtend< 64 >(std::bitset< 9 > { imm9 });*/
+                 std::uint64_t offset = SignExtend< 64 >(imm9, 9);*/
             } break;
             case LoadStoreGroup::LoadStoreRegisterImmediatePostIndexed::LDRSWi: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterImmediatePostIndexed::STRi_32BIT_SIMD: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterImmediatePostIndexed::LDRi_32BIT_SIMD: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterImmediatePostIndexed::STRi_64BIT: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterImmediatePostIndexed::LDRi_64BIT: {
-                throw not_implemented_feature {};
-                // if (size == 0b11) throw undefined_behaviour {};
+                return RaiseFault(Fault::NotImplementedFeature);
+                // if (size == 0b11) return RaiseFault(Fault::UndefinedBehaviour);
             } break;
             case LoadStoreGroup::LoadStoreRegisterImmediatePostIndexed::STRi_64BIT_SIMD: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterImmediatePostIndexed::LDRi_64BIT_SIMD: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             default: {
-                throw undefined_instruction {};
+                return RaiseFault(Fault::UndefinedInstruction);
             } break;
         }
     }
     void Execute(Instruction&& instruction, LoadStoreGroup::LoadStoreRegisterUnprivileged instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&& instruction, LoadStoreGroup::LoadStoreRegisterImmediatePreIndexed instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&& instruction, LoadStoreGroup::AtomicMemoryOperation instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&& instruction, LoadStoreGroup::LoadStoreRegisterRegisterOffset instructionType) {
-        auto Rt     = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rt);
-        auto Rn     = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rn);
-        auto S      = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::S);
-        auto option = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Option);
-        auto Rm     = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rm);
-        auto size   = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Size);
-
         switch (instructionType) {
             case LoadStoreGroup::LoadStoreRegisterRegisterOffset::STRBr_EXTENDED: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterRegisterOffset::STRBr_SHIFTED: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterRegisterOffset::LDRBr_EXTENDED: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterRegisterOffset::LDRBr_SHIFTED: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterRegisterOffset::LDRSBr_64BIT_EXTENDED: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterRegisterOffset::LDRSBr_64BIT_SHIFTED: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterRegisterOffset::LDRSBr_32BIT_EXTENDED: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterRegisterOffset::LDRSBr_32BIT_SHIFTED: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterRegisterOffset::STRr_SIMD: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterRegisterOffset::LDRr_SIMD: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterRegisterOffset::STRHr: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterRegisterOffset::LDRHr: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterRegisterOffset::LDRSHr_64BIT: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterRegisterOffset::LDRSHr_32BIT: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterRegisterOffset::STRr_32BIT: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterRegisterOffset::LDRr_32BIT: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterRegisterOffset::LDRSWr: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterRegisterOffset::STRr_64BIT: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterRegisterOffset::LDRr_64BIT: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterRegisterOffset::PRFMr: { // P.1257
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(LoadStoreGroup::LoadStoreRegisterRegisterOffset::PRFMr),
-                                  Enum::ToChar(A64DecodeGroup::LoadStore));
+                LogInstruction(instruction, LoadStoreGroup::LoadStoreRegisterRegisterOffset::PRFMr,
+                               A64DecodeGroup::LoadStore);
                 // No-op
                 // This system emulation is depending on O(1) memory access, no operation is needed to pre-fetch
             } break;
             default: {
-                throw undefined_instruction {};
+                return RaiseFault(Fault::UndefinedInstruction);
             } break;
         }
     }
     void Execute(Instruction&& instruction, LoadStoreGroup::LoadStoreRegisterPAC instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
+    }
+    /// @brief STR(B/H) (immediate) with an unsigned offset, imm12 is scaled by the access size
+    template < std::unsigned_integral T >
+    void StoreUnsignedOffset(std::uint32_t Rt, std::uint32_t Rn, std::uint32_t imm12) {
+        const auto base    = Rn == 31 ? SP() : m_gpRegisters.X(Rn);
+        const auto address = base + (static_cast< std::uint64_t >(imm12) << std::countr_zero(sizeof(T)));
+
+        m_memory.Write< T >(address, static_cast< T >(m_gpRegisters.X(Rt)));
+    }
+
+    /// @brief LDR(B/H/SB/SH/SW) (immediate) with an unsigned offset, the loaded value is zero or sign extended to
+    /// the RegisterSize bits of Rt
+    template < std::unsigned_integral T, std::uint32_t RegisterSize, bool IsSigned >
+    void LoadUnsignedOffset(std::uint32_t Rt, std::uint32_t Rn, std::uint32_t imm12) {
+        static_assert(RegisterSize == 32 || RegisterSize == 64);
+        const auto base    = Rn == 31 ? SP() : m_gpRegisters.X(Rn);
+        const auto address = base + (static_cast< std::uint64_t >(imm12) << std::countr_zero(sizeof(T)));
+
+        const auto memoryData = m_memory.Read< T >(address);
+        if (!memoryData) {
+            return;
+        }
+
+        auto data = static_cast< std::uint64_t >(*memoryData);
+        if constexpr (IsSigned) {
+            data = static_cast< std::uint64_t >(static_cast< std::int64_t >(static_cast< std::make_signed_t< T > >(data)));
+        }
+
+        if constexpr (RegisterSize == 32) {
+            m_gpRegisters.write(Rt, static_cast< std::uint32_t >(data));
+        } else {
+            m_gpRegisters.write(Rt, data);
+        }
     }
+
     void Execute(Instruction&& instruction, LoadStoreGroup::LoadStoreRegisterUnsignedImmediate instructionType) {
-        auto Rt    = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rt);
-        auto Rn    = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rn);
-        auto imm12 = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Imm12);
-        auto size  = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Size);
+        auto Rt    = A64InstructionManager::Extract< A64InstructionManager::Tag::Rt >(instruction);
+        auto Rn    = A64InstructionManager::Extract< A64InstructionManager::Tag::Rn >(instruction);
+        auto imm12 = A64InstructionManager::Extract< A64InstructionManager::Tag::Imm12 >(instruction);
+        auto size  = A64InstructionManager::Extract< A64InstructionManager::Tag::Size >(instruction);
 
         switch (instructionType) {
             case LoadStoreGroup::LoadStoreRegisterUnsignedImmediate::STRBi: {
-                throw not_implemented_feature {};
+                LogInstruction(instruction, LoadStoreGroup::LoadStoreRegisterUnsignedImmediate::STRBi, A64DecodeGroup::LoadStore);
+                return StoreUnsignedOffset< std::uint8_t >(Rt, Rn, imm12);
             } break;
             case LoadStoreGroup::LoadStoreRegisterUnsignedImmediate::LDRBi: {
-                throw not_implemented_feature {};
+                LogInstruction(instruction, LoadStoreGroup::LoadStoreRegisterUnsignedImmediate::LDRBi, A64DecodeGroup::LoadStore);
+                return LoadUnsignedOffset< std::uint8_t, 32, false >(Rt, Rn, imm12);
             } break;
             case LoadStoreGroup::LoadStoreRegisterUnsignedImmediate::LDRSBi_64BIT: {
-                throw not_implemented_feature {};
+                LogInstruction(instruction, LoadStoreGroup::LoadStoreRegisterUnsignedImmediate::LDRSBi_64BIT, A64DecodeGroup::LoadStore);
+                return LoadUnsignedOffset< std::uint8_t, 64, true >(Rt, Rn, imm12);
             } break;
             case LoadStoreGroup::LoadStoreRegisterUnsignedImmediate::LDRSBi_32BIT: {
-                throw not_implemented_feature {};
+                LogInstruction(instruction, LoadStoreGroup::LoadStoreRegisterUnsignedImmediate::LDRSBi_32BIT, A64DecodeGroup::LoadStore);
+                return LoadUnsignedOffset< std::uint8_t, 32, true >(Rt, Rn, imm12);
             } break;
             case LoadStoreGroup::LoadStoreRegisterUnsignedImmediate::STRi_8BIT_SIMD: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterUnsignedImmediate::LDRi_8BIT_SIMD: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterUnsignedImmediate::STRi_128BIT_SIMD: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterUnsignedImmediate::LDRi_128BIT_SIMD: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterUnsignedImmediate::STRHi: {
-                throw not_implemented_feature {};
+                LogInstruction(instruction, LoadStoreGroup::LoadStoreRegisterUnsignedImmediate::STRHi, A64DecodeGroup::LoadStore);
+                return StoreUnsignedOffset< std::uint16_t >(Rt, Rn, imm12);
             } break;
             case LoadStoreGroup::LoadStoreRegisterUnsignedImmediate::LDRHi: {
-                throw not_implemented_feature {};
+                LogInstruction(instruction, LoadStoreGroup::LoadStoreRegisterUnsignedImmediate::LDRHi, A64DecodeGroup::LoadStore);
+                return LoadUnsignedOffset< std::uint16_t, 32, false >(Rt, Rn, imm12);
             } break;
             case LoadStoreGroup::LoadStoreRegisterUnsignedImmediate::LDRSHi_64BIT: {
-                throw not_implemented_feature {};
+                LogInstruction(instruction, LoadStoreGroup::LoadStoreRegisterUnsignedImmediate::LDRSHi_64BIT, A64DecodeGroup::LoadStore);
+                return LoadUnsignedOffset< std::uint16_t, 64, true >(Rt, Rn, imm12);
             } break;
             case LoadStoreGroup::LoadStoreRegisterUnsignedImmediate::LDRSHi_32BIT: {
-                throw not_implemented_feature {};
+                LogInstruction(instruction, LoadStoreGroup::LoadStoreRegisterUnsignedImmediate::LDRSHi_32BIT, A64DecodeGroup::LoadStore);
+                return LoadUnsignedOffset< std::uint16_t, 32, true >(Rt, Rn, imm12);
             } break;
             case LoadStoreGroup::LoadStoreRegisterUnsignedImmediate::STRi_16BIT_SIMD: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterUnsignedImmediate::LDRi_16BIT_SIMD: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterUnsignedImmediate::STRi_32BIT: { // P.1261 + 88
                 // TODO
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(LoadStoreGroup::LoadStoreRegisterUnsignedImmediate::STRi_32BIT),
-                                  Enum::ToChar(A64DecodeGroup::LoadStore));
+                LogInstruction(instruction, LoadStoreGroup::LoadStoreRegisterUnsignedImmediate::STRi_32BIT,
+                               A64DecodeGroup::LoadStore);
 
                 if (size != 0b10) {
-                    throw undefined_behaviour {};
+                    return RaiseFault(Fault::UndefinedBehaviour);
                 }
                 auto wback     = false;
                 auto postindex = false;
 
-                auto offset = LSL< 64 >(ZeroExtend< 64 >(std::bitset< 12 > { imm12.ToULong() }), size.ToULong());
-                static_assert(std::is_same_v< decltype(offset), std::bitset< 64 > >);
+                auto offset = LSL< 64 >(ZeroExtend< 64 >(imm12, 12), size);
 
                 constexpr std::uint32_t datasize    = 8 << 0b10;
                 bool                    tag_checked = wback || (Rn != 31);
@@ -1641,17 +1620,18 @@ struct A64ProcessState : public A64ProcessingUnit::ProcessState {
                     (void)tag_checked;
                     // SetTagCheckedInstruction(tag_checked);
                 }
-                std::bitset< 64 >       address;
-                std::bitset< datasize > data;
+                std::uint64_t          address = 0;
+                get_type_t< datasize > data    = 0;
 
                 bool rt_unknown = false;
 
                 if (wback && Rn == Rt && Rn != 31) {
                     /*auto c = ALU::ConstrainUnpredictable();
                     if (c != Constraint::NONE && c != Constraint::UNKNOWN && c != Constraint::UNDEF && c !=
-                    Constraint::NOP) throw undefined_behaviour {}; switch (c) { case Constraint::NONE: { rt_unknown =
-                    false; } break; case Constraint::UNKNOWN: { rt_unknown = true; } break; case Constraint::UNDEF: {
-                            throw undefined_behaviour {};
+                    Constraint::NOP) return RaiseFault(Fault::UndefinedBehaviour); switch (c) { case Constraint::NONE: {
+                    rt_unknown = false; } break; case Constraint::UNKNOWN: { rt_unknown = true; } break;
+                    case Constraint::UNDEF: {
+                            return RaiseFault(Fault::UndefinedBehaviour);
                         } break;
                         case Constraint::NOP: {
                             EndOfInstruction(); // return
@@ -1667,21 +1647,23 @@ struct A64ProcessState : public A64ProcessingUnit::ProcessState {
                 }
 
                 if (!postindex) {
-                    address = address.to_ullong() + offset.to_ullong();
+                    address = address + offset;
                 }
 
                 if (rt_unknown) {
-                    throw undefined_behaviour {};
-                    // data = std::bitset< datasize >(0);
+                    return RaiseFault(Fault::UndefinedBehaviour);
+                    // data = 0;
                 } else {
                     data = m_gpRegisters.W(Rt);
                 }
                 // ALU::Mem[address, datasize / 8, AccType::NORMAL] = data;
-                m_upStreamMemory->Write(m_mmu.Translate(address.to_ullong()), data.to_ullong());
+                if (!m_memory.Write< std::uint32_t >(address, data)) {
+                    return;
+                }
 
                 if (wback) {
                     if (postindex) {
-                        address = address.to_ullong() + offset.to_ullong();
+                        address = address + offset;
                     } else if (Rn == 31) {
                         SP() = address;
                     } else {
@@ -1690,35 +1672,33 @@ struct A64ProcessState : public A64ProcessingUnit::ProcessState {
                 }
             } break;
             case LoadStoreGroup::LoadStoreRegisterUnsignedImmediate::LDRi_32BIT: { // // P.997 + 88
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(LoadStoreGroup::LoadStoreRegisterUnsignedImmediate::LDRi_32BIT),
-                                  Enum::ToChar(A64DecodeGroup::LoadStore));
+                LogInstruction(instruction, LoadStoreGroup::LoadStoreRegisterUnsignedImmediate::LDRi_32BIT,
+                               A64DecodeGroup::LoadStore);
 
                 if (size != 0b10) {
-                    throw undefined_behaviour {};
+                    return RaiseFault(Fault::UndefinedBehaviour);
                 }
                 bool wback     = false;
                 bool postindex = false;
 
-                auto offset = LSL< 64 >(ZeroExtend< 64 >(std::bitset< 12 > { imm12.ToULong() }), size.ToULong());
-                static_assert(std::is_same_v< decltype(offset), std::bitset< 64 > >);
+                auto offset = LSL< 64 >(ZeroExtend< 64 >(imm12, 12), size);
 
                 constexpr std::uint32_t datasize = 8 << 0b10;
                 if (supportedFeatures.find(IProcessingUnit::Feature::FEAT_MTE) != supportedFeatures.end()) {
                     // SetTagCheckedInstruction(tag_checked);
                 }
-                std::bitset< 64 >       address;
-                std::bitset< datasize > data;
+                std::uint64_t          address = 0;
+                get_type_t< datasize > data    = 0;
 
                 bool wb_unknown = false;
 
                 if (wback && Rn == Rt && Rn != 31) {
                     /*auto c = ALU::ConstrainUnpredictable();
                     if (c != Constraint::NONE && c != Constraint::UNKNOWN && c != Constraint::UNDEF && c !=
-                    Constraint::NOP) throw undefined_behaviour {}; switch (c) { case Constraint::NONE: { rt_unknown =
-                    false; } break; case Constraint::UNKNOWN: { rt_unknown = true; } break; case Constraint::UNDEF: {
-                    throw undefined_behaviour {};
+                    Constraint::NOP) return RaiseFault(Fault::UndefinedBehaviour); switch (c) { case Constraint::NONE: {
+                    rt_unknown = false; } break; case Constraint::UNKNOWN: { rt_unknown = true; } break;
+                    case Constraint::UNDEF: {
+                    return RaiseFault(Fault::UndefinedBehaviour);
                     } break;
                     case Constraint::NOP: {
                     EndOfInstruction(); // return
@@ -1734,18 +1714,22 @@ struct A64ProcessState : public A64ProcessingUnit::ProcessState {
                 }
 
                 if (!postindex) {
-                    address = address.to_ullong() + offset.to_ullong();
+                    address = address + offset;
                 }
 
                 // data = ALU::Mem[address, datasize / 8, AccType::NORMAL];
-                data = m_upStreamMemory->Read(m_mmu.Translate(address.to_ullong()));
+                const auto memoryData = m_memory.Read< std::uint32_t >(address);
+                if (!memoryData) {
+                    return;
+                }
+                data = *memoryData;
                 m_gpRegisters.write(Rt, data);
 
                 if (wback) {
                     if (wb_unknown) {
-                        throw undefined_behaviour {};
+                        return RaiseFault(Fault::UndefinedBehaviour);
                     } else if (postindex) {
-                        address = address.to_ullong() + offset.to_ullong();
+                        address = address + offset;
                     }
 
                     if (Rn == 31) {
@@ -1756,29 +1740,27 @@ struct A64ProcessState : public A64ProcessingUnit::ProcessState {
                 }
             } break;
             case LoadStoreGroup::LoadStoreRegisterUnsignedImmediate::LDRSWi: {
-                throw not_implemented_feature {};
+                LogInstruction(instruction, LoadStoreGroup::LoadStoreRegisterUnsignedImmediate::LDRSWi, A64DecodeGroup::LoadStore);
+                return LoadUnsignedOffset< std::uint32_t, 64, true >(Rt, Rn, imm12);
             } break;
             case LoadStoreGroup::LoadStoreRegisterUnsignedImmediate::STRi_32BIT_SIMD: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterUnsignedImmediate::LDRi_32BIT_SIMD: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterUnsignedImmediate::STRi_64BIT: { // P.1261 + 88
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(LoadStoreGroup::LoadStoreRegisterUnsignedImmediate::STRi_64BIT),
-                                  Enum::ToChar(A64DecodeGroup::LoadStore));
+                LogInstruction(instruction, LoadStoreGroup::LoadStoreRegisterUnsignedImmediate::STRi_64BIT,
+                               A64DecodeGroup::LoadStore);
 
                 /**/
                 if (size != 0b11) {
-                    throw undefined_behaviour {};
+                    return RaiseFault(Fault::UndefinedBehaviour);
                 }
                 auto wback     = false;
                 auto postindex = false;
 
-                auto offset = LSL< 64 >(ZeroExtend< 64 >(std::bitset< 12 > { imm12.ToULong() }), size.ToULong());
-                static_assert(std::is_same_v< decltype(offset), std::bitset< 64 > >);
+                auto offset = LSL< 64 >(ZeroExtend< 64 >(imm12, 12), size);
 
                 constexpr std::uint32_t datasize    = 8 << 0b11;
                 bool                    tag_checked = wback || (Rn != 31);
@@ -1787,17 +1769,18 @@ struct A64ProcessState : public A64ProcessingUnit::ProcessState {
                     (void)tag_checked;
                     // SetTagCheckedInstruction(tag_checked);
                 }
-                std::bitset< 64 >       address;
-                std::bitset< datasize > data;
+                std::uint64_t          address = 0;
+                get_type_t< datasize > data    = 0;
 
                 bool rt_unknown = false;
 
                 if (wback && Rn == Rt && Rn != 31) {
                     /*auto c = ALU::ConstrainUnpredictable();
                     if (c != Constraint::NONE && c != Constraint::UNKNOWN && c != Constraint::UNDEF && c !=
-                    Constraint::NOP) throw undefined_behaviour {}; switch (c) { case Constraint::NONE: { rt_unknown =
-                    false; } break; case Constraint::UNKNOWN: { rt_unknown = true; } break; case Constraint::UNDEF: {
-                    throw undefined_behaviour {};
+                    Constraint::NOP) return RaiseFault(Fault::UndefinedBehaviour); switch (c) { case Constraint::NONE: {
+                    rt_unknown = false; } break; case Constraint::UNKNOWN: { rt_unknown = true; } break;
+                    case Constraint::UNDEF: {
+                    return RaiseFault(Fault::UndefinedBehaviour);
                     } break;
                     case Constraint::NOP: {
                     EndOfInstruction(); // return
@@ -1813,20 +1796,22 @@ struct A64ProcessState : public A64ProcessingUnit::ProcessState {
                 }
 
                 if (!postindex) {
-                    address = address.to_ullong() + offset.to_ullong();
+                    address = address + offset;
                 }
 
                 if (rt_unknown) {
-                    data = std::bitset< datasize >(0);
+                    data = 0;
                 } else {
                     data = m_gpRegisters.X(Rt);
                 }
                 // ALU::Mem[address, datasize / 8, AccType::NORMAL] = data;
-                m_upStreamMemory->Write(m_mmu.Translate(address.to_ullong()), data.to_ullong());
+                if (!m_memory.Write< std::uint64_t >(address, data)) {
+                    return;
+                }
 
                 if (wback) {
                     if (postindex) {
-                        address = address.to_ullong() + offset.to_ullong();
+                        address = address + offset;
                     } else if (Rn == 31) {
                         SP() = address;
                     } else {
@@ -1835,35 +1820,33 @@ struct A64ProcessState : public A64ProcessingUnit::ProcessState {
                 }
             } break;
             case LoadStoreGroup::LoadStoreRegisterUnsignedImmediate::LDRi_64BIT: { // P.997 + 88
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(LoadStoreGroup::LoadStoreRegisterUnsignedImmediate::LDRi_64BIT),
-                                  Enum::ToChar(A64DecodeGroup::LoadStore));
+                LogInstruction(instruction, LoadStoreGroup::LoadStoreRegisterUnsignedImmediate::LDRi_64BIT,
+                               A64DecodeGroup::LoadStore);
 
                 if (size != 0b11) {
-                    throw undefined_behaviour {};
+                    return RaiseFault(Fault::UndefinedBehaviour);
                 }
                 bool wback     = false;
                 bool postindex = false;
 
-                auto offset = LSL< 64 >(ZeroExtend< 64 >(std::bitset< 12 > { imm12.ToULong() }), size.ToULong());
-                static_assert(std::is_same_v< decltype(offset), std::bitset< 64 > >);
+                auto offset = LSL< 64 >(ZeroExtend< 64 >(imm12, 12), size);
 
                 constexpr std::uint32_t datasize = 8 << 0b11;
                 if (supportedFeatures.find(IProcessingUnit::Feature::FEAT_MTE) != supportedFeatures.end()) {
                     // SetTagCheckedInstruction(tag_checked);
                 }
-                std::bitset< 64 >       address;
-                std::bitset< datasize > data;
+                std::uint64_t          address = 0;
+                get_type_t< datasize > data    = 0;
 
                 bool wb_unknown = false;
 
                 if (wback && Rn == Rt && Rn != 31) {
                     /*auto c = ALU::ConstrainUnpredictable();
                     if (c != Constraint::NONE && c != Constraint::UNKNOWN && c != Constraint::UNDEF && c !=
-                    Constraint::NOP) throw undefined_behaviour {}; switch (c) { case Constraint::NONE: { rt_unknown =
-                    false; } break; case Constraint::UNKNOWN: { rt_unknown = true; } break; case Constraint::UNDEF: {
-                    throw undefined_behaviour {};
+                    Constraint::NOP) return RaiseFault(Fault::UndefinedBehaviour); switch (c) { case Constraint::NONE: {
+                    rt_unknown = false; } break; case Constraint::UNKNOWN: { rt_unknown = true; } break;
+                    case Constraint::UNDEF: {
+                    return RaiseFault(Fault::UndefinedBehaviour);
                     } break;
                     case Constraint::NOP: {
                     EndOfInstruction(); // return
@@ -1879,18 +1862,22 @@ struct A64ProcessState : public A64ProcessingUnit::ProcessState {
                 }
 
                 if (!postindex) {
-                    address = address.to_ullong() + offset.to_ullong();
+                    address = address + offset;
                 }
 
                 // data = ALU::Mem[address, datasize / 8, AccType::NORMAL];
-                data = m_upStreamMemory->Read(m_mmu.Translate(address.to_ullong()));
+                const auto memoryData = m_memory.Read< std::uint64_t >(address);
+                if (!memoryData) {
+                    return;
+                }
+                data = *memoryData;
                 m_gpRegisters.write(Rt, data);
 
                 if (wback) {
                     if (wb_unknown) {
-                        throw undefined_behaviour {};
+                        return RaiseFault(Fault::UndefinedBehaviour);
                     } else if (postindex) {
-                        address = address.to_ullong() + offset.to_ullong();
+                        address = address + offset;
                     }
 
                     if (Rn == 31) {
@@ -1905,248 +1892,213 @@ struct A64ProcessState : public A64ProcessingUnit::ProcessState {
                 // This system emulation is depending on O(1) memory access, no operation is needed to pre-fetch
             } break;
             case LoadStoreGroup::LoadStoreRegisterUnsignedImmediate::STRi_64BIT_SIMD: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case LoadStoreGroup::LoadStoreRegisterUnsignedImmediate::LDRi_64BIT_SIMD: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             default: {
-                throw undefined_instruction {};
+                return RaiseFault(Fault::UndefinedInstruction);
             } break;
         }
     }
 
     void Execute(Instruction&& instruction, DataProcessingRegisterGroup::DataProcessingTwoSource instructionType) {
-        auto Rd  = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rd);
-        auto Rn  = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rn);
-        auto Rm  = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rm);
-        auto op2 = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Op2);
+        auto Rd  = A64InstructionManager::Extract< A64InstructionManager::Tag::Rd >(instruction);
+        auto Rn  = A64InstructionManager::Extract< A64InstructionManager::Tag::Rn >(instruction);
+        auto Rm  = A64InstructionManager::Extract< A64InstructionManager::Tag::Rm >(instruction);
+        auto op2 = A64InstructionManager::Extract< A64InstructionManager::Tag::Opc >(instruction);
 
         switch (instructionType) {
             case DataProcessingRegisterGroup::DataProcessingTwoSource::UDIV_32BIT: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case DataProcessingRegisterGroup::DataProcessingTwoSource::SDIV_32BIT: { // P.1293
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::DataProcessingTwoSource::SDIV_32BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::DataProcessingTwoSource::SDIV_32BIT,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 32;
 
                 auto               operand1 = m_gpRegisters.W(Rn);
                 decltype(operand1) operand2 = m_gpRegisters.W(Rm);
-                static_assert(std::is_same_v< decltype(operand2), std::bitset< datasize > >);
 
                 std::int64_t result {};
 
-                if (!operand2.any()) {
+                if (operand2 == 0) {
                     result = 0;
                 } else {
                     result = RoundTowardsZero(
-                        static_cast< long double >(std::bit_cast< std::int64_t >(operand1.to_ullong())) /
-                        static_cast< long double >(std::bit_cast< std::int64_t >(operand2.to_ullong())));
+                        static_cast< long double >(static_cast< std::int64_t >(operand1)) /
+                        static_cast< long double >(static_cast< std::int64_t >(operand2)));
                 }
 
                 m_gpRegisters.write(Rd, std::bit_cast< std::uint64_t >(result));
             } break;
             case DataProcessingRegisterGroup::DataProcessingTwoSource::LSLV_32BIT: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case DataProcessingRegisterGroup::DataProcessingTwoSource::LSRV_32BIT: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case DataProcessingRegisterGroup::DataProcessingTwoSource::ASRV_32BIT: { // P.889
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::DataProcessingTwoSource::ASRV_32BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::DataProcessingTwoSource::ASRV_32BIT,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 32;
 
                 auto shift_type = DecodeShift(op2);
 
                 auto operand2 = m_gpRegisters.W(Rm);
-                static_assert(std::is_same_v< decltype(operand2), std::bitset< datasize > >);
 
-                auto result = ShiftReg< datasize >(
-                    Rn, shift_type, static_cast< std::uint8_t >(std::uint64_t { operand2.to_ulong() } % datasize));
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
+                auto result = ShiftReg< datasize >(Rn, shift_type, static_cast< std::uint8_t >(operand2 % datasize));
 
-                m_gpRegisters.write(Rd, result);
+                m_gpRegisters.write(Rd, static_cast< std::uint32_t >(result));
 
             } break;
             case DataProcessingRegisterGroup::DataProcessingTwoSource::RORV_32BIT: { // P.1279
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::DataProcessingTwoSource::RORV_32BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::DataProcessingTwoSource::RORV_32BIT,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 32;
 
                 auto shift_type = DecodeShift(op2);
 
                 auto operand2 = m_gpRegisters.W(Rm);
-                static_assert(std::is_same_v< decltype(operand2), std::bitset< datasize > >);
 
-                auto result = ShiftReg< datasize >(
-                    Rn, shift_type, static_cast< std::uint8_t >(std::uint64_t { operand2.to_ulong() } % datasize));
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
+                auto result = ShiftReg< datasize >(Rn, shift_type, static_cast< std::uint8_t >(operand2 % datasize));
 
-                m_gpRegisters.write(Rd, result);
+                m_gpRegisters.write(Rd, static_cast< std::uint32_t >(result));
             } break;
             case DataProcessingRegisterGroup::DataProcessingTwoSource::CRC32B: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case DataProcessingRegisterGroup::DataProcessingTwoSource::CRC32H: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case DataProcessingRegisterGroup::DataProcessingTwoSource::CRC32W: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case DataProcessingRegisterGroup::DataProcessingTwoSource::CRC32CB: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case DataProcessingRegisterGroup::DataProcessingTwoSource::CRC32CH: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case DataProcessingRegisterGroup::DataProcessingTwoSource::CRC32CW: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case DataProcessingRegisterGroup::DataProcessingTwoSource::SUBP: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case DataProcessingRegisterGroup::DataProcessingTwoSource::UDIV_64BIT: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case DataProcessingRegisterGroup::DataProcessingTwoSource::SDIV_64BIT: { // P.1293
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::DataProcessingTwoSource::SDIV_64BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::DataProcessingTwoSource::SDIV_64BIT,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 64;
 
                 auto               operand1 = m_gpRegisters.X(Rn);
                 decltype(operand1) operand2 = m_gpRegisters.X(Rm);
-                static_assert(std::is_same_v< decltype(operand2), std::bitset< datasize > >);
 
                 std::int64_t result {};
 
-                if (!operand2.any()) {
+                if (operand2 == 0) {
                     result = 0;
                 } else {
                     result = RoundTowardsZero(
-                        static_cast< long double >(std::bit_cast< std::int64_t >(operand1.to_ullong())) /
-                        static_cast< long double >(std::bit_cast< std::int64_t >(operand2.to_ullong())));
+                        static_cast< long double >(static_cast< std::int64_t >(operand1)) /
+                        static_cast< long double >(static_cast< std::int64_t >(operand2)));
                 }
 
                 m_gpRegisters.write(Rd, std::bit_cast< std::uint64_t >(result));
             } break;
             case DataProcessingRegisterGroup::DataProcessingTwoSource::IRG: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case DataProcessingRegisterGroup::DataProcessingTwoSource::GMI: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case DataProcessingRegisterGroup::DataProcessingTwoSource::LSLV_64BIT: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case DataProcessingRegisterGroup::DataProcessingTwoSource::LSRV_64BIT: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case DataProcessingRegisterGroup::DataProcessingTwoSource::ASRV_64BIT: { // P.889
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::DataProcessingTwoSource::ASRV_64BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::DataProcessingTwoSource::ASRV_64BIT,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize   = 64;
                 auto           shift_type = DecodeShift(op2);
 
                 auto operand2 = m_gpRegisters.X(Rm);
-                static_assert(std::is_same_v< decltype(operand2), std::bitset< datasize > >);
 
-                auto result = ShiftReg< datasize >(
-                    Rn, shift_type, static_cast< std::uint8_t >(std::uint64_t { operand2.to_ulong() } % datasize));
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
+                auto result = ShiftReg< datasize >(Rn, shift_type, static_cast< std::uint8_t >(operand2 % datasize));
 
                 m_gpRegisters.write(Rd, result);
             } break;
             case DataProcessingRegisterGroup::DataProcessingTwoSource::RORV_64BIT: { // P.1279
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::DataProcessingTwoSource::RORV_64BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::DataProcessingTwoSource::RORV_64BIT,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 64;
 
                 auto shift_type = DecodeShift(op2);
 
                 auto operand2 = m_gpRegisters.X(Rm);
-                static_assert(std::is_same_v< decltype(operand2), std::bitset< datasize > >);
 
-                auto result = ShiftReg< datasize >(
-                    Rn, shift_type, static_cast< std::uint8_t >(std::uint64_t { operand2.to_ulong() } % datasize));
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
+                auto result = ShiftReg< datasize >(Rn, shift_type, static_cast< std::uint8_t >(operand2 % datasize));
 
                 m_gpRegisters.write(Rd, result);
             } break;
             case DataProcessingRegisterGroup::DataProcessingTwoSource::PACGA: { // P.1246
                 if (HasArchVersion(IProcessingUnit::ExtensionVersion::Armv8p3)) {
-                    throw unsupported_instruction {};
+                    return RaiseFault(Fault::UnsupportedInstruction);
                 } else {
-                    throw not_implemented_feature {};
+                    return RaiseFault(Fault::NotImplementedFeature);
                 }
             } break;
             case DataProcessingRegisterGroup::DataProcessingTwoSource::CRC32X: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case DataProcessingRegisterGroup::DataProcessingTwoSource::CRC32CX: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case DataProcessingRegisterGroup::DataProcessingTwoSource::SUBPS: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             default: {
-                throw undefined_instruction {};
+                return RaiseFault(Fault::UndefinedInstruction);
             } break;
         }
     }
     void Execute(Instruction&& instruction, DataProcessingRegisterGroup::DataProcessingOneSource instructionType) {
-        auto Rd  = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rd);
-        auto Rn  = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rn);
-        auto Z   = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Z);
-        auto opc = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Opc);
+        auto Rd  = A64InstructionManager::Extract< A64InstructionManager::Tag::Rd >(instruction);
+        auto Rn  = A64InstructionManager::Extract< A64InstructionManager::Tag::Rn >(instruction);
+        auto opc = A64InstructionManager::Extract< A64InstructionManager::Tag::Opc >(instruction);
 
         switch (instructionType) {
             case DataProcessingRegisterGroup::DataProcessingOneSource::RBIT_32BIT: { // P.1263
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::DataProcessingOneSource::RBIT_32BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::DataProcessingOneSource::RBIT_32BIT,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 32;
 
                 auto operand = m_gpRegisters.W(Rn);
-                auto result  = decltype(operand) {};
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
+                auto result  = BitReverse< datasize >(operand);
 
-                for (auto i = 0; i < datasize; ++i) {
-                    result[datasize - 1 - i] = operand[i];
-                }
-                m_gpRegisters.write(Rd, result);
+                m_gpRegisters.write(Rd, static_cast< std::uint32_t >(result));
             } break;
             case DataProcessingRegisterGroup::DataProcessingOneSource::REV16_32BIT: { // P.1269
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::DataProcessingOneSource::REV16_32BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::DataProcessingOneSource::REV16_32BIT,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 32;
 
                 int container_size {};
-                switch (opc.ToULong()) {
+                switch (opc) {
                     case 0: {
                         Unreachable();
                     } break;
@@ -2157,49 +2109,25 @@ struct A64ProcessState : public A64ProcessingUnit::ProcessState {
                         container_size = 32;
                     } break;
                     case 3: {
-                        throw undefined_behaviour {};
+                        return RaiseFault(Fault::UndefinedBehaviour);
                     } break;
                     default: {
-                        throw undefined_behaviour {};
+                        return RaiseFault(Fault::UndefinedBehaviour);
                     }
                 }
                 auto operand = m_gpRegisters.W(Rn);
-                auto result  = decltype(operand) {};
-                static_assert(std::is_same_v< decltype(operand), std::bitset< datasize > >);
-
-                auto containers             = datasize / container_size;
-                auto elements_per_container = container_size / 8;
-                int  index                  = 0;
-                int  rev_index;
-                for (auto c = 0; c < containers; ++c) {
-                    rev_index = index + ((elements_per_container - 1) * 8);
-                    for (auto e = 0; e < elements_per_container; ++e) {
-                        result[rev_index]                            = operand[index];
-                        result[static_cast< size_t >(rev_index) + 1] = operand[static_cast< size_t >(index) + 1];
-                        result[static_cast< size_t >(rev_index) + 2] = operand[static_cast< size_t >(index) + 2];
-                        result[static_cast< size_t >(rev_index) + 3] = operand[static_cast< size_t >(index) + 3];
-                        result[static_cast< size_t >(rev_index) + 4] = operand[static_cast< size_t >(index) + 4];
-                        result[static_cast< size_t >(rev_index) + 5] = operand[static_cast< size_t >(index) + 5];
-                        result[static_cast< size_t >(rev_index) + 6] = operand[static_cast< size_t >(index) + 6];
-                        result[static_cast< size_t >(rev_index) + 7] = operand[static_cast< size_t >(index) + 7];
-
-                        index     = index + 8;
-                        rev_index = rev_index - 8;
-                    }
-                }
+                auto result  = ReverseBytes< datasize >(operand, container_size);
 
-                m_gpRegisters.write(Rd, result);
+                m_gpRegisters.write(Rd, static_cast< std::uint32_t >(result));
             } break;
             case DataProcessingRegisterGroup::DataProcessingOneSource::REV_32BIT: { // P.1267
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::DataProcessingOneSource::REV_32BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::DataProcessingOneSource::REV_32BIT,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 32;
 
                 int container_size {};
-                switch (opc.ToULong()) {
+                switch (opc) {
                     case 0: {
                         Unreachable();
                     } break;
@@ -2210,72 +2138,42 @@ struct A64ProcessState : public A64ProcessingUnit::ProcessState {
                         container_size = 32;
                     } break;
                     case 3: {
-                        throw undefined_behaviour {};
+                        return RaiseFault(Fault::UndefinedBehaviour);
                     } break;
                     default: {
-                        throw undefined_behaviour {};
+                        return RaiseFault(Fault::UndefinedBehaviour);
                     }
                 }
                 auto operand = m_gpRegisters.W(Rn);
-                auto result  = decltype(operand) {};
-                static_assert(std::is_same_v< decltype(operand), std::bitset< datasize > >);
-
-                auto containers             = datasize / container_size;
-                auto elements_per_container = container_size / 8;
-                int  index                  = 0;
-                int  rev_index;
-                for (auto c = 0; c < containers; ++c) {
-                    rev_index = index + ((elements_per_container - 1) * 8);
-                    for (auto e = 0; e < elements_per_container; ++e) {
-                        result[rev_index]                            = operand[index];
-                        result[static_cast< size_t >(rev_index) + 1] = operand[static_cast< size_t >(index) + 1];
-                        result[static_cast< size_t >(rev_index) + 2] = operand[static_cast< size_t >(index) + 2];
-                        result[static_cast< size_t >(rev_index) + 3] = operand[static_cast< size_t >(index) + 3];
-                        result[static_cast< size_t >(rev_index) + 4] = operand[static_cast< size_t >(index) + 4];
-                        result[static_cast< size_t >(rev_index) + 5] = operand[static_cast< size_t >(index) + 5];
-                        result[static_cast< size_t >(rev_index) + 6] = operand[static_cast< size_t >(index) + 6];
-                        result[static_cast< size_t >(rev_index) + 7] = operand[static_cast< size_t >(index) + 7];
-
-                        index     = index + 8;
-                        rev_index = rev_index - 8;
-                    }
-                }
+                auto result  = ReverseBytes< datasize >(operand, container_size);
 
-                m_gpRegisters.write(Rd, result);
+                m_gpRegisters.write(Rd, static_cast< std::uint32_t >(result));
             } break;
             case DataProcessingRegisterGroup::DataProcessingOneSource::CLZ_32BIT: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case DataProcessingRegisterGroup::DataProcessingOneSource::CLS_32BIT: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case DataProcessingRegisterGroup::DataProcessingOneSource::RBIT_64BIT: { // P.1263
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::DataProcessingOneSource::RBIT_64BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::DataProcessingOneSource::RBIT_64BIT,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 64;
 
                 auto operand = m_gpRegisters.X(Rn);
-                auto result  = decltype(operand) {};
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
+                auto result  = BitReverse< datasize >(operand);
 
-                for (auto i = 0; i < datasize; ++i) {
-                    result[datasize - 1 - i] = operand[i];
-                }
                 m_gpRegisters.write(Rd, result);
             } break;
             case DataProcessingRegisterGroup::DataProcessingOneSource::REV16_64BIT: { // P.1269
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::DataProcessingOneSource::REV16_64BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::DataProcessingOneSource::REV16_64BIT,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 64;
 
                 int container_size {};
-                switch (opc.ToULong()) {
+                switch (opc) {
                     case 0: {
                         Unreachable();
                     } break;
@@ -2289,46 +2187,22 @@ struct A64ProcessState : public A64ProcessingUnit::ProcessState {
                         container_size = 64;
                     } break;
                     default: {
-                        throw undefined_behaviour {};
+                        return RaiseFault(Fault::UndefinedBehaviour);
                     }
                 }
                 auto operand = m_gpRegisters.X(Rn);
-                auto result  = decltype(operand) {};
-                static_assert(std::is_same_v< decltype(operand), std::bitset< datasize > >);
-
-                auto containers             = datasize / container_size;
-                auto elements_per_container = container_size / 8;
-                int  index                  = 0;
-                int  rev_index              = 0;
-                for (auto c = 0; c < containers; ++c) {
-                    rev_index = index + ((elements_per_container - 1) * 8);
-                    for (auto e = 0; e < elements_per_container; ++e) {
-                        result[rev_index]                            = operand[index];
-                        result[static_cast< size_t >(rev_index) + 1] = operand[static_cast< size_t >(index) + 1];
-                        result[static_cast< size_t >(rev_index) + 2] = operand[static_cast< size_t >(index) + 2];
-                        result[static_cast< size_t >(rev_index) + 3] = operand[static_cast< size_t >(index) + 3];
-                        result[static_cast< size_t >(rev_index) + 4] = operand[static_cast< size_t >(index) + 4];
-                        result[static_cast< size_t >(rev_index) + 5] = operand[static_cast< size_t >(index) + 5];
-                        result[static_cast< size_t >(rev_index) + 6] = operand[static_cast< size_t >(index) + 6];
-                        result[static_cast< size_t >(rev_index) + 7] = operand[static_cast< size_t >(index) + 7];
-
-                        index     = index + 8;
-                        rev_index = rev_index - 8;
-                    }
-                }
+                auto result  = ReverseBytes< datasize >(operand, container_size);
 
                 m_gpRegisters.write(Rd, result);
             } break;
             case DataProcessingRegisterGroup::DataProcessingOneSource::REV32: { // P.1271
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::DataProcessingOneSource::REV32),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::DataProcessingOneSource::REV32,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 64;
 
                 int container_size {};
-                switch (opc.ToULong()) {
+                switch (opc) {
                     case 0: {
                         Unreachable();
                     } break;
@@ -2342,46 +2216,22 @@ struct A64ProcessState : public A64ProcessingUnit::ProcessState {
                         container_size = 64;
                     } break;
                     default: {
-                        throw undefined_behaviour {};
+                        return RaiseFault(Fault::UndefinedBehaviour);
                     }
                 }
                 auto operand = m_gpRegisters.X(Rn);
-                auto result  = decltype(operand) {};
-                static_assert(std::is_same_v< decltype(operand), std::bitset< datasize > >);
-
-                auto containers             = datasize / container_size;
-                auto elements_per_container = container_size / 8;
-                int  index                  = 0;
-                int  rev_index              = 0;
-                for (auto c = 0; c < containers; ++c) {
-                    rev_index = index + ((elements_per_container - 1) * 8);
-                    for (auto e = 0; e < elements_per_container; ++e) {
-                        result[rev_index]                            = operand[index];
-                        result[static_cast< size_t >(rev_index) + 1] = operand[static_cast< size_t >(index) + 1];
-                        result[static_cast< size_t >(rev_index) + 2] = operand[static_cast< size_t >(index) + 2];
-                        result[static_cast< size_t >(rev_index) + 3] = operand[static_cast< size_t >(index) + 3];
-                        result[static_cast< size_t >(rev_index) + 4] = operand[static_cast< size_t >(index) + 4];
-                        result[static_cast< size_t >(rev_index) + 5] = operand[static_cast< size_t >(index) + 5];
-                        result[static_cast< size_t >(rev_index) + 6] = operand[static_cast< size_t >(index) + 6];
-                        result[static_cast< size_t >(rev_index) + 7] = operand[static_cast< size_t >(index) + 7];
-
-                        index     = index + 8;
-                        rev_index = rev_index - 8;
-                    }
-                }
+                auto result  = ReverseBytes< datasize >(operand, container_size);
 
                 m_gpRegisters.write(Rd, result);
             } break;
             case DataProcessingRegisterGroup::DataProcessingOneSource::REV_64BIT: { // P.1267
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::DataProcessingOneSource::REV_64BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::DataProcessingOneSource::REV_64BIT,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 64;
 
                 int container_size {};
-                switch (opc.ToULong()) {
+                switch (opc) {
                     case 0: {
                         Unreachable();
                     } break;
@@ -2395,85 +2245,61 @@ struct A64ProcessState : public A64ProcessingUnit::ProcessState {
                         container_size = 64;
                     } break;
                     default: {
-                        throw undefined_behaviour {};
+                        return RaiseFault(Fault::UndefinedBehaviour);
                     }
                 }
                 auto operand = m_gpRegisters.X(Rn);
-                auto result  = decltype(operand) {};
-                static_assert(std::is_same_v< decltype(operand), std::bitset< datasize > >);
-
-                auto containers             = datasize / container_size;
-                auto elements_per_container = container_size / 8;
-                int  index                  = 0;
-                int  rev_index              = 0;
-                for (auto c = 0; c < containers; ++c) {
-                    rev_index = index + ((elements_per_container - 1) * 8);
-                    for (auto e = 0; e < elements_per_container; ++e) {
-                        result[rev_index]                            = operand[index];
-                        result[static_cast< size_t >(rev_index) + 1] = operand[static_cast< size_t >(index) + 1];
-                        result[static_cast< size_t >(rev_index) + 2] = operand[static_cast< size_t >(index) + 2];
-                        result[static_cast< size_t >(rev_index) + 3] = operand[static_cast< size_t >(index) + 3];
-                        result[static_cast< size_t >(rev_index) + 4] = operand[static_cast< size_t >(index) + 4];
-                        result[static_cast< size_t >(rev_index) + 5] = operand[static_cast< size_t >(index) + 5];
-                        result[static_cast< size_t >(rev_index) + 6] = operand[static_cast< size_t >(index) + 6];
-                        result[static_cast< size_t >(rev_index) + 7] = operand[static_cast< size_t >(index) + 7];
-
-                        index     = index + 8;
-                        rev_index = rev_index - 8;
-                    }
-                }
+                auto result  = ReverseBytes< datasize >(operand, container_size);
 
                 m_gpRegisters.write(Rd, result);
             } break;
             case DataProcessingRegisterGroup::DataProcessingOneSource::CLZ_64BIT: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case DataProcessingRegisterGroup::DataProcessingOneSource::CLS_64BIT: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case DataProcessingRegisterGroup::DataProcessingOneSource::PACIA: { // P.1247
                 if (HasArchVersion(IProcessingUnit::ExtensionVersion::Armv8p3)) {
-                    throw unsupported_instruction {};
+                    return RaiseFault(Fault::UnsupportedInstruction);
                 } else {
-                    throw not_implemented_feature {};
+                    return RaiseFault(Fault::NotImplementedFeature);
                 }
             } break;
             case DataProcessingRegisterGroup::DataProcessingOneSource::PACIB: { // P.1250
                 if (HasArchVersion(IProcessingUnit::ExtensionVersion::Armv8p3)) {
-                    throw unsupported_instruction {};
+                    return RaiseFault(Fault::UnsupportedInstruction);
                 } else {
-                    throw not_implemented_feature {};
+                    return RaiseFault(Fault::NotImplementedFeature);
                 }
             } break;
             case DataProcessingRegisterGroup::DataProcessingOneSource::PACDA: { // P.1244
                 if (HasArchVersion(IProcessingUnit::ExtensionVersion::Armv8p3)) {
-                    throw unsupported_instruction {};
+                    return RaiseFault(Fault::UnsupportedInstruction);
                 } else {
-                    throw not_implemented_feature {};
+                    return RaiseFault(Fault::NotImplementedFeature);
                 }
             } break;
             case DataProcessingRegisterGroup::DataProcessingOneSource::PACDB: { // P.1245
                 if (HasArchVersion(IProcessingUnit::ExtensionVersion::Armv8p3)) {
-                    throw unsupported_instruction {};
+                    return RaiseFault(Fault::UnsupportedInstruction);
                 } else {
-                    throw not_implemented_feature {};
+                    return RaiseFault(Fault::NotImplementedFeature);
                 }
             } break;
             case DataProcessingRegisterGroup::DataProcessingOneSource::AUTIA: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case DataProcessingRegisterGroup::DataProcessingOneSource::AUTIB: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case DataProcessingRegisterGroup::DataProcessingOneSource::AUTDA: { // P.897
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::DataProcessingOneSource::AUTDA),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::DataProcessingOneSource::AUTDA,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 auto source_is_sp = false;
                 if (!HavePACExt())
-                    throw unsupported_instruction {};
+                    return RaiseFault(Fault::UnsupportedInstruction);
 
                 // Will always throw since instruction is ARMv8p3
                 /*if (Rn == 31) source_is_sp = true;
@@ -2489,50 +2315,48 @@ struct A64ProcessState : public A64ProcessingUnit::ProcessState {
                 }*/
             } break;
             case DataProcessingRegisterGroup::DataProcessingOneSource::AUTDB: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case DataProcessingRegisterGroup::DataProcessingOneSource::PACIZA: { // P.1247
                 if (HasArchVersion(IProcessingUnit::ExtensionVersion::Armv8p3)) {
-                    throw unsupported_instruction {};
+                    return RaiseFault(Fault::UnsupportedInstruction);
                 } else {
-                    throw not_implemented_feature {};
+                    return RaiseFault(Fault::NotImplementedFeature);
                 }
             } break;
             case DataProcessingRegisterGroup::DataProcessingOneSource::PACIZB: { // P.1250
                 if (HasArchVersion(IProcessingUnit::ExtensionVersion::Armv8p3)) {
-                    throw unsupported_instruction {};
+                    return RaiseFault(Fault::UnsupportedInstruction);
                 } else {
-                    throw not_implemented_feature {};
+                    return RaiseFault(Fault::NotImplementedFeature);
                 }
             } break;
             case DataProcessingRegisterGroup::DataProcessingOneSource::PACDZA: { // P.1244
                 if (HasArchVersion(IProcessingUnit::ExtensionVersion::Armv8p3)) {
-                    throw unsupported_instruction {};
+                    return RaiseFault(Fault::UnsupportedInstruction);
                 } else {
-                    throw not_implemented_feature {};
+                    return RaiseFault(Fault::NotImplementedFeature);
                 }
             } break;
             case DataProcessingRegisterGroup::DataProcessingOneSource::PACDZB: { // P.1245
                 if (HasArchVersion(IProcessingUnit::ExtensionVersion::Armv8p3)) {
-                    throw unsupported_instruction {};
+                    return RaiseFault(Fault::UnsupportedInstruction);
                 } else {
-                    throw not_implemented_feature {};
+                    return RaiseFault(Fault::NotImplementedFeature);
                 }
             } break;
             case DataProcessingRegisterGroup::DataProcessingOneSource::AUTIZA: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case DataProcessingRegisterGroup::DataProcessingOneSource::AUTIZB: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case DataProcessingRegisterGroup::DataProcessingOneSource::AUTDZA: { // P.897
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::DataProcessingOneSource::AUTDZA),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::DataProcessingOneSource::AUTDZA,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 if (!HavePACExt()) {
-                    throw unsupported_instruction {};
+                    return RaiseFault(Fault::UnsupportedInstruction);
                 } else { // Will always throw since instruction is ARMv8p3
                     /*auto source_is_sp = false;
 
@@ -2546,205 +2370,175 @@ struct A64ProcessState : public A64ProcessingUnit::ProcessState {
                 }
             } break;
             case DataProcessingRegisterGroup::DataProcessingOneSource::AUTDZB: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case DataProcessingRegisterGroup::DataProcessingOneSource::XPACI: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case DataProcessingRegisterGroup::DataProcessingOneSource::XPACD: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             default:
-                throw undefined_instruction {};
+                return RaiseFault(Fault::UndefinedInstruction);
                 break;
         }
     }
     void Execute(Instruction&& instruction, DataProcessingRegisterGroup::LogicalShiftedRegister instructionType) {
-        auto Rd    = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rd);
-        auto Rn    = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rn);
-        auto Rm    = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rm);
-        auto imm6  = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Imm6);
-        auto N     = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::N);
-        auto shift = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Shift);
+        auto Rd    = A64InstructionManager::Extract< A64InstructionManager::Tag::Rd >(instruction);
+        auto Rn    = A64InstructionManager::Extract< A64InstructionManager::Tag::Rn >(instruction);
+        auto Rm    = A64InstructionManager::Extract< A64InstructionManager::Tag::Rm >(instruction);
+        auto imm6  = A64InstructionManager::Extract< A64InstructionManager::Tag::Imm6 >(instruction);
+        auto shift = A64InstructionManager::Extract< A64InstructionManager::Tag::Shift >(instruction);
 
         switch (instructionType) {
             case DataProcessingRegisterGroup::LogicalShiftedRegister::AND_32BIT_SHIFTED: { // P.795 + 88
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::LogicalShiftedRegister::AND_32BIT_SHIFTED),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::LogicalShiftedRegister::AND_32BIT_SHIFTED,
+                               A64DecodeGroup::DataProcessingRegister);
 
-                if (static_cast< bool >(imm6.ToULong() & 0b100000) == true)
-                    throw undefined_behaviour {};
+                if (static_cast< bool >(imm6 & 0b100000) == true)
+                    return RaiseFault(Fault::UndefinedBehaviour);
                 constexpr auto datasize   = 32;
                 auto           shift_type = DecodeShift(shift);
 
                 auto operand1 = m_gpRegisters.W(Rn);
-                auto operand2 = ShiftReg< datasize >(Rm, shift_type, imm6.ToULong());
+                auto operand2 = ShiftReg< datasize >(Rm, shift_type, imm6);
 
                 auto result = operand1 & operand2;
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
-                m_gpRegisters.write(Rd, result);
+                m_gpRegisters.write(Rd, static_cast< std::uint32_t >(result));
             } break;
             case DataProcessingRegisterGroup::LogicalShiftedRegister::BIC_32BIT_SHIFTED: { // P.826 + 88
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::LogicalShiftedRegister::BIC_32BIT_SHIFTED),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::LogicalShiftedRegister::BIC_32BIT_SHIFTED,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 32;
-                if (imm6.ToULong() >= 32)
-                    throw undefined_instruction {};
+                if (imm6 >= 32)
+                    return RaiseFault(Fault::UndefinedInstruction);
 
                 auto shift_type   = DecodeShift(shift);
-                auto shift_amount = imm6.ToULong();
+                auto shift_amount = imm6;
 
                 auto operand1 = m_gpRegisters.W(Rn);
                 auto operand2 = ShiftReg< datasize >(Rm, shift_type, shift_amount);
 
-                operand2.flip();
+                operand2    = NOT< datasize >(operand2);
                 auto result = operand1 & operand2;
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
 
-                m_gpRegisters.write(Rd, result);
+                m_gpRegisters.write(Rd, static_cast< std::uint32_t >(result));
             } break;
             case DataProcessingRegisterGroup::LogicalShiftedRegister::ORR_32BIT_SHIFTED: { // P.1242
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::LogicalShiftedRegister::ORR_32BIT_SHIFTED),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::LogicalShiftedRegister::ORR_32BIT_SHIFTED,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 32;
-                if (imm6.ToULong() >= 32)
-                    throw undefined_instruction {};
+                if (imm6 >= 32)
+                    return RaiseFault(Fault::UndefinedInstruction);
 
                 auto shift_type   = DecodeShift(shift);
-                auto shift_amount = imm6.ToULong();
+                auto shift_amount = imm6;
 
                 auto operand1 = m_gpRegisters.W(Rn);
                 auto operand2 = ShiftReg< datasize >(Rm, shift_type, shift_amount);
 
                 auto result = operand1 | operand2;
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
 
-                m_gpRegisters.write(Rd, result);
+                m_gpRegisters.write(Rd, static_cast< std::uint32_t >(result));
 
             } break;
             case DataProcessingRegisterGroup::LogicalShiftedRegister::ORN_32BIT_SHIFTED: { // P.1238
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::LogicalShiftedRegister::ORN_32BIT_SHIFTED),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::LogicalShiftedRegister::ORN_32BIT_SHIFTED,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 32;
-                if (imm6.ToULong() >= 32)
-                    throw undefined_instruction {};
+                if (imm6 >= 32)
+                    return RaiseFault(Fault::UndefinedInstruction);
 
                 auto shift_type   = DecodeShift(shift);
-                auto shift_amount = imm6.ToULong();
+                auto shift_amount = imm6;
 
                 auto operand1 = m_gpRegisters.W(Rn);
                 auto operand2 = ShiftReg< datasize >(Rm, shift_type, shift_amount);
-                operand2.flip();
+
+                operand2 = NOT< datasize >(operand2);
 
                 auto result = operand1 | operand2;
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
 
-                m_gpRegisters.write(Rd, result);
+                m_gpRegisters.write(Rd, static_cast< std::uint32_t >(result));
             } break;
             case DataProcessingRegisterGroup::LogicalShiftedRegister::EOR_32BIT_SHIFTED: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case DataProcessingRegisterGroup::LogicalShiftedRegister::EON_32BIT_SHIFTED: { // P.914 + 88
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::LogicalShiftedRegister::EON_32BIT_SHIFTED),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::LogicalShiftedRegister::EON_32BIT_SHIFTED,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 32;
-                if (imm6.ToULong() >= 32)
-                    throw undefined_instruction {};
+                if (imm6 >= 32)
+                    return RaiseFault(Fault::UndefinedInstruction);
 
                 auto shift_type   = DecodeShift(shift);
-                auto shift_amount = imm6.ToULong();
+                auto shift_amount = imm6;
 
                 auto operand1 = m_gpRegisters.W(Rn);
                 auto operand2 = ShiftReg< datasize >(Rm, shift_type, shift_amount);
-                static_assert(std::is_same_v< decltype(operand1), std::bitset< datasize > >);
-                static_assert(std::is_same_v< decltype(operand2), std::bitset< datasize > >);
 
-                operand2.flip();
+                operand2 = NOT< datasize >(operand2);
 
                 auto result = operand1 | operand2;
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
 
-                m_gpRegisters.write(Rd, result);
+                m_gpRegisters.write(Rd, static_cast< std::uint32_t >(result));
             } break;
             case DataProcessingRegisterGroup::LogicalShiftedRegister::ANDS_32BIT_SHIFTED: { // P.799 + 88
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::LogicalShiftedRegister::ANDS_32BIT_SHIFTED),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::LogicalShiftedRegister::ANDS_32BIT_SHIFTED,
+                               A64DecodeGroup::DataProcessingRegister);
 
-                if (static_cast< bool >(imm6.ToULong() & 0b100000) == true)
-                    throw undefined_behaviour {};
+                if (static_cast< bool >(imm6 & 0b100000) == true)
+                    return RaiseFault(Fault::UndefinedBehaviour);
                 constexpr auto datasize   = 32;
                 auto           shift_type = DecodeShift(shift);
 
                 auto operand1 = m_gpRegisters.W(Rn);
-                auto operand2 = ShiftReg< datasize >(Rm, shift_type, imm6.ToULong());
+                auto operand2 = ShiftReg< datasize >(Rm, shift_type, imm6);
 
                 auto result = operand1 & operand2;
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
-                std::bitset< 4 > nzcv = concate< 2, 2 >(concate< 1, 1 >(result[31] ? 1 : 0, result == 0 ? 1 : 0), 0);
-                SetNZCV(nzcv);
-                m_gpRegisters.write(Rd, result);
+                SetLogicalFlags< datasize >(result);
+                m_gpRegisters.write(Rd, static_cast< std::uint32_t >(result));
             } break;
             case DataProcessingRegisterGroup::LogicalShiftedRegister::BICS_32BIT_SHIFTED: { // P.828 + 88
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::LogicalShiftedRegister::BICS_32BIT_SHIFTED),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::LogicalShiftedRegister::BICS_32BIT_SHIFTED,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 32;
-                if (imm6.ToULong() >= 32)
-                    throw undefined_instruction {};
+                if (imm6 >= 32)
+                    return RaiseFault(Fault::UndefinedInstruction);
 
                 auto shift_type   = DecodeShift(shift);
-                auto shift_amount = imm6.ToULong();
+                auto shift_amount = imm6;
 
                 auto operand1 = m_gpRegisters.W(Rn);
                 auto operand2 = ShiftReg< datasize >(Rm, shift_type, shift_amount);
 
-                operand2.flip();
+                operand2    = NOT< datasize >(operand2);
                 auto result = operand1 & operand2;
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
 
-                bool val = result[datasize - 1];
-                SetNZCV(concate< 1, 3 >(val, concate< 1, 2 >(result == 0, 0)));
-                m_gpRegisters.write(Rd, result);
+                SetLogicalFlags< datasize >(result);
+                m_gpRegisters.write(Rd, static_cast< std::uint32_t >(result));
             } break;
             case DataProcessingRegisterGroup::LogicalShiftedRegister::AND_64BIT_SHIFTED: { // P.795 + 88
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::LogicalShiftedRegister::AND_64BIT_SHIFTED),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::LogicalShiftedRegister::AND_64BIT_SHIFTED,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 auto           shift_type = DecodeShift(shift);
                 constexpr auto datasize   = 64;
 
                 auto operand1 = m_gpRegisters.X(Rn);
-                auto operand2 = ShiftReg< datasize >(Rm, shift_type, imm6.ToULong());
+                auto operand2 = ShiftReg< datasize >(Rm, shift_type, imm6);
 
                 auto result = operand1 & operand2;
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
                 m_gpRegisters.write(Rd, result);
             } break;
             case DataProcessingRegisterGroup::LogicalShiftedRegister::BIC_64BIT_SHIFTED: { // P.826 + 88
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::LogicalShiftedRegister::BIC_64BIT_SHIFTED),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::LogicalShiftedRegister::BIC_64BIT_SHIFTED,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 64;
 
@@ -2752,314 +2546,271 @@ struct A64ProcessState : public A64ProcessingUnit::ProcessState {
                 auto shift_amount = imm6;
 
                 auto operand1 = m_gpRegisters.X(Rn);
-                auto operand2 = ShiftReg< datasize >(Rm, shift_type, shift_amount.ToULong());
+                auto operand2 = ShiftReg< datasize >(Rm, shift_type, shift_amount);
 
-                operand2.flip();
+                operand2    = NOT< datasize >(operand2);
                 auto result = operand1 & operand2;
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
 
                 m_gpRegisters.write(Rd, result);
             } break;
             case DataProcessingRegisterGroup::LogicalShiftedRegister::ORR_64BIT_SHIFTED: { // P.1242
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::LogicalShiftedRegister::ORR_64BIT_SHIFTED),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::LogicalShiftedRegister::ORR_64BIT_SHIFTED,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 64;
 
                 auto shift_type   = DecodeShift(shift);
-                auto shift_amount = imm6.ToULong();
+                auto shift_amount = imm6;
 
                 auto operand1 = m_gpRegisters.X(Rn);
                 auto operand2 = ShiftReg< datasize >(Rm, shift_type, shift_amount);
 
                 auto result = operand1 | operand2;
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
 
                 m_gpRegisters.write(Rd, result);
             } break;
             case DataProcessingRegisterGroup::LogicalShiftedRegister::ORN_64BIT_SHIFTED: { // P.1238
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::LogicalShiftedRegister::ORN_64BIT_SHIFTED),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::LogicalShiftedRegister::ORN_64BIT_SHIFTED,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 64;
 
                 auto shift_type   = DecodeShift(shift);
-                auto shift_amount = imm6.ToULong();
+                auto shift_amount = imm6;
 
                 auto operand1 = m_gpRegisters.X(Rn);
                 auto operand2 = ShiftReg< datasize >(Rm, shift_type, shift_amount);
-                operand2.flip();
+
+                operand2 = NOT< datasize >(operand2);
 
                 auto result = operand1 | operand2;
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
 
                 m_gpRegisters.write(Rd, result);
             } break;
             case DataProcessingRegisterGroup::LogicalShiftedRegister::EOR_64BIT_SHIFTED: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case DataProcessingRegisterGroup::LogicalShiftedRegister::EON_64BIT_SHIFTED: { // P.914 + 88
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::LogicalShiftedRegister::EON_64BIT_SHIFTED),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::LogicalShiftedRegister::EON_64BIT_SHIFTED,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 64;
 
                 auto shift_type   = DecodeShift(shift);
-                auto shift_amount = imm6.ToULong();
+                auto shift_amount = imm6;
 
                 auto operand1 = m_gpRegisters.X(Rn);
                 auto operand2 = ShiftReg< datasize >(Rm, shift_type, shift_amount);
-                static_assert(std::is_same_v< decltype(operand1), std::bitset< datasize > >);
-                static_assert(std::is_same_v< decltype(operand2), std::bitset< datasize > >);
 
-                operand2.flip();
+                operand2 = NOT< datasize >(operand2);
 
                 auto result = operand1 | operand2;
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
 
                 m_gpRegisters.write(Rd, result);
             } break;
             case DataProcessingRegisterGroup::LogicalShiftedRegister::ANDS_64BIT_SHIFTED: { // P.799 + 88
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::LogicalShiftedRegister::ANDS_64BIT_SHIFTED),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::LogicalShiftedRegister::ANDS_64BIT_SHIFTED,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 auto           shift_type = DecodeShift(shift);
                 constexpr auto datasize   = 64;
 
                 auto operand1 = m_gpRegisters.X(Rn);
-                auto operand2 = ShiftReg< datasize >(Rm, shift_type, imm6.ToULong());
+                auto operand2 = ShiftReg< datasize >(Rm, shift_type, imm6);
 
                 auto result = operand1 & operand2;
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
-                std::bitset< 4 > nzcv = concate< 2, 2 >(concate< 1, 1 >(result[63] ? 1 : 0, result == 0 ? 1 : 0), 0);
-                SetNZCV(nzcv);
+                SetLogicalFlags< datasize >(result);
                 m_gpRegisters.write(Rd, result);
             } break;
             case DataProcessingRegisterGroup::LogicalShiftedRegister::BICS_64BIT_SHIFTED: { // P.828 + 88
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::LogicalShiftedRegister::BICS_64BIT_SHIFTED),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::LogicalShiftedRegister::BICS_64BIT_SHIFTED,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 64;
 
                 auto shift_type   = DecodeShift(shift);
-                auto shift_amount = imm6.ToULong();
+                auto shift_amount = imm6;
 
                 auto operand1 = m_gpRegisters.X(Rn);
                 auto operand2 = ShiftReg< datasize >(Rm, shift_type, shift_amount);
 
-                operand2.flip();
+                operand2    = NOT< datasize >(operand2);
                 auto result = operand1 & operand2;
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
 
-                bool val = result[datasize - 1];
-                SetNZCV(concate< 1, 3 >(val, concate< 1, 2 >(result == 0, 0)));
+                SetLogicalFlags< datasize >(result);
                 m_gpRegisters.write(Rd, result);
             } break;
             default: {
-                throw undefined_instruction {};
+                return RaiseFault(Fault::UndefinedInstruction);
             } break;
         }
     }
     void Execute(Instruction&& instruction, DataProcessingRegisterGroup::AddSubtractShiftedRegister instructionType) {
-        auto Rd    = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rd);
-        auto Rn    = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rn);
-        auto Rm    = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rm);
-        auto shift = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Shift);
-        auto imm6  = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Imm6);
+        auto Rd    = A64InstructionManager::Extract< A64InstructionManager::Tag::Rd >(instruction);
+        auto Rn    = A64InstructionManager::Extract< A64InstructionManager::Tag::Rn >(instruction);
+        auto Rm    = A64InstructionManager::Extract< A64InstructionManager::Tag::Rm >(instruction);
+        auto shift = A64InstructionManager::Extract< A64InstructionManager::Tag::Shift >(instruction);
+        auto imm6  = A64InstructionManager::Extract< A64InstructionManager::Tag::Imm6 >(instruction);
 
         switch (instructionType) {
             case DataProcessingRegisterGroup::AddSubtractShiftedRegister::ADD_32BIT_SHIFTED: { // P.781 + 88
-                m_debugObject.Log(
-                    LogType::Instruction, instructionLogStatement, std::bitset< 32 > { instruction.Get() }.to_string(),
-                    Enum::ToChar(DataProcessingRegisterGroup::AddSubtractShiftedRegister::ADD_32BIT_SHIFTED),
-                    Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::AddSubtractShiftedRegister::ADD_32BIT_SHIFTED,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 if (shift == 3) {
-                    throw undefined_behaviour {};
+                    return RaiseFault(Fault::UndefinedBehaviour);
                 }
-                if (static_cast< bool >(imm6.ToULong() & 0b100000) == true) {
-                    throw undefined_behaviour {};
+                if (static_cast< bool >(imm6 & 0b100000) == true) {
+                    return RaiseFault(Fault::UndefinedBehaviour);
                 }
                 constexpr auto datasize   = 32;
                 auto           shift_type = DecodeShift(shift);
 
                 auto operand1 = m_gpRegisters.W(Rn);
-                auto operand2 = ShiftReg< datasize >(Rm, shift_type, imm6.ToULong());
+                auto operand2 = ShiftReg< datasize >(Rm, shift_type, imm6);
 
-                auto [result, _] = AddWithCarry(operand1, operand2, 0);
+                auto [result, _] = AddWithCarry< datasize >(operand1, operand2, 0);
 
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
-                m_gpRegisters.write(Rd, result);
+                m_gpRegisters.write(Rd, static_cast< std::uint32_t >(result));
             } break;
             case DataProcessingRegisterGroup::AddSubtractShiftedRegister::ADDS_32BIT_SHIFTED: {
-                m_debugObject.Log(
-                    LogType::Instruction, instructionLogStatement, std::bitset< 32 > { instruction.Get() }.to_string(),
-                    Enum::ToChar(DataProcessingRegisterGroup::AddSubtractShiftedRegister::ADDS_32BIT_SHIFTED),
-                    Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::AddSubtractShiftedRegister::ADDS_32BIT_SHIFTED,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 if (shift == 3) {
-                    throw undefined_behaviour {};
+                    return RaiseFault(Fault::UndefinedBehaviour);
                 }
-                if (static_cast< bool >(imm6.ToULong() & 0b100000) == true) {
-                    throw undefined_behaviour {};
+                if (static_cast< bool >(imm6 & 0b100000) == true) {
+                    return RaiseFault(Fault::UndefinedBehaviour);
                 }
                 constexpr auto datasize   = 32;
                 auto           shift_type = DecodeShift(shift);
 
                 auto operand1 = m_gpRegisters.W(Rn);
-                auto operand2 = ShiftReg< datasize >(Rm, shift_type, imm6.ToULong());
+                auto operand2 = ShiftReg< datasize >(Rm, shift_type, imm6);
 
-                auto [result, nzcv] = AddWithCarry(operand1, operand2, 0);
+                auto result = AddWithCarrySetFlags< datasize >(operand1, operand2, 0);
 
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
-                static_assert(std::is_same_v< decltype(nzcv), std::bitset< 4 > >);
-                SetNZCV(nzcv);
-                m_gpRegisters.write(Rd, result);
+                m_gpRegisters.write(Rd, static_cast< std::uint32_t >(result));
             } break;
             case DataProcessingRegisterGroup::AddSubtractShiftedRegister::SUB_32BIT_SHIFTED: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case DataProcessingRegisterGroup::AddSubtractShiftedRegister::SUBS_32BIT_SHIFTED: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case DataProcessingRegisterGroup::AddSubtractShiftedRegister::ADD_64BIT_SHIFTED: { // P.781 + 88
-                m_debugObject.Log(
-                    LogType::Instruction, instructionLogStatement, std::bitset< 32 > { instruction.Get() }.to_string(),
-                    Enum::ToChar(DataProcessingRegisterGroup::AddSubtractShiftedRegister::ADD_64BIT_SHIFTED),
-                    Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::AddSubtractShiftedRegister::ADD_64BIT_SHIFTED,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 if (shift == 3) {
-                    throw undefined_behaviour {};
+                    return RaiseFault(Fault::UndefinedBehaviour);
                 }
                 constexpr auto datasize   = 64;
                 auto           shift_type = DecodeShift(shift);
 
                 auto operand1 = m_gpRegisters.X(Rn);
-                auto operand2 = ShiftReg< datasize >(Rm, shift_type, imm6.ToULong());
+                auto operand2 = ShiftReg< datasize >(Rm, shift_type, imm6);
 
-                auto [result, _] = AddWithCarry(operand1, operand2, 0);
+                auto [result, _] = AddWithCarry< datasize >(operand1, operand2, 0);
 
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
             } break;
             case DataProcessingRegisterGroup::AddSubtractShiftedRegister::ADDS_64BIT_SHIFTED: {
-                m_debugObject.Log(
-                    LogType::Instruction, instructionLogStatement, std::bitset< 32 > { instruction.Get() }.to_string(),
-                    Enum::ToChar(DataProcessingRegisterGroup::AddSubtractShiftedRegister::ADDS_64BIT_SHIFTED),
-                    Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::AddSubtractShiftedRegister::ADDS_64BIT_SHIFTED,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 if (shift == 3) {
-                    throw undefined_behaviour {};
+                    return RaiseFault(Fault::UndefinedBehaviour);
                 }
                 constexpr auto datasize   = 64;
                 auto           shift_type = DecodeShift(shift);
 
                 auto operand1 = m_gpRegisters.X(Rn);
-                auto operand2 = ShiftReg< datasize >(Rm, shift_type, imm6.ToULong());
+                auto operand2 = ShiftReg< datasize >(Rm, shift_type, imm6);
 
-                auto [result, nzcv] = AddWithCarry(operand1, operand2, 0);
+                auto result = AddWithCarrySetFlags< datasize >(operand1, operand2, 0);
 
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
-                static_assert(std::is_same_v< decltype(nzcv), std::bitset< 4 > >);
-                SetNZCV(nzcv);
                 m_gpRegisters.write(Rd, result);
             } break;
             case DataProcessingRegisterGroup::AddSubtractShiftedRegister::SUB_64BIT_SHIFTED: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case DataProcessingRegisterGroup::AddSubtractShiftedRegister::SUBS_64BIT_SHIFTED: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             default: {
-                throw undefined_instruction {};
+                return RaiseFault(Fault::UndefinedInstruction);
             } break;
         }
     }
     void Execute(Instruction&& instruction, DataProcessingRegisterGroup::AddSubtractExtendedRegister instructionType) {
-        auto Rd     = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rd);
-        auto Rn     = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rn);
-        auto Rm     = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rm);
-        auto option = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Option);
-        auto imm3   = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Imm3);
+        auto Rd     = A64InstructionManager::Extract< A64InstructionManager::Tag::Rd >(instruction);
+        auto Rn     = A64InstructionManager::Extract< A64InstructionManager::Tag::Rn >(instruction);
+        auto Rm     = A64InstructionManager::Extract< A64InstructionManager::Tag::Rm >(instruction);
+        auto option = A64InstructionManager::Extract< A64InstructionManager::Tag::Option >(instruction);
+        auto imm3   = A64InstructionManager::Extract< A64InstructionManager::Tag::Imm3 >(instruction);
 
         switch (instructionType) {
             case DataProcessingRegisterGroup::AddSubtractExtendedRegister::ADD_32BIT_EXTENDED: { // P.776 + 88
-                m_debugObject.Log(
-                    LogType::Instruction, instructionLogStatement, std::bitset< 32 > { instruction.Get() }.to_string(),
-                    Enum::ToChar(DataProcessingRegisterGroup::AddSubtractExtendedRegister::ADD_32BIT_EXTENDED),
-                    Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction,
+                               DataProcessingRegisterGroup::AddSubtractExtendedRegister::ADD_32BIT_EXTENDED,
+                               A64DecodeGroup::DataProcessingRegister);
 
-                if (imm3.ToULong() > 4) {
-                    throw undefined_behaviour {};
+                if (imm3 > 4) {
+                    return RaiseFault(Fault::UndefinedBehaviour);
                 }
                 constexpr auto datasize = 32;
                 auto           operand1 = Rn == 31 ? WSP() : m_gpRegisters.W(Rn);
-                auto operand2 = ExtendReg< datasize >(Rm, static_cast< IProcessingUnit::ExtendType >(option.ToULong()),
-                                                      imm3.ToULong());
-                auto [result, _] = AddWithCarry(operand1, operand2, static_cast< std::uint8_t >(0));
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
+                auto operand2 = ExtendReg< datasize >(Rm, static_cast< IProcessingUnit::ExtendType >(option),
+                                                      imm3);
+                auto [result, _] = AddWithCarry< datasize >(operand1, operand2, static_cast< std::uint8_t >(0));
                 if (Rn == 31) {
-                    WSP(result);
+                    WSP(static_cast< std::uint32_t >(result));
                 } else {
-                    m_gpRegisters.write(Rd, result);
+                    m_gpRegisters.write(Rd, static_cast< std::uint32_t >(result));
                 }
             } break;
             case DataProcessingRegisterGroup::AddSubtractExtendedRegister::ADDS_32BIT_EXTENDED: { // P.784 + 88
-                m_debugObject.Log(
-                    LogType::Instruction, instructionLogStatement, std::bitset< 32 > { instruction.Get() }.to_string(),
-                    Enum::ToChar(DataProcessingRegisterGroup::AddSubtractExtendedRegister::ADDS_32BIT_EXTENDED),
-                    Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction,
+                               DataProcessingRegisterGroup::AddSubtractExtendedRegister::ADDS_32BIT_EXTENDED,
+                               A64DecodeGroup::DataProcessingRegister);
 
-                if (imm3.ToULong() > 4) {
-                    throw undefined_behaviour {};
+                if (imm3 > 4) {
+                    return RaiseFault(Fault::UndefinedBehaviour);
                 }
-                if (imm3.ToULong() > 4) {
-                    throw undefined_behaviour {};
+                if (imm3 > 4) {
+                    return RaiseFault(Fault::UndefinedBehaviour);
                 }
                 constexpr auto datasize = 32;
                 auto           operand1 = Rn == 31 ? WSP() : m_gpRegisters.W(Rn);
-                auto operand2 = ExtendReg< datasize >(Rm, static_cast< IProcessingUnit::ExtendType >(option.ToULong()),
-                                                      imm3.ToULong());
-                auto [result, nzcv] = AddWithCarry(operand1, operand2, static_cast< std::uint8_t >(0));
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
-                static_assert(std::is_same_v< decltype(nzcv), std::bitset< 4 > >);
-                SetNZCV(nzcv);
+                auto operand2 = ExtendReg< datasize >(Rm, static_cast< IProcessingUnit::ExtendType >(option),
+                                                      imm3);
+                auto result = AddWithCarrySetFlags< datasize >(operand1, operand2, static_cast< std::uint8_t >(0));
                 if (Rn == 31) {
-                    WSP(result);
+                    WSP(static_cast< std::uint32_t >(result));
                 } else {
-                    m_gpRegisters.write(Rd, result);
+                    m_gpRegisters.write(Rd, static_cast< std::uint32_t >(result));
                 }
             } break;
             case DataProcessingRegisterGroup::AddSubtractExtendedRegister::SUB_32BIT_EXTENDED: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case DataProcessingRegisterGroup::AddSubtractExtendedRegister::SUBS_32BIT_EXTENDED: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case DataProcessingRegisterGroup::AddSubtractExtendedRegister::ADD_64BIT_EXTENDED: { // P.776 + 88
-                m_debugObject.Log(
-                    LogType::Instruction, instructionLogStatement, std::bitset< 32 > { instruction.Get() }.to_string(),
-                    Enum::ToChar(DataProcessingRegisterGroup::AddSubtractExtendedRegister::ADD_64BIT_EXTENDED),
-                    Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction,
+                               DataProcessingRegisterGroup::AddSubtractExtendedRegister::ADD_64BIT_EXTENDED,
+                               A64DecodeGroup::DataProcessingRegister);
 
-                if (imm3.ToULong() > 4) {
-                    throw undefined_behaviour {};
+                if (imm3 > 4) {
+                    return RaiseFault(Fault::UndefinedBehaviour);
                 }
                 constexpr auto datasize = 64;
                 auto           operand1 = Rn == 31 ? SP() : m_gpRegisters.X(Rn);
-                auto operand2 = ExtendReg< datasize >(Rm, static_cast< IProcessingUnit::ExtendType >(option.ToULong()),
-                                                      imm3.ToULong());
-                auto [result, _] = AddWithCarry(operand1, operand2, static_cast< std::uint8_t >(0));
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
+                auto operand2 = ExtendReg< datasize >(Rm, static_cast< IProcessingUnit::ExtendType >(option),
+                                                      imm3);
+                auto [result, _] = AddWithCarry< datasize >(operand1, operand2, static_cast< std::uint8_t >(0));
                 if (Rn == 31) {
                     SP() = result;
                 } else {
@@ -3067,22 +2818,18 @@ struct A64ProcessState : public A64ProcessingUnit::ProcessState {
                 }
             } break;
             case DataProcessingRegisterGroup::AddSubtractExtendedRegister::ADDS_64BIT_EXTENDED: { // P.784 + 88
-                m_debugObject.Log(
-                    LogType::Instruction, instructionLogStatement, std::bitset< 32 > { instruction.Get() }.to_string(),
-                    Enum::ToChar(DataProcessingRegisterGroup::AddSubtractExtendedRegister::ADDS_64BIT_EXTENDED),
-                    Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction,
+                               DataProcessingRegisterGroup::AddSubtractExtendedRegister::ADDS_64BIT_EXTENDED,
+                               A64DecodeGroup::DataProcessingRegister);
 
-                if (imm3.ToULong() > 4) {
-                    throw undefined_behaviour {};
+                if (imm3 > 4) {
+                    return RaiseFault(Fault::UndefinedBehaviour);
                 }
                 constexpr auto datasize = 64;
                 auto           operand1 = Rn == 31 ? SP() : m_gpRegisters.X(Rn);
-                auto operand2 = ExtendReg< datasize >(Rm, static_cast< IProcessingUnit::ExtendType >(option.ToULong()),
-                                                      imm3.ToULong());
-                auto [result, nzcv] = AddWithCarry(operand1, operand2, static_cast< std::uint8_t >(0));
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
-                static_assert(std::is_same_v< decltype(nzcv), std::bitset< 4 > >);
-                SetNZCV(nzcv);
+                auto operand2 = ExtendReg< datasize >(Rm, static_cast< IProcessingUnit::ExtendType >(option),
+                                                      imm3);
+                auto result = AddWithCarrySetFlags< datasize >(operand1, operand2, static_cast< std::uint8_t >(0));
                 if (Rn == 31) {
                     SP() = result;
                 } else {
@@ -3090,515 +2837,421 @@ struct A64ProcessState : public A64ProcessingUnit::ProcessState {
                 }
             } break;
             case DataProcessingRegisterGroup::AddSubtractExtendedRegister::SUB_64BIT_EXTENDED: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case DataProcessingRegisterGroup::AddSubtractExtendedRegister::SUBS_64BIT_EXTENDED: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             default: {
-                throw undefined_instruction {};
+                return RaiseFault(Fault::UndefinedInstruction);
             } break;
         }
     }
     void Execute(Instruction&& instruction, DataProcessingRegisterGroup::AddSubtractCarry instructionType) {
-        auto Rd = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rd);
-        auto Rn = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rn);
-        auto Rm = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rm);
+        auto Rd = A64InstructionManager::Extract< A64InstructionManager::Tag::Rd >(instruction);
+        auto Rn = A64InstructionManager::Extract< A64InstructionManager::Tag::Rn >(instruction);
+        auto Rm = A64InstructionManager::Extract< A64InstructionManager::Tag::Rm >(instruction);
 
         switch (instructionType) {
             case DataProcessingRegisterGroup::AddSubtractCarry::ADC_32BIT: { // P.772 + 88
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::AddSubtractCarry::ADC_32BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::AddSubtractCarry::ADC_32BIT,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 32;
-                auto [result, _] =
-                    AddWithCarry(m_gpRegisters.W(Rn), m_gpRegisters.W(Rm), static_cast< std::uint32_t >(C[0]));
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
-                m_gpRegisters.write(Rd, result);
+                auto [result, _] = AddWithCarry< datasize >(m_gpRegisters.W(Rn), m_gpRegisters.W(Rm), CarryFlag());
+                m_gpRegisters.write(Rd, static_cast< std::uint32_t >(result));
             } break;
             case DataProcessingRegisterGroup::AddSubtractCarry::ADCS_32BIT: { // P.774 + 88
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::AddSubtractCarry::ADCS_32BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::AddSubtractCarry::ADCS_32BIT,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 32;
-                auto [result, nzcv] =
-                    AddWithCarry(m_gpRegisters.W(Rn), m_gpRegisters.W(Rm), static_cast< std::uint32_t >(C[0]));
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
-                static_assert(std::is_same_v< decltype(nzcv), std::bitset< 4 > >);
-                SetNZCV(nzcv);
-                m_gpRegisters.write(Rd, result);
+                auto result = AddWithCarrySetFlags< datasize >(m_gpRegisters.W(Rn), m_gpRegisters.W(Rm), CarryFlag());
+                m_gpRegisters.write(Rd, static_cast< std::uint32_t >(result));
             } break;
             case DataProcessingRegisterGroup::AddSubtractCarry::SBC_32BIT: { // P.1282
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::AddSubtractCarry::SBC_32BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::AddSubtractCarry::SBC_32BIT,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 32;
 
                 auto               operand1 = m_gpRegisters.W(Rn);
                 decltype(operand1) operand2 = m_gpRegisters.W(Rm);
 
-                static_assert(std::is_same_v< decltype(operand2), std::bitset< datasize > >);
-                operand2.flip();
+                operand2 = NOT< datasize >(operand2);
 
-                auto [result, _] = AddWithCarry(operand1, operand2, C[0]);
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
+                auto [result, _] = AddWithCarry< datasize >(operand1, operand2, CarryFlag());
 
-                m_gpRegisters.write(Rd, result);
+                m_gpRegisters.write(Rd, static_cast< std::uint32_t >(result));
             } break;
             case DataProcessingRegisterGroup::AddSubtractCarry::SBCS_32BIT: { // P.1284
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::AddSubtractCarry::SBCS_32BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::AddSubtractCarry::SBCS_32BIT,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 32;
 
                 auto               operand1 = m_gpRegisters.W(Rn);
                 decltype(operand1) operand2 = m_gpRegisters.W(Rm);
 
-                static_assert(std::is_same_v< decltype(operand2), std::bitset< datasize > >);
-                operand2.flip();
+                operand2 = NOT< datasize >(operand2);
 
-                auto [result, nzcv] = AddWithCarry(operand1, operand2, C[0]);
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
-                static_assert(std::is_same_v< decltype(nzcv), std::bitset< 4 > >);
-                SetNZCV(nzcv);
-                m_gpRegisters.write(Rd, result);
+                auto result = AddWithCarrySetFlags< datasize >(operand1, operand2, CarryFlag());
+                m_gpRegisters.write(Rd, static_cast< std::uint32_t >(result));
             } break;
             case DataProcessingRegisterGroup::AddSubtractCarry::ADC_64BIT: { // P.772 + 88
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::AddSubtractCarry::ADC_64BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::AddSubtractCarry::ADC_64BIT,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 64;
-                auto [result, _] =
-                    AddWithCarry(m_gpRegisters.X(Rn), m_gpRegisters.X(Rm), static_cast< std::uint64_t >(C[0]));
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
+                auto [result, _] = AddWithCarry< datasize >(m_gpRegisters.X(Rn), m_gpRegisters.X(Rm), CarryFlag());
                 m_gpRegisters.write(Rd, result);
             } break;
             case DataProcessingRegisterGroup::AddSubtractCarry::ADCS_64BIT: { // P.774 + 88
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::AddSubtractCarry::ADCS_64BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::AddSubtractCarry::ADCS_64BIT,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 64;
-                auto [result, nzcv] =
-                    AddWithCarry(m_gpRegisters.X(Rn), m_gpRegisters.X(Rm), static_cast< std::uint64_t >(C[0]));
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
-                static_assert(std::is_same_v< decltype(nzcv), std::bitset< 4 > >);
-                SetNZCV(nzcv);
+                auto result = AddWithCarrySetFlags< datasize >(m_gpRegisters.X(Rn), m_gpRegisters.X(Rm), CarryFlag());
                 m_gpRegisters.write(Rd, result);
             } break;
             case DataProcessingRegisterGroup::AddSubtractCarry::SBC_64BIT: { // P.1282
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::AddSubtractCarry::SBC_64BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::AddSubtractCarry::SBC_64BIT,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 64;
 
                 auto               operand1 = m_gpRegisters.X(Rn);
                 decltype(operand1) operand2 = m_gpRegisters.X(Rm);
 
-                static_assert(std::is_same_v< decltype(operand2), std::bitset< datasize > >);
-                operand2.flip();
+                operand2 = NOT< datasize >(operand2);
 
-                auto [result, _] = AddWithCarry(operand1, operand2, C[0]);
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
+                auto [result, _] = AddWithCarry< datasize >(operand1, operand2, CarryFlag());
 
                 m_gpRegisters.write(Rd, result);
             } break;
             case DataProcessingRegisterGroup::AddSubtractCarry::SBCS_64BIT: { // P.1284
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::AddSubtractCarry::SBCS_64BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::AddSubtractCarry::SBCS_64BIT,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 64;
 
                 auto               operand1 = m_gpRegisters.X(Rn);
                 decltype(operand1) operand2 = m_gpRegisters.X(Rm);
 
-                static_assert(std::is_same_v< decltype(operand2), std::bitset< datasize > >);
-                operand2.flip();
+                operand2 = NOT< datasize >(operand2);
 
-                auto [result, nzcv] = AddWithCarry(operand1, operand2, C[0]);
-                static_assert(std::is_same_v< decltype(result), std::bitset< datasize > >);
-                static_assert(std::is_same_v< decltype(nzcv), std::bitset< 4 > >);
-                SetNZCV(nzcv);
+                auto result = AddWithCarrySetFlags< datasize >(operand1, operand2, CarryFlag());
                 m_gpRegisters.write(Rd, result);
             } break;
             default: {
-                throw undefined_instruction {};
+                return RaiseFault(Fault::UndefinedInstruction);
             } break;
         }
     }
     void Execute(Instruction&& instruction, DataProcessingRegisterGroup::RotateRightIntoFlags instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&& instruction, DataProcessingRegisterGroup::EvaluateIntoFlags instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&& instruction, DataProcessingRegisterGroup::ConditionalCompareRegister instructionType) {
-        auto nzcv = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::NZCV);
-        auto Rn   = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rn);
-        auto cond = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Cond);
-        auto Rm   = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rm);
+        auto nzcv = A64InstructionManager::Extract< A64InstructionManager::Tag::NZCV >(instruction);
+        auto Rn   = A64InstructionManager::Extract< A64InstructionManager::Tag::Rn >(instruction);
+        auto cond = A64InstructionManager::Extract< A64InstructionManager::Tag::CondHi >(instruction);
+        auto Rm   = A64InstructionManager::Extract< A64InstructionManager::Tag::Rm >(instruction);
 
         switch (instructionType) {
             case DataProcessingRegisterGroup::ConditionalCompareRegister::CCMNr_32BIT: { // P.854 + 88
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::ConditionalCompareRegister::CCMNr_32BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::ConditionalCompareRegister::CCMNr_32BIT,
+                               A64DecodeGroup::DataProcessingRegister);
 
-                constexpr auto   datasize = 32;
-                std::bitset< 4 > flags    = nzcv.ToULong();
+                constexpr auto datasize = 32;
+                std::uint32_t  flags    = nzcv;
 
                 auto operand1 = m_gpRegisters.W(Rn);
                 auto operand2 = m_gpRegisters.W(Rm);
-                static_assert(std::is_same_v< decltype(operand1), std::bitset< datasize > >);
-                static_assert(std::is_same_v< decltype(operand2), std::bitset< datasize > >);
 
                 if (ConditionHolds(cond, NZCV())) {
-                    auto [_, val] = AddWithCarry(operand1, operand2, 0);
+                    auto [_, val] = AddWithCarry< datasize >(operand1, operand2, 0);
                     flags         = val;
                 }
 
                 SetNZCV(flags);
             } break;
             case DataProcessingRegisterGroup::ConditionalCompareRegister::CCMPr_32BIT: { // P.858 + 88
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::ConditionalCompareRegister::CCMPr_32BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::ConditionalCompareRegister::CCMPr_32BIT,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 32;
 
-                std::bitset< 4 > flags = nzcv.ToULong();
+                std::uint32_t flags = nzcv;
 
                 auto operand1 = m_gpRegisters.W(Rn);
                 auto operand2 = m_gpRegisters.W(Rm);
-                static_assert(std::is_same_v< decltype(operand1), std::bitset< datasize > >);
-                static_assert(std::is_same_v< decltype(operand2), std::bitset< datasize > >);
 
                 if (ConditionHolds(cond, NZCV())) {
-                    operand2.flip();
-                    auto [_, val] = AddWithCarry(operand1, operand2, 1);
+                    operand2      = NOT< datasize >(operand2);
+                    auto [_, val] = AddWithCarry< datasize >(operand1, operand2, 1);
                     flags         = val;
                 }
                 SetNZCV(flags);
             } break;
             case DataProcessingRegisterGroup::ConditionalCompareRegister::CCMNr_64BIT: { // P.854 + 88
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::ConditionalCompareRegister::CCMNr_64BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::ConditionalCompareRegister::CCMNr_64BIT,
+                               A64DecodeGroup::DataProcessingRegister);
 
-                constexpr auto   datasize = 64;
-                std::bitset< 4 > flags    = nzcv.ToULong();
+                constexpr auto datasize = 64;
+                std::uint32_t  flags    = nzcv;
 
                 auto operand1 = m_gpRegisters.X(Rn);
                 auto operand2 = m_gpRegisters.X(Rm);
-                static_assert(std::is_same_v< decltype(operand1), std::bitset< datasize > >);
-                static_assert(std::is_same_v< decltype(operand2), std::bitset< datasize > >);
 
                 if (ConditionHolds(cond, NZCV())) {
-                    auto [_, val] = AddWithCarry(operand1, operand2, 0);
+                    auto [_, val] = AddWithCarry< datasize >(operand1, operand2, 0);
                     flags         = val;
                 }
 
                 SetNZCV(flags);
             } break;
             case DataProcessingRegisterGroup::ConditionalCompareRegister::CCMPr_64BIT: { // P.858 + 88
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::ConditionalCompareRegister::CCMPr_64BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::ConditionalCompareRegister::CCMPr_64BIT,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 64;
 
-                std::bitset< 4 > flags = nzcv.ToULong();
+                std::uint32_t flags = nzcv;
 
                 auto operand1 = m_gpRegisters.X(Rn);
                 auto operand2 = m_gpRegisters.X(Rm);
-                static_assert(std::is_same_v< decltype(operand1), std::bitset< datasize > >);
-                static_assert(std::is_same_v< decltype(operand2), std::bitset< datasize > >);
 
                 if (ConditionHolds(cond, NZCV())) {
-                    operand2.flip();
-                    auto [_, val] = AddWithCarry(operand1, operand2, 1);
+                    operand2      = NOT< datasize >(operand2);
+                    auto [_, val] = AddWithCarry< datasize >(operand1, operand2, 1);
                     flags         = val;
                 }
                 SetNZCV(flags);
             } break;
             default:
-                throw undefined_instruction {};
+                return RaiseFault(Fault::UndefinedInstruction);
                 break;
         }
     }
     void Execute(Instruction&& instruction, DataProcessingRegisterGroup::ConditionalCompareImmediate instructionType) {
-        auto nzcv = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::NZCV);
-        auto Rn   = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rn);
-        auto cond = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Cond);
-        auto imm5 = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Imm5);
+        auto nzcv = A64InstructionManager::Extract< A64InstructionManager::Tag::NZCV >(instruction);
+        auto Rn   = A64InstructionManager::Extract< A64InstructionManager::Tag::Rn >(instruction);
+        auto cond = A64InstructionManager::Extract< A64InstructionManager::Tag::CondHi >(instruction);
+        auto imm5 = A64InstructionManager::Extract< A64InstructionManager::Tag::Imm5 >(instruction);
 
         switch (instructionType) {
             case DataProcessingRegisterGroup::ConditionalCompareImmediate::CCMNi_32BIT: { // P.852 + 88
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::ConditionalCompareImmediate::CCMNi_32BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::ConditionalCompareImmediate::CCMNi_32BIT,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 32;
 
-                std::bitset< 4 > flags = nzcv.ToULong();
-                auto             imm   = ZeroExtend< datasize, 5 >(imm5.ToULong());
+                std::uint32_t flags = nzcv;
+                auto          imm   = ZeroExtend< datasize >(imm5, 5);
 
                 auto operand1 = m_gpRegisters.W(Rn);
-                static_assert(std::is_same_v< decltype(operand1), std::bitset< datasize > >);
 
                 if (ConditionHolds(cond, NZCV())) {
-                    auto [_, val] = AddWithCarry(operand1, imm, 0);
+                    auto [_, val] = AddWithCarry< datasize >(operand1, imm, 0);
                     flags         = val;
                 }
                 SetNZCV(flags);
             } break;
             case DataProcessingRegisterGroup::ConditionalCompareImmediate::CCMPi_32BIT: { // P.856 + 88
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::ConditionalCompareImmediate::CCMPi_32BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::ConditionalCompareImmediate::CCMPi_32BIT,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 32;
 
-                std::bitset< 4 > flags = nzcv.ToULong();
-                auto             imm   = ZeroExtend< datasize, 5 >(imm5.ToULong());
-                static_assert(std::is_same_v< decltype(imm), std::bitset< datasize > >);
+                std::uint32_t flags = nzcv;
+                auto          imm   = ZeroExtend< datasize >(imm5, 5);
 
-                auto operand1 = m_gpRegisters.W(Rn);
-                static_assert(std::is_same_v< decltype(operand1), std::bitset< datasize > >);
-                auto operand2 = std::bitset< datasize > {};
+                auto          operand1 = m_gpRegisters.W(Rn);
+                std::uint64_t operand2 = 0;
 
                 if (ConditionHolds(cond, NZCV())) {
-                    operand2 = ~imm;
-                    (void)AddWithCarry(operand1, operand2, 1); // TODO: Check
+                    operand2 = NOT< datasize >(imm);
+                    (void)AddWithCarry< datasize >(operand1, operand2, 1); // TODO: Check
                 }
                 SetNZCV(flags);
             } break;
             case DataProcessingRegisterGroup::ConditionalCompareImmediate::CCMNi_64BIT: { // P.852 + 88
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::ConditionalCompareImmediate::CCMNi_64BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::ConditionalCompareImmediate::CCMNi_64BIT,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 64;
 
-                std::bitset< 4 > flags = nzcv.ToULong();
-                auto             imm   = ZeroExtend< datasize, 5 >(imm5.ToULong());
+                std::uint32_t flags = nzcv;
+                auto          imm   = ZeroExtend< datasize >(imm5, 5);
 
                 auto operand1 = m_gpRegisters.X(Rn);
-                static_assert(std::is_same_v< decltype(operand1), std::bitset< datasize > >);
 
                 if (ConditionHolds(cond, NZCV())) {
-                    auto [_, val] = AddWithCarry(operand1, imm, 0);
+                    auto [_, val] = AddWithCarry< datasize >(operand1, imm, 0);
                     flags         = val;
                 }
                 SetNZCV(flags);
             } break;
             case DataProcessingRegisterGroup::ConditionalCompareImmediate::CCMPi_64BIT: { // P.856 + 88
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::ConditionalCompareImmediate::CCMPi_64BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::ConditionalCompareImmediate::CCMPi_64BIT,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 64;
 
-                std::bitset< 4 > flags = nzcv.ToULong();
-                auto             imm   = ZeroExtend< datasize, 5 >(imm5.ToULong());
-                static_assert(std::is_same_v< decltype(imm), std::bitset< datasize > >);
+                std::uint32_t flags = nzcv;
+                auto          imm   = ZeroExtend< datasize >(imm5, 5);
 
-                auto operand1 = m_gpRegisters.X(Rn);
-                static_assert(std::is_same_v< decltype(operand1), std::bitset< datasize > >);
-                auto operand2 = std::bitset< datasize > {};
+                auto          operand1 = m_gpRegisters.X(Rn);
+                std::uint64_t operand2 = 0;
 
                 if (ConditionHolds(cond, NZCV())) {
-                    operand2 = ~imm;
-                    (void)AddWithCarry(operand1, operand2, 1); // TODO: Check
+                    operand2 = NOT< datasize >(imm);
+                    (void)AddWithCarry< datasize >(operand1, operand2, 1); // TODO: Check
                 }
                 SetNZCV(flags);
             } break;
             default:
-                throw undefined_instruction {};
+                return RaiseFault(Fault::UndefinedInstruction);
                 break;
         }
     }
     void Execute(Instruction&& instruction, DataProcessingRegisterGroup::ConditionalSelect instructionType) {
-        auto Rd   = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rd);
-        auto Rn   = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rn);
-        auto Rm   = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rm);
-        auto cond = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Cond);
+        auto Rd   = A64InstructionManager::Extract< A64InstructionManager::Tag::Rd >(instruction);
+        auto Rn   = A64InstructionManager::Extract< A64InstructionManager::Tag::Rn >(instruction);
+        auto Rm   = A64InstructionManager::Extract< A64InstructionManager::Tag::Rm >(instruction);
+        auto cond = A64InstructionManager::Extract< A64InstructionManager::Tag::CondHi >(instruction);
 
         switch (instructionType) {
             case DataProcessingRegisterGroup::ConditionalSelect::CSEL_32BIT: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case DataProcessingRegisterGroup::ConditionalSelect::CSINC_32BIT: { // P.896 + 88
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::ConditionalSelect::CSINC_32BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::ConditionalSelect::CSINC_32BIT,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 32;
                 auto           operand1 = m_gpRegisters.W(Rn);
                 auto           operand2 = m_gpRegisters.W(Rm);
 
-                std::bitset< datasize > result;
+                std::uint64_t result = 0;
 
                 if (ConditionHolds(cond, NZCV())) {
                     result = operand1;
                 } else {
-                    result = operand2.to_ullong() + 1;
+                    result = (operand2 + 1) & Ones(datasize);
                 }
-                m_gpRegisters.write(Rd, result);
+                m_gpRegisters.write(Rd, static_cast< std::uint32_t >(result));
             } break;
             case DataProcessingRegisterGroup::ConditionalSelect::CSINV_32BIT: { // P.898 + 88
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::ConditionalSelect::CSINV_32BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::ConditionalSelect::CSINV_32BIT,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 32;
 
                 auto operand1 = m_gpRegisters.W(Rn);
                 auto operand2 = m_gpRegisters.W(Rm);
 
-                static_assert(std::is_same_v< decltype(operand1), std::bitset< datasize > >);
-                static_assert(std::is_same_v< decltype(operand2), std::bitset< datasize > >);
                 decltype(operand1) result;
 
                 if (ConditionHolds(cond, NZCV()))
                     result = operand1;
                 else
-                    result = ~operand2;
+                    result = NOT< datasize >(operand2);
 
-                m_gpRegisters.write(Rd, result);
+                m_gpRegisters.write(Rd, static_cast< std::uint32_t >(result));
             } break;
             case DataProcessingRegisterGroup::ConditionalSelect::CSNEG_32BIT: { // P.900 + 88
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::ConditionalSelect::CSNEG_32BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::ConditionalSelect::CSNEG_32BIT,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 32;
 
                 auto operand1 = m_gpRegisters.W(Rn);
                 auto operand2 = m_gpRegisters.W(Rm);
-                static_assert(std::is_same_v< decltype(operand1), std::bitset< datasize > >);
-                static_assert(std::is_same_v< decltype(operand2), std::bitset< datasize > >);
                 decltype(operand1) result;
 
                 if (ConditionHolds(cond, NZCV())) {
                     result = operand1;
                 } else {
-                    get_type_t< datasize > res = static_cast< get_type_t< datasize > >((~operand2).to_ullong());
-                    result = static_cast< get_type_t< datasize > >(res) + static_cast< get_type_t< datasize > >(1);
+                    result = (NOT< datasize >(operand2) + 1) & Ones(datasize);
                 }
 
-                m_gpRegisters.write(Rd, result);
+                m_gpRegisters.write(Rd, static_cast< std::uint32_t >(result));
             } break;
             case DataProcessingRegisterGroup::ConditionalSelect::CSEL_64BIT: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case DataProcessingRegisterGroup::ConditionalSelect::CSINC_64BIT: { // P.896 + 88
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::ConditionalSelect::CSINC_64BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::ConditionalSelect::CSINC_64BIT,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 64;
                 auto           operand1 = m_gpRegisters.X(Rn);
                 auto           operand2 = m_gpRegisters.X(Rm);
 
-                std::bitset< datasize > result;
+                std::uint64_t result = 0;
 
                 if (ConditionHolds(cond, NZCV())) {
                     result = operand1;
                 } else {
-                    result = operand2.to_ullong() + 1;
+                    result = (operand2 + 1) & Ones(datasize);
                 }
                 m_gpRegisters.write(Rd, result);
             } break;
             case DataProcessingRegisterGroup::ConditionalSelect::CSINV_64BIT: { // P.898 + 88
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::ConditionalSelect::CSINV_64BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::ConditionalSelect::CSINV_64BIT,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 64;
 
                 auto operand1 = m_gpRegisters.X(Rn);
                 auto operand2 = m_gpRegisters.X(Rm);
 
-                static_assert(std::is_same_v< decltype(operand1), std::bitset< datasize > >);
-                static_assert(std::is_same_v< decltype(operand2), std::bitset< datasize > >);
                 decltype(operand1) result;
 
                 if (ConditionHolds(cond, NZCV()))
                     result = operand1;
                 else
-                    result = ~operand2;
+                    result = NOT< datasize >(operand2);
 
                 m_gpRegisters.write(Rd, result);
             } break;
             case DataProcessingRegisterGroup::ConditionalSelect::CSNEG_64BIT: { // P.900 + 88
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::ConditionalSelect::CSNEG_64BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::ConditionalSelect::CSNEG_64BIT,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 64;
 
                 auto operand1 = m_gpRegisters.X(Rn);
                 auto operand2 = m_gpRegisters.X(Rm);
-                static_assert(std::is_same_v< decltype(operand1), std::bitset< datasize > >);
-                static_assert(std::is_same_v< decltype(operand2), std::bitset< datasize > >);
                 decltype(operand1) result;
 
                 if (ConditionHolds(cond, NZCV())) {
                     result = operand1;
                 } else {
-                    get_type_t< datasize > res = static_cast< get_type_t< datasize > >((~operand2).to_ullong());
-                    result                     = res + static_cast< get_type_t< datasize > >(1);
+                    result = (NOT< datasize >(operand2) + 1) & Ones(datasize);
                 }
 
                 m_gpRegisters.write(Rd, result);
             } break;
             default: {
-                throw undefined_instruction {};
+                return RaiseFault(Fault::UndefinedInstruction);
             } break;
         }
     }
     void Execute(Instruction&& instruction, DataProcessingRegisterGroup::DataProcessingThreeSource instructionType) {
-        auto Rm = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rm);
-        auto Ra = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Ra);
-        auto Rn = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rn);
-        auto Rd = A64InstructionManager::Get(instruction, A64InstructionManager::Tag::Rd);
+        auto Rm = A64InstructionManager::Extract< A64InstructionManager::Tag::Rm >(instruction);
+        auto Ra = A64InstructionManager::Extract< A64InstructionManager::Tag::Ra >(instruction);
+        auto Rn = A64InstructionManager::Extract< A64InstructionManager::Tag::Rn >(instruction);
+        auto Rd = A64InstructionManager::Extract< A64InstructionManager::Tag::Rd >(instruction);
 
         switch (instructionType) {
             case DataProcessingRegisterGroup::DataProcessingThreeSource::MADD_32BIT: { // P.1200
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::DataProcessingThreeSource::MADD_32BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::DataProcessingThreeSource::MADD_32BIT,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 32;
 
@@ -3606,20 +3259,14 @@ struct A64ProcessState : public A64ProcessingUnit::ProcessState {
                 auto operand2 = m_gpRegisters.W(Rm);
                 auto operand3 = m_gpRegisters.W(Ra);
 
-                static_assert(std::is_same_v< decltype(operand1), std::bitset< datasize > >);
-                static_assert(std::is_same_v< decltype(operand2), std::bitset< datasize > >);
-                static_assert(std::is_same_v< decltype(operand3), std::bitset< datasize > >);
 
-                auto result =
-                    std::bitset< datasize > { operand3.to_ullong() + (operand1.to_ullong() * operand2.to_ullong()) };
+                auto result = (operand3 + (operand1 * operand2)) & Ones(datasize);
 
-                m_gpRegisters.write(Rd, result);
+                m_gpRegisters.write(Rd, static_cast< std::uint32_t >(result));
             } break;
             case DataProcessingRegisterGroup::DataProcessingThreeSource::MSUB_32BIT: { // P.1224
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::DataProcessingThreeSource::MSUB_32BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::DataProcessingThreeSource::MSUB_32BIT,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 32;
 
@@ -3627,20 +3274,14 @@ struct A64ProcessState : public A64ProcessingUnit::ProcessState {
                 auto operand2 = m_gpRegisters.W(Rm);
                 auto operand3 = m_gpRegisters.W(Ra);
 
-                static_assert(std::is_same_v< decltype(operand1), std::bitset< datasize > >);
-                static_assert(std::is_same_v< decltype(operand2), std::bitset< datasize > >);
-                static_assert(std::is_same_v< decltype(operand3), std::bitset< datasize > >);
 
-                auto result =
-                    std::bitset< datasize > { operand3.to_ullong() - (operand1.to_ullong() * operand2.to_ullong()) };
+                auto result = (operand3 - (operand1 * operand2)) & Ones(datasize);
 
-                m_gpRegisters.write(Rd, result);
+                m_gpRegisters.write(Rd, static_cast< std::uint32_t >(result));
             } break;
             case DataProcessingRegisterGroup::DataProcessingThreeSource::MADD_64BIT: { // P.1200
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::DataProcessingThreeSource::MADD_64BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::DataProcessingThreeSource::MADD_64BIT,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 64;
 
@@ -3648,20 +3289,14 @@ struct A64ProcessState : public A64ProcessingUnit::ProcessState {
                 auto operand2 = m_gpRegisters.X(Rm);
                 auto operand3 = m_gpRegisters.X(Ra);
 
-                static_assert(std::is_same_v< decltype(operand1), std::bitset< datasize > >);
-                static_assert(std::is_same_v< decltype(operand2), std::bitset< datasize > >);
-                static_assert(std::is_same_v< decltype(operand3), std::bitset< datasize > >);
 
-                auto result =
-                    std::bitset< datasize > { operand3.to_ullong() + (operand1.to_ullong() * operand2.to_ullong()) };
+                auto result = (operand3 + (operand1 * operand2)) & Ones(datasize);
 
                 m_gpRegisters.write(Rd, result);
             } break;
             case DataProcessingRegisterGroup::DataProcessingThreeSource::MSUB_64BIT: { // P.1224
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::DataProcessingThreeSource::MSUB_64BIT),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::DataProcessingThreeSource::MSUB_64BIT,
+                               A64DecodeGroup::DataProcessingRegister);
 
                 constexpr auto datasize = 64;
 
@@ -3669,1101 +3304,1372 @@ struct A64ProcessState : public A64ProcessingUnit::ProcessState {
                 auto operand2 = m_gpRegisters.X(Rm);
                 auto operand3 = m_gpRegisters.X(Ra);
 
-                static_assert(std::is_same_v< decltype(operand1), std::bitset< datasize > >);
-                static_assert(std::is_same_v< decltype(operand2), std::bitset< datasize > >);
-                static_assert(std::is_same_v< decltype(operand3), std::bitset< datasize > >);
 
-                auto result =
-                    std::bitset< datasize > { operand3.to_ullong() - (operand1.to_ullong() * operand2.to_ullong()) };
+                auto result = (operand3 - (operand1 * operand2)) & Ones(datasize);
 
                 m_gpRegisters.write(Rd, result);
             } break;
             case DataProcessingRegisterGroup::DataProcessingThreeSource::SMADDL: { // P.1297
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::DataProcessingThreeSource::SMADDL),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::DataProcessingThreeSource::SMADDL,
+                               A64DecodeGroup::DataProcessingRegister);
 
-                std::bitset< 32 > operand1 = m_gpRegisters.W(Rn);
-                std::bitset< 32 > operand2 = m_gpRegisters.W(Rm);
-                std::bitset< 64 > operand3 = m_gpRegisters.X(Ra);
+                const auto operand1 = m_gpRegisters.W(Rn);
+                const auto operand2 = m_gpRegisters.W(Rm);
+                const auto operand3 = m_gpRegisters.X(Ra);
 
-                std::int64_t result = std::bit_cast< std::int64_t >(operand3.to_ullong()) +
-                                      (std::bit_cast< std::int64_t >(operand1.to_ullong()) *
-                                       std::bit_cast< std::int64_t >(operand2.to_ullong()));
+                std::int64_t result = std::bit_cast< std::int64_t >(operand3) +
+                                      (static_cast< std::int64_t >(operand1) * static_cast< std::int64_t >(operand2));
 
                 m_gpRegisters.write(Rd, std::bit_cast< std::uint64_t >(result));
             } break;
             case DataProcessingRegisterGroup::DataProcessingThreeSource::SMSUBL: { // P.1301
-                m_debugObject.Log(LogType::Instruction, instructionLogStatement,
-                                  std::bitset< 32 > { instruction.Get() }.to_string(),
-                                  Enum::ToChar(DataProcessingRegisterGroup::DataProcessingThreeSource::SMSUBL),
-                                  Enum::ToChar(A64DecodeGroup::DataProcessingRegister));
+                LogInstruction(instruction, DataProcessingRegisterGroup::DataProcessingThreeSource::SMSUBL,
+                               A64DecodeGroup::DataProcessingRegister);
 
-                std::bitset< 32 > operand1 = m_gpRegisters.W(Rn);
-                std::bitset< 32 > operand2 = m_gpRegisters.W(Rm);
-                std::bitset< 64 > operand3 = m_gpRegisters.X(Ra);
+                const auto operand1 = m_gpRegisters.W(Rn);
+                const auto operand2 = m_gpRegisters.W(Rm);
+                const auto operand3 = m_gpRegisters.X(Ra);
 
-                std::int64_t result = std::bit_cast< std::int64_t >(operand3.to_ullong()) -
-                                      (std::bit_cast< std::int64_t >(operand1.to_ullong()) *
-                                       std::bit_cast< std::int64_t >(operand2.to_ullong()));
+                std::int64_t result = std::bit_cast< std::int64_t >(operand3) -
+                                      (static_cast< std::int64_t >(operand1) * static_cast< std::int64_t >(operand2));
 
                 m_gpRegisters.write(Rd, std::bit_cast< std::uint64_t >(result));
             } break;
             case DataProcessingRegisterGroup::DataProcessingThreeSource::SMULH: { // P.1303
-                std::bitset< 64 > operand1 = m_gpRegisters.X(Rn);
-                std::bitset< 64 > operand2 = m_gpRegisters.X(Rm);
+                const auto operand1 = m_gpRegisters.X(Rn);
+                const auto operand2 = m_gpRegisters.X(Rm);
 
-                // bitset multiply to 128
+                // TODO: multiply to 128
+                (void)operand1;
+                (void)operand2;
             } break;
             case DataProcessingRegisterGroup::DataProcessingThreeSource::UMADDL: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case DataProcessingRegisterGroup::DataProcessingThreeSource::UMSUBL: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             case DataProcessingRegisterGroup::DataProcessingThreeSource::UMULH: {
-                throw not_implemented_feature {};
+                return RaiseFault(Fault::NotImplementedFeature);
             } break;
             default: {
-                throw undefined_instruction {};
+                return RaiseFault(Fault::UndefinedInstruction);
             } break;
         }
     }
 
     void Execute(Instruction&&                                                        instruction,
                  DataProcessingScalarFloatingPointAdvancedSIMDGroup::CryptographicAES instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&&                                                                     instruction,
                  DataProcessingScalarFloatingPointAdvancedSIMDGroup::CryptographicThreeRegisterSHA instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&&                                                                   instruction,
                  DataProcessingScalarFloatingPointAdvancedSIMDGroup::CryptographicTwoRegisterSHA instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&&                                                              instruction,
                  DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDScalarCopy instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&&                                                                       instruction,
                  DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDScalarThreeSameFP16 instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&& instruction,
                  DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDScalarTwoRegisterMiscellaneousFP16
                      instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(
         Instruction&&                                                                             instruction,
         DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDScalarThreeSameExtraction instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&& instruction,
                  DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDScalarTwoRegisterMiscellaneous
                      instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&&                                                                  instruction,
                  DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDScalarPairwise instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&&                                                                        instruction,
                  DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDScalarThreeDifferent instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&&                                                                   instruction,
                  DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDScalarThreeSame instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(
         Instruction&&                                                                          instruction,
         DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDScalarShiftByImmediate instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void
         Execute(Instruction&&                                                                         instruction,
                 DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDScalarXIndexedElement instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&&                                                               instruction,
                  DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDTableLookup instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&&                                                           instruction,
                  DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDPermute instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&&                                                           instruction,
                  DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDExtract instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&&                                                        instruction,
                  DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDCopy instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&&                                                                 instruction,
                  DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDThreeSameFP16 instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(
         Instruction&&                                                                                instruction,
         DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDTwoRegisterMiscellaneousFP16 instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(
         Instruction&&                                                                          instruction,
         DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDThreeRegisterExtension instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(
         Instruction&&                                                                            instruction,
         DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDTwoRegisterMiscellaneous instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&&                                                               instruction,
                  DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDAcrossLanes instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&&                                                                  instruction,
                  DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDThreeDifferent instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&&                                                             instruction,
                  DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDThreeSame instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&&                                                                     instruction,
                  DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDModifiedImmediate instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&&                                                                    instruction,
                  DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDShiftByImmediate instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void
         Execute(Instruction&&                                                                         instruction,
                 DataProcessingScalarFloatingPointAdvancedSIMDGroup::AdvancedSIMDVectorXIndexedElement instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&&                                                                      instruction,
                  DataProcessingScalarFloatingPointAdvancedSIMDGroup::CryptographicThreeRegisterIMM2 instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&&                                                                        instruction,
                  DataProcessingScalarFloatingPointAdvancedSIMDGroup::CryptographicThreeRegisterSHA512 instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&&                                                                 instruction,
                  DataProcessingScalarFloatingPointAdvancedSIMDGroup::CryptographicFourRegister instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&& instruction, DataProcessingScalarFloatingPointAdvancedSIMDGroup::XAR instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&&                                                                      instruction,
                  DataProcessingScalarFloatingPointAdvancedSIMDGroup::CryptographicTwoRegisterSHA512 instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(
         Instruction&&                                                                            instruction,
         DataProcessingScalarFloatingPointAdvancedSIMDGroup::ConversionFloatingPointAndFixedPoint instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void
         Execute(Instruction&&                                                                         instruction,
                 DataProcessingScalarFloatingPointAdvancedSIMDGroup::ConversionFloatingPointAndInteger instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(
         Instruction&&                                                                            instruction,
         DataProcessingScalarFloatingPointAdvancedSIMDGroup::FloatingPointDataProcessingOneSource instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&&                                                            instruction,
                  DataProcessingScalarFloatingPointAdvancedSIMDGroup::FloatingPointCompare instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&&                                                              instruction,
                  DataProcessingScalarFloatingPointAdvancedSIMDGroup::FloatingPointImmediate instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&&                                                                       instruction,
                  DataProcessingScalarFloatingPointAdvancedSIMDGroup::FloatingPointConditionalCompare instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(
         Instruction&&                                                                            instruction,
         DataProcessingScalarFloatingPointAdvancedSIMDGroup::FloatingPointDataProcessingTwoSource instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(Instruction&&                                                                      instruction,
                  DataProcessingScalarFloatingPointAdvancedSIMDGroup::FloatingPointConditionalSelect instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
     void Execute(
         Instruction&&                                                                              instruction,
         DataProcessingScalarFloatingPointAdvancedSIMDGroup::FloatingPointDataProcessingThreeSource instructionType) {
-        throw not_implemented_feature {};
+        return RaiseFault(Fault::NotImplementedFeature);
     }
 
     void Execute(Instruction&& instruction, A64ReservedGroup instructionClass) {
         switch (instructionClass) {
-            case A64ReservedGroup::UDP:
-                throw not_implemented_feature {};
+            case A64ReservedGroup::UDP: // UDF is permanently undefined
+                return RaiseFault(Fault::UndefinedInstruction);
                 break;
             default: {
-                throw undefined_instruction {};
+                // Instructions that failed to decode end up here as well
+                if (A64InstructionManager::GetDecodeGroup(instruction) == A64DecodeGroup::ScalableVectorExtension) {
+                    return RaiseFault(Fault::NotImplementedFeature);
+                }
+                return RaiseFault(Fault::UndefinedInstruction);
             } break;
         }
     }
-    void Execute(Instruction&& instruction, A64DataProcessingImmediateGroup instructionClass) {
-        switch (instructionClass) {
-            case A64DataProcessingImmediateGroup::PC_RELATIVE_ADDRESSING: {
-                const auto instructionType =
-                    DataProcessingImmediateGroup::GetInstance()
-                        .GetInstructionType< A64DataProcessingImmediateGroup::PC_RELATIVE_ADDRESSING >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingImmediateGroup::ADD_SUBTRACT_IMMEDIATE: {
-                const auto instructionType =
-                    DataProcessingImmediateGroup::GetInstance()
-                        .GetInstructionType< A64DataProcessingImmediateGroup::ADD_SUBTRACT_IMMEDIATE >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingImmediateGroup::ADD_SUBTRACT_IMMEDIATE_TAG: {
-                const auto instructionType =
-                    DataProcessingImmediateGroup::GetInstance()
-                        .GetInstructionType< A64DataProcessingImmediateGroup::ADD_SUBTRACT_IMMEDIATE_TAG >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingImmediateGroup::LOGICAL_IMMEDIATE: {
-                const auto instructionType =
-                    DataProcessingImmediateGroup::GetInstance()
-                        .GetInstructionType< A64DataProcessingImmediateGroup::LOGICAL_IMMEDIATE >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingImmediateGroup::MOVE_WIDE_IMMEDIATE: {
-                const auto instructionType =
-                    DataProcessingImmediateGroup::GetInstance()
-                        .GetInstructionType< A64DataProcessingImmediateGroup::MOVE_WIDE_IMMEDIATE >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingImmediateGroup::BITFIELD: {
-                const auto instructionType =
-                    DataProcessingImmediateGroup::GetInstance()
-                        .GetInstructionType< A64DataProcessingImmediateGroup::BITFIELD >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingImmediateGroup::EXTRACT: {
-                const auto instructionType =
-                    DataProcessingImmediateGroup::GetInstance()
-                        .GetInstructionType< A64DataProcessingImmediateGroup::BITFIELD >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            default: {
-                throw undefined_instruction {};
-            } break;
-        }
+
+    using InstructionHandler = void (A64ProcessState::*)(Instruction&&);
+
+    /// @brief Handler bound to a single leaf instruction type, the instruction type is known at compile time so the
+    /// leaf switch of the matching Execute overload folds into the handler
+    template < auto InstructionType >
+    void ExecuteAs(Instruction&& instruction) {
+        Execute(std::move(instruction), InstructionType);
     }
-    void Execute(Instruction&& instruction, A64BranchExceptionSystemGroup instructionClass) {
-        switch (instructionClass) {
-            case A64BranchExceptionSystemGroup::CONDITIONAL_BRANCHING: {
-                const auto instructionType =
-                    BranchExceptionSystemGroup::GetInstance()
-                        .GetInstructionType< A64BranchExceptionSystemGroup::CONDITIONAL_BRANCHING >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64BranchExceptionSystemGroup::EXCEPTION_GENERATION: {
-                const auto instructionType =
-                    BranchExceptionSystemGroup::GetInstance()
-                        .GetInstructionType< A64BranchExceptionSystemGroup::EXCEPTION_GENERATION >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64BranchExceptionSystemGroup::HINTS: {
-                const auto instructionType =
-                    BranchExceptionSystemGroup::GetInstance()
-                        .GetInstructionType< A64BranchExceptionSystemGroup::HINTS >(instruction);
-                Execute(std::move(instruction), instructionType);
-                throw not_implemented_feature {};
-            } break;
-            case A64BranchExceptionSystemGroup::BARRIERS: {
-                const auto instructionType =
-                    BranchExceptionSystemGroup::GetInstance()
-                        .GetInstructionType< A64BranchExceptionSystemGroup::BARRIERS >(instruction);
-                Execute(std::move(instruction), instructionType);
-                throw not_implemented_feature {};
-            } break;
-            case A64BranchExceptionSystemGroup::PSTATE: {
-                const auto instructionType =
-                    BranchExceptionSystemGroup::GetInstance()
-                        .GetInstructionType< A64BranchExceptionSystemGroup::PSTATE >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64BranchExceptionSystemGroup::SYSTEM_INSTRUCTIONS: {
-                const auto instructionType =
-                    BranchExceptionSystemGroup::GetInstance()
-                        .GetInstructionType< A64BranchExceptionSystemGroup::SYSTEM_INSTRUCTIONS >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64BranchExceptionSystemGroup::SYSTEM_REGISTER_MOVE: {
-                const auto instructionType =
-                    BranchExceptionSystemGroup::GetInstance()
-                        .GetInstructionType< A64BranchExceptionSystemGroup::SYSTEM_REGISTER_MOVE >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64BranchExceptionSystemGroup::UNCONDITIONAL_BRANCH_REGISTER: {
-                const auto instructionType =
-                    BranchExceptionSystemGroup::GetInstance()
-                        .GetInstructionType< A64BranchExceptionSystemGroup::UNCONDITIONAL_BRANCH_REGISTER >(
-                            instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64BranchExceptionSystemGroup::UNCONDITIONAL_BRANCH_IMMEDIATE: {
-                const auto instructionType =
-                    BranchExceptionSystemGroup::GetInstance()
-                        .GetInstructionType< A64BranchExceptionSystemGroup::UNCONDITIONAL_BRANCH_IMMEDIATE >(
-                            instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64BranchExceptionSystemGroup::COMPARE_AND_BRANCH_IMMEDIATE: {
-                const auto instructionType =
-                    BranchExceptionSystemGroup::GetInstance()
-                        .GetInstructionType< A64BranchExceptionSystemGroup::COMPARE_AND_BRANCH_IMMEDIATE >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64BranchExceptionSystemGroup::TEST_AND_BRANCH_IMMEDIATE: {
-                const auto instructionType =
-                    BranchExceptionSystemGroup::GetInstance()
-                        .GetInstructionType< A64BranchExceptionSystemGroup::TEST_AND_BRANCH_IMMEDIATE >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            default: {
-                throw undefined_instruction {};
-            } break;
-        }
+
+    template < class InstructionType, std::size_t... Values >
+    static constexpr auto BuildInstructionClassHandlers(std::index_sequence< Values... >) noexcept {
+        return std::array< InstructionHandler, sizeof...(Values) + 1 > {
+            &A64ProcessState::ExecuteAs< static_cast< InstructionType >(Values) >...,
+            &A64ProcessState::ExecuteAs< InstructionType::Undefined >
+        };
     }
-    void Execute(Instruction&& instruction, A64LoadStoreGroup instructionClass) {
-        switch (instructionClass) {
-            case A64LoadStoreGroup::ADVANCED_SIMD_LOAD_STORE_MULTIPLE_STRUCTURES: {
-                const auto instructionType =
-                    LoadStoreGroup::GetInstance()
-                        .GetInstructionType< A64LoadStoreGroup::ADVANCED_SIMD_LOAD_STORE_MULTIPLE_STRUCTURES >(
-                            instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64LoadStoreGroup::ADVANCED_SIMD_LOAD_STORE_MULTIPLE_STRUCTURES_POST_INDEXED: {
-                const auto instructionType =
-                    LoadStoreGroup::GetInstance()
-                        .GetInstructionType<
-                            A64LoadStoreGroup::ADVANCED_SIMD_LOAD_STORE_MULTIPLE_STRUCTURES_POST_INDEXED >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64LoadStoreGroup::ADVANCED_SIMD_LOAD_STORE_SINGLE_STRUCTURE: {
-                const auto instructionType =
-                    LoadStoreGroup::GetInstance()
-                        .GetInstructionType< A64LoadStoreGroup::ADVANCED_SIMD_LOAD_STORE_SINGLE_STRUCTURE >(
-                            instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64LoadStoreGroup::ADVANCED_SIMD_LOAD_STORE_SINGLE_STRUCTURE_POST_INDEXED: {
-                const auto instructionType =
-                    LoadStoreGroup::GetInstance()
-                        .GetInstructionType<
-                            A64LoadStoreGroup::ADVANCED_SIMD_LOAD_STORE_SINGLE_STRUCTURE_POST_INDEXED >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64LoadStoreGroup::LOAD_STORE_MEMORY_TAG: {
-                const auto instructionType =
-                    LoadStoreGroup::GetInstance().GetInstructionType< A64LoadStoreGroup::LOAD_STORE_MEMORY_TAG >(
-                        instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64LoadStoreGroup::LOAD_STORE_EXCLUSIVE: {
-                const auto instructionType =
-                    LoadStoreGroup::GetInstance().GetInstructionType< A64LoadStoreGroup::LOAD_STORE_EXCLUSIVE >(
-                        instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64LoadStoreGroup::LDAPR_STLR_UNSCALED_IMMEDIATE: {
-                const auto instructionType =
-                    LoadStoreGroup::GetInstance()
-                        .GetInstructionType< A64LoadStoreGroup::LDAPR_STLR_UNSCALED_IMMEDIATE >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64LoadStoreGroup::LOAD_REGISTER_LITERAL: {
-                const auto instructionType =
-                    LoadStoreGroup::GetInstance().GetInstructionType< A64LoadStoreGroup::LOAD_REGISTER_LITERAL >(
-                        instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64LoadStoreGroup::LOAD_STORE_NO_ALLOCATE_PAIR_OFFSET: {
-                const auto instructionType =
-                    LoadStoreGroup::GetInstance()
-                        .GetInstructionType< A64LoadStoreGroup::LOAD_STORE_NO_ALLOCATE_PAIR_OFFSET >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64LoadStoreGroup::LOAD_STORE_REGISTER_PAIR_POST_INDEXED: {
-                const auto instructionType =
-                    LoadStoreGroup::GetInstance()
-                        .GetInstructionType< A64LoadStoreGroup::LOAD_STORE_REGISTER_PAIR_POST_INDEXED >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64LoadStoreGroup::LOAD_STORE_REGISTER_PAIR_OFFSET: {
-                const auto instructionType =
-                    LoadStoreGroup::GetInstance()
-                        .GetInstructionType< A64LoadStoreGroup::LOAD_STORE_REGISTER_PAIR_OFFSET >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64LoadStoreGroup::LOAD_STORE_REGISTER_PAIR_PRE_INDEXED: {
-                const auto instructionType =
-                    LoadStoreGroup::GetInstance()
-                        .GetInstructionType< A64LoadStoreGroup::LOAD_STORE_REGISTER_PAIR_PRE_INDEXED >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64LoadStoreGroup::LOAD_STORE_REGISTER_UNSCALED_IMMEDIATE: {
-                const auto instructionType =
-                    LoadStoreGroup::GetInstance()
-                        .GetInstructionType< A64LoadStoreGroup::LOAD_STORE_REGISTER_UNSCALED_IMMEDIATE >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64LoadStoreGroup::LOAD_STORE_REGISTER_IMMEDIATE_POST_INDEXED: {
-                const auto instructionType =
-                    LoadStoreGroup::GetInstance()
-                        .GetInstructionType< A64LoadStoreGroup::LOAD_STORE_REGISTER_IMMEDIATE_POST_INDEXED >(
-                            instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64LoadStoreGroup::LOAD_STORE_REGISTER_UNPRIVILEGED: {
-                const auto instructionType =
-                    LoadStoreGroup::GetInstance()
-                        .GetInstructionType< A64LoadStoreGroup::LOAD_STORE_REGISTER_UNPRIVILEGED >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64LoadStoreGroup::LOAD_STORE_REGISTER_IMMEDIATE_PRE_INDEXED: {
-                const auto instructionType =
-                    LoadStoreGroup::GetInstance()
-                        .GetInstructionType< A64LoadStoreGroup::LOAD_STORE_REGISTER_IMMEDIATE_PRE_INDEXED >(
-                            instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64LoadStoreGroup::ATOMIC_MEMORY_OPERATION: {
-                const auto instructionType =
-                    LoadStoreGroup::GetInstance().GetInstructionType< A64LoadStoreGroup::ATOMIC_MEMORY_OPERATION >(
-                        instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64LoadStoreGroup::LOAD_STORE_REGISTER_REGISTER_OFFSET: {
-                const auto instructionType =
-                    LoadStoreGroup::GetInstance()
-                        .GetInstructionType< A64LoadStoreGroup::LOAD_STORE_REGISTER_REGISTER_OFFSET >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64LoadStoreGroup::LOAD_STORE_REGISTER_PAC: {
-                const auto instructionType =
-                    LoadStoreGroup::GetInstance().GetInstructionType< A64LoadStoreGroup::LOAD_STORE_REGISTER_PAC >(
-                        instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64LoadStoreGroup::LOAD_STORE_REGISTER_UNSIGNED_IMMEDIATE: {
-                const auto instructionType =
-                    LoadStoreGroup::GetInstance()
-                        .GetInstructionType< A64LoadStoreGroup::LOAD_STORE_REGISTER_UNSIGNED_IMMEDIATE >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            default: {
-                throw undefined_instruction {};
-            } break;
+
+    template < std::size_t... Alternatives >
+    static constexpr auto BuildInstructionHandlers(std::index_sequence< Alternatives... >) noexcept {
+        std::array< InstructionHandler, A64InstructionManager::Index_count > handlers {};
+        (
+            [&]() {
+                using Alternative = std::variant_alternative_t< Alternatives, A64InstructionType >;
+
+                const auto classHandlers = BuildInstructionClassHandlers< Alternative >(
+                    std::make_index_sequence< enum_size_v< Alternative > > {});
+                std::copy(classHandlers.begin(), classHandlers.end(),
+                          handlers.begin() + A64InstructionManager::Index_offsets[Alternatives]);
+            }(),
+            ...);
+        return handlers;
+    }
+
+    void Execute(const A64DecodedInstruction& decodedInstruction) {
+        static constexpr auto instructionHandlers =
+            BuildInstructionHandlers(std::make_index_sequence< std::variant_size_v< A64InstructionType > > {});
+
+        (this->*instructionHandlers[decodedInstruction.m_instructionIndex])(
+            Instruction { decodedInstruction.m_instruction });
+    }
+
+    using JitReg   = X64Assembler::Reg;
+    using JitWidth = X64Assembler::Width;
+    using JitEntry = void (*)(A64RegisterFile*);
+
+    /// @brief Executions of a block before it gets translated to host code
+    static constexpr std::uint32_t Jit_hotness_threshold = 16;
+
+    // Integer arguments of the host calling convention, translated code only ever passes three of them
+#if defined(ARMEMU_OS_WINDOWS)
+    static constexpr std::array< JitReg, 3 > Jit_arguments { JitReg::Rcx, JitReg::Rdx, JitReg::R8 };
+#else  // ARMEMU_OS_WINDOWS
+    static constexpr std::array< JitReg, 3 > Jit_arguments { JitReg::Rdi, JitReg::Rsi, JitReg::Rdx };
+#endif // !ARMEMU_OS_WINDOWS
+
+    // Entry points of translated code back into the process state. They return false once the access faulted, nothing
+    // may unwind through translated code so host exceptions are turned into faults like the run loop does.
+    template < std::unsigned_integral T >
+    static bool NativeLoad(A64ProcessState* self, std::uint64_t address, std::uint64_t* data) noexcept {
+        try {
+            const auto memoryData = self->m_memory.Read< T >(address);
+            if (!memoryData) {
+                return false;
+            }
+            *data = static_cast< std::uint64_t >(*memoryData);
+            return true;
+        } catch (...) {
+            self->RaiseFault(Fault::UndefinedBehaviour);
+            return false;
         }
     }
-    void Execute(Instruction&& instruction, A64DataProcessingRegisterGroup instructionClass) {
-        switch (instructionClass) {
-            case A64DataProcessingRegisterGroup::DATA_PROCESSING_TWO_SOURCE: {
-                const auto instructionType =
-                    DataProcessingRegisterGroup::GetInstance()
-                        .GetInstructionType< A64DataProcessingRegisterGroup::DATA_PROCESSING_TWO_SOURCE >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingRegisterGroup::DATA_PROCESSING_ONE_SOURCE: {
-                const auto instructionType =
-                    DataProcessingRegisterGroup::GetInstance()
-                        .GetInstructionType< A64DataProcessingRegisterGroup::DATA_PROCESSING_ONE_SOURCE >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingRegisterGroup::LOGICAL_SHIFTED_REGISTER: {
-                const auto instructionType =
-                    DataProcessingRegisterGroup::GetInstance()
-                        .GetInstructionType< A64DataProcessingRegisterGroup::LOGICAL_SHIFTED_REGISTER >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingRegisterGroup::ADD_SUBTRACT_SHIFTED_REGISTER: {
-                const auto instructionType =
-                    DataProcessingRegisterGroup::GetInstance()
-                        .GetInstructionType< A64DataProcessingRegisterGroup::ADD_SUBTRACT_SHIFTED_REGISTER >(
-                            instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingRegisterGroup::ADD_SUBTRACT_EXTENDED_REGISTER: {
-                const auto instructionType =
-                    DataProcessingRegisterGroup::GetInstance()
-                        .GetInstructionType< A64DataProcessingRegisterGroup::ADD_SUBTRACT_EXTENDED_REGISTER >(
-                            instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingRegisterGroup::ADD_SUBTRACT_CARRY: {
-                const auto instructionType =
-                    DataProcessingRegisterGroup::GetInstance()
-                        .GetInstructionType< A64DataProcessingRegisterGroup::ADD_SUBTRACT_CARRY >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingRegisterGroup::ROTATE_RIGHT_INTO_FLAGS: {
-                const auto instructionType =
-                    DataProcessingRegisterGroup::GetInstance()
-                        .GetInstructionType< A64DataProcessingRegisterGroup::ROTATE_RIGHT_INTO_FLAGS >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingRegisterGroup::EVALUATE_INTO_FLAGS: {
-                const auto instructionType =
-                    DataProcessingRegisterGroup::GetInstance()
-                        .GetInstructionType< A64DataProcessingRegisterGroup::EVALUATE_INTO_FLAGS >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingRegisterGroup::CONDITIONAL_COMPARE_REGISTER: {
-                const auto instructionType =
-                    DataProcessingRegisterGroup::GetInstance()
-                        .GetInstructionType< A64DataProcessingRegisterGroup::CONDITIONAL_COMPARE_REGISTER >(
-                            instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingRegisterGroup::CONDITIONAL_COMPARE_IMMEDIATE: {
-                const auto instructionType =
-                    DataProcessingRegisterGroup::GetInstance()
-                        .GetInstructionType< A64DataProcessingRegisterGroup::CONDITIONAL_COMPARE_IMMEDIATE >(
-                            instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingRegisterGroup::CONDITIONAL_SELECT: {
-                const auto instructionType =
-                    DataProcessingRegisterGroup::GetInstance()
-                        .GetInstructionType< A64DataProcessingRegisterGroup::CONDITIONAL_SELECT >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingRegisterGroup::DATA_PROCESSING_THREE_SOURCE: {
-                const auto instructionType =
-                    DataProcessingRegisterGroup::GetInstance()
-                        .GetInstructionType< A64DataProcessingRegisterGroup::DATA_PROCESSING_THREE_SOURCE >(
-                            instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            default: {
-                throw undefined_instruction {};
-            } break;
+
+    template < std::unsigned_integral T >
+    static bool NativeStore(A64ProcessState* self, std::uint64_t address, std::uint64_t data) noexcept {
+        try {
+            return self->m_memory.Write< T >(address, static_cast< T >(data));
+        } catch (...) {
+            self->RaiseFault(Fault::UndefinedBehaviour);
+            return false;
         }
     }
-    void Execute(Instruction&& instruction, A64DataProcessingScalarFloatingPointAdvancedSIMDGroup instructionClass) {
-        switch (instructionClass) {
-            case A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::CRYPTOGRAPHIC_AES: {
-                const auto instructionType =
-                    DataProcessingScalarFloatingPointAdvancedSIMDGroup::GetInstance()
-                        .GetInstructionType< A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::CRYPTOGRAPHIC_AES >(
-                            instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::CRYPTOHRAPHIC_THREE_REGISTER_SHA: {
-                const auto instructionType =
-                    DataProcessingScalarFloatingPointAdvancedSIMDGroup::GetInstance()
-                        .GetInstructionType<
-                            A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::CRYPTOHRAPHIC_THREE_REGISTER_SHA >(
-                            instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::CRYPTOGRAPHIC_TWO_REGISTER_SHA: {
-                const auto instructionType =
-                    DataProcessingScalarFloatingPointAdvancedSIMDGroup::GetInstance()
-                        .GetInstructionType<
-                            A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::CRYPTOGRAPHIC_TWO_REGISTER_SHA >(
-                            instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::ADVANCED_SIMD_SCALAR_COPY: {
-                const auto instructionType =
-                    DataProcessingScalarFloatingPointAdvancedSIMDGroup::GetInstance()
-                        .GetInstructionType<
-                            A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::ADVANCED_SIMD_SCALAR_COPY >(
-                            instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::ADVANCED_SIMG_SCALAR_THREE_SAME_FP16: {
-                const auto instructionType =
-                    DataProcessingScalarFloatingPointAdvancedSIMDGroup::GetInstance()
-                        .GetInstructionType< A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::
-                                                 ADVANCED_SIMG_SCALAR_THREE_SAME_FP16 >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::
-                ADVANCED_SIMD_SCALAR_TWO_REGISTER_MISCELLANEOUS_FP16: {
-                const auto instructionType =
-                    DataProcessingScalarFloatingPointAdvancedSIMDGroup::GetInstance()
-                        .GetInstructionType< A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::
-                                                 ADVANCED_SIMD_SCALAR_TWO_REGISTER_MISCELLANEOUS_FP16 >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::ADVANCED_SIMD_SCALAR_THREE_SAME_EXTRACTION: {
-                const auto instructionType =
-                    DataProcessingScalarFloatingPointAdvancedSIMDGroup::GetInstance()
-                        .GetInstructionType< A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::
-                                                 ADVANCED_SIMD_SCALAR_THREE_SAME_EXTRACTION >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::
-                ADVANCED_SIMD_SCALAR_TWO_REGISTER_MISCELLANEOUS: {
-                const auto instructionType =
-                    DataProcessingScalarFloatingPointAdvancedSIMDGroup::GetInstance()
-                        .GetInstructionType< A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::
-                                                 ADVANCED_SIMD_SCALAR_TWO_REGISTER_MISCELLANEOUS >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::ADVANCED_SIMD_SCALAR_PAIRWISE: {
-                const auto instructionType =
-                    DataProcessingScalarFloatingPointAdvancedSIMDGroup::GetInstance()
-                        .GetInstructionType<
-                            A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::ADVANCED_SIMD_SCALAR_PAIRWISE >(
-                            instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::ADVANCED_SIMD_SCALAR_THREE_DIFFERENT: {
-                const auto instructionType =
-                    DataProcessingScalarFloatingPointAdvancedSIMDGroup::GetInstance()
-                        .GetInstructionType< A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::
-                                                 ADVANCED_SIMD_SCALAR_THREE_DIFFERENT >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::ADVANCED_SIMD_SCALAR_THREE_SAME: {
-                const auto instructionType =
-                    DataProcessingScalarFloatingPointAdvancedSIMDGroup::GetInstance()
-                        .GetInstructionType<
-                            A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::ADVANCED_SIMD_SCALAR_THREE_SAME >(
-                            instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::ADVANCED_SIMD_SCALAR_SHIFT_BY_IMMEDIATE: {
-                const auto instructionType =
-                    DataProcessingScalarFloatingPointAdvancedSIMDGroup::GetInstance()
-                        .GetInstructionType< A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::
-                                                 ADVANCED_SIMD_SCALAR_SHIFT_BY_IMMEDIATE >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::ADVANCED_SIMD_SCALAR_X_INDEXED_ELEMENT: {
-                const auto instructionType =
-                    DataProcessingScalarFloatingPointAdvancedSIMDGroup::GetInstance()
-                        .GetInstructionType< A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::
-                                                 ADVANCED_SIMD_SCALAR_X_INDEXED_ELEMENT >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::ADVANCED_SIMD_TABLE_LOOKUP: {
-                const auto instructionType =
-                    DataProcessingScalarFloatingPointAdvancedSIMDGroup::GetInstance()
-                        .GetInstructionType<
-                            A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::ADVANCED_SIMD_TABLE_LOOKUP >(
-                            instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::ADVANCED_SIMD_PERMUTE: {
-                const auto instructionType =
-                    DataProcessingScalarFloatingPointAdvancedSIMDGroup::GetInstance()
-                        .GetInstructionType<
-                            A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::ADVANCED_SIMD_PERMUTE >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::ADVANCED_SIMD_EXTRACT: {
-                const auto instructionType =
-                    DataProcessingScalarFloatingPointAdvancedSIMDGroup::GetInstance()
-                        .GetInstructionType<
-                            A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::ADVANCED_SIMD_EXTRACT >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::ADVANCED_SIMD_COPY: {
-                const auto instructionType =
-                    DataProcessingScalarFloatingPointAdvancedSIMDGroup::GetInstance()
-                        .GetInstructionType<
-                            A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::ADVANCED_SIMD_COPY >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::ADVANCED_SIMD_THREE_SAME_FP16: {
-                const auto instructionType =
-                    DataProcessingScalarFloatingPointAdvancedSIMDGroup::GetInstance()
-                        .GetInstructionType<
-                            A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::ADVANCED_SIMD_THREE_SAME_FP16 >(
-                            instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::ADVANCED_SIMD_TWO_REGISTER_MISCELLANEOUS_FP16: {
-                const auto instructionType =
-                    DataProcessingScalarFloatingPointAdvancedSIMDGroup::GetInstance()
-                        .GetInstructionType< A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::
-                                                 ADVANCED_SIMD_TWO_REGISTER_MISCELLANEOUS_FP16 >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::ADVANCED_SIMD_THREE_REGISTER_EXTENSION: {
-                const auto instructionType =
-                    DataProcessingScalarFloatingPointAdvancedSIMDGroup::GetInstance()
-                        .GetInstructionType< A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::
-                                                 ADVANCED_SIMD_THREE_REGISTER_EXTENSION >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::ADVANCED_SIMD_TWO_REGISTER_MISCELLANEOUS: {
-                const auto instructionType =
-                    DataProcessingScalarFloatingPointAdvancedSIMDGroup::GetInstance()
-                        .GetInstructionType< A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::
-                                                 ADVANCED_SIMD_TWO_REGISTER_MISCELLANEOUS >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::ADVANCED_SIMD_ACROSS_LANES: {
-                const auto instructionType =
-                    DataProcessingScalarFloatingPointAdvancedSIMDGroup::GetInstance()
-                        .GetInstructionType<
-                            A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::ADVANCED_SIMD_ACROSS_LANES >(
-                            instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::ADVANCED_SIMD_THREE_DIFFERENT: {
-                const auto instructionType =
-                    DataProcessingScalarFloatingPointAdvancedSIMDGroup::GetInstance()
-                        .GetInstructionType<
-                            A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::ADVANCED_SIMD_THREE_DIFFERENT >(
-                            instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::ADVANCED_SIMD_THREE_SAME: {
-                const auto instructionType =
-                    DataProcessingScalarFloatingPointAdvancedSIMDGroup::GetInstance()
-                        .GetInstructionType<
-                            A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::ADVANCED_SIMD_THREE_SAME >(
-                            instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::ADVANCED_SIMD_MODIFIED_IMMEDIATE: {
-                const auto instructionType =
-                    DataProcessingScalarFloatingPointAdvancedSIMDGroup::GetInstance()
-                        .GetInstructionType<
-                            A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::ADVANCED_SIMD_MODIFIED_IMMEDIATE >(
-                            instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::ADVANCED_SIMD_SHIFT_BY_IMMEDIATE: {
-                const auto instructionType =
-                    DataProcessingScalarFloatingPointAdvancedSIMDGroup::GetInstance()
-                        .GetInstructionType<
-                            A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::ADVANCED_SIMD_SHIFT_BY_IMMEDIATE >(
-                            instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::ADVANCED_SIMD_VECTOR_X_INDEXED_ELEMENT: {
-                const auto instructionType =
-                    DataProcessingScalarFloatingPointAdvancedSIMDGroup::GetInstance()
-                        .GetInstructionType< A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::
-                                                 ADVANCED_SIMD_VECTOR_X_INDEXED_ELEMENT >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::CRYPTOGRAPHIC_THREE_REGISTER_IMM2: {
-                const auto instructionType =
-                    DataProcessingScalarFloatingPointAdvancedSIMDGroup::GetInstance()
-                        .GetInstructionType<
-                            A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::CRYPTOGRAPHIC_THREE_REGISTER_IMM2 >(
-                            instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::CRYPTOGRAPHIC_THREE_REGISTER_SHA512: {
-                const auto instructionType =
-                    DataProcessingScalarFloatingPointAdvancedSIMDGroup::GetInstance()
-                        .GetInstructionType< A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::
-                                                 CRYPTOGRAPHIC_THREE_REGISTER_SHA512 >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::CRYPTOGRAPHIC_FOUR_REGISTER: {
-                const auto instructionType =
-                    DataProcessingScalarFloatingPointAdvancedSIMDGroup::GetInstance()
-                        .GetInstructionType<
-                            A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::CRYPTOGRAPHIC_FOUR_REGISTER >(
-                            instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::XAR: {
-                const auto instructionType =
-                    DataProcessingScalarFloatingPointAdvancedSIMDGroup::GetInstance()
-                        .GetInstructionType< A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::XAR >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::CRYPTOGRAPHIC_TWO_REGISTER_SHA512: {
-                const auto instructionType =
-                    DataProcessingScalarFloatingPointAdvancedSIMDGroup::GetInstance()
-                        .GetInstructionType<
-                            A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::CRYPTOGRAPHIC_TWO_REGISTER_SHA512 >(
-                            instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::CONVERSION_FLOATING_POINT_AND_FIXED_POINT: {
-                const auto instructionType =
-                    DataProcessingScalarFloatingPointAdvancedSIMDGroup::GetInstance()
-                        .GetInstructionType< A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::
-                                                 CONVERSION_FLOATING_POINT_AND_FIXED_POINT >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::CONVERSION_FLOATING_POINT_AND_INTEGER: {
-                const auto instructionType =
-                    DataProcessingScalarFloatingPointAdvancedSIMDGroup::GetInstance()
-                        .GetInstructionType< A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::
-                                                 CONVERSION_FLOATING_POINT_AND_INTEGER >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::FLOATING_POINT_DATA_PROCESSING_ONE_SOURCE: {
-                const auto instructionType =
-                    DataProcessingScalarFloatingPointAdvancedSIMDGroup::GetInstance()
-                        .GetInstructionType< A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::
-                                                 FLOATING_POINT_DATA_PROCESSING_ONE_SOURCE >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::FLOATING_POINT_COMPARE: {
-                const auto instructionType =
-                    DataProcessingScalarFloatingPointAdvancedSIMDGroup::GetInstance()
-                        .GetInstructionType<
-                            A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::FLOATING_POINT_COMPARE >(
-                            instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::FLOATING_POINT_IMMEDIATE: {
-                const auto instructionType =
-                    DataProcessingScalarFloatingPointAdvancedSIMDGroup::GetInstance()
-                        .GetInstructionType<
-                            A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::FLOATING_POINT_IMMEDIATE >(
-                            instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::FLOATING_POINT_CONDITIONAL_COMPARE: {
-                const auto instructionType =
-                    DataProcessingScalarFloatingPointAdvancedSIMDGroup::GetInstance()
-                        .GetInstructionType<
-                            A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::FLOATING_POINT_CONDITIONAL_COMPARE >(
-                            instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::FLOATING_POINT_DATA_PROCESSING_TWO_SOURCE: {
-                const auto instructionType =
-                    DataProcessingScalarFloatingPointAdvancedSIMDGroup::GetInstance()
-                        .GetInstructionType< A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::
-                                                 FLOATING_POINT_DATA_PROCESSING_TWO_SOURCE >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::FLOATING_POINT_CONDITIONAL_SELECT: {
-                const auto instructionType =
-                    DataProcessingScalarFloatingPointAdvancedSIMDGroup::GetInstance()
-                        .GetInstructionType<
-                            A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::FLOATING_POINT_CONDITIONAL_SELECT >(
-                            instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            case A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::FLOATING_POINT_DATA_PROCESSING_THREE_SOURCE: {
-                const auto instructionType =
-                    DataProcessingScalarFloatingPointAdvancedSIMDGroup::GetInstance()
-                        .GetInstructionType< A64DataProcessingScalarFloatingPointAdvancedSIMDGroup::
-                                                 FLOATING_POINT_DATA_PROCESSING_THREE_SOURCE >(instruction);
-                Execute(std::move(instruction), instructionType);
-            } break;
-            default: {
-                throw undefined_instruction {};
-            } break;
-        }
+
+    static bool NativeConditionHolds(A64ProcessState* self, std::uint32_t cond) noexcept {
+        return self->ConditionHolds(cond, self->NZCV());
     }
 
-    void Execute(Instruction&& instruction, A64DecodeGroup decodeGroup) {
-        if (decodeGroup == A64DecodeGroup::Reserved) {
-            const auto instructionType = ReservedGroup::GetInstance().GetInstructionClass(instruction);
-            Execute(std::move(instruction), instructionType);
-        } else if (decodeGroup == A64DecodeGroup::ScalableVectorExtension) {
-            throw not_implemented_feature {};
-        } else if (decodeGroup == A64DecodeGroup::DataProcessingImmediate) {
-            const auto instructionType = DataProcessingImmediateGroup::GetInstance().GetInstructionClass(instruction);
-            Execute(std::move(instruction), instructionType);
-        } else if (decodeGroup == A64DecodeGroup::BranchExceptionSystem) {
-            const auto instructionType = BranchExceptionSystemGroup::GetInstance().GetInstructionClass(instruction);
-            Execute(std::move(instruction), instructionType);
-        } else if (decodeGroup == A64DecodeGroup::LoadStore) {
-            const auto instructionType = LoadStoreGroup::GetInstance().GetInstructionClass(instruction);
-            Execute(std::move(instruction), instructionType);
-        } else if (decodeGroup == A64DecodeGroup::DataProcessingRegister) {
-            const auto instructionType = DataProcessingRegisterGroup::GetInstance().GetInstructionClass(instruction);
-            Execute(std::move(instruction), instructionType);
-        } else if (decodeGroup == A64DecodeGroup::DataProcessingScalarFloatingPointAdvancedSIMD) {
-            const auto instructionType =
-                DataProcessingScalarFloatingPointAdvancedSIMDGroup::GetInstance().GetInstructionClass(instruction);
-            Execute(std::move(instruction), instructionType);
-        } else {
-            throw undefined_instruction {};
-        }
+    [[nodiscard]] static constexpr JitWidth JitWidthOf(std::uint32_t datasize) noexcept {
+        return datasize == 64 ? JitWidth::Bits64 : JitWidth::Bits32;
     }
 
-  public:
-    A64ProcessState(Object* logger, A64ProcessingUnitWatcher& watcher, ICacheMemory* upStreamMemory,
-                    IMemory::Address allocatedSize, MemoryManagementUnitProxy mmuProxy) :
-        m_status(IProcessingUnit::ProcessStatus::Idle),
-        m_upStreamMemory(upStreamMemory),
-        m_mmu(std::move(mmuProxy)),
-        m_allocatedSize(allocatedSize),
-        m_programs(),
-        m_watcher(watcher),
-        m_debugObject(*logger),
-        m_programMutex(),
-        m_stopRunningInterrupt(nullptr),
-        m_gpRegisters(*this, m_upStreamMemory, std::addressof(m_mmu)) {
+    [[nodiscard]] static constexpr std::int32_t JitOffsetOfX(std::uint32_t loc) noexcept {
+        return static_cast< std::int32_t >(offsetof(A64RegisterFile, m_X) + loc * sizeof(std::uint64_t));
     }
 
-    Result SetProgram(Program program) {
-        constexpr bool isStepInAllowed = false;
-        m_debugObject.LogTrace(LogType::Other, "Adding program {}!",
-                               static_cast< const void* const >(program.GetProgram()));
-        auto resultElement =
-            std::allocate_shared< ResultElement >(std::pmr::polymorphic_allocator< ResultElement > {}, isStepInAllowed);
-        {
-            std::unique_lock lock { m_programMutex };
-            m_programs.emplace(std::move(program), isStepInAllowed, resultElement->weak_from_this());
-        }
-        return Result { std::move(resultElement) };
+    // Register 31 is never an operand of translated code, the interpreter gives it SP or memory semantics
+    static void EmitLoadX(X64Assembler& assembler, std::uint32_t datasize, JitReg destination, std::uint32_t loc) {
+        assert(loc < 31);
+        assembler.Load(JitWidthOf(datasize), destination, JitReg::Rbx, JitOffsetOfX(loc));
     }
 
-    ControlledResult SetProgramToStepIn(Program program) {
-        constexpr bool isStepInAllowed = true;
-        m_debugObject.LogTrace(LogType::Other, "Adding program {} to step in!",
-                               static_cast< const void* const >(program.GetProgram()));
-        auto resultElement =
-            std::allocate_shared< ResultElement >(std::pmr::polymorphic_allocator< ResultElement > {}, isStepInAllowed);
-        {
-            std::unique_lock lock { m_programMutex };
-            m_programs.emplace(std::move(program), isStepInAllowed, resultElement->weak_from_this());
-        }
-        return ControlledResult { std::move(resultElement) };
+    // 32-bit results come from 32-bit host operations, which already cleared the upper half
+    static void EmitStoreX(X64Assembler& assembler, std::uint32_t loc, JitReg source) {
+        assert(loc < 31);
+        assembler.Store(JitWidth::Bits64, JitReg::Rbx, JitOffsetOfX(loc), source);
     }
 
-    IMemory const* GetCurrentProgramMemory() const noexcept {
-        return m_programs.size() > 0 ? m_programs.front().m_program.GetProgram() : nullptr;
+    static void EmitStorePC(X64Assembler& assembler, std::uint64_t pc) {
+        assembler.MoveImmediate(JitReg::Rax, pc);
+        assembler.Store(JitWidth::Bits64, JitReg::Rbx, static_cast< std::int32_t >(offsetof(A64RegisterFile, m_PC)),
+                        JitReg::Rax);
     }
 
-    IProcessingUnit::ProcessStatus GetStatus() const noexcept {
-        return m_status.load(std::memory_order_seq_cst);
+    // Calls a helper once its arguments are in place, only RBX survives the call
+    template < class Helper >
+    static void EmitCall(X64Assembler& assembler, Helper helper) {
+        assembler.MoveImmediate(JitReg::Rax, reinterpret_cast< std::uint64_t >(helper));
+        assembler.Call(JitReg::Rax);
     }
 
-    void Run(Interrupt interrupt, std::condition_variable& runProcessCondVar,
-             std::condition_variable_any& stepInCondVar) {
-        if (m_programs.size() == 0) {
-            m_debugObject.Log(LogType::Other, "Run(): no programs found to run!");
-            return;
+    /// @brief SetNZCVFromAdd() of RAX + RCX + carry_in, both operands hold datasize bits. The sum is left in RDX
+    static void EmitAddSetFlags(X64Assembler& assembler, std::uint32_t datasize, bool carry_in) {
+        const auto width = JitWidthOf(datasize);
+
+        assembler.Move(width, JitReg::Rdx, JitReg::Rax);
+        assembler.Alu(X64Assembler::AluOp::Add, width, JitReg::Rdx, JitReg::Rcx);
+        if (carry_in) {
+            assembler.AluImmediate(X64Assembler::AluOp::Add, width, JitReg::Rdx, 1);
         }
 
-        m_debugObject.Log(LogType::Other, "ProcessingUnit::Run() is running!");
+        assembler.StoreImmediate(JitWidth::Bits32, JitReg::Rbx,
+                                 static_cast< std::int32_t >(offsetof(A64RegisterFile, m_flagSource)),
+                                 static_cast< std::int32_t >(FlagSource::Add));
+        assembler.StoreImmediate(JitWidth::Bits32, JitReg::Rbx,
+                                 static_cast< std::int32_t >(offsetof(A64RegisterFile, m_flagWidth)),
+                                 static_cast< std::int32_t >(datasize));
+        assembler.Store(JitWidth::Bits64, JitReg::Rbx,
+                        static_cast< std::int32_t >(offsetof(A64RegisterFile, m_flagOperand1)), JitReg::Rax);
+        assembler.Store(JitWidth::Bits64, JitReg::Rbx,
+                        static_cast< std::int32_t >(offsetof(A64RegisterFile, m_flagOperand2)), JitReg::Rcx);
+        assembler.StoreImmediate(JitWidth::Bits8, JitReg::Rbx,
+                                 static_cast< std::int32_t >(offsetof(A64RegisterFile, m_flagCarryIn)), carry_in);
+        assembler.Store(JitWidth::Bits64, JitReg::Rbx,
+                        static_cast< std::int32_t >(offsetof(A64RegisterFile, m_flagResult)), JitReg::Rdx);
+    }
+
+    /// @brief SetNZCVFromLogical() of the datasize bits result
+    static void EmitLogicalSetFlags(X64Assembler& assembler, std::uint32_t datasize, JitReg result) {
+        assembler.StoreImmediate(JitWidth::Bits32, JitReg::Rbx,
+                                 static_cast< std::int32_t >(offsetof(A64RegisterFile, m_flagSource)),
+                                 static_cast< std::int32_t >(FlagSource::Logical));
+        assembler.StoreImmediate(JitWidth::Bits32, JitReg::Rbx,
+                                 static_cast< std::int32_t >(offsetof(A64RegisterFile, m_flagWidth)),
+                                 static_cast< std::int32_t >(datasize));
+        assembler.Store(JitWidth::Bits64, JitReg::Rbx,
+                        static_cast< std::int32_t >(offsetof(A64RegisterFile, m_flagResult)), result);
+    }
+
+    /// @brief ShiftReg() of Rm into RCX
+    static void EmitShiftReg(X64Assembler& assembler, std::uint32_t datasize, std::uint32_t Rm, std::uint32_t shift,
+                             std::uint32_t amount) {
+        static constexpr std::array< X64Assembler::ShiftOp, 4 > shiftOps {
+            X64Assembler::ShiftOp::Shl, X64Assembler::ShiftOp::Shr, X64Assembler::ShiftOp::Sar,
+            X64Assembler::ShiftOp::Ror
+        };
 
-        auto                       currentProgramMemory    = m_programs.front().m_program.GetProgram();
-        const auto                 currentProgramEntrySize = m_programs.front().m_program.GetEntryPoint();
-        bool                       doStepIn                = m_programs.front().m_stepIn;
-        SharedRef< ResultElement > currentResult           = m_programs.front().m_result.lock();
+        EmitLoadX(assembler, datasize, JitReg::Rcx, Rm);
+        if (amount != 0) {
+            assembler.Shift(shiftOps[shift], JitWidthOf(datasize), JitReg::Rcx, static_cast< std::uint8_t >(amount));
+        }
+    }
+
+    /// @brief ConditionHolds() of the current flags into AL
+    void EmitConditionHolds(X64Assembler& assembler, std::uint32_t cond) {
+        assembler.MoveImmediate(Jit_arguments[0], reinterpret_cast< std::uint64_t >(this));
+        assembler.MoveImmediate(Jit_arguments[1], cond);
+        EmitCall(assembler, &A64ProcessState::NativeConditionHolds);
+    }
+
+    /// @brief DecodeBitMasks() as the handlers call it, nullopt where it would fault
+    template < std::size_t M >
+    [[nodiscard]] std::optional< std::pair< std::uint64_t, std::uint64_t > >
+        TryDecodeBitMasks(bool immN, std::uint32_t imms, std::uint32_t immr, bool immediate) {
+        assert(m_fault == Fault::None && "Translating a block of a faulted program!");
+
+        const auto masks = DecodeBitMasks< M >(immN, imms, immr, immediate);
+        if (m_fault != Fault::None) {
+            m_fault = Fault::None;
+            return std::nullopt;
+        }
+        return masks;
+    }
+
+    // Instructions without a translation are left to the interpreter
+    template < class InstructionType >
+    bool TranslateInstruction(X64Assembler&, const Instruction&, InstructionType, IMemory::Address,
+                              X64Assembler::Label) {
+        return false;
+    }
+
+    bool TranslateInstruction(X64Assembler& assembler, const Instruction& instruction,
+                              DataProcessingImmediateGroup::AddSubtractImmediate instructionType, IMemory::Address,
+                              X64Assembler::Label) {
+        using Type = DataProcessingImmediateGroup::AddSubtractImmediate;
+
+        const auto Rd    = A64InstructionManager::Extract< A64InstructionManager::Tag::Rd >(instruction);
+        const auto Rn    = A64InstructionManager::Extract< A64InstructionManager::Tag::Rn >(instruction);
+        const auto imm12 = A64InstructionManager::Extract< A64InstructionManager::Tag::Imm12 >(instruction);
+        const auto shift = A64InstructionManager::Extract< A64InstructionManager::Tag::Sh >(instruction);
+
+        std::uint32_t datasize = 32;
+        bool          isSub    = false;
+        bool          setFlags = false;
+        switch (instructionType) {
+            case Type::ADDi_32BIT:
+                break;
+            case Type::ADDSi_32BIT:
+                setFlags = true;
+                break;
+            case Type::SUBi_32BIT:
+                isSub = true;
+                break;
+            case Type::SUBSi_32BIT:
+                isSub    = true;
+                setFlags = true;
+                break;
+            case Type::ADDi_64BIT:
+                datasize = 64;
+                break;
+            case Type::ADDSi_64BIT:
+                datasize = 64;
+                setFlags = true;
+                break;
+            case Type::SUBi_64BIT:
+                datasize = 64;
+                isSub    = true;
+                break;
+            case Type::SUBSi_64BIT:
+                datasize = 64;
+                isSub    = true;
+                setFlags = true;
+                break;
+            default:
+                return false;
+        }
+        if (Rd == 31 || Rn == 31) {
+            return false;
+        }
+
+        const auto imm = static_cast< std::uint64_t >(shift ? imm12 << 12 : imm12);
+        EmitLoadX(assembler, datasize, JitReg::Rax, Rn);
+        if (!setFlags) {
+            assembler.AluImmediate(isSub ? X64Assembler::AluOp::Sub : X64Assembler::AluOp::Add, JitWidthOf(datasize),
+                                   JitReg::Rax, static_cast< std::int32_t >(imm));
+            EmitStoreX(assembler, Rd, JitReg::Rax);
+            return true;
+        }
+
+        // Subtractions add the inverted immediate and a carry, the flags record these operands
+        assembler.MoveImmediate(JitReg::Rcx, (isSub ? ~imm : imm) & Ones(datasize));
+        EmitAddSetFlags(assembler, datasize, isSub);
+        EmitStoreX(assembler, Rd, JitReg::Rdx);
+        return true;
+    }
+
+    bool TranslateInstruction(X64Assembler& assembler, const Instruction& instruction,
+                              DataProcessingImmediateGroup::LogicalImmediate instructionType, IMemory::Address,
+                              X64Assembler::Label) {
+        using Type = DataProcessingImmediateGroup::LogicalImmediate;
+
+        const auto Rd   = A64InstructionManager::Extract< A64InstructionManager::Tag::Rd >(instruction);
+        const auto Rn   = A64InstructionManager::Extract< A64InstructionManager::Tag::Rn >(instruction);
+        const auto imms = A64InstructionManager::Extract< A64InstructionManager::Tag::Imms >(instruction);
+        const auto immr = A64InstructionManager::Extract< A64InstructionManager::Tag::Immr >(instruction);
+        const auto N    = A64InstructionManager::Extract< A64InstructionManager::Tag::N >(instruction);
+
+        // ANDS (32-bit) is left out, its handler rejects every value of N
+        std::uint32_t datasize = 32;
+        auto          op       = X64Assembler::AluOp::And;
+        bool          setFlags = false;
+        switch (instructionType) {
+            case Type::AND_32BIT:
+                break;
+            case Type::ORR_32BIT:
+                op = X64Assembler::AluOp::Or;
+                break;
+            case Type::EOR_32BIT:
+                op = X64Assembler::AluOp::Xor;
+                break;
+            case Type::AND_64BIT:
+                datasize = 64;
+                break;
+            case Type::ORR_64BIT:
+                datasize = 64;
+                op       = X64Assembler::AluOp::Or;
+                break;
+            case Type::EOR_64BIT:
+                datasize = 64;
+                op       = X64Assembler::AluOp::Xor;
+                break;
+            case Type::ANDS_64BIT:
+                datasize = 64;
+                setFlags = true;
+                break;
+            default:
+                return false;
+        }
+        if (Rd == 31 || Rn == 31 || (datasize == 32 && N != 0)) {
+            return false;
+        }
+
+        const auto masks = datasize == 64 ? TryDecodeBitMasks< 64 >(static_cast< bool >(N), imms, immr, true)
+                                          : TryDecodeBitMasks< 32 >(static_cast< bool >(N), imms, immr, true);
+        if (!masks) {
+            return false;
+        }
+
+        EmitLoadX(assembler, datasize, JitReg::Rax, Rn);
+        assembler.MoveImmediate(JitReg::Rcx, masks->first & Ones(datasize));
+        assembler.Alu(op, JitWidthOf(datasize), JitReg::Rax, JitReg::Rcx);
+        if (setFlags) {
+            EmitLogicalSetFlags(assembler, datasize, JitReg::Rax);
+        }
+        EmitStoreX(assembler, Rd, JitReg::Rax);
+        return true;
+    }
+
+    bool TranslateInstruction(X64Assembler& assembler, const Instruction& instruction,
+                              DataProcessingImmediateGroup::MoveWideImmediate instructionType, IMemory::Address,
+                              X64Assembler::Label) {
+        using Type = DataProcessingImmediateGroup::MoveWideImmediate;
+
+        const auto Rd    = A64InstructionManager::Extract< A64InstructionManager::Tag::Rd >(instruction);
+        const auto imm16 = A64InstructionManager::Extract< A64InstructionManager::Tag::Imm16 >(instruction);
+        const auto hw    = A64InstructionManager::Extract< A64InstructionManager::Tag::Hw >(instruction);
+
+        std::uint32_t datasize = 32;
+        switch (instructionType) {
+            case Type::MOVN_32BIT:
+            case Type::MOVZ_32BIT:
+            case Type::MOVK_32BIT:
+                break;
+            case Type::MOVN_64BIT:
+            case Type::MOVZ_64BIT:
+            case Type::MOVK_64BIT:
+                datasize = 64;
+                break;
+            default:
+                return false;
+        }
+        if (Rd == 31 || (datasize == 32 && hw >= 2)) {
+            return false;
+        }
+
+        const auto imm = static_cast< std::uint64_t >(imm16) << (hw << 4);
+        switch (instructionType) {
+            case Type::MOVN_32BIT:
+            case Type::MOVN_64BIT:
+                assembler.MoveImmediate(JitReg::Rax, ~imm & Ones(datasize));
+                break;
+            case Type::MOVZ_32BIT:
+            case Type::MOVZ_64BIT:
+                assembler.MoveImmediate(JitReg::Rax, imm);
+                break;
+            default: {
+                const auto width = JitWidthOf(datasize);
+
+                EmitLoadX(assembler, datasize, JitReg::Rax, Rd);
+                assembler.MoveImmediate(JitReg::Rcx, ~(Ones(16) << (hw << 4)) & Ones(datasize));
+                assembler.Alu(X64Assembler::AluOp::And, width, JitReg::Rax, JitReg::Rcx);
+                assembler.MoveImmediate(JitReg::Rcx, imm);
+                assembler.Alu(X64Assembler::AluOp::Or, width, JitReg::Rax, JitReg::Rcx);
+            } break;
+        }
+        EmitStoreX(assembler, Rd, JitReg::Rax);
+        return true;
+    }
+
+    bool TranslateInstruction(X64Assembler& assembler, const Instruction& instruction,
+                              DataProcessingImmediateGroup::Bitfield instructionType, IMemory::Address,
+                              X64Assembler::Label) {
+        using Type = DataProcessingImmediateGroup::Bitfield;
+
+        const auto Rd   = A64InstructionManager::Extract< A64InstructionManager::Tag::Rd >(instruction);
+        const auto Rn   = A64InstructionManager::Extract< A64InstructionManager::Tag::Rn >(instruction);
+        const auto imms = A64InstructionManager::Extract< A64InstructionManager::Tag::Imms >(instruction);
+        const auto immr = A64InstructionManager::Extract< A64InstructionManager::Tag::Immr >(instruction);
+        const auto N    = A64InstructionManager::Extract< A64InstructionManager::Tag::N >(instruction);
+
+        if (Rd == 31 || Rn == 31) {
+            return false;
+        }
+
+        // The SBFM handlers decode their masks with immN taken from Rn, the translation follows them. BFM (64-bit)
+        // rotates by a single bit and is left to its handler.
+        std::optional< std::pair< std::uint64_t, std::uint64_t > > masks;
+        std::uint32_t                                              datasize = 32;
+        switch (instructionType) {
+            case Type::SBFM_32BIT:
+                if (Rn != 0 || immr >= 32 || imms >= 32) {
+                    return false;
+                }
+                masks = TryDecodeBitMasks< 32 >(false, imms, immr, false);
+                break;
+            case Type::BFM_32BIT:
+                if (N != 0 || immr >= 32 || imms >= 32) {
+                    return false;
+                }
+                masks = TryDecodeBitMasks< 32 >(false, imms, immr, false);
+                break;
+            case Type::SBFM_64BIT:
+                datasize = 64;
+                masks    = TryDecodeBitMasks< 64 >(static_cast< bool >(Rn), imms, immr, false);
+                break;
+            default:
+                return false;
+        }
+        if (!masks) {
+            return false;
+        }
+
+        const auto width    = JitWidthOf(datasize);
+        const auto bitsMask = masks->first & masks->second & Ones(datasize);
+        if (instructionType == Type::BFM_32BIT) {
+            // Bits under both masks come from the rotated source, the others keep the destination
+            EmitLoadX(assembler, datasize, JitReg::Rax, Rd);
+            assembler.MoveImmediate(JitReg::Rdx, ~bitsMask & Ones(datasize));
+            assembler.Alu(X64Assembler::AluOp::And, width, JitReg::Rax, JitReg::Rdx);
+            EmitLoadX(assembler, datasize, JitReg::Rcx, Rn);
+        } else {
+            // Bits outside tmask replicate bit S of the source
+            EmitLoadX(assembler, datasize, JitReg::Rcx, Rn);
+            assembler.Move(width, JitReg::Rax, JitReg::Rcx);
+            if (imms != datasize - 1) {
+                assembler.Shift(X64Assembler::ShiftOp::Shl, width, JitReg::Rax,
+                                static_cast< std::uint8_t >(datasize - 1 - imms));
+            }
+            assembler.Shift(X64Assembler::ShiftOp::Sar, width, JitReg::Rax, static_cast< std::uint8_t >(datasize - 1));
+            assembler.MoveImmediate(JitReg::Rdx, ~masks->second & Ones(datasize));
+            assembler.Alu(X64Assembler::AluOp::And, width, JitReg::Rax, JitReg::Rdx);
+        }
+        if (immr % datasize != 0) {
+            assembler.Shift(X64Assembler::ShiftOp::Ror, width, JitReg::Rcx, static_cast< std::uint8_t >(immr));
+        }
+        assembler.MoveImmediate(JitReg::Rdx, bitsMask);
+        assembler.Alu(X64Assembler::AluOp::And, width, JitReg::Rcx, JitReg::Rdx);
+        assembler.Alu(X64Assembler::AluOp::Or, width, JitReg::Rax, JitReg::Rcx);
+        EmitStoreX(assembler, Rd, JitReg::Rax);
+        return true;
+    }
+
+    bool TranslateInstruction(X64Assembler& assembler, const Instruction& instruction,
+                              DataProcessingRegisterGroup::LogicalShiftedRegister instructionType, IMemory::Address,
+                              X64Assembler::Label) {
+        using Type = DataProcessingRegisterGroup::LogicalShiftedRegister;
+
+        const auto Rd    = A64InstructionManager::Extract< A64InstructionManager::Tag::Rd >(instruction);
+        const auto Rn    = A64InstructionManager::Extract< A64InstructionManager::Tag::Rn >(instruction);
+        const auto Rm    = A64InstructionManager::Extract< A64InstructionManager::Tag::Rm >(instruction);
+        const auto imm6  = A64InstructionManager::Extract< A64InstructionManager::Tag::Imm6 >(instruction);
+        const auto shift = A64InstructionManager::Extract< A64InstructionManager::Tag::Shift >(instruction);
+
+        // EOR is not implemented by its handlers and EON ORs the inverted operand, both are left to the interpreter
+        std::uint32_t datasize = 32;
+        auto          op       = X64Assembler::AluOp::And;
+        bool          invert   = false;
+        bool          setFlags = false;
+        switch (instructionType) {
+            case Type::AND_32BIT_SHIFTED:
+                break;
+            case Type::BIC_32BIT_SHIFTED:
+                invert = true;
+                break;
+            case Type::ORR_32BIT_SHIFTED:
+                op = X64Assembler::AluOp::Or;
+                break;
+            case Type::ORN_32BIT_SHIFTED:
+                op     = X64Assembler::AluOp::Or;
+                invert = true;
+                break;
+            case Type::ANDS_32BIT_SHIFTED:
+                setFlags = true;
+                break;
+            case Type::BICS_32BIT_SHIFTED:
+                invert   = true;
+                setFlags = true;
+                break;
+            case Type::AND_64BIT_SHIFTED:
+                datasize = 64;
+                break;
+            case Type::BIC_64BIT_SHIFTED:
+                datasize = 64;
+                invert   = true;
+                break;
+            case Type::ORR_64BIT_SHIFTED:
+                datasize = 64;
+                op       = X64Assembler::AluOp::Or;
+                break;
+            case Type::ORN_64BIT_SHIFTED:
+                datasize = 64;
+                op       = X64Assembler::AluOp::Or;
+                invert   = true;
+                break;
+            case Type::ANDS_64BIT_SHIFTED:
+                datasize = 64;
+                setFlags = true;
+                break;
+            case Type::BICS_64BIT_SHIFTED:
+                datasize = 64;
+                invert   = true;
+                setFlags = true;
+                break;
+            default:
+                return false;
+        }
+        if (Rd == 31 || Rn == 31 || Rm == 31 || imm6 >= datasize) {
+            return false;
+        }
+
+        const auto width = JitWidthOf(datasize);
+        EmitShiftReg(assembler, datasize, Rm, shift, imm6);
+        if (invert) {
+            assembler.Not(width, JitReg::Rcx);
+        }
+        EmitLoadX(assembler, datasize, JitReg::Rax, Rn);
+        assembler.Alu(op, width, JitReg::Rax, JitReg::Rcx);
+        if (setFlags) {
+            EmitLogicalSetFlags(assembler, datasize, JitReg::Rax);
+        }
+        EmitStoreX(assembler, Rd, JitReg::Rax);
+        return true;
+    }
+
+    bool TranslateInstruction(X64Assembler& assembler, const Instruction& instruction,
+                              DataProcessingRegisterGroup::AddSubtractShiftedRegister instructionType,
+                              IMemory::Address, X64Assembler::Label) {
+        using Type = DataProcessingRegisterGroup::AddSubtractShiftedRegister;
+
+        const auto Rd    = A64InstructionManager::Extract< A64InstructionManager::Tag::Rd >(instruction);
+        const auto Rn    = A64InstructionManager::Extract< A64InstructionManager::Tag::Rn >(instruction);
+        const auto Rm    = A64InstructionManager::Extract< A64InstructionManager::Tag::Rm >(instruction);
+        const auto shift = A64InstructionManager::Extract< A64InstructionManager::Tag::Shift >(instruction);
+        const auto imm6  = A64InstructionManager::Extract< A64InstructionManager::Tag::Imm6 >(instruction);
+
+        // Only the forms whose handlers write their result, the subtractions are not implemented
+        std::uint32_t datasize = 32;
+        bool          setFlags = false;
+        switch (instructionType) {
+            case Type::ADD_32BIT_SHIFTED:
+                break;
+            case Type::ADDS_32BIT_SHIFTED:
+                setFlags = true;
+                break;
+            case Type::ADDS_64BIT_SHIFTED:
+                datasize = 64;
+                setFlags = true;
+                break;
+            default:
+                return false;
+        }
+        if (Rd == 31 || Rn == 31 || Rm == 31 || shift == 3 || imm6 >= datasize) {
+            return false;
+        }
+
+        EmitShiftReg(assembler, datasize, Rm, shift, imm6);
+        EmitLoadX(assembler, datasize, JitReg::Rax, Rn);
+        if (!setFlags) {
+            assembler.Alu(X64Assembler::AluOp::Add, JitWidthOf(datasize), JitReg::Rax, JitReg::Rcx);
+            EmitStoreX(assembler, Rd, JitReg::Rax);
+            return true;
+        }
+        EmitAddSetFlags(assembler, datasize, false);
+        EmitStoreX(assembler, Rd, JitReg::Rdx);
+        return true;
+    }
+
+    bool TranslateInstruction(X64Assembler& assembler, const Instruction& instruction,
+                              DataProcessingRegisterGroup::ConditionalSelect instructionType, IMemory::Address,
+                              X64Assembler::Label) {
+        using Type = DataProcessingRegisterGroup::ConditionalSelect;
+
+        const auto Rd   = A64InstructionManager::Extract< A64InstructionManager::Tag::Rd >(instruction);
+        const auto Rn   = A64InstructionManager::Extract< A64InstructionManager::Tag::Rn >(instruction);
+        const auto Rm   = A64InstructionManager::Extract< A64InstructionManager::Tag::Rm >(instruction);
+        const auto cond = A64InstructionManager::Extract< A64InstructionManager::Tag::CondHi >(instruction);
+
+        std::uint32_t datasize = 32;
+        switch (instructionType) {
+            case Type::CSINC_32BIT:
+            case Type::CSINV_32BIT:
+            case Type::CSNEG_32BIT:
+                break;
+            case Type::CSINC_64BIT:
+            case Type::CSINV_64BIT:
+            case Type::CSNEG_64BIT:
+                datasize = 64;
+                break;
+            default:
+                return false;
+        }
+        if (Rd == 31 || Rn == 31 || Rm == 31) {
+            return false;
+        }
+
+        const auto width = JitWidthOf(datasize);
+        const auto done  = assembler.CreateLabel();
+
+        EmitConditionHolds(assembler, cond);
+        EmitLoadX(assembler, datasize, JitReg::Rcx, Rm);
+        switch (instructionType) {
+            case Type::CSINC_32BIT:
+            case Type::CSINC_64BIT:
+                assembler.AluImmediate(X64Assembler::AluOp::Add, width, JitReg::Rcx, 1);
+                break;
+            case Type::CSINV_32BIT:
+            case Type::CSINV_64BIT:
+                assembler.Not(width, JitReg::Rcx);
+                break;
+            default:
+                assembler.Negate(width, JitReg::Rcx);
+                break;
+        }
+        assembler.Test(JitWidth::Bits8, JitReg::Rax, JitReg::Rax);
+        assembler.Jump(X64Assembler::Condition::Zero, done);
+        EmitLoadX(assembler, datasize, JitReg::Rcx, Rn);
+        assembler.Bind(done);
+        EmitStoreX(assembler, Rd, JitReg::Rcx);
+        return true;
+    }
+
+    bool TranslateInstruction(X64Assembler& assembler, const Instruction& instruction,
+                              DataProcessingRegisterGroup::DataProcessingThreeSource instructionType,
+                              IMemory::Address, X64Assembler::Label) {
+        using Type = DataProcessingRegisterGroup::DataProcessingThreeSource;
+
+        const auto Rm = A64InstructionManager::Extract< A64InstructionManager::Tag::Rm >(instruction);
+        const auto Ra = A64InstructionManager::Extract< A64InstructionManager::Tag::Ra >(instruction);
+        const auto Rn = A64InstructionManager::Extract< A64InstructionManager::Tag::Rn >(instruction);
+        const auto Rd = A64InstructionManager::Extract< A64InstructionManager::Tag::Rd >(instruction);
+
+        std::uint32_t datasize = 32;
+        auto          op       = X64Assembler::AluOp::Add;
+        switch (instructionType) {
+            case Type::MADD_32BIT:
+                break;
+            case Type::MSUB_32BIT:
+                op = X64Assembler::AluOp::Sub;
+                break;
+            case Type::MADD_64BIT:
+                datasize = 64;
+                break;
+            case Type::MSUB_64BIT:
+                datasize = 64;
+                op       = X64Assembler::AluOp::Sub;
+                break;
+            default:
+                return false;
+        }
+        if (Rd == 31 || Rn == 31 || Rm == 31 || Ra == 31) {
+            return false;
+        }
+
+        const auto width = JitWidthOf(datasize);
+        EmitLoadX(assembler, datasize, JitReg::Rax, Rn);
+        EmitLoadX(assembler, datasize, JitReg::Rcx, Rm);
+        assembler.Multiply(width, JitReg::Rax, JitReg::Rcx);
+        EmitLoadX(assembler, datasize, JitReg::Rdx, Ra);
+        assembler.Alu(op, width, JitReg::Rdx, JitReg::Rax);
+        EmitStoreX(assembler, Rd, JitReg::Rdx);
+        return true;
+    }
+
+    bool TranslateInstruction(X64Assembler& assembler, const Instruction& instruction,
+                              BranchExceptionSystemGroup::ConditionalBranching instructionType,
+                              IMemory::Address address, X64Assembler::Label exit) {
+        const auto cond  = A64InstructionManager::Extract< A64InstructionManager::Tag::Cond >(instruction);
+        const auto imm19 = A64InstructionManager::Extract< A64InstructionManager::Tag::Imm19 >(instruction);
+
+        // Targets with tag bits are left to BranchTo()
+        const auto target = address + SignExtend< 64 >(imm19, 19);
+        if (instructionType != BranchExceptionSystemGroup::ConditionalBranching::BCond || (target >> 55) != 0) {
+            return false;
+        }
+
+        // Not taken, the block ends on the branch and PC is set past it like after any other last instruction
+        const auto notTaken = assembler.CreateLabel();
+        EmitConditionHolds(assembler, cond);
+        assembler.Test(JitWidth::Bits8, JitReg::Rax, JitReg::Rax);
+        assembler.Jump(X64Assembler::Condition::Zero, notTaken);
+        EmitStorePC(assembler, target);
+        assembler.Jump(exit);
+        assembler.Bind(notTaken);
+        return true;
+    }
+
+    bool TranslateInstruction(X64Assembler& assembler, const Instruction& instruction,
+                              LoadStoreGroup::LoadStoreRegisterUnsignedImmediate instructionType,
+                              IMemory::Address address, X64Assembler::Label exit) {
+        using Type = LoadStoreGroup::LoadStoreRegisterUnsignedImmediate;
+
+        const auto Rt    = A64InstructionManager::Extract< A64InstructionManager::Tag::Rt >(instruction);
+        const auto Rn    = A64InstructionManager::Extract< A64InstructionManager::Tag::Rn >(instruction);
+        const auto imm12 = A64InstructionManager::Extract< A64InstructionManager::Tag::Imm12 >(instruction);
+        const auto size  = A64InstructionManager::Extract< A64InstructionManager::Tag::Size >(instruction);
+
+        // Helper of the access, bytes accessed and, for loads, the size of Rt and whether the value is sign extended
+        struct Access {
+            std::uint64_t m_helper;
+            std::uint32_t m_bytes;
+            std::uint32_t m_registerSize;
+            bool          m_isSigned;
+            bool          m_isStore;
+        };
+        const auto load = []< class T >(T, std::uint32_t registerSize, bool isSigned) {
+            return Access { reinterpret_cast< std::uint64_t >(&A64ProcessState::NativeLoad< T >), sizeof(T),
+                            registerSize, isSigned, false };
+        };
+        const auto store = []< class T >(T) {
+            return Access { reinterpret_cast< std::uint64_t >(&A64ProcessState::NativeStore< T >), sizeof(T), 64,
+                            false, true };
+        };
+
+        Access access {};
+        switch (instructionType) {
+            case Type::STRBi:
+                access = store(std::uint8_t {});
+                break;
+            case Type::LDRBi:
+                access = load(std::uint8_t {}, 32, false);
+                break;
+            case Type::LDRSBi_64BIT:
+                access = load(std::uint8_t {}, 64, true);
+                break;
+            case Type::LDRSBi_32BIT:
+                access = load(std::uint8_t {}, 32, true);
+                break;
+            case Type::STRHi:
+                access = store(std::uint16_t {});
+                break;
+            case Type::LDRHi:
+                access = load(std::uint16_t {}, 32, false);
+                break;
+            case Type::LDRSHi_64BIT:
+                access = load(std::uint16_t {}, 64, true);
+                break;
+            case Type::LDRSHi_32BIT:
+                access = load(std::uint16_t {}, 32, true);
+                break;
+            case Type::STRi_32BIT:
+                access = store(std::uint32_t {});
+                break;
+            case Type::LDRi_32BIT:
+                access = load(std::uint32_t {}, 32, false);
+                break;
+            case Type::LDRSWi:
+                access = load(std::uint32_t {}, 64, true);
+                break;
+            case Type::STRi_64BIT:
+                access = store(std::uint64_t {});
+                break;
+            case Type::LDRi_64BIT:
+                access = load(std::uint64_t {}, 64, false);
+                break;
+            default:
+                return false;
+        }
+        // The plain 32 and 64-bit forms fault on a mismatching size field in their handlers
+        const bool isPlainAccess = instructionType == Type::STRi_32BIT || instructionType == Type::LDRi_32BIT ||
+                                   instructionType == Type::STRi_64BIT || instructionType == Type::LDRi_64BIT;
+        if (Rt == 31 || Rn == 31 || (isPlainAccess && (1u << size) != access.m_bytes)) {
+            return false;
+        }
+
+        // PC is in place should the access fault
+        EmitStorePC(assembler, address + 1);
+        assembler.MoveImmediate(Jit_arguments[0], reinterpret_cast< std::uint64_t >(this));
+        EmitLoadX(assembler, 64, Jit_arguments[1], Rn);
+        if (imm12 != 0) {
+            assembler.AluImmediate(X64Assembler::AluOp::Add, JitWidth::Bits64, Jit_arguments[1],
+                                   static_cast< std::int32_t >(imm12 * access.m_bytes));
+        }
+        if (access.m_isStore) {
+            EmitLoadX(assembler, 64, Jit_arguments[2], Rt);
+        } else {
+            assembler.LoadAddress(Jit_arguments[2], JitReg::Rbx, JitOffsetOfX(Rt));
+        }
+        assembler.MoveImmediate(JitReg::Rax, access.m_helper);
+        assembler.Call(JitReg::Rax);
+        assembler.Test(JitWidth::Bits8, JitReg::Rax, JitReg::Rax);
+        assembler.Jump(X64Assembler::Condition::Zero, exit);
+
+        // Loads land zero extended in Rt
+        if (access.m_isSigned) {
+            EmitLoadX(assembler, 64, JitReg::Rax, Rt);
+            assembler.MoveSignExtend(JitWidthOf(access.m_registerSize), JitReg::Rax, JitReg::Rax, 8 * access.m_bytes);
+            EmitStoreX(assembler, Rt, JitReg::Rax);
+        }
+        return true;
+    }
+
+    /// <summary>
+    /// Translates the longest run of supported instructions starting the block to x86-64 code. The code works on the
+    /// register file in place, calls back into the process state for memory accesses and conditions and leaves PC
+    /// past the last instruction it ran, or at the target of its taken branch, for the interpreter to go on from.
+    /// Register 31 operands and the forms whose handlers deviate from the architecture are never translated, so that
+    /// both execute the same way.
+    /// </summary>
+    void TranslateBlock(A64BasicBlock& block) {
+        X64Assembler assembler {};
+        const auto   exit = assembler.CreateLabel();
+
+        // RBX holds the register file throughout, the stack is 16 bytes aligned at the calls
+        assembler.Push(JitReg::Rbx);
+#if defined(ARMEMU_OS_WINDOWS)
+        assembler.AluImmediate(X64Assembler::AluOp::Sub, JitWidth::Bits64, JitReg::Rsp, 32);
+#endif // ARMEMU_OS_WINDOWS
+        assembler.Move(JitWidth::Bits64, JitReg::Rbx, Jit_arguments[0]);
+
+        std::size_t nativeCount = 0;
+        for (const auto& decodedInstruction : block.m_instructions) {
+            const auto address    = block.m_address + nativeCount;
+            const bool translated = std::visit(
+                [&](auto instructionType) {
+                    return TranslateInstruction(assembler, decodedInstruction.m_instruction, instructionType, address,
+                                                exit);
+                },
+                decodedInstruction.m_instructionType);
+            if (!translated) {
+                break;
+            }
+            ++nativeCount;
+        }
+        if (nativeCount == 0) {
+            return;
+        }
+
+        EmitStorePC(assembler, block.m_address + nativeCount);
+        assembler.Bind(exit);
+#if defined(ARMEMU_OS_WINDOWS)
+        assembler.AluImmediate(X64Assembler::AluOp::Add, JitWidth::Bits64, JitReg::Rsp, 32);
+#endif // ARMEMU_OS_WINDOWS
+        assembler.Pop(JitReg::Rbx);
+        assembler.Return();
+
+        // A full arena leaves the block to the interpreter
+        const auto code = assembler.Finish();
+        if (const auto* nativeCode = code.empty() ? nullptr : m_jitCode.Append(code)) {
+            block.m_nativeCode  = nativeCode;
+            block.m_nativeCount = nativeCount;
+        }
+    }
+
+    /// @brief Runs the host code of the block, translating the block once it got hot
+    /// @return Instructions of the block the host code ran
+    std::size_t ExecuteNative(A64BasicBlock& block) {
+#if defined(ARMEMU_JIT_X64)
+        if (block.m_executionCount < Jit_hotness_threshold && ++block.m_executionCount == Jit_hotness_threshold) {
+            TranslateBlock(block);
+        }
+        if (!block.m_nativeCode) {
+            return 0;
+        }
+
+        reinterpret_cast< JitEntry >(const_cast< std::byte* >(block.m_nativeCode))(
+            std::addressof(m_gpRegisters.File()));
+        return block.m_nativeCount;
+#else  // ARMEMU_JIT_X64
+        (void)block;
+        return 0;
+#endif // !ARMEMU_JIT_X64
+    }
+
+    /// @brief Executes the basic block at PC, chained from the previously executed block
+    /// @param doCompile Whether hot blocks run as host code, the instructions it does not cover are interpreted
+    /// @return The executed block, nullptr if PC was outside of the program and a single instruction was executed
+    A64BasicBlock* ExecuteBlock(A64BasicBlock* previousBlock, bool doCompile) {
+        auto* block = m_blockCache.Fetch(PC(), previousBlock);
+        if (!block) {
+            const auto& decodedInstruction = m_decodeCache.Fetch(PC());
+            PC() += 1;
+            Execute(decodedInstruction);
+            return nullptr;
+        }
+
+        const auto nativeCount = doCompile ? ExecuteNative(*block) : 0;
+        if (m_fault != Fault::None) {
+            return block;
+        }
+
+        for (const auto& decodedInstruction : std::span { block->m_instructions }.subspan(nativeCount)) {
+            PC() += 1;
+            Execute(decodedInstruction);
+
+            // Faults stay precise, nothing past the faulting instruction of the block runs
+            if (m_fault != Fault::None) {
+                break;
+            }
+        }
+        return block;
+    }
+
+  public:
+    A64ProcessState(Object* logger, A64ProcessingUnitWatcher& watcher, ICacheMemory* upStreamMemory,
+                    IMemory::Address allocatedSize, MemoryManagementUnitProxy mmuProxy,
+                    std::span< IMemory::DataUnit > flatMemory, WorkStealingDomain* workStealingDomain,
+                    const WorkStealingDomain::IWorker* worker) :
+        m_status(IProcessingUnit::ProcessStatus::Idle),
+        m_upStreamMemory(upStreamMemory),
+        m_mmu(std::move(mmuProxy)),
+        m_allocatedSize(allocatedSize),
+        m_programs(),
+        m_currentProgram(),
+        m_currentProgramMemory(nullptr),
+        m_workStealingDomain(workStealingDomain),
+        m_worker(worker),
+        m_watcher(watcher),
+        m_debugObject(*logger),
+        m_executionMode(ExecutionMode::BlockTranslation),
+        m_fault(IProcessingUnit::Fault::None),
+        m_stopRunningInterrupt(nullptr),
+        m_memory(m_upStreamMemory, std::addressof(m_mmu), flatMemory, std::addressof(m_fault)),
+        m_gpRegisters(*this, std::addressof(m_memory)),
+        m_sysRegisters() {
+        assert((m_upStreamMemory || m_memory.IsFlat()) && "Processing unit has no memory to run programs in!");
+        m_mmu.AttachRegisters(std::addressof(m_sysRegisters));
+    }
+
+    Result SetProgram(Program program) {
+        constexpr bool isStepInAllowed = false;
+        m_debugObject.LogTrace(LogType::Other, "Adding program {}!",
+                               static_cast< const void* const >(program.GetProgram()));
+        auto resultElement =
+            std::allocate_shared< ResultElement >(std::pmr::polymorphic_allocator< ResultElement > {}, isStepInAllowed);
+
+        // Counted before it is pushed, a thief may take it right away
+        m_watcher.RecordProgramQueued();
+        m_programs.Push(QueuedProgram { std::move(program), isStepInAllowed, resultElement->weak_from_this() });
+        return Result { std::move(resultElement) };
+    }
+
+    ControlledResult SetProgramToStepIn(Program program) {
+        constexpr bool isStepInAllowed = true;
+        m_debugObject.LogTrace(LogType::Other, "Adding program {} to step in!",
+                               static_cast< const void* const >(program.GetProgram()));
+        auto resultElement =
+            std::allocate_shared< ResultElement >(std::pmr::polymorphic_allocator< ResultElement > {}, isStepInAllowed);
+
+        m_watcher.RecordProgramQueued();
+        m_programs.Push(QueuedProgram { std::move(program), isStepInAllowed, resultElement->weak_from_this() });
+        return ControlledResult { std::move(resultElement) };
+    }
+
+    std::pmr::vector< Result > SetPrograms(std::span< Program > programs, ResultElementPool& resultPool) {
+        constexpr bool isStepInAllowed = false;
+        m_debugObject.LogTrace(LogType::Other, "Adding a batch of {} programs!", programs.size());
+
+        std::pmr::vector< Result >        results {};
+        std::pmr::vector< QueuedProgram > queuedPrograms {};
+        results.reserve(programs.size());
+        queuedPrograms.reserve(programs.size());
+        for (auto& program : programs) {
+            auto resultElement = resultPool.Allocate(isStepInAllowed);
+            queuedPrograms.emplace_back(std::move(program), isStepInAllowed, resultElement->weak_from_this());
+            results.emplace_back(std::move(resultElement));
+        }
+
+        m_watcher.RecordProgramsQueued(queuedPrograms.size());
+        m_programs.PushBatch(queuedPrograms);
+        return results;
+    }
+
+    IMemory const* GetCurrentProgramMemory() const noexcept {
+        return m_currentProgramMemory.load(std::memory_order_acquire);
+    }
+
+    ProgramQueue& GetProgramQueue() noexcept {
+        return m_programs;
+    }
+
+    bool HasQueuedPrograms() const noexcept {
+        return !m_programs.IsEmpty();
+    }
+
+    IProcessingUnit::ProcessStatus GetStatus() const noexcept {
+        return m_status.load(std::memory_order_seq_cst);
+    }
+
+    ExecutionMode GetExecutionMode() const noexcept {
+        return m_executionMode.load(std::memory_order_relaxed);
+    }
+
+    void SetExecutionMode(ExecutionMode executionMode) noexcept {
+        m_executionMode.store(executionMode, std::memory_order_relaxed);
+    }
+
+    void Run(Interrupt interrupt, std::condition_variable& runProcessCondVar,
+             std::condition_variable_any& stepInCondVar) {
+        if (!TakeNextProgram()) {
+            m_debugObject.Log(LogType::Other, "Run(): no programs found to run!");
+            return;
+        }
+
+        m_debugObject.Log(LogType::Other, "ProcessingUnit::Run() is running!");
+
+        auto                       currentProgramMemory    = m_currentProgram->m_program.GetProgram();
+        auto                       currentProgramEntrySize = m_currentProgram->m_program.GetEntryPoint();
+        bool                       doStepIn                = m_currentProgram->m_stepIn;
+        SharedRef< ResultElement > currentResult           = m_currentProgram->m_result.lock();
 
         m_stopRunningInterrupt = interrupt;
         m_status.store(IProcessingUnit::ProcessStatus::Running, std::memory_order_seq_cst);
         Interrupt                    stepInDoneInterrupt {};
         std::condition_variable_any* stepInDoneCondVar { nullptr };
-        if (doStepIn && currentResult) {
-            if (!stepInDoneInterrupt) {
-                stepInDoneInterrupt = CreateInterrupt();
-            }
-            stepInDoneCondVar = std::addressof(currentResult->StepInSetup(stepInCondVar, stepInDoneInterrupt));
-        }
 
         while (currentProgramMemory && !m_stopRunningInterrupt->IsTriggered()) {
             m_debugObject.Log(LogType::Other, "ProcessingUnit::Run() is starting program {} in {} mode!",
                               static_cast< const void* >(currentProgramMemory), doStepIn ? "StepIn" : "Run");
 
+            // Stepping in stops once its instruction budget is spent, blocks are only run while a whole one fits in it
+            const auto executionMode     = GetExecutionMode();
+            const bool doTranslateBlocks = executionMode != ExecutionMode::Interpreter;
+            const bool doCompileBlocks   = executionMode == ExecutionMode::Jit;
+
+            if (doStepIn && currentResult) {
+                if (!stepInDoneInterrupt) {
+                    stepInDoneInterrupt = CreateInterrupt();
+                }
+                stepInDoneCondVar = std::addressof(currentResult->StepInSetup(stepInCondVar, stepInDoneInterrupt));
+            }
+
             if (currentResult) {
                 currentResult->Signal(doStepIn ? IResult::State::Waiting : IResult::State::Running);
             }
 
-            auto& memory = currentProgramMemory;
-            bool  setup  = true;
-            while (!m_stopRunningInterrupt->IsTriggered() &&
-                   (!doStepIn || (doStepIn && currentResult) /* If result is destroyed then ignore the program */)) {
+            m_decodeCache.Attach(currentProgramMemory);
+            m_blockCache.Attach(currentProgramMemory);
+            m_jitCode.Clear();
+            m_fault = Fault::None;
 
-                if (setup) {
-                    SetupRegisters(currentProgramEntrySize);
-                    setup = false;
-                }
+            bool           setup         = true;
+            A64BasicBlock* previousBlock = nullptr;
+            std::uint64_t  stepBudget    = 0;
 
-                if (PC() == Return_from_program) {
-                    if (doStepIn && currentResult) {
-                        currentResult->SignalStepInValidity(false);
-                        stepInDoneInterrupt->Trigger();
-                        stepInDoneCondVar->notify_one();
+            // Nothing on the execution path throws, faults are raised instead. Anything escaping is a host failure
+            // and ends the current program only
+            try {
+                // If result is destroyed then ignore the program
+                while (!m_stopRunningInterrupt->IsTriggered() && (!doStepIn || (doStepIn && currentResult))) {
+
+                    if (setup) {
+                        SetupRegisters(currentProgramEntrySize);
+                        setup = false;
+                    }
+
+                    if (PC() == Return_from_program) {
+                        if (doStepIn && currentResult) {
+                            // Publish the final frame before releasing the stepping thread
+                            currentResult->SetResultFrame(GenerateFrameData());
+                            currentResult->SignalStepInValidity(false);
+                            stepInDoneInterrupt->Trigger();
+                            stepInDoneCondVar->notify_one();
+                        }
+                        break; // Program ended
                     }
-                    break; // Program ended
-                }
 
-                if (doStepIn) {
-                    if (currentResult) {
-                        currentResult->SetResultFrame(GenerateFrameData());
-
-                        std::mutex       localMutex {};
-                        std::unique_lock localLock { localMutex };
-                        auto             stepInInterrupt = currentResult->GetStepInInterrupt();
-                        stepInDoneInterrupt->Trigger();
-                        stepInDoneCondVar->notify_one();
-                        currentResult->Signal(IResult::State::StepInMode);
-                        stepInCondVar.wait(localLock, [&]() {
-                            return stepInInterrupt->IsTriggered() || m_stopRunningInterrupt->IsTriggered();
-                        });
-                        if (m_stopRunningInterrupt->IsTriggered()) {
+                    if (doStepIn && stepBudget == 0) {
+                        if (currentResult) {
+                            currentResult->SetResultFrame(GenerateFrameData());
+
+                            std::mutex       localMutex {};
+                            std::unique_lock localLock { localMutex };
+                            auto             stepInInterrupt = currentResult->GetStepInInterrupt();
+                            stepInDoneInterrupt->Trigger();
+                            stepInDoneCondVar->notify_one();
+                            currentResult->Signal(IResult::State::StepInMode);
+
+                            // The host thread waits for the stepping thread, the pool runs other processing units
+                            // meanwhile
+                            HostThreadPool::BlockingScope blocking {};
+                            stepInCondVar.wait(localLock, [&]() {
+                                return stepInInterrupt->IsTriggered() || m_stopRunningInterrupt->IsTriggered();
+                            });
+                            if (m_stopRunningInterrupt->IsTriggered()) {
+                                break;
+                            }
+                            stepBudget = currentResult->GetStepBudget();
+                        } else {
                             break;
                         }
+                    }
+
+                    // Fetch and decode, decoding is skipped for instructions seen before
+                    if (doTranslateBlocks && (!doStepIn || stepBudget >= A64BlockCache::Max_block_size)) {
+                        previousBlock = ExecuteBlock(previousBlock, doCompileBlocks);
+                        if (doStepIn) {
+                            stepBudget -= previousBlock ? previousBlock->m_instructions.size() : 1;
+                        }
                     } else {
-                        break;
+                        const auto& decodedInstruction = m_decodeCache.Fetch(PC());
+                        PC() += 1;
+                        previousBlock = nullptr;
+
+                        // Execute
+                        Execute(decodedInstruction);
+                        if (doStepIn) {
+                            --stepBudget;
+                        }
                     }
-                }
 
-                // Fetch
-                auto instruction = Instruction { memory->Read(PC()) };
-
-                // Decode
-                const auto decodeGroup = A64InstructionManager::GetDecodeGroup(instruction);
-                PC() += 1;
-
-                // Execute
-                try {
-                    Execute(std::move(instruction), decodeGroup);
-                } catch (undefined_instruction) {
-                    m_debugObject.Log(LogType::Other, "Program {} is using an undefined instruction!",
-                                      static_cast< const void* >(currentProgramMemory));
-                    ExitProgramWithInterrupt(static_cast< const void* >(currentProgramMemory));
-                } catch (undefined_behaviour) {
-                    m_debugObject.Log(LogType::Other, "Program {} caused undefined behaviour!",
-                                      static_cast< const void* >(currentProgramMemory));
-                    ExitProgramWithInterrupt(static_cast< const void* >(currentProgramMemory));
-                } catch (undefined_register_access) {
-                    m_debugObject.Log(LogType::Other, "Program {} triggered undefined register access!",
-                                      static_cast< const void* >(currentProgramMemory));
-                    ExitProgramWithInterrupt(static_cast< const void* >(currentProgramMemory));
-                } catch (not_implemented_feature) {
-                    m_debugObject.Log(LogType::Other, "Program {} is running using a non-implemented feature!",
-                                      static_cast< const void* >(currentProgramMemory));
-                    ExitProgramWithInterrupt(static_cast< const void* >(currentProgramMemory));
-                } catch (invalid_physical_memory_access) {
-                    m_debugObject.Log(LogType::Other, "Program {} is had either a stack or a heap overflow!",
-                                      static_cast< const void* >(currentProgramMemory));
-                    ExitProgramWithInterrupt(static_cast< const void* >(currentProgramMemory));
-                } catch (untracked_processing_unit) {
-                    m_debugObject.Log(LogType::Other, "The processing unit is untracked in the MMU!");
-                    ExitProgramWithInterrupt(static_cast< const void* >(currentProgramMemory));
-                } catch (...) {
-                    m_debugObject.Log(LogType::Other, "Program {} threw an unexpected exception!",
-                                      static_cast< const void* >(currentProgramMemory));
-                    ExitProgramWithInterrupt(static_cast< const void* >(currentProgramMemory));
+                    // A fault ends the program only, the processing unit goes on with the next one
+                    if (m_fault != Fault::None) [[unlikely]] {
+                        LogFault(m_fault, static_cast< const void* >(currentProgramMemory));
+                        break;
+                    }
                 }
+            } catch (...) {
+                m_debugObject.Log(LogType::Other, "Program {} threw an unexpected exception!",
+                                  static_cast< const void* >(currentProgramMemory));
+                RaiseFault(Fault::UndefinedBehaviour);
+                LogFault(m_fault, static_cast< const void* >(currentProgramMemory));
             }
 
             if (m_stopRunningInterrupt->IsTriggered()) {
@@ -4774,41 +4680,53 @@ struct A64ProcessState : public A64ProcessingUnit::ProcessState {
                 }
 
                 m_watcher.RecordProcessInterrupted();
-                if (doStepIn) {
+                if (doStepIn && currentResult) {
                     currentResult->StepInFinalize();
+                    stepInDoneInterrupt->Trigger();
+                    stepInDoneCondVar->notify_one();
                 }
-                stepInDoneInterrupt->Trigger();
-                stepInDoneCondVar->notify_one();
                 return;
             }
 
-            // Program completed without interrupt
-            if (!doStepIn || (doStepIn && currentResult)) {
-                m_watcher.RecordProcessHandled();
-            }
-            if (doStepIn && currentResult) {
-                currentResult->StepInFinalize();
-            }
-            if (currentResult) {
-                currentResult->SetResultFrame(GenerateFrameData());
-                currentResult->Signal(Result::State::Ready);
+            if (m_fault != Fault::None) [[unlikely]] {
+                // The frame keeps the fault, the stepping thread sees the program interrupted once released
+                if (currentResult) {
+                    currentResult->SetResultFrame(GenerateFrameData());
+                    currentResult->Signal(Result::State::Interrupted);
+                }
+                if (doStepIn && currentResult) {
+                    currentResult->SignalStepInValidity(false);
+                    currentResult->StepInFinalize();
+                    stepInDoneInterrupt->Trigger();
+                    stepInDoneCondVar->notify_one();
+                }
+                m_watcher.RecordProcessInterrupted();
+            } else {
+                // Program completed without interrupt
+                if (!doStepIn || (doStepIn && currentResult)) {
+                    m_watcher.RecordProcessHandled();
+                }
+                if (doStepIn && currentResult) {
+                    currentResult->StepInFinalize();
+                }
+                if (currentResult) {
+                    currentResult->SetResultFrame(GenerateFrameData());
+                    currentResult->Signal(Result::State::Ready);
+                }
             }
             m_debugObject.Log(LogType::Other, "ProcessingUnit::Run() finished executing program {}!",
                               static_cast< const void* >(currentProgramMemory));
-            {
-                std::unique_lock lock { m_programMutex };
-                m_programs.pop();
-            }
-            if (m_programs.size() > 0) {
-                auto                       currentProgramMemory    = m_programs.front().m_program.GetProgram();
-                const auto                 currentProgramEntrySize = m_programs.front().m_program.GetEntryPoint();
-                bool                       doStepIn                = m_programs.front().m_stepIn;
-                SharedRef< ResultElement > currentResult           = m_programs.front().m_result.lock();
+            RetireCurrentProgram();
+            if (TakeNextProgram()) {
+                currentProgramMemory    = m_currentProgram->m_program.GetProgram();
+                currentProgramEntrySize = m_currentProgram->m_program.GetEntryPoint();
+                doStepIn                = m_currentProgram->m_stepIn;
+                currentResult           = m_currentProgram->m_result.lock();
             } else {
-                currentProgramMemory               = nullptr;
-                const auto currentProgramEntrySize = 0;
-                doStepIn                           = false;
-                currentResult                      = nullptr;
+                currentProgramMemory    = nullptr;
+                currentProgramEntrySize = 0;
+                doStepIn                = false;
+                currentResult           = nullptr;
             }
         }
 
@@ -4834,56 +4752,146 @@ struct A64ProcessState : public A64ProcessingUnit::ProcessState {
         assert(status != IProcessingUnit::ProcessStatus::Running && "Impossible to reset a running process state!");
 
         if (status == IProcessingUnit::ProcessStatus::Interrupted &&
-            m_programs.size() > 0 /* Interrupted a running a program */) {
-            {
-                std::unique_lock lock { m_programMutex };
-                m_programs.pop();
-            }
+            m_currentProgram /* Interrupted a running a program */) {
+            RetireCurrentProgram();
             m_watcher.RecordProcessHandled();
         }
-        m_upStreamMemory->ClearCache();
         m_status.store(IProcessingUnit::ProcessStatus::Idle, std::memory_order_seq_cst);
     }
 
+    /// @brief Writes the dirty lines back and drops the cache of the processing unit, kept out of the noexcept reset
+    void ClearCache() {
+        if (m_upStreamMemory) {
+            m_upStreamMemory->ClearCache();
+        }
+    }
+
   private:
+    /// @brief Takes the next queued program, once the queue is empty one queued on another processing unit is stolen
+    bool TakeNextProgram() {
+        auto program = m_programs.TryTake();
+        if (!program && m_workStealingDomain) {
+            program = m_workStealingDomain->Steal(m_worker);
+            if (program) {
+                m_watcher.RecordProgramQueued();
+            }
+        }
+
+        m_currentProgram = std::move(program);
+        m_currentProgramMemory.store(m_currentProgram ? m_currentProgram->m_program.GetProgram() : nullptr,
+                                     std::memory_order_release);
+        return m_currentProgram.has_value();
+    }
+
+    void RetireCurrentProgram() noexcept {
+        m_currentProgram.reset();
+        m_currentProgramMemory.store(nullptr, std::memory_order_release);
+        m_watcher.RecordProgramDequeued();
+    }
+
 #include <ProcessingUnit/InstructionCodeImpl/AArch64Operations/AArch64Operations.h>
 #include <ProcessingUnit/InstructionCodeImpl/SharedOperations/SharedOperations.h>
 
     void SetupRegisters(const Program::EntryPoint entry) {
         PC() = entry;
-        SP() = m_allocatedSize - 1;
+        // The stack grows down from the end of the byte addressed data space
+        SP() = m_allocatedSize * sizeof(IMemory::DataUnit);
+
+        // Demand paged processes start every program with translation enabled on their own tables
+        if (m_mmu.SetupTranslationRegisters(m_sysRegisters)) {
+            m_mmu.FlushTlb();
+        }
     }
 
-    void ExitProgramWithInterrupt(const void* programAddress) const {
-        m_debugObject.LogTrace(LogType::Other, "Exiting execution of program {} with interrupt signal!",
-                               programAddress);
-        m_stopRunningInterrupt->Trigger(); // At this point, the interrupt exists
+    void LogFault(Fault fault, const void* programAddress) const {
+        switch (fault) {
+            case Fault::UndefinedInstruction:
+                m_debugObject.Log(LogType::Other, "Program {} is using an undefined instruction!", programAddress);
+                break;
+            case Fault::UndefinedBehaviour:
+                m_debugObject.Log(LogType::Other, "Program {} caused undefined behaviour!", programAddress);
+                break;
+            case Fault::UndefinedRegisterAccess:
+                m_debugObject.Log(LogType::Other, "Program {} triggered undefined register access!", programAddress);
+                break;
+            case Fault::UnsupportedInstruction:
+                m_debugObject.Log(LogType::Other, "Program {} is using an unsupported instruction!", programAddress);
+                break;
+            case Fault::NotImplementedFeature:
+                m_debugObject.Log(LogType::Other, "Program {} is running using a non-implemented feature!",
+                                  programAddress);
+                break;
+            case Fault::InvalidPhysicalMemoryAccess:
+                m_debugObject.Log(LogType::Other, "Program {} is had either a stack or a heap overflow!",
+                                  programAddress);
+                break;
+            case Fault::UntrackedProcessingUnit:
+                m_debugObject.Log(LogType::Other, "The processing unit is untracked in the MMU!");
+                break;
+            case Fault::TranslationFault:
+                m_debugObject.Log(LogType::Other, "Program {} accessed an unmapped virtual address!", programAddress);
+                break;
+            case Fault::None:
+            default:
+                break;
+        }
     }
 
-    IResult::ResultFrame::Impl GenerateFrameData() const {
+    DataBlock< IMemory::DataUnit > ReadProcessMemory() const {
+        if (m_memory.IsFlat()) {
+            const auto flatMemory = m_memory.GetFlatMemory();
+            return DataBlock< IMemory::DataUnit > { std::min(m_allocatedSize, flatMemory.size()), flatMemory.data() };
+        }
+
+        // The memory is read through the cache hierarchy, so dirty lines of write-back caches are seen. Pages the
+        // program never touched are not mapped and read as zero.
+        auto processMemory = DataBlock< IMemory::DataUnit >(m_allocatedSize, IMemory::Empty_data_unit);
+
+        // Physically contiguous pages are read with a single block
+        IMemory::Address runStart    = 0;
+        IMemory::Address runPhysical = 0;
+        IMemory::Address runSize     = 0;
+
+        const auto readRun = [&]() {
+            if (runSize > 0) {
+                m_upStreamMemory->ReadBlock(runPhysical,
+                                            std::span< IMemory::DataUnit > { processMemory.Data() + runStart, runSize });
+            }
+            runSize = 0;
+        };
 
-        // TODO: very slow, think of a way to read more memory at once
-        /*
-        std::pmr::vector< IMemory::DataUnit > m_processMemory {};
-        m_processMemory.reserve(m_allocatedSize);
+        for (IMemory::Address pageStart = 0; pageStart < m_allocatedSize;
+             pageStart += MemoryManagementUnit::Page_size) {
+            const auto page = m_mmu.LookupPage(pageStart);
+            if (page.m_fault != TranslationFault::None) {
+                readRun();
+                continue;
+            }
 
-        const auto nReads = static_cast< IMemory::Address >(
-            std::ceil(static_cast< double >(m_allocatedSize) / ICacheMemory::Cache_line_size));
+            const auto unitCount = std::min({ MemoryManagementUnit::Page_size, page.m_unitCount,
+                                              m_allocatedSize - pageStart });
+            if (runSize == 0 || runStart + runSize != pageStart || runPhysical + runSize != page.m_physicalAddress) {
+                readRun();
+                runStart    = pageStart;
+                runPhysical = page.m_physicalAddress;
+            }
+            runSize += unitCount;
+        }
+        readRun();
 
-        for (IMemory::Address i = 0; i < nReads; ++i) {
-            auto data = m_upStreamMemory->ReadBlock(i * ICacheMemory::Cache_line_size, ICacheMemory::Cache_line_size);
-            m_processMemory.insert(m_processMemory.end(), data.Begin(), data.End());
-        }*/
-        // This is a quick hack until re-writing CacheMemory to allow for multi-cacheline read
-        auto ram = const_cast< IMemory* >(
-            static_cast< const ICacheMemory* >(
-                static_cast< const ICacheMemory* >(m_upStreamMemory->GetUpStreamMemory())->GetUpStreamMemory())
-                ->GetUpStreamMemory());
+        return processMemory;
+    }
 
-        auto m_processMemory = ram->ReadBlock(0, m_allocatedSize);
+    IResult::ResultFrame::Impl GenerateFrameData() const {
+        auto       m_processMemory = ReadProcessMemory();
+        const auto nzcv            = NZCV();
+        const bool n               = (nzcv >> 3) & 1;
+        const bool z               = (nzcv >> 2) & 1;
+        const bool c               = (nzcv >> 1) & 1;
+        const bool v               = nzcv & 1;
 
         return IResult::ResultFrame::Impl {
-            m_gpRegisters.ReadBulk(),        PC(), SP().to_ullong(), N.any(), C.any(), Z.any(), V.any(),
+            m_gpRegisters.ReadBulk(), PC(), SP(), n, c, z, v, m_fault,
             std::move(m_processMemory.Get())
         };
     }
@@ -4892,22 +4900,36 @@ struct A64ProcessState : public A64ProcessingUnit::ProcessState {
     ICacheMemory* const                                         m_upStreamMemory;
     MemoryManagementUnitProxy                                   m_mmu;
     IMemory::Address                                            m_allocatedSize;
-    std::queue< ProgramState, std::pmr::deque< ProgramState > > m_programs;
-    std::mutex                                                  m_programMutex;
-    A64ProcessingUnitWatcher&                                   m_watcher;
-    Object&                                                     m_debugObject;
+    ProgramQueue                                  m_programs;
+    std::optional< QueuedProgram >                m_currentProgram; // Only touched by the processing unit thread
+    std::atomic< IMemory const* >                 m_currentProgramMemory;
+    WorkStealingDomain* const                     m_workStealingDomain;
+    const WorkStealingDomain::IWorker* const      m_worker;
+    A64ProcessingUnitWatcher&                     m_watcher;
+    Object&                                       m_debugObject;
+    std::atomic< ExecutionMode >                  m_executionMode;
+
+    // First fault raised by the instruction being executed, checked by the run loop after every instruction
+    IProcessingUnit::Fault m_fault;
 
     // Registers ?
     Interrupt        m_stopRunningInterrupt;
+    MemoryPort       m_memory;
     GPRegistersProxy m_gpRegisters;
     SystemRegisters  m_sysRegisters;
+
+    A64DecodeCache   m_decodeCache;
+    A64BlockCache    m_blockCache;
+    ExecutableMemory m_jitCode; // Host code of the hot blocks of m_blockCache
 };
 
-class A64ProcessingUnit::Impl final {
+class A64ProcessingUnit::Impl final : public WorkStealingDomain::IWorker {
   public:
     Impl(Object* logger, ICacheMemory* upStreamMemory, IMemory::Address allocatedSize,
-         MemoryManagementUnitProxy mmuProxy) :
-        m_processState(logger, m_watcher, upStreamMemory, allocatedSize, mmuProxy),
+         MemoryManagementUnitProxy mmuProxy, std::span< IMemory::DataUnit > flatMemory,
+         WorkStealingDomain* workStealingDomain, std::size_t locality, HostThreadPool* hostThreadPool) :
+        m_processState(logger, m_watcher, upStreamMemory, allocatedSize, mmuProxy, flatMemory, workStealingDomain,
+                       this),
         m_watcher(),
         m_runProcessMutex(),
         m_runProcessCondVar(),
@@ -4916,7 +4938,13 @@ class A64ProcessingUnit::Impl final {
         m_endProcessInterrupt(CreateInterrupt()),
         m_cleanUp(CreateInterrupt()),
         m_debugObject(*logger),
-        m_runningThread([&]() { this->InternalRun(); }) {
+        m_workStealingDomain(workStealingDomain),
+        m_ownHostThreadPool(),
+        m_hostThreadPool(hostThreadPool ? *hostThreadPool : m_ownHostThreadPool.emplace(1)),
+        m_isScheduled(false) {
+        if (m_workStealingDomain) {
+            m_workStealingDomain->Join(this, locality);
+        }
         m_debugObject.Log(LogType::Construction, "Processing unit construction succeeded");
     }
 
@@ -4925,10 +4953,13 @@ class A64ProcessingUnit::Impl final {
 
     ~Impl() {
         m_cleanUp->Trigger();
-        m_runProcessCondVar.notify_one();
-
-        if (m_runningThread.joinable()) {
-            m_runningThread.join();
+        {
+            // A run already scheduled finishes its program, the pool may outlive this processing unit
+            std::unique_lock lock(m_runProcessMutex);
+            m_runProcessCondVar.wait(lock, [&]() { return !m_isScheduled.load(std::memory_order_seq_cst); });
+        }
+        if (m_workStealingDomain) {
+            m_workStealingDomain->Leave(this);
         }
         m_debugObject.Log(LogType::Destruction, "Processing unit destruction succeeded");
     }
@@ -4945,6 +4976,14 @@ class A64ProcessingUnit::Impl final {
         return m_watcher;
     }
 
+    ExecutionMode GetExecutionMode() const noexcept {
+        return m_processState.GetExecutionMode();
+    }
+
+    void SetExecutionMode(ExecutionMode executionMode) noexcept {
+        m_processState.SetExecutionMode(executionMode);
+    }
+
     const A64ProcessingUnit::ProcessState* const GetCurrentProcessState() const noexcept {
         return &m_processState;
     }
@@ -4957,6 +4996,23 @@ class A64ProcessingUnit::Impl final {
         return RequestRes< ControlledResult >(std::move(program));
     }
 
+    std::pmr::vector< Result > RunBatch(std::span< Program > programs, ResultElementPool& resultPool) {
+        m_debugObject.LogTrace(LogType::Other, "Running a batch of {} programs requested!", programs.size());
+
+        auto processStatus = m_processState.GetStatus();
+        if (processStatus == ProcessStatus::Interrupted) {
+            std::unique_lock lock(m_runProcessMutex);
+            m_runProcessCondVar.wait(lock, [&]() { return m_processState.GetStatus() == ProcessStatus::Idle; });
+        }
+
+        // The whole batch is published at once, the processing unit is woken up a single time
+        auto results = m_processState.SetPrograms(programs, resultPool);
+        if (processStatus != ProcessStatus::Running) {
+            RequestProcessRun();
+        }
+        return results;
+    }
+
     void Stop() {
         if (m_processState.GetStatus() == ProcessStatus::Running) {
             m_endProcessInterrupt->Trigger();
@@ -4969,27 +5025,77 @@ class A64ProcessingUnit::Impl final {
         m_runProcessCondVar.notify_one();
     }
 
+    ProgramQueue& GetProgramQueue() noexcept final {
+        return m_processState.GetProgramQueue();
+    }
+
+    void OnProgramStolen() noexcept final {
+        m_watcher.RecordProgramDequeued();
+    }
+
+    bool WakeIfIdle() final {
+        // Held by the host thread running the processing unit, if any
+        std::unique_lock lock(m_runProcessMutex, std::try_to_lock);
+        if (!lock || m_cleanUp->IsTriggered() || m_processState.GetStatus() != ProcessStatus::Idle) {
+            return false;
+        }
+        RequestProcessRun();
+        return true;
+    }
+
   private:
-    void InternalRun() {
-        while (!m_cleanUp->IsTriggered()) {
-            std::unique_lock lock(m_runProcessMutex);
-            m_runProcessCondVar.wait(
-                lock, [&]() { return m_runProcessInterrupt->IsTriggered() || m_cleanUp->IsTriggered(); });
+    void WakeIdleWorker() {
+        if (m_workStealingDomain) {
+            m_workStealingDomain->WakeIdleWorker(this);
+        }
+    }
 
-            if (m_cleanUp->IsTriggered()) {
-                break; // Cleanup triggered
-            }
+    /// @brief Asks for the queued programs to be run, schedules the processing unit on the pool unless it already is
+    void RequestProcessRun() {
+        m_runProcessInterrupt->Trigger();
+        if (!m_isScheduled.exchange(true, std::memory_order_seq_cst)) {
+            m_hostThreadPool.Submit([this]() { InternalRun(); });
+        }
+    }
 
+    /// @brief Runs the queued programs on a host thread of the pool, once per scheduling of the processing unit
+    void InternalRun() {
+        std::unique_lock lock(m_runProcessMutex);
+        if (!m_cleanUp->IsTriggered() && m_runProcessInterrupt->IsTriggered()) {
             m_processState.Run(m_endProcessInterrupt, m_runProcessCondVar, m_stepInProcessCondVar);
 
-            if (m_endProcessInterrupt->IsTriggered()) {
+            const bool isStopped = m_endProcessInterrupt->IsTriggered();
+            if (isStopped) {
                 m_endProcessInterrupt->Reset();
             }
             if (m_runProcessInterrupt->IsTriggered()) {
                 m_runProcessInterrupt->Reset();
             }
+            m_processState.ClearCache();
             ResetProcessState();
+
+            // Programs queued while the last one was retiring saw a running processing unit and did not wake it
+            if (!isStopped && m_processState.HasQueuedPrograms()) {
+                m_runProcessInterrupt->Trigger();
+            }
+        }
+
+        // The host thread is handed back between runs, the other processing units of the pool get their turn first
+        const auto isRunRequested = [&]() {
+            return !m_cleanUp->IsTriggered() && m_runProcessInterrupt->IsTriggered();
+        };
+        if (isRunRequested()) {
+            m_hostThreadPool.Submit([this]() { InternalRun(); });
+            return;
+        }
+        m_isScheduled.store(false, std::memory_order_seq_cst);
+
+        // A run requested before the store above found the processing unit scheduled and left it to this one
+        if (isRunRequested() && !m_isScheduled.exchange(true, std::memory_order_seq_cst)) {
+            m_hostThreadPool.Submit([this]() { InternalRun(); });
+            return;
         }
+        m_runProcessCondVar.notify_all();
     }
 
     template < class Res >
@@ -5005,10 +5111,16 @@ class A64ProcessingUnit::Impl final {
 
         auto processStatus = m_processState.GetStatus();
         if (processStatus == ProcessStatus::Running) {
-            if constexpr (std::same_as< Res, ControlledResult >)
-                return m_processState.SetProgramToStepIn(std::move(program));
-            else if constexpr (std::same_as< Res, Result >)
-                return m_processState.SetProgram(std::move(program));
+            // The program waits behind the running one, an idle processing unit may run it sooner
+            if constexpr (std::same_as< Res, ControlledResult >) {
+                auto result = m_processState.SetProgramToStepIn(std::move(program));
+                WakeIdleWorker();
+                return result;
+            } else if constexpr (std::same_as< Res, Result >) {
+                auto result = m_processState.SetProgram(std::move(program));
+                WakeIdleWorker();
+                return result;
+            }
         }
 
         if (processStatus == ProcessStatus::Interrupted) {
@@ -5021,13 +5133,11 @@ class A64ProcessingUnit::Impl final {
 
         if constexpr (std::same_as< Res, ControlledResult >) {
             auto result = m_processState.SetProgramToStepIn(std::move(program));
-            m_runProcessInterrupt->Trigger();
-            m_runProcessCondVar.notify_one();
+            RequestProcessRun();
             return result;
         } else if constexpr (std::same_as< Res, Result >) {
             auto result = m_processState.SetProgram(std::move(program));
-            m_runProcessInterrupt->Trigger();
-            m_runProcessCondVar.notify_one();
+            RequestProcessRun();
             return result;
         }
     }
@@ -5041,33 +5151,47 @@ class A64ProcessingUnit::Impl final {
     Interrupt                   m_endProcessInterrupt;
     Interrupt                   m_cleanUp;
     Object&                     m_debugObject;
-    std::thread                 m_runningThread;
+    WorkStealingDomain* const   m_workStealingDomain;
+
+    std::optional< HostThreadPool > m_ownHostThreadPool; // Single thread of a processing unit outside of a CPU
+    HostThreadPool&                 m_hostThreadPool;
+    std::atomic< bool >             m_isScheduled; // Run submitted to the pool and not finished yet
 };
 
 template < class ImplDetail >
 UniqueRef< A64ProcessingUnit::Impl >
     A64ProcessingUnit::ConstructProcessingUnit(ICacheMemory* upStreamMemory, IMemory::Address allocatedSize,
-                                               MemoryManagementUnitProxy mmuProxy, ImplDetail myself) {
+                                               MemoryManagementUnitProxy      mmuProxy,
+                                               std::span< IMemory::DataUnit > flatMemory,
+                                               WorkStealingDomain* workStealingDomain, std::size_t locality,
+                                               HostThreadPool* hostThreadPool, ImplDetail myself) {
     myself->Log(LogType::Construction,
-                "Constructing A64ProcessingUnit with upStreamMemory {} and program address space of {}",
-                static_cast< void* >(upStreamMemory), allocatedSize);
+                "Constructing A64ProcessingUnit with upStreamMemory {}, flat memory {} and program address space of {}",
+                static_cast< void* >(upStreamMemory), static_cast< void* >(flatMemory.data()), allocatedSize);
     std::pmr::polymorphic_allocator< A64ProcessingUnit::Impl > alloc {};
 
-    return allocate_unique< A64ProcessingUnit::Impl >(alloc, myself, upStreamMemory, allocatedSize, mmuProxy);
+    return allocate_unique< A64ProcessingUnit::Impl >(alloc, myself, upStreamMemory, allocatedSize, mmuProxy,
+                                                      flatMemory, workStealingDomain, locality, hostThreadPool);
 }
 
 A64ProcessingUnit::A64ProcessingUnit(std::string name, ICacheMemory* upStreamMemory, IMemory::Address allocatedSize,
-                                     MemoryManagementUnitProxy mmuProxy) :
+                                     MemoryManagementUnitProxy mmuProxy, std::span< IMemory::DataUnit > flatMemory,
+                                     WorkStealingDomain* workStealingDomain, std::size_t locality,
+                                     HostThreadPool* hostThreadPool) :
     IProcessingUnit(std::move(name)), m_processingUnit(nullptr) {
     mmuProxy.Attach(this);
-    m_processingUnit = ConstructProcessingUnit(upStreamMemory, allocatedSize, mmuProxy, this);
+    m_processingUnit = ConstructProcessingUnit(upStreamMemory, allocatedSize, mmuProxy, flatMemory, workStealingDomain,
+                                               locality, hostThreadPool, this);
 }
 
 A64ProcessingUnit::A64ProcessingUnit(ICacheMemory* upStreamMemory, IMemory::Address allocatedSize,
-                                     MemoryManagementUnitProxy mmuProxy) :
+                                     MemoryManagementUnitProxy mmuProxy, std::span< IMemory::DataUnit > flatMemory,
+                                     WorkStealingDomain* workStealingDomain, std::size_t locality,
+                                     HostThreadPool* hostThreadPool) :
     IProcessingUnit(Default_name), m_processingUnit(nullptr) {
     mmuProxy.Attach(this);
-    m_processingUnit = ConstructProcessingUnit(upStreamMemory, allocatedSize, mmuProxy, this);
+    m_processingUnit = ConstructProcessingUnit(upStreamMemory, allocatedSize, mmuProxy, flatMemory, workStealingDomain,
+                                               locality, hostThreadPool, this);
 }
 
 A64ProcessingUnit::A64ProcessingUnit(A64ProcessingUnit&&) noexcept = default;
@@ -5112,6 +5236,14 @@ const IProcessingUnitWatcher& A64ProcessingUnit::GetProcessingUnitWatcher() cons
     return m_processingUnit->GetProcessingUnitWatcher();
 }
 
+ExecutionMode A64ProcessingUnit::GetExecutionMode() const noexcept {
+    return m_processingUnit->GetExecutionMode();
+}
+
+void A64ProcessingUnit::SetExecutionMode(ExecutionMode executionMode) noexcept {
+    m_processingUnit->SetExecutionMode(executionMode);
+}
+
 const A64ProcessingUnit::ProcessState* const A64ProcessingUnit::GetCurrentProcessState() const noexcept {
     return m_processingUnit->GetCurrentProcessState();
 }
@@ -5124,6 +5256,10 @@ ControlledResult A64ProcessingUnit::StepIn(Program program) {
     return m_processingUnit->StepIn(std::move(program));
 }
 
+std::pmr::vector< Result > A64ProcessingUnit::RunBatch(std::span< Program > programs, ResultElementPool& resultPool) {
+    return m_processingUnit->RunBatch(programs, resultPool);
+}
+
 void A64ProcessingUnit::Stop() {
     m_processingUnit->Stop();
 }
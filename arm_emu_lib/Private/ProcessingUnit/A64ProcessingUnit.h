@@ -5,17 +5,31 @@
     #include <Memory/MemoryManagementUnitProxy.h>
     #include <ProcessingUnit/IProcessingUnit.h>
     #include <Utility/UniqueRef.h>
+    #include <cstddef>
+    #include <span>
     #include <string>
 
 BEGIN_NAMESPACE
 
+class HostThreadPool;
+class WorkStealingDomain;
+
 class [[nodiscard]] A64ProcessingUnit final : public IProcessingUnit {
     static constexpr const char* Default_name = "ProcessingUnit";
 
   public:
-    A64ProcessingUnit(ICacheMemory* upStreamMemory, IMemory::Address allocatedSize, MemoryManagementUnitProxy mmuProxy);
+    /// @param flatMemory Host buffer backing the program address space in the flat memory model, accesses then bypass
+    /// the MMU and upStreamMemory, which may be nullptr. Empty for the cache hierarchy memory model.
+    /// @param workStealingDomain Domain the queued programs are shared with, nullptr to run them all on this unit
+    /// @param locality Processing units of equal locality, sharing a cache, steal from each other first
+    /// @param hostThreadPool Host threads the programs run on, nullptr for a host thread of this unit only
+    A64ProcessingUnit(ICacheMemory* upStreamMemory, IMemory::Address allocatedSize, MemoryManagementUnitProxy mmuProxy,
+                      std::span< IMemory::DataUnit > flatMemory = {}, WorkStealingDomain* workStealingDomain = nullptr,
+                      std::size_t locality = 0, HostThreadPool* hostThreadPool = nullptr);
     A64ProcessingUnit(std::string name, ICacheMemory* upStreamMemory, IMemory::Address allocatedSize,
-                      MemoryManagementUnitProxy mmuProxy);
+                      MemoryManagementUnitProxy mmuProxy, std::span< IMemory::DataUnit > flatMemory = {},
+                      WorkStealingDomain* workStealingDomain = nullptr, std::size_t locality = 0,
+                      HostThreadPool* hostThreadPool = nullptr);
     A64ProcessingUnit(A64ProcessingUnit&&) noexcept;
     A64ProcessingUnit& operator=(A64ProcessingUnit&&) noexcept;
     ~A64ProcessingUnit() final;
@@ -32,6 +46,9 @@ class [[nodiscard]] A64ProcessingUnit final : public IProcessingUnit {
     [[nodiscard]] IMemory const* GetCurrentProgramMemory() const noexcept final;
     [[nodiscard]] ProcessStatus  GetStatus() const noexcept final;
     [[nodiscard]] const IProcessingUnitWatcher& GetProcessingUnitWatcher() const noexcept final;
+    [[nodiscard]] ExecutionMode                 GetExecutionMode() const noexcept final;
+
+    void SetExecutionMode(ExecutionMode executionMode) noexcept final;
 
     [[nodiscard]] const ProcessState* const GetCurrentProcessState() const noexcept final;
 
@@ -40,6 +57,8 @@ class [[nodiscard]] A64ProcessingUnit final : public IProcessingUnit {
     void             Stop() final;
     void             Reset() noexcept final;
 
+    std::pmr::vector< Result > RunBatch(std::span< Program > programs, ResultElementPool& resultPool) final;
+
   private:
     void ResetProcessState() noexcept;
 
@@ -49,7 +68,9 @@ class [[nodiscard]] A64ProcessingUnit final : public IProcessingUnit {
     template < class ImplDetail >
     [[nodiscard]] static UniqueRef< Impl >
         ConstructProcessingUnit(ICacheMemory* upStreamMemory, IMemory::Address allocatedSize,
-                                MemoryManagementUnitProxy mmuProxy, ImplDetail detail);
+                                MemoryManagementUnitProxy mmuProxy, std::span< IMemory::DataUnit > flatMemory,
+                                WorkStealingDomain* workStealingDomain, std::size_t locality,
+                                HostThreadPool* hostThreadPool, ImplDetail detail);
 };
 
 END_NAMESPACE
@@ -14,7 +14,8 @@ A64ProcessingUnitWatcher::A64ProcessingUnitWatcher() :
     m_reservedInstructions(0),
     m_scalableVectorExtension(0),
     m_processCount(0),
-    m_interruptCount(0) {
+    m_interruptCount(0),
+    m_queueDepth(0) {
 }
 
 void A64ProcessingUnitWatcher::RecordInstructionHandled(InstructionType type) noexcept {
@@ -54,6 +55,19 @@ void A64ProcessingUnitWatcher::RecordProcessInterrupted() noexcept {
     ++m_interruptCount;
 }
 
+void A64ProcessingUnitWatcher::RecordProgramQueued() noexcept {
+    RecordProgramsQueued(1);
+}
+
+void A64ProcessingUnitWatcher::RecordProgramsQueued(std::size_t count) noexcept {
+    m_queueDepth.fetch_add(count, std::memory_order_relaxed);
+}
+
+void A64ProcessingUnitWatcher::RecordProgramDequeued() noexcept {
+    assert(m_queueDepth.load(std::memory_order_relaxed) > 0 && "No program was queued!");
+    m_queueDepth.fetch_sub(1, std::memory_order_relaxed);
+}
+
 std::size_t A64ProcessingUnitWatcher::GetInstructionCountFor(InstructionType type) const noexcept {
     switch (type) {
         case InstructionType::BranchExceptionSystem:
@@ -91,4 +105,8 @@ std::size_t A64ProcessingUnitWatcher::GetInterruptCount() const noexcept {
     return m_interruptCount;
 }
 
+std::size_t A64ProcessingUnitWatcher::GetQueueDepth() const noexcept {
+    return m_queueDepth.load(std::memory_order_relaxed);
+}
+
 END_NAMESPACE
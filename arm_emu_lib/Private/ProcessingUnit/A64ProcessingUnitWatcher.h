@@ -3,6 +3,7 @@
 
     #include <API/Api.h>
     #include <ProcessingUnit/IProcessingUnitWatcher.h>
+    #include <atomic>
     #include <cstdint>
 
 BEGIN_NAMESPACE
@@ -10,17 +11,21 @@ BEGIN_NAMESPACE
 struct [[nodiscard]] A64ProcessingUnitWatcher : public IProcessingUnitWatcher {
   public:
     A64ProcessingUnitWatcher();
-    DEFAULT_COPY_CLASS(A64ProcessingUnitWatcher)
-    DEFAULT_MOVE_CLASS(A64ProcessingUnitWatcher)
+    DELETE_COPY_CLASS(A64ProcessingUnitWatcher)
+    DELETE_MOVE_CLASS(A64ProcessingUnitWatcher)
     VIRTUAL_DTOR(A64ProcessingUnitWatcher)
 
     void RecordInstructionHandled(InstructionType type) noexcept final;
     void RecordProcessHandled() noexcept final;
     void RecordProcessInterrupted() noexcept final;
+    void RecordProgramQueued() noexcept final;
+    void RecordProgramsQueued(std::size_t count) noexcept final;
+    void RecordProgramDequeued() noexcept final;
 
     [[nodiscard]] std::size_t GetInstructionCountFor(InstructionType type) const noexcept final;
     [[nodiscard]] std::size_t GetProcessCount() const noexcept final;
     [[nodiscard]] std::size_t GetInterruptCount() const noexcept final;
+    [[nodiscard]] std::size_t GetQueueDepth() const noexcept final;
 
   private:
     std::size_t m_branchExceptionSystemInstructions;
@@ -33,6 +38,9 @@ struct [[nodiscard]] A64ProcessingUnitWatcher : public IProcessingUnitWatcher {
 
     std::size_t m_processCount;
     std::size_t m_interruptCount;
+
+    // Updated by submitting threads and the processing unit thread, read by load balancers
+    std::atomic< std::size_t > m_queueDepth;
 };
 
 END_NAMESPACE
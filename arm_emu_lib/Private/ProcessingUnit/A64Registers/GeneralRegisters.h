@@ -3,10 +3,9 @@
 
     #include <API/Api.h>
     #include <ProcessingUnit/IProcessingUnit.h>
-    #include <Utility/Bitset.h>
     #include <Utility/Utilities.h>
     #include <array>
-    #include <bitset>
+    #include <cstdint>
     #include <variant>
 
 BEGIN_NAMESPACE
@@ -18,188 +17,168 @@ enum class RegisterStatus : std::uint32_t
     ACTIVE,
 };
 
+/// <summary>
+/// Operation that last wrote the condition flags, NZCV is only derived from its operands when read
+/// </summary>
+enum class FlagSource : std::uint32_t
+{
+    Value,
+    Add,
+    Logical,
+};
+
+/// <summary>
+/// Architectural register file of an A64 processing element, kept as raw integers. Hot state (X0 - X30, PC, SP_ELx
+/// and NZCV) shares one cache-line aligned block.
+/// </summary>
+struct alignas(64) A64RegisterFile {
+    // R0 - R30 (31 registers)
+    std::array< std::uint64_t, 31 > m_X {};
+    std::uint64_t                   m_PC { 0 };
+    // C5.2.11 - C5.2.14 SP_EL0, SP_EL1, SP_EL2, SP_EL3
+    std::array< std::uint64_t, 4 > m_SP {};
+    // C5.2.9 NZCV, Condition Flags: N, Z, C and V live in bits [3:0], valid when m_flagSource is Value
+    std::uint32_t m_NZCV { 0 };
+
+    // Last flag setting operation
+    FlagSource    m_flagSource { FlagSource::Value };
+    std::uint32_t m_flagWidth { 64 };
+    std::uint64_t m_flagOperand1 { 0 };
+    std::uint64_t m_flagOperand2 { 0 };
+    std::uint64_t m_flagResult { 0 };
+    bool          m_flagCarryIn { false };
+};
+
 struct [[nodiscard]] GPRegisters {
 
-    using Arch64Registers = std::array< std::bitset< 64 >, 31 >;
+    using Arch64Registers = std::array< std::uint64_t, 31 >;
 
     [[nodiscard]] auto& PC() noexcept {
-        return m_PC;
+        return m_file.m_PC;
     }
 
     [[nodiscard]] auto& PC() const noexcept {
-        return m_PC;
-    }
-
-    [[nodiscard]] auto& SP() noexcept { // Width 64
-        switch (m_PE.EL.to_ulong()) {
-            case 0:
-                return m_SPEL0.m_value;
-                break;
-            case 1:
-                return m_SPEL1.m_value;
-                break;
-            case 2:
-                return m_SPEL2.m_value;
-                break;
-            case 3:
-                return m_SPEL3.m_value;
-                break;
+        return m_file.m_PC;
+    }
+
+    [[nodiscard]] std::uint64_t& SP() noexcept { // Width 64
+        return m_file.m_SP[m_PE.EL.to_ulong()];
+    }
+
+    [[nodiscard]] const std::uint64_t& SP() const noexcept {
+        return m_file.m_SP[m_PE.EL.to_ulong()];
+    }
+
+    // Materialises N, Z, C and V (bits [3:0]) from the last flag setting operation
+    [[nodiscard]] std::uint32_t NZCV() const noexcept {
+        const auto& file = m_file;
+        switch (file.m_flagSource) {
+            case FlagSource::Value:
+                return file.m_NZCV;
+            case FlagSource::Logical:
+                return NZFlags(file.m_flagResult, file.m_flagWidth);
+            case FlagSource::Add: {
+                const auto width  = file.m_flagWidth;
+                const auto result = file.m_flagResult;
+                const auto x      = file.m_flagOperand1;
+                const auto y      = file.m_flagOperand2;
+
+                bool carry_out = false;
+                if (width == 64) {
+                    carry_out = result < x || (file.m_flagCarryIn && result == x);
+                } else {
+                    carry_out = ((x + y + static_cast< std::uint64_t >(file.m_flagCarryIn)) >> width) & 1;
+                }
+                const bool overflow = (((x ^ result) & (y ^ result)) >> (width - 1)) & 1;
+
+                return NZFlags(result, width) | static_cast< std::uint32_t >(carry_out) << 1 |
+                       static_cast< std::uint32_t >(overflow);
+            }
             default:
                 assert(false && "Unreachable code path!");
                 std::terminate();
         }
     }
 
-    [[nodiscard]] const auto& SP() const noexcept {
-        switch (m_PE.EL.to_ulong()) {
-            case 0:
-                return m_SPEL0.m_value;
-                break;
-            case 1:
-                return m_SPEL1.m_value;
-                break;
-            case 2:
-                return m_SPEL2.m_value;
-                break;
-            case 3:
-                return m_SPEL3.m_value;
-                break;
-            default:
-                assert(false && "Unreachable code path!");
-                std::terminate();
-        }
+    void SetNZCV(std::uint32_t nzcv) noexcept {
+        m_file.m_NZCV       = nzcv & 0b1111;
+        m_file.m_flagSource = FlagSource::Value;
     }
 
-    // 64-bit aliases
-    [[nodiscard]] auto X(const Bitset& loc) const {
-        auto mLoc = loc.ToULong();
-        PreConditions(mLoc);
+    // Returns the width bits sum of x, y and carry_in, deferring its flags until NZCV() is read
+    [[nodiscard]] std::uint64_t SetNZCVFromAdd(std::uint32_t width, std::uint64_t x, std::uint64_t y,
+                                               bool carry_in) noexcept {
+        assert(width > 0 && width <= 64);
+        const auto mask = WidthMask(width);
 
-        return m_registers[mLoc];
+        m_file.m_flagSource   = FlagSource::Add;
+        m_file.m_flagWidth    = width;
+        m_file.m_flagOperand1 = x & mask;
+        m_file.m_flagOperand2 = y & mask;
+        m_file.m_flagCarryIn  = carry_in;
+        m_file.m_flagResult   = (m_file.m_flagOperand1 + m_file.m_flagOperand2 + carry_in) & mask;
+        return m_file.m_flagResult;
     }
 
-    // 32-bit aliases
-    [[nodiscard]] auto WSP() noexcept { // Width 32
-        constexpr std::uint64_t Mask = 0x00000000FFFFFFFF;
-        switch (m_PE.EL.to_ulong()) {
-            case 0:
-                return m_SPEL0.m_value.to_ullong() & Mask;
-                break;
-            case 1:
-                return m_SPEL1.m_value.to_ullong() & Mask;
-                break;
-            case 2:
-                return m_SPEL2.m_value.to_ullong() & Mask;
-                break;
-            case 3:
-                return m_SPEL3.m_value.to_ullong() & Mask;
-                break;
-            default:
-                assert(false && "Unreachable code path!");
-                std::terminate();
-        }
+    // N and Z follow the result, C and V are cleared
+    void SetNZCVFromLogical(std::uint32_t width, std::uint64_t result) noexcept {
+        assert(width > 0 && width <= 64);
+        m_file.m_flagSource = FlagSource::Logical;
+        m_file.m_flagWidth  = width;
+        m_file.m_flagResult = result;
     }
 
-    void WSP(std::uint32_t data) noexcept { // Width 32
-        switch (m_PE.EL.to_ulong()) {
-            case 0:
-                m_SPEL0.m_value = data;
-                break;
-            case 1:
-                m_SPEL1.m_value = data;
-                break;
-            case 2:
-                m_SPEL2.m_value = data;
-                break;
-            case 3:
-                m_SPEL3.m_value = data;
-                break;
-            default:
-                assert(false && "Unreachable code path!");
-                std::terminate();
-        }
+    // C6.2.52 CFINV, only C changes
+    void InvertCarryFlag() noexcept {
+        SetNZCV(NZCV() ^ 0b0010);
     }
 
-    void WSP(const std::bitset< 32 >& data) noexcept { // Width 32
-        switch (m_PE.EL.to_ulong()) {
-            case 0:
-                m_SPEL0.m_value = data.to_ullong();
-                break;
-            case 1:
-                m_SPEL1.m_value = data.to_ullong();
-                break;
-            case 2:
-                m_SPEL2.m_value = data.to_ullong();
-                break;
-            case 3:
-                m_SPEL3.m_value = data.to_ullong();
-                break;
-            default:
-                assert(false && "Unreachable code path!");
-                std::terminate();
-        }
-    }
-
-    [[nodiscard]] auto W(const Bitset& loc) noexcept {
-        auto mLoc = loc.ToULong();
-        PreConditions(mLoc);
+    // 64-bit aliases
+    [[nodiscard]] std::uint64_t X(std::uint32_t loc) const {
+        PreConditions(loc);
 
-        auto returnValue = m_registers[mLoc].to_ullong() & 0x00000000FFFFFFFF;
-        return std::bitset< 32 >(static_cast< std::uint32_t >(returnValue));
+        return m_file.m_X[loc];
     }
 
-    [[nodiscard]] auto read(const Bitset& loc) const noexcept {
-        auto mLoc = loc.ToULong();
-        PreConditions(mLoc);
+    // 32-bit aliases
+    [[nodiscard]] auto WSP() noexcept { // Width 32
+        return SP() & 0x00000000FFFFFFFF;
+    }
 
-        return m_registers[mLoc];
+    void WSP(std::uint32_t data) noexcept { // Width 32
+        SP() = data;
     }
 
-    [[nodiscard]] auto read(const std::uint8_t loc) const noexcept {
+    [[nodiscard]] std::uint32_t W(std::uint32_t loc) const noexcept {
         PreConditions(loc);
 
-        return m_registers[loc];
+        return static_cast< std::uint32_t >(m_file.m_X[loc]);
     }
 
-    auto write(std::uint8_t loc, const std::uint64_t data) noexcept {
+    [[nodiscard]] auto read(std::uint32_t loc) const noexcept {
         PreConditions(loc);
 
-        m_registers[loc] = data;
+        return m_file.m_X[loc];
     }
-    auto write(const Bitset& loc, const std::uint64_t data) noexcept {
-        auto mLoc = loc.ToULong();
-        PreConditions(mLoc);
 
-        m_registers[mLoc] = data;
-    }
-    auto write(const Bitset& loc, std::bitset< 64 > data) noexcept {
-        auto mLoc = loc.ToULong();
-        PreConditions(mLoc);
+    auto write(std::uint32_t loc, const std::uint64_t data) noexcept {
+        PreConditions(loc);
 
-        m_registers[mLoc] = std::move(data);
+        m_file.m_X[loc] = data;
     }
-    auto write(const Bitset& loc, const std::uint32_t data) noexcept {
-        auto mLoc = loc.ToULong();
-        PreConditions(mLoc);
+    auto write(std::uint32_t loc, const std::uint32_t data) noexcept {
+        PreConditions(loc);
 
-        m_registers[mLoc] = static_cast< std::uint64_t >(data);
+        m_file.m_X[loc] = static_cast< std::uint64_t >(data);
     }
-    auto write(const Bitset& loc, const std::bitset< 32 >& data) noexcept {
-        auto mLoc = loc.ToULong();
-        PreConditions(mLoc);
 
-        m_registers[mLoc] = data.to_ullong();
+    auto ReadBulk() const noexcept {
+        return m_file.m_X;
     }
-    auto write(const Bitset& loc, const Bitset& data) noexcept {
-        auto mLoc = loc.ToULong();
-        PreConditions(mLoc);
 
-        assert(data.Size() <= 64);
-        m_registers[mLoc] = data.ToULLong();
-    }
-
-    auto ReadBulk() const noexcept {
-        return m_registers;
+    // The whole register file, code translated to the host reads and writes it in place
+    [[nodiscard]] A64RegisterFile& File() noexcept {
+        return m_file;
     }
 
     GPRegisters(const IProcessingUnit::ProcessState& PE) : m_PE(PE) {
@@ -212,30 +191,22 @@ struct [[nodiscard]] GPRegisters {
     GPRegisters& operator=(GPRegisters&&) = delete;
 
   protected:
-    struct SPELRegister {
-        std::bitset< 64 > m_value { 0 };
-        // RegisterStatus    m_status { RegisterStatus::UNKNOWN };
-    };
+    [[nodiscard]] static constexpr std::uint64_t WidthMask(std::uint32_t width) noexcept {
+        return width >= 64 ? ~static_cast< std::uint64_t >(0) : (static_cast< std::uint64_t >(1) << width) - 1;
+    }
 
-    void PreConditions(std::uint8_t loc) const noexcept {
-        assert(loc >= 0 && loc < m_registers.size());
+    [[nodiscard]] static std::uint32_t NZFlags(std::uint64_t result, std::uint32_t width) noexcept {
+        return static_cast< std::uint32_t >((result >> (width - 1)) & 1) << 3 |
+               static_cast< std::uint32_t >((result & WidthMask(width)) == 0) << 2;
+    }
+
+    void PreConditions(std::uint32_t loc) const noexcept {
+        assert(loc >= 0 && loc < m_file.m_X.size());
     }
 
     static constexpr std::size_t Procedural_link_register_index = 30;
     // TODO: register 30's role as a link on procedure calls.
-    // R0 - R30 (31 registers)
-    Arch64Registers m_registers {};
-    // std::bitset< 64 > m_SP { 0 };
-    std::uint64_t m_PC { 0 };
-
-    // C5.2.11 SP_EL0, Stack Pointer (EL0)
-    SPELRegister m_SPEL0;
-    // C5.2.12 SP_EL1, Stack Pointer (EL1)
-    SPELRegister m_SPEL1;
-    // C5.2.13 SP_EL2, Stack Pointer (EL2)
-    SPELRegister m_SPEL2;
-    // C5.2.14 SP_EL3, Stack Pointer (EL3)
-    SPELRegister m_SPEL3;
+    A64RegisterFile m_file {};
 
     const IProcessingUnit::ProcessState& m_PE;
 };
@@ -6,11 +6,32 @@
     #include <Utility/Bitset.h>
     #include <Utility/Utilities.h>
     #include <array>
+    #include <cstdint>
 
 BEGIN_NAMESPACE
 
 struct SystemRegisters {
-    // TODO: Implement system registers P.3017
+    // TODO: Implement the remaining system registers P.3017
+
+    // Translation table base for the lower virtual address range, BADDR in bits [47:1]
+    std::uint64_t m_TTBR0_EL1 { 0 };
+    // Translation control, T0SZ in bits [5:0] sizes the TTBR0_EL1 region to 2^(64 - T0SZ) bytes
+    std::uint64_t m_TCR_EL1 { 0 };
+    // System control, M in bit [0] enables the stage 1 translation
+    std::uint64_t m_SCTLR_EL1 { 0 };
+
+    [[nodiscard]] bool IsStage1Enabled() const noexcept {
+        return (m_SCTLR_EL1 & 0b1) != 0;
+    }
+
+    /// @brief Byte address of the first level translation table, only 4 KiB granule tables are supported
+    [[nodiscard]] std::uint64_t GetTranslationTableBase() const noexcept {
+        return m_TTBR0_EL1 & 0x0000'FFFF'FFFF'F000;
+    }
+
+    [[nodiscard]] std::uint32_t GetT0SZ() const noexcept {
+        return static_cast< std::uint32_t >(m_TCR_EL1 & 0b11'1111);
+    }
 };
 
 END_NAMESPACE
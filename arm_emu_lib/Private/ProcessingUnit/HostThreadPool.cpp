@@ -0,0 +1,116 @@
+#include <ProcessingUnit/HostThreadPool.h>
+#include <algorithm>
+#include <cassert>
+
+BEGIN_NAMESPACE
+
+namespace {
+    // Pool of the calling thread, nullptr outside of pool threads
+    thread_local HostThreadPool* currentPool = nullptr;
+} // namespace
+
+HostThreadPool::BlockingScope::BlockingScope() : m_pool(currentPool) {
+    if (m_pool) {
+        m_pool->EnterBlocking();
+    }
+}
+
+HostThreadPool::BlockingScope::~BlockingScope() {
+    if (m_pool) {
+        m_pool->LeaveBlocking();
+    }
+}
+
+HostThreadPool::HostThreadPool(std::size_t threadCount) :
+    m_threadCount(threadCount > 0 ? threadCount
+                                  : std::max< std::size_t >(std::thread::hardware_concurrency(), 1)),
+    m_tasks(),
+    m_threads(),
+    m_idleCount(0),
+    m_blockedCount(0),
+    m_isStopping(false),
+    m_mutex(),
+    m_condVar() {
+}
+
+HostThreadPool::~HostThreadPool() {
+    {
+        std::unique_lock lock { m_mutex };
+        m_isStopping = true;
+    }
+    m_condVar.notify_all();
+
+    // Threads still started by blocked tasks are joined as well
+    for (std::size_t threadIdx = 0;; ++threadIdx) {
+        std::thread thread {};
+        {
+            std::unique_lock lock { m_mutex };
+            if (threadIdx == m_threads.size()) {
+                break;
+            }
+            thread = std::move(m_threads[threadIdx]);
+        }
+        thread.join();
+    }
+    assert(m_tasks.empty() && "Host thread pool destroyed with tasks left!");
+}
+
+void HostThreadPool::Submit(Task task) {
+    {
+        std::unique_lock lock { m_mutex };
+        m_tasks.push_back(std::move(task));
+        StartThreadIfNeeded();
+    }
+    m_condVar.notify_one();
+}
+
+std::size_t HostThreadPool::GetThreadCount() const noexcept {
+    return m_threadCount;
+}
+
+std::size_t HostThreadPool::GetStartedThreadCount() const {
+    std::unique_lock lock { m_mutex };
+    return m_threads.size();
+}
+
+void HostThreadPool::RunTasks() {
+    currentPool = this;
+
+    std::unique_lock lock { m_mutex };
+    while (true) {
+        ++m_idleCount;
+        m_condVar.wait(lock, [&]() { return !m_tasks.empty() || m_isStopping; });
+        --m_idleCount;
+
+        // Queued tasks are run before stopping, the processing units waiting on them are already gone
+        if (m_tasks.empty()) {
+            break;
+        }
+        auto task = std::move(m_tasks.front());
+        m_tasks.pop_front();
+
+        lock.unlock();
+        task();
+        lock.lock();
+    }
+}
+
+void HostThreadPool::EnterBlocking() {
+    std::unique_lock lock { m_mutex };
+    ++m_blockedCount;
+    StartThreadIfNeeded();
+}
+
+void HostThreadPool::LeaveBlocking() {
+    std::unique_lock lock { m_mutex };
+    --m_blockedCount;
+}
+
+void HostThreadPool::StartThreadIfNeeded() {
+    const std::size_t runnableCount = m_threads.size() - m_blockedCount;
+    if (m_tasks.size() > m_idleCount && runnableCount < m_threadCount && !m_isStopping) {
+        m_threads.emplace_back([this]() { RunTasks(); });
+    }
+}
+
+END_NAMESPACE
@@ -0,0 +1,75 @@
+#if !defined(HOSTTHREADPOOL_H_INCLUDED_4888307D_A305_4D58_A69C_70596D17D1B2)
+    #define HOSTTHREADPOOL_H_INCLUDED_4888307D_A305_4D58_A69C_70596D17D1B2
+
+    #include <API/Api.h>
+    #include <API/HiddenAPI.h>
+    #include <condition_variable>
+    #include <cstddef>
+    #include <deque>
+    #include <functional>
+    #include <memory_resource>
+    #include <mutex>
+    #include <thread>
+    #include <vector>
+
+BEGIN_NAMESPACE
+
+/// <summary>
+/// Host threads running the processing units of a CPU, so that the number of guest processing units does not set the
+/// number of host threads. Threads are started on demand, up to the size of the pool.
+/// A task blocking its thread (stepping in waits for the host) does not count against the size of the pool, another
+/// thread runs the queued tasks meanwhile.
+/// </summary>
+class [[nodiscard]] HostThreadPool {
+  public:
+    using Task = std::function< void() >;
+
+    /// <summary>
+    /// Marks the calling task as blocked on the host for its lifetime, does nothing outside of a pool thread
+    /// </summary>
+    class [[nodiscard]] BlockingScope {
+      public:
+        BlockingScope();
+        DELETE_COPY_CLASS(BlockingScope)
+        DELETE_MOVE_CLASS(BlockingScope)
+        ~BlockingScope();
+
+      private:
+        HostThreadPool* m_pool;
+    };
+
+    /// @param threadCount Number of tasks run at once, 0 for the hardware concurrency of the host
+    explicit HostThreadPool(std::size_t threadCount = 0);
+    DELETE_COPY_CLASS(HostThreadPool)
+    DELETE_MOVE_CLASS(HostThreadPool)
+    ~HostThreadPool();
+
+    /// @brief Queues task to run on a pool thread, tasks start in submission order
+    void Submit(Task task);
+
+    [[nodiscard]] std::size_t GetThreadCount() const noexcept;
+
+    /// @brief Host threads started so far, more than the thread count only while tasks were blocked
+    [[nodiscard]] std::size_t GetStartedThreadCount() const;
+
+  private:
+    void RunTasks();
+    void EnterBlocking();
+    void LeaveBlocking();
+
+    /// @brief Starts a thread when queued tasks outnumber the idle threads and a runnable thread is missing
+    void StartThreadIfNeeded();
+
+    const std::size_t               m_threadCount;
+    std::pmr::deque< Task >         m_tasks;
+    std::pmr::vector< std::thread > m_threads;
+    std::size_t                     m_idleCount;
+    std::size_t                     m_blockedCount;
+    bool                            m_isStopping;
+    mutable std::mutex              m_mutex;
+    std::condition_variable         m_condVar;
+};
+
+END_NAMESPACE
+
+#endif // !defined(HOSTTHREADPOOL_H_INCLUDED_4888307D_A305_4D58_A69C_70596D17D1B2)
@@ -2,18 +2,23 @@
     #define IPROCESSINGUNIT_H_INCLUDED_23E7732A_6223_466F_8087_945323852C58
 
     #include <API/Api.h>
+    #include <CPU/ExecutionMode.h>
     #include <DebugUtils/Object.h>
     #include <Memory/ICacheMemory.h>
     #include <Memory/IMemory.h>
     #include <ProcessingUnit/IProcessingUnitWatcher.h>
     #include <Program/ControlledResult.h>
     #include <Program/Program.h>
+    #include <Program/ProgramFault.h>
     #include <Program/Result.h>
     #include <cstdint>
+    #include <span>
     #include <vector>
 
 BEGIN_NAMESPACE
 
+class ResultElementPool;
+
 // TODO: add a feature to stop a certain program or unload it (if not run yet)
 class [[nodiscard]] IProcessingUnit : public Object {
   public:
@@ -42,6 +47,7 @@ class [[nodiscard]] IProcessingUnit : public Object {
     enum class WidthOption : std::uint32_t;
 
     using ExecutionState = ArchitectureProfile;
+    using Fault          = ProgramFault;
 
     enum class ProcessStatus
     {
@@ -68,6 +74,10 @@ class [[nodiscard]] IProcessingUnit : public Object {
     [[nodiscard]] virtual IMemory const* GetCurrentProgramMemory() const noexcept                                 = 0;
     [[nodiscard]] virtual ProcessStatus  GetStatus() const noexcept                                               = 0;
     [[nodiscard]] virtual const IProcessingUnitWatcher& GetProcessingUnitWatcher() const noexcept                 = 0;
+    [[nodiscard]] virtual ExecutionMode                 GetExecutionMode() const noexcept                         = 0;
+
+    /// @brief Selects how programs are executed, takes effect from the next program to start
+    virtual void SetExecutionMode(ExecutionMode executionMode) noexcept = 0;
 
     [[nodiscard]] virtual const ProcessState* const GetCurrentProcessState() const noexcept = 0;
 
@@ -75,6 +85,9 @@ class [[nodiscard]] IProcessingUnit : public Object {
     virtual ControlledResult StepIn(Program program) = 0;
     virtual void             Stop()                  = 0;
     virtual void             Reset() noexcept        = 0;
+
+    /// @brief Queues all programs at once, they are moved from, results are in the order of the programs
+    virtual std::pmr::vector< Result > RunBatch(std::span< Program > programs, ResultElementPool& resultPool) = 0;
 };
 
 END_NAMESPACE
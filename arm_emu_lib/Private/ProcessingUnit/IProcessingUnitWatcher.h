@@ -23,10 +23,17 @@ struct [[nodiscard]] IProcessingUnitWatcher {
     virtual void RecordInstructionHandled(InstructionType type) noexcept = 0;
     virtual void RecordProcessHandled() noexcept                         = 0;
     virtual void RecordProcessInterrupted() noexcept                     = 0;
+    virtual void RecordProgramQueued() noexcept                          = 0;
+    virtual void RecordProgramsQueued(std::size_t count) noexcept        = 0;
+    virtual void RecordProgramDequeued() noexcept                        = 0;
 
     [[nodiscard]] virtual std::size_t GetInstructionCountFor(InstructionType type) const noexcept = 0;
     [[nodiscard]] virtual std::size_t GetProcessCount() const noexcept                            = 0;
     [[nodiscard]] virtual std::size_t GetInterruptCount() const noexcept                          = 0;
+
+    /// @brief Programs queued on the processing unit, including the running one
+    /// @note Safe to read from any thread, load balancers place programs by it
+    [[nodiscard]] virtual std::size_t GetQueueDepth() const noexcept = 0;
 };
 
 END_NAMESPACE
@@ -1,7 +1,7 @@
 void TakeException(std::bitset< 2 > target_el, IProcessingUnit::ExceptionRecord exception,
                    std::uint64_t preferred_exception_return, std::uint32_t vect_offset) {
     if (HaveEL(target_el) && (target_el.to_ulong() > EL.to_ulong())) {
-        throw undefined_behaviour {};
+        return RaiseFault(Fault::UndefinedBehaviour);
     }
 
     // Take Exception ...
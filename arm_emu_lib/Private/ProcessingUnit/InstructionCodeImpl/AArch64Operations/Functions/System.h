@@ -34,7 +34,7 @@ void AArch64CheckSystemAccess(std::uint8_t op0, std::uint8_t op1, std::uint8_t c
             break;
         case 5:
             if (!HaveVirtHostExt())
-                throw undefined_behaviour {};
+                return RaiseFault(Fault::UndefinedBehaviour);
             min_EL = IProcessingUnit::ExceptionLevel::EL2;
             break;
         case 6:
@@ -45,13 +45,13 @@ void AArch64CheckSystemAccess(std::uint8_t op0, std::uint8_t op1, std::uint8_t c
             need_secure = true;
             break;
         default:
-            throw undefined_instruction {};
+            return RaiseFault(Fault::UndefinedInstruction);
     }
 
     if (EL.to_ulong() < static_cast< std::underlying_type_t< IProcessingUnit::ExceptionLevel > >(min_EL)) {
-        throw undefined_behaviour {};
+        return RaiseFault(Fault::UndefinedBehaviour);
     } else if (need_secure && !IsSecure()) {
-        throw undefined_behaviour {};
+        return RaiseFault(Fault::UndefinedBehaviour);
     }
 }
 
@@ -67,9 +67,28 @@ void AArch64CheckSystemAccess(std::uint8_t op0, std::uint8_t op1, std::uint8_t c
 /// <param name="val"></param>
 /// <returns></returns>
 void SysInstr(std::uint8_t op0, std::uint8_t op1, std::uint8_t crn, std::uint8_t crm, std::uint8_t op2,
-              std::bitset< 64 > val) {
-    throw not_implemented_feature {};
-    return;
+              std::uint64_t val) {
+    return RaiseFault(Fault::NotImplementedFeature);
+}
+
+/// <summary>
+/// Return the implemented system register encoded by op0, op1, CRn, CRm and op2, nullptr otherwise.
+/// </summary>
+[[nodiscard]] std::uint64_t* SysRegLookup(std::uint8_t op0, std::uint8_t op1, std::uint8_t crn, std::uint8_t crm,
+                                          std::uint8_t op2) noexcept {
+    if (op0 != 3 || op1 != 0 || crm != 0) {
+        return nullptr;
+    }
+    if (crn == 1 && op2 == 0) {
+        return std::addressof(m_sysRegisters.m_SCTLR_EL1);
+    }
+    if (crn == 2 && op2 == 0) {
+        return std::addressof(m_sysRegisters.m_TTBR0_EL1);
+    }
+    if (crn == 2 && op2 == 2) {
+        return std::addressof(m_sysRegisters.m_TCR_EL1);
+    }
+    return nullptr;
 }
 
 /// <summary>
@@ -82,9 +101,13 @@ void SysInstr(std::uint8_t op0, std::uint8_t op1, std::uint8_t crn, std::uint8_t
 /// <param name="crm"></param>
 /// <param name="op2"></param>
 /// <returns></returns>
-std::bitset< 64 > SysRegRead(std::uint8_t op0, std::uint8_t op1, std::uint8_t crn, std::uint8_t crm, std::uint8_t op2) {
-    throw not_implemented_feature {};
-    return std::bitset< 64 > {};
+std::uint64_t SysRegRead(std::uint8_t op0, std::uint8_t op1, std::uint8_t crn, std::uint8_t crm, std::uint8_t op2) {
+    auto* sysRegister = SysRegLookup(op0, op1, crn, crm, op2);
+    if (sysRegister == nullptr) {
+        RaiseFault(Fault::NotImplementedFeature);
+        return 0;
+    }
+    return *sysRegister;
 }
 
 /// <summary>
@@ -99,7 +122,13 @@ std::bitset< 64 > SysRegRead(std::uint8_t op0, std::uint8_t op1, std::uint8_t cr
 /// <param name="val"></param>
 /// <returns></returns>
 void SysRegWrite(std::uint8_t op0, std::uint8_t op1, std::uint8_t crn, std::uint8_t crm, std::uint8_t op2,
-                 std::bitset< 64 > val) {
-    throw not_implemented_feature {};
-    return;
+                 std::uint64_t val) {
+    auto* sysRegister = SysRegLookup(op0, op1, crn, crm, op2);
+    if (sysRegister == nullptr) {
+        return RaiseFault(Fault::NotImplementedFeature);
+    }
+    *sysRegister = val;
+
+    // Every implemented system register takes part in the translation regime
+    m_mmu.FlushTlb();
 }
@@ -8,9 +8,9 @@
 /// <param name="shift"></param>
 /// <returns></returns>
 template < std::size_t N >
-[[nodiscard]] std::bitset< N > ExtendReg(const Bitset& reg, IProcessingUnit::ExtendType extType, std::uint8_t shift) {
+[[nodiscard]] std::uint64_t ExtendReg(std::uint32_t reg, IProcessingUnit::ExtendType extType, std::uint8_t shift) {
     assert(shift >= 0 && shift <= 4);
-    std::bitset< N > val;
+    std::uint64_t val = 0;
     if constexpr (N == 32) {
         val = m_gpRegisters.W(reg);
     } else if constexpr (N == 64) {
@@ -62,10 +62,8 @@ template < std::size_t N >
 
     len = std::min(len, static_cast< std::uint8_t >(N - shift));
 
-    std::bitset< N > mVal    = static_cast< std::size_t >(std::pow(2, len) - 1);
-    auto             new_val = mVal & val;
-    new_val <<= shift;
-    return Extend< N, N >(new_val, unsigned_);
+    const auto new_val = ((val & Ones(len)) << shift) & Ones(N);
+    return Extend< N >(new_val, N, unsigned_);
 }
 
 /// <summary>
@@ -74,6 +72,7 @@ template < std::size_t N >
 /// <typeparam name="Ty"></typeparam>
 /// <param name="option"></param>
 /// <returns></returns>
-[[nodiscard]] IProcessingUnit::ExtendType DecodeRegExtend(const std::bitset< 3 >& option) noexcept {
-    return static_cast< IProcessingUnit::ExtendType >(option.to_ulong());
+[[nodiscard]] IProcessingUnit::ExtendType DecodeRegExtend(std::uint32_t option) noexcept {
+    assert(option < (1 << 3));
+    return static_cast< IProcessingUnit::ExtendType >(option);
 }
@@ -8,20 +8,20 @@
 /// <param name="immediate"></param>
 /// <returns></returns>
 template < std::size_t M >
-[[nodiscard]] std::pair< std::bitset< M >, std::bitset< M > > DecodeBitMasks(bool immN, const Bitset& imms,
-                                                                             const Bitset& immr, bool immediate) {
-    assert(imms.Size() == 6 && immr.Size() == 6);
+[[nodiscard]] std::pair< std::uint64_t, std::uint64_t > DecodeBitMasks(bool immN, std::uint32_t imms,
+                                                                       std::uint32_t immr, bool immediate) {
+    assert(imms < (1 << 6) && immr < (1 << 6));
 
-    std::bitset< M > tmask, wmask;
-    Bitset           levels { 6, 0 };
+    std::uint64_t tmask = 0, wmask = 0;
+    std::uint32_t levels = 0;
 
     // Compute log2 of element size
     // 2^len must be in range [2, M]
-    auto NOTimms = imms;
-    NOTimms.Flip();
-    const auto len = HighestSetBit(concate< 1, 6 >(immN, NOTimms.ToULong()));
+    const auto NOTimms = ~imms & 0b111111;
+    const auto len     = HighestSetBit(static_cast< std::uint64_t >(immN) << 6 | NOTimms);
     if (len < 1) {
-        throw undefined_behaviour {};
+        RaiseFault(Fault::UndefinedBehaviour);
+        return {};
     }
     assert(M >= (1 << std::bit_cast< std::uint64_t >(len)));
 
@@ -35,11 +35,12 @@ template < std::size_t M >
     // For logical immediates an all-ones value of S is reserved
     // since it would generate a useless all-ones result (many times)
     if (immediate && ((imms & levels) == levels)) {
-        throw undefined_behaviour {};
+        RaiseFault(Fault::UndefinedBehaviour);
+        return {};
     }
 
-    auto S    = static_cast< std::uint32_t >((imms & levels).ToULong());
-    auto R    = static_cast< std::uint32_t >((immr & levels).ToULong());
+    auto S    = imms & levels;
+    auto R    = immr & levels;
     auto diff = S - R; // 6-bit subtract with borrow
 
     auto esize = (static_cast< std::int64_t >(1) << len);
@@ -65,19 +66,17 @@ template < std::size_t M >
     return std::make_pair(wmask, tmask);
 }
 
-[[nodiscard]] IProcessingUnit::ShiftType DecodeShift(const Bitset& op) {
-    assert(op.Size() == 2);
-
-    std::uint8_t op_ = static_cast< std::uint8_t >(op.ToULong());
-    switch (op_) {
+[[nodiscard]] IProcessingUnit::ShiftType DecodeShift(std::uint32_t op) noexcept {
+    switch (op) {
         case 0b00:
         case 0b01:
         case 0b10:
         case 0b11:
-            return static_cast< IProcessingUnit::ShiftType >(op_);
+            return static_cast< IProcessingUnit::ShiftType >(op);
             break;
         default:
-            throw undefined_behaviour {};
+            RaiseFault(Fault::UndefinedBehaviour);
+            return IProcessingUnit::ShiftType::LSL;
     }
 }
 
@@ -90,8 +89,8 @@ template < std::size_t M >
 /// <param name="amount"></param>
 /// <returns></returns>
 template < std::size_t N >
-[[nodiscard]] std::bitset< N > ShiftReg(const Bitset& reg, IProcessingUnit::ShiftType shifttype, std::uint8_t amount) {
-    std::bitset< N > result = m_gpRegisters.X(reg).to_ullong();
+[[nodiscard]] std::uint64_t ShiftReg(std::uint32_t reg, IProcessingUnit::ShiftType shifttype, std::uint8_t amount) {
+    std::uint64_t result = m_gpRegisters.X(reg) & Ones(N);
 
     switch (shifttype) {
         case IProcessingUnit::ShiftType::LSL:
@@ -107,9 +106,5 @@ template < std::size_t N >
             result = ROR< N >(result, amount);
             break;
     }
-    if constexpr (N == 64) {
-        return result;
-    } else {
-        return std::bitset< N > { result.to_ullong() };
-    }
+    return result;
 }
@@ -1,205 +1,159 @@
+/// <summary>
+/// Returns a mask with the low n bits set
+/// </summary>
+[[nodiscard]] static constexpr std::uint64_t Ones(std::size_t n) noexcept {
+    return n >= 64 ? std::numeric_limits< std::uint64_t >::max() : (static_cast< std::uint64_t >(1) << n) - 1;
+}
 
-template < std::size_t N, std::size_t M >
-[[nodiscard]] std::bitset< N * M > Replicate(std::bitset< M > x) const {
-    static_assert(N % M == 0);
-    std::bitset< N * M > return_value;
-    std::bitset< N * M > value(0);
-    if (N * M > 0) {
-        value = x.to_ullong();
-    }
-    if (N / M > 0) {
-        for (std::size_t n = 0; n < static_cast< std::size_t >(N / M); n++) {
-            return_value |= value;
-            value <<= M;
-        }
-    }
-    return return_value;
+/// <summary>
+/// Bitwise NOT of the low N bits, the bits above them stay clear
+/// </summary>
+template < std::size_t N >
+[[nodiscard]] static constexpr std::uint64_t NOT(std::uint64_t x) noexcept {
+    static_assert(N > 0 && N <= 64);
+    return ~x & Ones(N);
 }
 
-[[nodiscard]] std::uint64_t Replicate(std::uint64_t x, std::size_t currentSize, std::size_t targetSize) const {
-    if (targetSize % currentSize != 0) {
-        throw undefined_behaviour {};
+[[nodiscard]] std::uint64_t Replicate(std::uint64_t x, std::size_t currentSize, std::size_t targetSize) noexcept {
+    if (currentSize == 0 || targetSize % currentSize != 0) {
+        RaiseFault(Fault::UndefinedBehaviour);
+        return 0;
     }
-    std::uint64_t return_value = 0;
-    std::uint64_t value        = 0;
-    if (targetSize * currentSize > 0) {
-        value        = x;
-        return_value = x;
-    }
-    for (std::size_t n = 1; n < static_cast< std::size_t >(targetSize / currentSize); n++) {
-        value <<= currentSize;
-        return_value |= value;
+    std::uint64_t return_value = x;
+    for (std::size_t n = currentSize; n < targetSize; n += currentSize) {
+        return_value |= x << n;
     }
     return return_value;
 }
 
-template < std::size_t N, std::size_t M >
-[[nodiscard]] std::bitset< N > SignExtend(std::bitset< M > x) const {
-    static_assert(N >= M);
-    auto             val          = Replicate< N - M >(std::bitset< 1 > { x[M - 1] });
-    std::bitset< N > return_value = concate< N - M, M >(val, x);
-    return return_value;
+template < std::size_t N >
+[[nodiscard]] static constexpr std::uint64_t SignExtend(std::uint64_t x, std::size_t currentSize) noexcept {
+    static_assert(N <= 64);
+    assert(currentSize > 0 && currentSize <= N);
+    const auto shift = 64 - currentSize;
+    return static_cast< std::uint64_t >(static_cast< std::int64_t >(x << shift) >> shift) & Ones(N);
 }
 
-template < std::size_t N, std::size_t M >
-[[nodiscard]] std::bitset< N > ZeroExtend(std::bitset< M > x) const {
-    static_assert(N >= M);
-    return std::bitset< N >(x.to_ullong());
+template < std::size_t N >
+[[nodiscard]] static constexpr std::uint64_t ZeroExtend(std::uint64_t x, std::size_t currentSize) noexcept {
+    static_assert(N <= 64);
+    assert(currentSize <= N);
+    return x & Ones(currentSize);
 }
 
-template < std::size_t N, std::size_t M >
-[[nodiscard]] std::bitset< N > Extend(std::bitset< M > x, bool unsigned_) const {
+template < std::size_t N >
+[[nodiscard]] static constexpr std::uint64_t Extend(std::uint64_t x, std::size_t currentSize, bool unsigned_) noexcept {
     if (unsigned_)
-        return ZeroExtend< N, M >(x);
+        return ZeroExtend< N >(x, currentSize);
     else
-        return SignExtend< N, M >(x);
-}
-
-template < std::size_t N >
-[[nodiscard]] std::int64_t HighestSetBit(std::bitset< N > x) const noexcept {
-    for (std::int64_t i = N - 1; i > -1; i--) {
-        if (x[i] == true) {
-            return i;
-        }
-    }
-    return -1;
+        return SignExtend< N >(x, currentSize);
 }
 
-[[nodiscard]] std::int64_t HighestSetBit(std::uint64_t x) const {
-    for (std::int64_t i = 63; i > -1; i--) {
-        if (static_cast< bool >(x & (static_cast< std::uint64_t >(1) << i)) == true)
-            return i;
+[[nodiscard]] std::int64_t HighestSetBit(std::uint64_t x) noexcept {
+    if (x == 0) {
+        RaiseFault(Fault::UndefinedBehaviour);
+        return -1;
     }
-    throw undefined_behaviour {};
+    return static_cast< std::int64_t >(std::bit_width(x)) - 1;
 }
 
 template < std::size_t N >
-[[nodiscard]] std::pair< std::bitset< N >, bool > LSL_C(std::bitset< N > x, std::uint8_t shift) const {
-    if (shift < 0) {
-        throw undefined_behaviour {};
-    }
-    std::bitset< N + 1 > extended_x { x.to_ullong() };
-    extended_x <<= shift;
-    std::bitset< N > result { extended_x.to_ullong() };
-    auto             carry_out = extended_x[N];
+[[nodiscard]] std::pair< std::uint64_t, bool > LSL_C(std::uint64_t x, std::uint8_t shift) const noexcept {
+    static_assert(N > 0 && N <= 64);
+    const auto result    = shift < N ? (x << shift) & Ones(N) : 0;
+    const auto carry_out = shift > 0 && shift <= N && ((x >> (N - shift)) & 1);
     return std::make_pair(result, carry_out);
 }
 
 template < std::size_t N >
-[[nodiscard]] std::bitset< N > LSL(std::bitset< N > x, std::uint8_t shift) const {
-    if (shift < 0) {
-        throw undefined_behaviour {};
-    }
-    if (shift == 0) {
-        return x;
-    } else {
-        auto [result, _] = LSL_C< N >(x, shift);
-        return result;
-    }
+[[nodiscard]] std::uint64_t LSL(std::uint64_t x, std::uint8_t shift) const noexcept {
+    return LSL_C< N >(x, shift).first;
 }
 
 template < std::size_t N >
-[[nodiscard]] std::pair< std::bitset< N >, bool > LSR_C(std::bitset< N > x, std::uint8_t shift) const {
-    if (shift < 0) {
-        throw undefined_behaviour {};
-    }
-
-    Bitset extended_x { N + shift, x.to_ullong() };
-
-    auto carry_out = extended_x[shift - 1];
-    extended_x >>= shift;
-    std::bitset< N > result { extended_x.ToULLong() };
+[[nodiscard]] std::pair< std::uint64_t, bool > LSR_C(std::uint64_t x, std::uint8_t shift) const noexcept {
+    static_assert(N > 0 && N <= 64);
+    x &= Ones(N);
+    const auto result    = shift < N ? x >> shift : 0;
+    const auto carry_out = shift > 0 && shift <= N && ((x >> (shift - 1)) & 1);
     return std::make_pair(result, carry_out);
 }
 
 template < std::size_t N >
-[[nodiscard]] std::bitset< N > LSR(std::bitset< N > x, std::uint8_t shift) const {
-    if (shift < 0) {
-        throw undefined_behaviour {};
-    }
-    if (shift == 0) {
-        return x;
-    } else {
-        auto [result, _] = LSR_C< N >(x, shift);
-        return result;
-    }
+[[nodiscard]] std::uint64_t LSR(std::uint64_t x, std::uint8_t shift) const noexcept {
+    return LSR_C< N >(x, shift).first;
 }
 
 template < std::size_t N >
-[[nodiscard]] std::pair< std::bitset< N >, bool > ASR_C(std::bitset< N > x, std::uint8_t shift) const {
-    if (shift < 0) {
-        throw undefined_behaviour {};
-    }
-
-    Bitset extended_x { N + shift, x.to_ullong() };
-    auto   carry_out = extended_x[shift - 1];
-    extended_x >>= shift;
-    std::bitset< N > result { extended_x.ToULLong() };
+[[nodiscard]] std::pair< std::uint64_t, bool > ASR_C(std::uint64_t x, std::uint8_t shift) const noexcept {
+    static_assert(N > 0 && N <= 64);
+    // Shifting by N or more replicates the sign bit, as does shifting the sign extended value by N - 1
+    const auto signed_x  = static_cast< std::int64_t >(SignExtend< 64 >(x & Ones(N), N));
+    const auto result    = static_cast< std::uint64_t >(signed_x >> std::min< std::size_t >(shift, N - 1)) & Ones(N);
+    const auto carry_out = shift > 0 && ((signed_x >> std::min< std::size_t >(shift - 1, N - 1)) & 1);
     return std::make_pair(result, carry_out);
 }
 
 template < std::size_t N >
-[[nodiscard]] std::bitset< N > ASR(std::bitset< N > x, std::uint8_t shift) const {
-    if (shift < 0) {
-        throw undefined_behaviour {};
-    }
-    if (shift == 0) {
-        return x;
-    } else {
-        auto [result, _] = ASR_C< N >(x, shift);
-        return result;
-    }
+[[nodiscard]] std::uint64_t ASR(std::uint64_t x, std::uint8_t shift) const noexcept {
+    return ASR_C< N >(x, shift).first;
 }
 
 template < std::size_t N >
-[[nodiscard]] std::pair< std::bitset< N >, bool > ROR_C(std::bitset< N > x, std::uint8_t shift) const {
-    if (shift < 0) {
-        throw undefined_behaviour {};
-    }
-
-    auto m      = static_cast< std::uint8_t >(shift % N);
-    auto result = LSR< N >(x, m);
-    result |= LSL< N >(x, N - m);
-
-    auto carry_out = result[N - 1];
+[[nodiscard]] std::pair< std::uint64_t, bool > ROR_C(std::uint64_t x, std::uint8_t shift) const noexcept {
+    static_assert(N > 0 && N <= 64);
+    x &= Ones(N);
+    const auto m         = static_cast< std::size_t >(shift % N);
+    const auto result    = m == 0 ? x : ((x >> m) | (x << (N - m))) & Ones(N);
+    const auto carry_out = static_cast< bool >((result >> (N - 1)) & 1);
     return std::make_pair(result, carry_out);
 }
 
 template < std::size_t N >
-[[nodiscard]] std::bitset< N > ROR(std::bitset< N > x, std::uint8_t shift) const {
-    if (shift < 0) {
-        throw undefined_behaviour {};
+[[nodiscard]] std::uint64_t ROR(std::uint64_t x, std::uint8_t shift) const noexcept {
+    return ROR_C< N >(x, shift).first;
+}
+
+[[nodiscard]] std::uint64_t ROR(std::uint64_t x, std::uint64_t currentSize, std::uint8_t shift) noexcept {
+    if (currentSize == 0 || currentSize > 64) {
+        RaiseFault(Fault::UndefinedBehaviour);
+        return 0;
     }
-    if (shift == 0) {
+    x &= Ones(currentSize);
+    const auto m = shift % currentSize;
+    if (m == 0) {
         return x;
-    } else {
-        auto [result, _] = ROR_C< N >(x, shift);
-        return result;
     }
+    return ((x >> m) | (x << (currentSize - m))) & Ones(currentSize);
 }
 
-[[nodiscard]] std::uint64_t ROR(std::uint64_t x, std::uint64_t currentSize, std::uint8_t shift) const {
-    if (shift < 0) {
-        throw undefined_behaviour {};
+/// <summary>
+/// Reverses the order of the low N bits
+/// </summary>
+template < std::size_t N >
+[[nodiscard]] static constexpr std::uint64_t BitReverse(std::uint64_t x) noexcept {
+    static_assert(N > 0 && N <= 64);
+    std::uint64_t result = 0;
+    for (std::size_t i = 0; i < N; ++i) {
+        result |= ((x >> i) & 1) << (N - 1 - i);
     }
-    if (shift == 0) {
-        return x;
-    } else {
-        auto m   = static_cast< std::uint8_t >(shift % currentSize);
-        auto LSR = x;
-        LSR >>= m;
-        auto result = LSR;
-        auto LSL    = x;
-        LSL <<= currentSize - m;
-        result |= LSL;
-
-        std::uint64_t return_value = 0;
-        for (std::uint64_t i = 0; i < currentSize; i++) {
-            return_value |= ((static_cast< std::uint64_t >(1) << i) & result);
-        }
+    return result;
+}
 
-        return return_value;
+/// <summary>
+/// Reverses the order of the bytes in each containerSize bits container of the low N bits
+/// </summary>
+template < std::size_t N >
+[[nodiscard]] static constexpr std::uint64_t ReverseBytes(std::uint64_t x, std::size_t containerSize) noexcept {
+    static_assert(N % 8 == 0 && N <= 64);
+    assert(containerSize % 8 == 0 && containerSize > 0 && containerSize <= N);
+    std::uint64_t result = 0;
+    for (std::size_t container = 0; container < N; container += containerSize) {
+        for (std::size_t byte = 0; byte < containerSize; byte += 8) {
+            result |= ((x >> (container + byte)) & 0xFF) << (container + containerSize - 8 - byte);
+        }
     }
+    return result;
 }
 
 template < typename Type >
@@ -1,21 +1,30 @@
 // AddWithCarry()
-// Integer addition with carry input, returning result and NZCV flags
+// Integer addition with carry input, returning result and NZCV flags (N, Z, C and V in bits [3:0])
 template < std::size_t N >
-[[nodiscard]] std::pair< std::bitset< N >, std::bitset< 4 > > AddWithCarry(std::bitset< N > x, std::bitset< N > y,
-                                                                           bool carry_in) {
-    using T  = std::uint64_t;
-    using ST = std::make_signed_t< T >;
+[[nodiscard]] std::pair< std::uint64_t, std::uint32_t > AddWithCarry(std::uint64_t x, std::uint64_t y,
+                                                                      bool carry_in) const noexcept {
+    static_assert(N > 0 && N <= 64);
+    x &= Ones(N);
+    y &= Ones(N);
 
-    T  unsigned_sum = static_cast< T >(x.to_ullong()) + static_cast< T >(y.to_ullong()) + static_cast< T >(carry_in);
-    ST signed_sum   = static_cast< ST >(x.to_ullong()) + static_cast< ST >(y.to_ullong()) + static_cast< T >(carry_in);
-    std::bitset< N > result = unsigned_sum;
+    bool          carry_out = false;
+    std::uint64_t result    = 0;
+    if constexpr (N == 64) {
+        // The sum can wrap on either addition, which is exactly a carry out of bit 63
+        const std::uint64_t partial_sum = x + y;
+        result                          = partial_sum + static_cast< std::uint64_t >(carry_in);
+        carry_out                       = partial_sum < x || result < partial_sum;
+    } else {
+        const std::uint64_t unsigned_sum = x + y + static_cast< std::uint64_t >(carry_in);
+        result                           = unsigned_sum & Ones(N);
+        carry_out                        = (unsigned_sum >> N) & 1;
+    }
+    const bool overflow = (((x ^ result) & (y ^ result)) >> (N - 1)) & 1;
 
-    std::bitset< 4 > nzcv { 0000 };
-    nzcv |= static_cast< std::uint8_t >(result[N - 1] & true) << 3;
-    // static_cast< std::uint8_t >((result.to_ullong() >> (N - 1)) & 1) << 3;
-    nzcv |= result.none() ? 1 << 2 : 0;
-    auto result_as_ull = result.to_ullong();
-    nzcv |= static_cast< T >(result_as_ull) == unsigned_sum ? 0 : 1 << 1;
-    nzcv |= static_cast< ST >(result_as_ull) == signed_sum ? 0 : 1 << 0;
+    std::uint32_t nzcv = 0;
+    nzcv |= static_cast< std::uint32_t >((result >> (N - 1)) & 1) << 3;
+    nzcv |= static_cast< std::uint32_t >(result == 0) << 2;
+    nzcv |= static_cast< std::uint32_t >(carry_out) << 1;
+    nzcv |= static_cast< std::uint32_t >(overflow);
     return std::make_pair(result, nzcv);
 }
@@ -5,7 +5,7 @@
 /// <param name="IsInstr"></param>
 /// <param name="el"></param>
 /// <returns></returns>
-[[nodiscard]] auto EffectiveTBI(std::bitset< 64 > address, bool IsInstr) noexcept {
+[[nodiscard]] auto EffectiveTBI(std::uint64_t address, bool IsInstr) noexcept {
     // TODO
     (void)IsInstr;
     (void)address;
@@ -42,7 +42,7 @@
 /// <param name="IsInstr"></param>
 /// <param name="el"></param>
 /// <returns></returns>
-[[nodiscard]] int AddrTop(const std::bitset< 64 >& address, bool IsInstr) noexcept {
+[[nodiscard]] int AddrTop(std::uint64_t address, bool IsInstr) noexcept {
     // TODO
     /*auto regime = S1TranslationRegime(el);*/
     /*if ELUsingAArch32(regime) then
@@ -30,7 +30,7 @@ void BranchTo(const std::uint64_t& target, IProcessingUnit::BranchType branchTyp
         assert N == 64 && !UsingAArch32();*/
     // Always using AArch64 now
     if (branchType != IProcessingUnit::BranchType::Ret)
-        PC() = BranchAddr(target).to_ullong();
+        PC() = BranchAddr(target);
     return;
 }
 
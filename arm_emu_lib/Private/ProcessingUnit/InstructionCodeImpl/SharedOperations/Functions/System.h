@@ -5,8 +5,8 @@
 /// <param name="cond"></param>
 /// <param name="nzcv"></param>
 /// <returns>bool</returns>
-[[nodiscard]] bool ConditionHolds(const Bitset& cond, const std::bitset< 4 >& nzcv) noexcept {
-    assert(cond.Size() == 4);
+[[nodiscard]] bool ConditionHolds(std::uint32_t cond, std::uint32_t nzcv) noexcept {
+    assert(cond < 16);
 
     constexpr size_t N = 3;
     constexpr size_t Z = 2;
@@ -15,28 +15,34 @@
 
     bool result = false;
 
-    std::string cond_s = cond.ToString();
-    std::string mCond  = cond_s.substr(0, 3);
-    auto        mCond0 = cond_s[3];
-    if (mCond == "000") {
-        result = (nzcv[Z] == true);
-    } else if (mCond == "001") {
-        result = (nzcv[C] == true);
-    } else if (mCond == "010") {
-        result = (nzcv[N] == true);
-    } else if (mCond == "011") {
-        result = (nzcv[V] == true);
-    } else if (mCond == "100") {
-        result = (nzcv[C] == true && nzcv[Z] == false);
-    } else if (mCond == "101") {
-        result = (nzcv[N] == nzcv[V]);
-    } else if (mCond == "110") {
-        result = (nzcv[N] == nzcv[V] && nzcv[Z] == false);
-    } else if (mCond == "111") {
-        result = (nzcv[Z] == true);
+    switch (cond >> 1) {
+        case 0b000:
+            result = (((nzcv >> Z) & 1) == 1);
+            break;
+        case 0b001:
+            result = (((nzcv >> C) & 1) == 1);
+            break;
+        case 0b010:
+            result = (((nzcv >> N) & 1) == 1);
+            break;
+        case 0b011:
+            result = (((nzcv >> V) & 1) == 1);
+            break;
+        case 0b100:
+            result = (((nzcv >> C) & 1) == 1 && ((nzcv >> Z) & 1) == 0);
+            break;
+        case 0b101:
+            result = (((nzcv >> N) & 1) == ((nzcv >> V) & 1));
+            break;
+        case 0b110:
+            result = (((nzcv >> N) & 1) == ((nzcv >> V) & 1) && ((nzcv >> Z) & 1) == 0);
+            break;
+        case 0b111:
+            result = true;
+            break;
     }
 
-    if (mCond0 == '1' && cond.ToULong() != 15) {
+    if ((cond & 0b1) == 0b1 && cond != 15) {
         return !result;
     }
     return result;
@@ -76,7 +82,8 @@
     if (HaveEL(static_cast< std::underlying_type_t< IProcessingUnit::ExceptionLevel > >(
             IProcessingUnit::ExceptionLevel::EL3))) {
         // return SCR_GEN[].NS == '0';
-        throw not_implemented_feature {};
+        RaiseFault(Fault::NotImplementedFeature);
+        return false;
     } else if (HaveEL(static_cast< std::underlying_type_t< IProcessingUnit::ExceptionLevel > >(
                    IProcessingUnit::ExceptionLevel::EL2)) &&
                !HaveSecureEL2Ext()) {
@@ -0,0 +1,91 @@
+#include <ProcessingUnit/ProgramQueue.h>
+#include <algorithm>
+#include <bit>
+#include <cassert>
+
+BEGIN_NAMESPACE
+
+ProgramQueue::ProgramQueue() : m_front(0), m_back(0), m_ring(nullptr), m_rings(), m_pushMutex() {
+    m_rings.push_back(allocate_unique< Ring >(std::pmr::polymorphic_allocator< Ring > {}, Initial_capacity));
+    m_ring.store(m_rings.back().get(), std::memory_order_relaxed);
+}
+
+ProgramQueue::~ProgramQueue() {
+    std::pmr::polymorphic_allocator< QueuedProgram > alloc {};
+
+    auto*      ring = m_ring.load(std::memory_order_relaxed);
+    const auto back = m_back.load(std::memory_order_relaxed);
+    for (auto index = m_front.load(std::memory_order_relaxed); index < back; ++index) {
+        alloc.delete_object(ring->At(index).load(std::memory_order_relaxed));
+    }
+}
+
+void ProgramQueue::Push(QueuedProgram program) {
+    PushBatch(std::span< QueuedProgram > { &program, 1 });
+}
+
+void ProgramQueue::PushBatch(std::span< QueuedProgram > programs) {
+    std::pmr::polymorphic_allocator< QueuedProgram > alloc {};
+    std::pmr::vector< QueuedProgram* >               nodes {};
+    nodes.reserve(programs.size());
+    for (auto& program : programs) {
+        nodes.push_back(alloc.new_object< QueuedProgram >(std::move(program)));
+    }
+
+    std::unique_lock lock { m_pushMutex };
+
+    const auto back  = m_back.load(std::memory_order_relaxed);
+    const auto front = m_front.load(std::memory_order_acquire);
+    auto*      ring  = m_ring.load(std::memory_order_relaxed);
+    if (static_cast< std::size_t >(back - front) + nodes.size() > ring->m_slots.size()) {
+        ring = Grow(ring, front, back, static_cast< std::size_t >(back - front) + nodes.size());
+    }
+
+    auto index = back;
+    for (auto* node : nodes) {
+        ring->At(index++).store(node, std::memory_order_relaxed);
+    }
+    m_back.store(index, std::memory_order_release);
+}
+
+std::optional< QueuedProgram > ProgramQueue::TryTake() {
+    auto front = m_front.load(std::memory_order_acquire);
+    while (front < m_back.load(std::memory_order_acquire)) {
+        // The slot is read before claiming it, a failed claim means another taker owns the program
+        auto* node = m_ring.load(std::memory_order_acquire)->At(front).load(std::memory_order_relaxed);
+        if (m_front.compare_exchange_weak(front, front + 1, std::memory_order_acq_rel, std::memory_order_acquire)) {
+            std::optional< QueuedProgram > program { std::move(*node) };
+            std::pmr::polymorphic_allocator< QueuedProgram > {}.delete_object(node);
+            return program;
+        }
+    }
+    return std::nullopt;
+}
+
+std::size_t ProgramQueue::Size() const noexcept {
+    const auto front = m_front.load(std::memory_order_acquire);
+    const auto back  = m_back.load(std::memory_order_acquire);
+    return back > front ? static_cast< std::size_t >(back - front) : 0;
+}
+
+bool ProgramQueue::IsEmpty() const noexcept {
+    return Size() == 0;
+}
+
+ProgramQueue::Ring* ProgramQueue::Grow(Ring* ring, std::int64_t front, std::int64_t back,
+                                       std::size_t neededCapacity) {
+    m_rings.push_back(allocate_unique< Ring >(std::pmr::polymorphic_allocator< Ring > {},
+                                              std::bit_ceil(std::max(neededCapacity, 2 * ring->m_slots.size()))));
+
+    // Takers may still claim slots of [front, back) while they are copied, both rings hold the same programs there
+    auto* grownRing = m_rings.back().get();
+    for (auto index = front; index < back; ++index) {
+        grownRing->At(index).store(ring->At(index).load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+    m_ring.store(grownRing, std::memory_order_release);
+
+    assert(grownRing->m_slots.size() >= neededCapacity && "Ring did not grow!");
+    return grownRing;
+}
+
+END_NAMESPACE
@@ -0,0 +1,86 @@
+#if !defined(PROGRAMQUEUE_H_INCLUDED_F4799D38_B838_4EBB_821E_8BB1D0DB24CC)
+    #define PROGRAMQUEUE_H_INCLUDED_F4799D38_B838_4EBB_821E_8BB1D0DB24CC
+
+    #include <API/Api.h>
+    #include <API/HiddenAPI.h>
+    #include <Program/Program.h>
+    #include <Program/ResultElement.h>
+    #include <Utility/UniqueRef.h>
+    #include <atomic>
+    #include <cstddef>
+    #include <cstdint>
+    #include <memory>
+    #include <memory_resource>
+    #include <mutex>
+    #include <optional>
+    #include <span>
+    #include <vector>
+
+BEGIN_NAMESPACE
+
+/// @brief Program waiting for a processing unit, with the result it reports to
+struct [[nodiscard]] QueuedProgram {
+    Program                        m_program;
+    bool                           m_stepIn;
+    std::weak_ptr< ResultElement > m_result;
+
+    QueuedProgram(Program program, bool stepIn, std::weak_ptr< ResultElement > result) :
+        m_program(std::move(program)), m_stepIn(stepIn), m_result(std::move(result)) {
+    }
+
+    DEFAULT_MOVE_CLASS(QueuedProgram)
+    DEFAULT_DTOR(QueuedProgram)
+};
+
+/// <summary>
+/// Programs queued on a processing unit, taken in submission order by the unit itself and by idle units stealing them.
+/// Taking is lock-free: slots of a growable ring are claimed by advancing its front with a compare and swap.
+/// Pushing is serialized between submitters, as programs are submitted from any host thread.
+/// </summary>
+class [[nodiscard]] ProgramQueue {
+  public:
+    static constexpr std::size_t Initial_capacity = 16;
+
+    ProgramQueue();
+    DELETE_COPY_CLASS(ProgramQueue)
+    DELETE_MOVE_CLASS(ProgramQueue)
+    ~ProgramQueue();
+
+    void Push(QueuedProgram program);
+
+    /// @brief Pushes programs in order, they are published to takers all at once
+    void PushBatch(std::span< QueuedProgram > programs);
+
+    /// @brief Takes the oldest program, nothing when the queue is empty or another thread won the race for it
+    [[nodiscard]] std::optional< QueuedProgram > TryTake();
+
+    /// @note Only a snapshot while other threads push or take
+    [[nodiscard]] std::size_t Size() const noexcept;
+    [[nodiscard]] bool        IsEmpty() const noexcept;
+
+  private:
+    struct Ring {
+        explicit Ring(std::size_t capacity) : m_slots(capacity) {
+        }
+
+        [[nodiscard]] std::atomic< QueuedProgram* >& At(std::int64_t index) noexcept {
+            return m_slots[static_cast< std::size_t >(index) % m_slots.size()];
+        }
+
+        std::pmr::vector< std::atomic< QueuedProgram* > > m_slots;
+    };
+
+    [[nodiscard]] Ring* Grow(Ring* ring, std::int64_t front, std::int64_t back, std::size_t neededCapacity);
+
+    std::atomic< std::int64_t > m_front;
+    std::atomic< std::int64_t > m_back;
+    std::atomic< Ring* >        m_ring;
+
+    // Rings outgrown are kept until destruction, a slow taker may still read a slot of them
+    std::pmr::vector< UniqueRef< Ring > > m_rings;
+    std::mutex                            m_pushMutex;
+};
+
+END_NAMESPACE
+
+#endif // !defined(PROGRAMQUEUE_H_INCLUDED_F4799D38_B838_4EBB_821E_8BB1D0DB24CC)
@@ -8,10 +8,6 @@
 BEGIN_NAMESPACE
 
 struct [[nodiscard]] IProcessingUnit::ProcessState {
-    std::bitset< 1 > N { 0 };
-    std::bitset< 1 > Z { 0 };
-    std::bitset< 1 > C { 0 };
-    std::bitset< 1 > V { 0 };
     std::bitset< 1 > D { 0 };
     std::bitset< 1 > A { 0 };
     std::bitset< 1 > I { 0 };
@@ -0,0 +1,96 @@
+#include <ProcessingUnit/WorkStealingDomain.h>
+#include <algorithm>
+#include <cassert>
+#include <mutex>
+
+BEGIN_NAMESPACE
+
+WorkStealingDomain::WorkStealingDomain() : m_members(), m_membersMutex(), m_steals(0) {
+}
+
+WorkStealingDomain::~WorkStealingDomain() {
+    assert(m_members.empty() && "Workers have to leave their work stealing domain before it is destroyed!");
+}
+
+void WorkStealingDomain::Join(IWorker* worker, std::size_t locality) {
+    std::unique_lock lock { m_membersMutex };
+    assert(std::none_of(m_members.begin(), m_members.end(),
+                        [worker](const Member& member) { return member.m_worker == worker; }));
+    m_members.push_back(Member { worker, locality });
+}
+
+void WorkStealingDomain::Leave(IWorker* worker) noexcept {
+    std::unique_lock lock { m_membersMutex };
+    m_members.erase(std::remove_if(m_members.begin(), m_members.end(),
+                                   [worker](const Member& member) { return member.m_worker == worker; }),
+                    m_members.end());
+}
+
+template < class Visit >
+bool WorkStealingDomain::VisitOthers(const IWorker* worker, Visit&& visit) const {
+    const auto self = std::find_if(m_members.begin(), m_members.end(),
+                                   [worker](const Member& member) { return member.m_worker == worker; });
+    if (self == m_members.end()) {
+        return false;
+    }
+
+    // Members are visited from the one after worker, so that workers don't all pick the same first victim
+    const auto        selfIdx = static_cast< std::size_t >(self - m_members.begin());
+    const std::size_t count   = m_members.size();
+    for (const bool sameLocality : { true, false }) {
+        for (std::size_t offset = 1; offset < count; ++offset) {
+            const auto& member = m_members[(selfIdx + offset) % count];
+            if ((member.m_locality == self->m_locality) == sameLocality && visit(member.m_worker)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+std::optional< QueuedProgram > WorkStealingDomain::Steal(const IWorker* thief) {
+    std::shared_lock lock { m_membersMutex };
+
+    std::optional< QueuedProgram > program {};
+    VisitOthers(thief, [&](IWorker* victim) {
+        if (victim->GetProgramQueue().IsEmpty()) {
+            return false;
+        }
+        program = victim->GetProgramQueue().TryTake();
+        if (program) {
+            victim->OnProgramStolen();
+            m_steals.fetch_add(1, std::memory_order_relaxed);
+        }
+        return program.has_value();
+    });
+    return program;
+}
+
+bool WorkStealingDomain::WakeIdleWorker(const IWorker* busyWorker) {
+    std::shared_lock lock { m_membersMutex };
+    return VisitOthers(busyWorker, [](IWorker* worker) { return worker->WakeIfIdle(); });
+}
+
+std::size_t WorkStealingDomain::WakeIdleWorkers(std::size_t count) {
+    std::shared_lock lock { m_membersMutex };
+
+    std::size_t wokenCount = 0;
+    for (auto& member : m_members) {
+        if (wokenCount == count) {
+            break;
+        }
+        wokenCount += member.m_worker->WakeIfIdle() ? 1 : 0;
+    }
+    return wokenCount;
+}
+
+std::size_t WorkStealingDomain::GetWorkerCount() const noexcept {
+    std::shared_lock lock { m_membersMutex };
+    return m_members.size();
+}
+
+std::size_t WorkStealingDomain::GetStealCount() const noexcept {
+    return m_steals.load(std::memory_order_relaxed);
+}
+
+END_NAMESPACE
@@ -0,0 +1,80 @@
+#if !defined(WORKSTEALINGDOMAIN_H_INCLUDED_C3CAA8C5_E75D_435C_AF49_1A3FCA7B82AE)
+    #define WORKSTEALINGDOMAIN_H_INCLUDED_C3CAA8C5_E75D_435C_AF49_1A3FCA7B82AE
+
+    #include <API/Api.h>
+    #include <API/HiddenAPI.h>
+    #include <ProcessingUnit/ProgramQueue.h>
+    #include <atomic>
+    #include <cstddef>
+    #include <memory_resource>
+    #include <optional>
+    #include <shared_mutex>
+    #include <vector>
+
+BEGIN_NAMESPACE
+
+/// <summary>
+/// Processing units lending each other their queued programs, typically all the processing units of a CPU.
+/// An idle worker steals the oldest program of a busy one, workers of its own locality first (the threads of a core,
+/// which share its L2 cache) and only then the others.
+/// </summary>
+class [[nodiscard]] WorkStealingDomain {
+  public:
+    /// <summary>
+    /// Processing unit whose queued programs may run on the other workers of its domain
+    /// </summary>
+    class [[nodiscard]] IWorker {
+      public:
+        IWorker() = default;
+        DELETE_COPY_CLASS(IWorker)
+        DELETE_MOVE_CLASS(IWorker)
+        virtual ~IWorker() = default;
+
+        [[nodiscard]] virtual ProgramQueue& GetProgramQueue() noexcept = 0;
+
+        /// @brief Another worker took one of the queued programs
+        virtual void OnProgramStolen() noexcept = 0;
+
+        /// @brief Wakes the worker up if it is idle, so that it steals, returns whether it was woken
+        virtual bool WakeIfIdle() = 0;
+    };
+
+    WorkStealingDomain();
+    DELETE_COPY_CLASS(WorkStealingDomain)
+    DELETE_MOVE_CLASS(WorkStealingDomain)
+    ~WorkStealingDomain();
+
+    /// @param locality Workers of equal locality are preferred victims of each other
+    void Join(IWorker* worker, std::size_t locality);
+    void Leave(IWorker* worker) noexcept;
+
+    /// @brief Takes a queued program of another worker, nothing when none of them has any
+    [[nodiscard]] std::optional< QueuedProgram > Steal(const IWorker* thief);
+
+    /// @brief A program was queued on a busy worker, wakes an idle one up to steal it
+    bool WakeIdleWorker(const IWorker* busyWorker);
+
+    /// @brief Programs were queued on any of the workers, wakes up to count idle ones, returns how many were woken
+    std::size_t WakeIdleWorkers(std::size_t count);
+
+    [[nodiscard]] std::size_t GetWorkerCount() const noexcept;
+    [[nodiscard]] std::size_t GetStealCount() const noexcept;
+
+  private:
+    struct Member {
+        IWorker*    m_worker;
+        std::size_t m_locality;
+    };
+
+    /// @brief Calls visit on the members other than worker, those of its locality first, until it returns true
+    template < class Visit >
+    bool VisitOthers(const IWorker* worker, Visit&& visit) const;
+
+    std::pmr::vector< Member > m_members;
+    mutable std::shared_mutex  m_membersMutex;
+    std::atomic< std::size_t > m_steals;
+};
+
+END_NAMESPACE
+
+#endif // !defined(WORKSTEALINGDOMAIN_H_INCLUDED_C3CAA8C5_E75D_435C_AF49_1A3FCA7B82AE)
@@ -41,10 +41,19 @@ class ControlledResult::Impl final {
         m_resultElement->WaitForState(state);
     }
 
+    void OnReady(ReadyCallback callback) {
+        m_resultElement->OnReady(std::move(callback));
+    }
+
     void StepIn() {
         m_resultElement->StepIn();
     }
 
+    IResult::ResultFrame RunFor(std::uint64_t instructionBudget) {
+        m_resultElement->RunFor(instructionBudget);
+        return m_resultElement->GetResultFrame();
+    }
+
     bool CanStepIn() {
         return m_resultElement->CanStepIn();
     }
@@ -93,8 +102,16 @@ bool ControlledResult::CanStepIn() const noexcept {
     return m_result->CanStepIn();
 }
 
+void ControlledResult::OnReady(ReadyCallback callback) {
+    m_result->OnReady(std::move(callback));
+}
+
 void ControlledResult::StepIn() {
     m_result->StepIn();
 }
 
+IResult::ResultFrame ControlledResult::RunFor(std::uint64_t instructionBudget) {
+    return m_result->RunFor(instructionBudget);
+}
+
 END_NAMESPACE
@@ -7,11 +7,20 @@
 BEGIN_NAMESPACE
 
 IResult::ResultFrame::Impl::Impl() :
-    m_registers(), m_PC(0), m_SP(0), m_N(false), m_C(false), m_Z(false), m_V(false), m_processMemory() {
+    m_registers(),
+    m_PC(0),
+    m_SP(0),
+    m_N(false),
+    m_C(false),
+    m_Z(false),
+    m_V(false),
+    m_fault(ProgramFault::None),
+    m_processMemory() {
 }
 
 IResult::ResultFrame::Impl::Impl(GPRegisters::Arch64Registers registers, std::uint64_t PC, std::uint64_t SP, bool N,
-                                 bool C, bool Z, bool V, std::pmr::vector< IMemory::DataUnit > processMemory) :
+                                 bool C, bool Z, bool V, ProgramFault fault,
+                                 std::pmr::vector< IMemory::DataUnit > processMemory) :
     m_registers(registers),
     m_PC(PC),
     m_SP(SP),
@@ -19,12 +28,13 @@ IResult::ResultFrame::Impl::Impl(GPRegisters::Arch64Registers registers, std::ui
     m_C(C),
     m_Z(Z),
     m_V(V),
+    m_fault(fault),
     m_processMemory(std::move(processMemory)) {
 }
 
 std::uint64_t IResult::ResultFrame::Impl::GetGPRegisterValue(std::uint8_t registerLocation) const {
     assert(registerLocation < 31 && registerLocation >= 0);
-    return m_registers[registerLocation].to_ullong();
+    return m_registers[registerLocation];
 }
 
 std::uint64_t IResult::ResultFrame::Impl::GetPC() const noexcept {
@@ -51,6 +61,10 @@ bool IResult::ResultFrame::Impl::GetV() const noexcept {
     return m_V;
 }
 
+ProgramFault IResult::ResultFrame::Impl::GetFault() const noexcept {
+    return m_fault;
+}
+
 const std::pmr::vector< IMemory::DataUnit >& IResult::ResultFrame::Impl::GetProcessMemory() const noexcept {
     return m_processMemory;
 }
@@ -90,6 +104,10 @@ bool IResult::ResultFrame::GetV() const noexcept {
     return m_frame->GetV();
 }
 
+ProgramFault IResult::ResultFrame::GetFault() const noexcept {
+    return m_frame->GetFault();
+}
+
 const std::pmr::vector< IMemory::DataUnit >& IResult::ResultFrame::GetProcessMemory() const noexcept {
     return m_frame->GetProcessMemory();
 }
@@ -13,7 +13,7 @@ class IResult::ResultFrame::Impl {
     Impl();
 
     Impl(GPRegisters::Arch64Registers registers, std::uint64_t PC, std::uint64_t SP, bool N, bool C, bool Z, bool V,
-         std::pmr::vector< IMemory::DataUnit > processMemory);
+         ProgramFault fault, std::pmr::vector< IMemory::DataUnit > processMemory);
 
     std::uint64_t GetGPRegisterValue(std::uint8_t registerLocation) const;
 
@@ -29,6 +29,8 @@ class IResult::ResultFrame::Impl {
 
     bool GetV() const noexcept;
 
+    ProgramFault GetFault() const noexcept;
+
     const std::pmr::vector< IMemory::DataUnit >& GetProcessMemory() const noexcept;
 
   private:
@@ -39,6 +41,7 @@ class IResult::ResultFrame::Impl {
     bool                                  m_C;
     bool                                  m_Z;
     bool                                  m_V;
+    ProgramFault                          m_fault;
     std::pmr::vector< IMemory::DataUnit > m_processMemory;
 };
 
@@ -41,6 +41,10 @@ class Result::Impl final {
         m_resultElement->WaitForState(state);
     }
 
+    void OnReady(ReadyCallback callback) {
+        m_resultElement->OnReady(std::move(callback));
+    }
+
   private:
     SharedRef< ResultElement > m_resultElement;
 };
@@ -84,4 +88,8 @@ bool Result::CanStepIn() const noexcept {
     return false;
 }
 
+void Result::OnReady(ReadyCallback callback) {
+    m_result->OnReady(std::move(callback));
+}
+
 END_NAMESPACE
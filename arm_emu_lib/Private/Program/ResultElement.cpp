@@ -17,9 +17,27 @@ ResultElement::~ResultElement() {
     }
 }
 
+namespace {
+    [[nodiscard]] constexpr bool IsDone(IResult::State state) noexcept {
+        return state == IResult::State::Ready || state == IResult::State::Interrupted;
+    }
+} // namespace
+
 void ResultElement::Signal(IResult::State state) noexcept {
-    m_state = state;
+    std::pmr::vector< IResult::ReadyCallback > readyCallbacks {};
+    {
+        // Set under the lock, so that neither a waiter nor a callback being registered misses the change
+        std::unique_lock lock { m_mutex };
+        m_state.store(state, std::memory_order_release);
+        if (IsDone(state)) {
+            readyCallbacks.swap(m_readyCallbacks);
+        }
+    }
     m_condVar.notify_all();
+
+    for (auto& callback : readyCallbacks) {
+        callback(state);
+    }
 }
 
 void ResultElement::SetResultFrame(IResult::ResultFrame::Impl frame) {
@@ -27,7 +45,7 @@ void ResultElement::SetResultFrame(IResult::ResultFrame::Impl frame) {
 }
 
 IResult::State ResultElement::GetState() const noexcept {
-    return m_state;
+    return m_state.load(std::memory_order_acquire);
 }
 
 IResult::ResultFrame ResultElement::GetResultFrame() const {
@@ -37,17 +55,29 @@ IResult::ResultFrame ResultElement::GetResultFrame() const {
 
 void ResultElement::WaitReady() {
     std::unique_lock lock { m_mutex };
-    m_condVar.wait(lock, [&]() { return m_state == IResult::State::Ready; });
+    m_condVar.wait(lock, [&]() { return IsDone(GetState()); });
 }
 
 void ResultElement::WaitForState(IResult::State state) {
     std::unique_lock lock { m_mutex };
-    m_condVar.wait(lock, [&]() { return m_state == state; });
+    m_condVar.wait(lock, [&]() { return GetState() == state; });
+}
+
+void ResultElement::OnReady(IResult::ReadyCallback callback) {
+    std::unique_lock lock { m_mutex };
+    const auto       state = GetState();
+    if (!IsDone(state)) {
+        m_readyCallbacks.push_back(std::move(callback));
+        return;
+    }
+
+    lock.unlock();
+    callback(state);
 }
 
 bool ResultElement::CanStepIn() const noexcept {
     return m_isStepInAllowed && static_cast< bool >(m_steppedInInterrupt) && static_cast< bool >(m_stepInCondVar) &&
-           (m_state == IResult::State::StepInMode);
+           (GetState() == IResult::State::StepInMode);
 }
 
 std::condition_variable_any& ResultElement::StepInSetup(std::condition_variable_any& condVarToTrigger,
@@ -72,6 +102,13 @@ Interrupt ResultElement::GetStepInInterrupt() noexcept { /* The caller guarantee
 }
 
 void ResultElement::StepIn() {
+    RunFor(1);
+}
+
+void ResultElement::RunFor(std::uint64_t instructionBudget) {
+    assert(instructionBudget > 0 && "Running for an empty instruction budget!");
+
+    m_stepBudget.store(instructionBudget, std::memory_order_relaxed); // Published by the step in trigger below
     m_steppedInInterrupt->Reset();
 
     if (m_stepInCondVar) {
@@ -83,6 +120,10 @@ void ResultElement::StepIn() {
     m_steppedIn.wait(lock, [&]() { return m_steppedInInterrupt->IsTriggered(); });
 }
 
+std::uint64_t ResultElement::GetStepBudget() const noexcept {
+    return m_stepBudget.load(std::memory_order_relaxed);
+}
+
 void ResultElement::SignalStepInValidity(bool isStepInAllowed) noexcept {
     m_isStepInAllowed = isStepInAllowed;
 }
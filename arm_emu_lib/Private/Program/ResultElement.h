@@ -8,11 +8,14 @@
     #include <Program/IResult.h>
     #include <Program/IResultImpl.h>
     #include <array>
+    #include <atomic>
     #include <bitset>
     #include <cassert>
     #include <condition_variable>
+    #include <cstdint>
     #include <mutex>
     #include <optional>
+    #include <vector>
 
 BEGIN_NAMESPACE
 
@@ -30,6 +33,9 @@ struct [[nodiscard]] ARMEMU_API ResultElement : public std::enable_shared_from_t
     void WaitReady();
     void WaitForState(IResult::State state);
 
+    /// @brief Calls callback once the state is Ready or Interrupted, right away when it already is
+    void OnReady(IResult::ReadyCallback callback);
+
     bool                                       CanStepIn() const noexcept;
     [[nodiscard]] std::condition_variable_any& StepInSetup(std::condition_variable_any& condVarToTrigger,
                                                            Interrupt                    stepInDone) noexcept;
@@ -37,21 +43,27 @@ struct [[nodiscard]] ARMEMU_API ResultElement : public std::enable_shared_from_t
     [[nodiscard]] Interrupt                    GetStepInInterrupt() noexcept;
 
     void StepIn();
+    void RunFor(std::uint64_t instructionBudget);
     void SignalStepInValidity(bool isStepInAllowed) noexcept;
 
+    /// @brief Number of instructions the processing unit may run before handing control back to the stepping thread
+    [[nodiscard]] std::uint64_t GetStepBudget() const noexcept;
+
   private:
     // TODO: add all read data into frame struct
     IResult::ResultFrame::Impl m_resultFrame;
 
-    IResult::State          m_state { IResult::State::Waiting };
-    std::mutex              m_mutex {};
-    std::condition_variable m_condVar {};
+    std::atomic< IResult::State >              m_state { IResult::State::Waiting };
+    std::mutex                                 m_mutex {};
+    std::condition_variable                    m_condVar {};
+    std::pmr::vector< IResult::ReadyCallback > m_readyCallbacks {};
 
     Interrupt                    m_stepInSource { CreateInterrupt() };
     std::condition_variable_any* m_stepInCondVar { nullptr };
 
-    Interrupt                   m_steppedInInterrupt { nullptr };
-    std::condition_variable_any m_steppedIn {};
+    Interrupt                    m_steppedInInterrupt { nullptr };
+    std::condition_variable_any  m_steppedIn {};
+    std::atomic< std::uint64_t > m_stepBudget { 1 };
 
     bool m_isStepInAllowed;
 };
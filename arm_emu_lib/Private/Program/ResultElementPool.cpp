@@ -0,0 +1,56 @@
+#include <Program/ResultElementPool.h>
+#include <algorithm>
+
+BEGIN_NAMESPACE
+
+namespace {
+    // Room for the shared_ptr control block stored next to each result element
+    constexpr std::size_t Control_block_size = 4 * sizeof(void*);
+} // namespace
+
+/// @brief Allocates from the buffer of the pool and keeps it alive, a copy is stored in every control block
+template < class Type >
+class ResultElementPool::Allocator {
+  public:
+    using value_type = Type;
+
+    explicit Allocator(SharedRef< std::pmr::monotonic_buffer_resource > buffer) noexcept : m_buffer(std::move(buffer)) {
+    }
+
+    template < class Other >
+    Allocator(const Allocator< Other >& other) noexcept : m_buffer(other.m_buffer) {
+    }
+
+    [[nodiscard]] Type* allocate(std::size_t count) {
+        return static_cast< Type* >(m_buffer->allocate(count * sizeof(Type), alignof(Type)));
+    }
+
+    void deallocate(Type* ptr, std::size_t count) noexcept {
+        // Monotonic buffers release nothing before they are destroyed, so results freed by several threads are fine
+        m_buffer->deallocate(ptr, count * sizeof(Type), alignof(Type));
+    }
+
+    template < class Other >
+    [[nodiscard]] bool operator==(const Allocator< Other >& other) const noexcept {
+        return m_buffer == other.m_buffer;
+    }
+
+  private:
+    template < class Other >
+    friend class Allocator;
+
+    SharedRef< std::pmr::monotonic_buffer_resource > m_buffer;
+};
+
+ResultElementPool::ResultElementPool(std::size_t capacity) :
+    m_buffer(std::allocate_shared< std::pmr::monotonic_buffer_resource >(
+        std::pmr::polymorphic_allocator< std::pmr::monotonic_buffer_resource > {},
+        std::max< std::size_t >(capacity, 1) * (sizeof(ResultElement) + Control_block_size),
+        std::pmr::get_default_resource())) {
+}
+
+SharedRef< ResultElement > ResultElementPool::Allocate(bool isStepInAllowed) {
+    return std::allocate_shared< ResultElement >(Allocator< ResultElement > { m_buffer }, isStepInAllowed);
+}
+
+END_NAMESPACE
@@ -0,0 +1,37 @@
+#if !defined(RESULTELEMENTPOOL_H_INCLUDED_DA786EAC_C0BB_4760_A53D_C5EF4462B483)
+    #define RESULTELEMENTPOOL_H_INCLUDED_DA786EAC_C0BB_4760_A53D_C5EF4462B483
+
+    #include <API/Api.h>
+    #include <API/HiddenAPI.h>
+    #include <Program/ResultElement.h>
+    #include <Utility/UniqueRef.h>
+    #include <cstddef>
+    #include <memory>
+    #include <memory_resource>
+
+BEGIN_NAMESPACE
+
+/// <summary>
+/// Result elements of a batch of programs, carved out of a single buffer instead of one allocation each.
+/// The buffer is released once the last result element of the batch is destroyed, so the pool itself may go away first.
+/// </summary>
+/// <remarks>Allocation is not thread safe, a batch is submitted by one thread</remarks>
+class [[nodiscard]] ResultElementPool {
+  public:
+    explicit ResultElementPool(std::size_t capacity);
+    DELETE_COPY_CLASS(ResultElementPool)
+    DEFAULT_MOVE_CLASS(ResultElementPool)
+    DEFAULT_DTOR(ResultElementPool)
+
+    [[nodiscard]] SharedRef< ResultElement > Allocate(bool isStepInAllowed);
+
+  private:
+    template < class Type >
+    class Allocator;
+
+    SharedRef< std::pmr::monotonic_buffer_resource > m_buffer;
+};
+
+END_NAMESPACE
+
+#endif // !defined(RESULTELEMENTPOOL_H_INCLUDED_DA786EAC_C0BB_4760_A53D_C5EF4462B483)
@@ -0,0 +1,21 @@
+#if !defined(EXECUTIONMODE_H_INCLUDED_2EFEB399_B7D9_4685_AFD6_C220E1E18ED6)
+    #define EXECUTIONMODE_H_INCLUDED_2EFEB399_B7D9_4685_AFD6_C220E1E18ED6
+
+    #include <API/Api.h>
+    #include <cstdint>
+
+namespace arm_emu {
+
+    /// @brief How the processing units of a CPU execute the programs that are not stepped into
+    enum class ExecutionMode : std::uint8_t
+    {
+        BlockTranslation, /* Chained basic blocks of decoded instructions, cached per program */
+
+        Interpreter, /* One instruction at a time, the reference block translation is compared against */
+
+        Jit, /* Block translation with hot blocks compiled to host code, same as BlockTranslation on non x86-64 hosts */
+    };
+
+} // namespace arm_emu
+
+#endif // !defined(EXECUTIONMODE_H_INCLUDED_2EFEB399_B7D9_4685_AFD6_C220E1E18ED6)
@@ -6,6 +6,7 @@
     #include <Program/ControlledResult.h>
     #include <Program/Program.h>
     #include <Program/Result.h>
+    #include <span>
     #include <vector>
 
 namespace arm_emu {
@@ -223,6 +224,11 @@ namespace arm_emu {
         /// @return ControlledResult to track and control program execution
         virtual ControlledResult StepIn(Program program) = 0;
 
+        /// @brief Submit many programs to be executed, cheaper than submitting them one by one
+        /// @param programs programs to be executed, they are moved from
+        /// @return Result objects to track program executions, in the order of the programs
+        virtual std::pmr::vector< Result > RunBatch(std::span< Program > programs) = 0;
+
         /// @brief Stop all program executions. If a program is in progress, it will be interrupted and stopped.
         virtual void Stop() = 0;
 
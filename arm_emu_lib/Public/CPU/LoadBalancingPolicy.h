@@ -0,0 +1,21 @@
+#if !defined(LOADBALANCINGPOLICY_H_INCLUDED_A07F65BB_F5F9_41CC_9489_C3F9F38D7C34)
+    #define LOADBALANCINGPOLICY_H_INCLUDED_A07F65BB_F5F9_41CC_9489_C3F9F38D7C34
+
+    #include <API/Api.h>
+    #include <cstdint>
+
+namespace arm_emu {
+
+    /// @brief How submitted programs are placed on the processing units of a CPU
+    enum class LoadBalancingPolicy : std::uint8_t
+    {
+        LeastLoaded, /* Processing unit with the fewest queued programs, ties go to the least loaded core */
+
+        RoundRobin, /* Processing units in turn, whatever their load */
+
+        FirstProcessingUnit, /* Every program on the first processing unit, idle processing units steal them */
+    };
+
+} // namespace arm_emu
+
+#endif // !defined(LOADBALANCINGPOLICY_H_INCLUDED_A07F65BB_F5F9_41CC_9489_C3F9F38D7C34)
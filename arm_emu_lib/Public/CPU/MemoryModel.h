@@ -0,0 +1,22 @@
+#if !defined(MEMORYMODEL_H_INCLUDED_4E313918_CCCD_40C5_9996_521C306F3CBE)
+    #define MEMORYMODEL_H_INCLUDED_4E313918_CCCD_40C5_9996_521C306F3CBE
+
+    #include <API/Api.h>
+    #include <cstdint>
+
+namespace arm_emu {
+
+    /// @brief How the memory of the system is modelled
+    enum class MemoryModel : std::uint8_t
+    {
+        CacheHierarchy, /* Accesses go through the MMU and the L1, L2 and L3 caches down to RAM */
+
+        Flat, /* Every processing unit accesses its address space directly in host memory, no cache is simulated */
+
+        Paged, /* Like CacheHierarchy, but process memory is mapped by stage 1 page tables one 4 KiB page at a time on
+                  first access instead of being reserved up front */
+    };
+
+} // namespace arm_emu
+
+#endif // !defined(MEMORYMODEL_H_INCLUDED_4E313918_CCCD_40C5_9996_521C306F3CBE)
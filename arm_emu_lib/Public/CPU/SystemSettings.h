@@ -3,6 +3,9 @@
 
     #include <API/Api.h>
     #include <CPU/CPUType.h>
+    #include <CPU/ExecutionMode.h>
+    #include <CPU/LoadBalancingPolicy.h>
+    #include <CPU/MemoryModel.h>
 
 namespace arm_emu {
 
@@ -10,6 +13,10 @@ namespace arm_emu {
         alignas(8) CPUType cpuType;
         alignas(8) std::uint8_t nCores;
         alignas(8) std::uint8_t nThreadsPerCore;
+        alignas(8) MemoryModel memoryModel; /* Cache sizes are ignored by the flat memory model */
+        alignas(8) LoadBalancingPolicy loadBalancingPolicy;
+        alignas(8) ExecutionMode executionMode;
+        alignas(8) std::uint16_t nHostThreads; /* Host threads running the processing units, 0 for all host cores */
 
         alignas(64) std::uint64_t L1CacheSize;
         alignas(64) std::uint64_t L2CacheSize;
@@ -2,7 +2,12 @@
     #define DATAUNIT_H_INCLUDED_F109F336_457F_4137_A7FC_4408CACA84A8
 
     #include <API/Api.h>
+    #include <algorithm>
+    #include <cassert>
     #include <initializer_list>
+    #include <memory_resource>
+    #include <span>
+    #include <utility>
     #include <vector>
 
 namespace arm_emu {
@@ -68,6 +73,75 @@ namespace arm_emu {
         std::pmr::vector< Unit > m_data {};
     };
 
+    /// <summary>
+    /// Read only view of data units, either borrowed from the storage of a memory or owning a copy when the memory
+    /// cannot expose its storage contiguously. A borrowed view is only valid until the next access to the memory it
+    /// was taken from, the owned copy guards views that would not outlive it.
+    /// </summary>
+    template < class Unit >
+    class [[nodiscard]] DataView {
+      public:
+        constexpr DataView() = default;
+        constexpr explicit DataView(std::span< const Unit > data) noexcept : m_storage(), m_data(data) {
+        }
+        constexpr explicit DataView(DataBlock< Unit >&& data) noexcept :
+            m_storage(std::move(data)), m_data(m_storage.Data(), m_storage.Size()) {
+        }
+
+        constexpr DataView(DataView&& other) noexcept : DataView() {
+            *this = std::move(other);
+        }
+        constexpr DataView& operator=(DataView&& other) noexcept {
+            const auto isOwning = other.IsOwning();
+            m_storage           = std::move(other.m_storage);
+            m_data              = isOwning ? Owned() : other.m_data;
+            other.m_data        = {};
+            return *this;
+        }
+        constexpr ~DataView() = default;
+
+        DataView(const DataView&)            = delete;
+        DataView& operator=(const DataView&) = delete;
+
+        [[nodiscard]] constexpr const Unit& At(size_t loc) const {
+            assert(loc < m_data.size());
+            return m_data[loc];
+        }
+
+        [[nodiscard]] constexpr std::span< const Unit > Get() const noexcept {
+            return m_data;
+        }
+
+        [[nodiscard]] constexpr const Unit* Data() const noexcept {
+            return m_data.data();
+        }
+
+        [[nodiscard]] constexpr decltype(auto) Begin() const noexcept {
+            return m_data.begin();
+        }
+
+        [[nodiscard]] constexpr decltype(auto) End() const noexcept {
+            return m_data.end();
+        }
+
+        [[nodiscard]] constexpr size_t Size() const noexcept {
+            return m_data.size();
+        }
+
+        /// @brief Whether the view holds its own copy of the data instead of borrowing it
+        [[nodiscard]] constexpr bool IsOwning() const noexcept {
+            return m_storage.Size() > 0;
+        }
+
+      private:
+        [[nodiscard]] constexpr std::span< const Unit > Owned() const noexcept {
+            return { m_storage.Data(), m_storage.Size() };
+        }
+
+        DataBlock< Unit >       m_storage {};
+        std::span< const Unit > m_data {};
+    };
+
     template < class Unit >
     [[nodiscard]] constexpr decltype(auto) begin(DataBlock< Unit >& block) noexcept {
         return block.Begin();
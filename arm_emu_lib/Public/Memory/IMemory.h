@@ -5,10 +5,17 @@
     #include <DebugUtils/Object.h>
     #include <Memory/DataUnit.h>
     #include <Memory/MemoryUnits.h>
+    #include <algorithm>
+    #include <array>
+    #include <bit>
     #include <cassert>
     #include <concepts>
+    #include <cstddef>
     #include <cstdint>
+    #include <cstring>
     #include <ratio>
+    #include <span>
+    #include <type_traits>
     #include <vector>
 
 namespace arm_emu {
@@ -22,6 +29,16 @@ namespace arm_emu {
 
         static constexpr DataUnit Empty_data_unit = DataUnit { 0 };
 
+        /// @brief 128 bit value of a quadword access, m_low holds the bytes at the lower addresses
+        struct Quadword {
+            std::uint64_t m_low;
+            std::uint64_t m_high;
+        };
+
+        /// @brief Value types of byte addressed accesses, 8/16/32/64 bit unsigned integers and quadwords
+        template < class T >
+        static constexpr bool Is_access_type = std::unsigned_integral< T > || std::same_as< T, Quadword >;
+
         IMemory(std::string name = "IMemory") : Object(std::move(name)) {
         }
         IMemory(IMemory&&)            = default;
@@ -37,6 +54,142 @@ namespace arm_emu {
         virtual void                                WriteBlock(Address start, const DataBlock< DataUnit >& data) = 0;
         [[nodiscard]] virtual Address               Size() const noexcept                                        = 0;
         [[nodiscard]] virtual const MemoryWatcher&  GetMemoryWatcher() const noexcept                            = 0;
+
+        /// @brief Copies the data.size() data units starting at start into data, without allocating
+        /// @note Goes through the allocating ReadBlock, memories with direct storage access should override it
+        virtual void ReadBlock(Address start, std::span< DataUnit > data) const {
+            const auto block = ReadBlock(start, data.size());
+            std::copy(block.Begin(), block.End(), data.begin());
+        }
+
+        /// @brief Writes the data units of data starting at start
+        /// @note Goes through the DataBlock WriteBlock, memories with direct storage access should override it
+        virtual void WriteBlock(Address start, std::span< const DataUnit > data) {
+            WriteBlock(start, DataBlock< DataUnit > { data.size(), data.data() });
+        }
+
+        /// @brief Read only view of the dataUnitCount data units starting at start, borrowed from the memory storage
+        /// when possible, valid until the next access to the memory
+        [[nodiscard]] virtual DataView< DataUnit > ViewBlock(Address start, std::uint64_t dataUnitCount) const {
+            return DataView< DataUnit > { ReadBlock(start, dataUnitCount) };
+        }
+
+        /// @brief Reads the sizeof(T) bytes starting at byteAddress as a little endian value, in a single access
+        template < class T >
+            requires Is_access_type< T >
+        [[nodiscard]] T Read(Address byteAddress) const {
+            std::array< std::byte, sizeof(T) > bytes {};
+            ReadBytes(byteAddress, bytes);
+            return FromBytes< T >(bytes);
+        }
+
+        /// @brief Writes value as sizeof(T) little endian bytes starting at byteAddress, in a single access
+        /// @note T has to be given explicitly, so Write(address, data) keeps resolving to the data unit overload
+        template < class T >
+            requires Is_access_type< T >
+        void Write(Address byteAddress, std::type_identity_t< T > value) {
+            const auto bytes = ToBytes< T >(value);
+            WriteBytes(byteAddress, bytes);
+        }
+
+        /// @brief Copies the bytes starting at byteAddress into data, bytes of a data unit are in little endian order
+        /// @note Goes through Read one data unit at a time, memories with direct storage access should override it
+        virtual void ReadBytes(Address byteAddress, std::span< std::byte > data) const {
+            for (std::size_t idx = 0; idx < data.size();) {
+                const auto currentAddress = byteAddress + idx;
+                const auto unitOffset     = static_cast< std::size_t >(currentAddress % sizeof(DataUnit));
+                const auto count          = std::min(sizeof(DataUnit) - unitOffset, data.size() - idx);
+                const auto unit           = Read(currentAddress / sizeof(DataUnit));
+
+                LoadBytes(std::span< const DataUnit > { &unit, 1 }, unitOffset, data.subspan(idx, count));
+                idx += count;
+            }
+        }
+
+        /// @brief Copies data into the bytes starting at byteAddress, bytes of a data unit are in little endian order
+        /// @note Goes through Read and Write one data unit at a time, memories with direct storage access should
+        /// override it
+        virtual void WriteBytes(Address byteAddress, std::span< const std::byte > data) {
+            for (std::size_t idx = 0; idx < data.size();) {
+                const auto currentAddress = byteAddress + idx;
+                const auto unitAddress    = currentAddress / sizeof(DataUnit);
+                const auto unitOffset     = static_cast< std::size_t >(currentAddress % sizeof(DataUnit));
+                const auto count          = std::min(sizeof(DataUnit) - unitOffset, data.size() - idx);
+
+                // Partially written data units keep their other bytes
+                auto unit = count == sizeof(DataUnit) ? Empty_data_unit : Read(unitAddress);
+                StoreBytes(std::span< DataUnit > { &unit, 1 }, unitOffset, data.subspan(idx, count));
+                Write(unitAddress, unit);
+                idx += count;
+            }
+        }
+
+        /// @brief Copies the bytes starting at byteOffset of units into data
+        static void LoadBytes(std::span< const DataUnit > units, std::size_t byteOffset,
+                              std::span< std::byte > data) noexcept {
+            assert(data.size() <= units.size_bytes() && byteOffset <= units.size_bytes() - data.size());
+            if constexpr (std::endian::native == std::endian::little) {
+                std::memcpy(data.data(), reinterpret_cast< const std::byte* >(units.data()) + byteOffset, data.size());
+            } else {
+                for (std::size_t idx = 0; idx < data.size(); ++idx) {
+                    const auto byte = byteOffset + idx;
+                    data[idx]       = static_cast< std::byte >(units[byte / sizeof(DataUnit)] >>
+                                                         (8 * (byte % sizeof(DataUnit))));
+                }
+            }
+        }
+
+        /// @brief Copies data into the bytes starting at byteOffset of units
+        static void StoreBytes(std::span< DataUnit > units, std::size_t byteOffset,
+                               std::span< const std::byte > data) noexcept {
+            assert(data.size() <= units.size_bytes() && byteOffset <= units.size_bytes() - data.size());
+            if constexpr (std::endian::native == std::endian::little) {
+                std::memcpy(reinterpret_cast< std::byte* >(units.data()) + byteOffset, data.data(), data.size());
+            } else {
+                for (std::size_t idx = 0; idx < data.size(); ++idx) {
+                    const auto byte  = byteOffset + idx;
+                    const auto shift = 8 * (byte % sizeof(DataUnit));
+                    auto&      unit  = units[byte / sizeof(DataUnit)];
+                    unit = (unit & ~(DataUnit { 0xFF } << shift)) | (std::to_integer< DataUnit >(data[idx]) << shift);
+                }
+            }
+        }
+
+        template < class T >
+            requires Is_access_type< T >
+        [[nodiscard]] static constexpr T FromBytes(const std::array< std::byte, sizeof(T) >& bytes) noexcept {
+            if constexpr (std::same_as< T, Quadword >) {
+                Quadword value {};
+                for (std::size_t idx = 0; idx < sizeof(std::uint64_t); ++idx) {
+                    value.m_low |= std::to_integer< std::uint64_t >(bytes[idx]) << (8 * idx);
+                    value.m_high |= std::to_integer< std::uint64_t >(bytes[idx + sizeof(std::uint64_t)]) << (8 * idx);
+                }
+                return value;
+            } else {
+                T value {};
+                for (std::size_t idx = 0; idx < sizeof(T); ++idx) {
+                    value |= static_cast< T >(std::to_integer< T >(bytes[idx]) << (8 * idx));
+                }
+                return value;
+            }
+        }
+
+        template < class T >
+            requires Is_access_type< T >
+        [[nodiscard]] static constexpr std::array< std::byte, sizeof(T) > ToBytes(T value) noexcept {
+            std::array< std::byte, sizeof(T) > bytes {};
+            if constexpr (std::same_as< T, Quadword >) {
+                for (std::size_t idx = 0; idx < sizeof(std::uint64_t); ++idx) {
+                    bytes[idx]                         = static_cast< std::byte >(value.m_low >> (8 * idx));
+                    bytes[idx + sizeof(std::uint64_t)] = static_cast< std::byte >(value.m_high >> (8 * idx));
+                }
+            } else {
+                for (std::size_t idx = 0; idx < sizeof(T); ++idx) {
+                    bytes[idx] = static_cast< std::byte >(value >> (8 * idx));
+                }
+            }
+            return bytes;
+        }
     };
 
     namespace literals {
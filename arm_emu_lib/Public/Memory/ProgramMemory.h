@@ -22,6 +22,9 @@ namespace arm_emu {
         ProgramMemory(const ProgramMemory&) = delete;
         ProgramMemory& operator=(const ProgramMemory&) = delete;
 
+        using IMemory::ReadBlock;
+        using IMemory::WriteBlock;
+
         [[nodiscard]] DataUnit              Read(Address address) const noexcept final;
         [[nodiscard]] DataBlock< DataUnit > ReadBlock(Address start, std::uint64_t dataUnitCount) const final;
 
@@ -4,6 +4,7 @@
     #include <API/Api.h>
     #include <Program/IResult.h>
     #include <Utility/UniqueRef.h>
+    #include <cstdint>
 
 namespace arm_emu {
 
@@ -23,9 +24,14 @@ namespace arm_emu {
         void                 WaitReady() final;
         void                 WaitForState(IResult::State state) final;
         bool                 CanStepIn() const noexcept final;
+        void                 OnReady(ReadyCallback callback) final;
 
         void StepIn();
 
+        /// @brief Runs up to instructionBudget instructions on the processing unit without stopping in between
+        /// @return Frame of the processing unit once the budget is spent or the program ended
+        IResult::ResultFrame RunFor(std::uint64_t instructionBudget);
+
       private:
         class Impl;
         UniqueRef< Impl > m_result;
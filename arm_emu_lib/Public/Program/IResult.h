@@ -3,8 +3,10 @@
 
     #include <API/Api.h>
     #include <Memory/IMemory.h>
+    #include <Program/ProgramFault.h>
     #include <Utility/UniqueRef.h>
     #include <cstdint>
+    #include <functional>
     #include <vector>
 
 namespace arm_emu {
@@ -31,6 +33,7 @@ namespace arm_emu {
             bool                                         GetZ() const noexcept;
             bool                                         GetC() const noexcept;
             bool                                         GetV() const noexcept;
+            ProgramFault                                 GetFault() const noexcept; // None unless Interrupted by it
             const std::pmr::vector< IMemory::DataUnit >& GetProcessMemory() const noexcept;
 
             class Impl;
@@ -41,6 +44,9 @@ namespace arm_emu {
             UniqueRef< Impl > m_frame;
         };
 
+        /// @brief Called once the program is done, with its final state, either Ready or Interrupted
+        using ReadyCallback = std::function< void(State) >;
+
         IResult()                   = default;
         IResult(IResult&&) noexcept = default;
         IResult& operator=(IResult&&) noexcept = default;
@@ -56,6 +62,11 @@ namespace arm_emu {
         virtual void        WaitReady()                        = 0;
         virtual void        WaitForState(IResult::State state) = 0;
         virtual bool        CanStepIn() const noexcept         = 0;
+
+        /// @brief Registers a callback instead of blocking in WaitReady, called right away when the program is done
+        /// @note The callback runs on the thread of the processing unit that ran the program, it must not throw nor
+        /// block on other results, it typically hands the completion over to the caller's own event loop
+        virtual void OnReady(ReadyCallback callback) = 0;
     };
 
 } // namespace arm_emu
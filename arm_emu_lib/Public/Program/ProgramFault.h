@@ -0,0 +1,33 @@
+#if !defined(PROGRAMFAULT_H_INCLUDED_5CF6E425_1FA2_46ED_A2C2_FF3127E5BDAE)
+    #define PROGRAMFAULT_H_INCLUDED_5CF6E425_1FA2_46ED_A2C2_FF3127E5BDAE
+
+    #include <API/Api.h>
+    #include <cstdint>
+
+namespace arm_emu {
+
+    /// @brief Why a program stopped at an instruction, a faulting program ends in the Interrupted state
+    enum class ProgramFault : std::uint32_t
+    {
+        None, /* Execution can continue */
+
+        UndefinedInstruction, /* Instruction encoding is unallocated */
+
+        UndefinedBehaviour, /* Instruction hit a constrained unpredictable or reserved case */
+
+        UndefinedRegisterAccess, /* Register is in an undefined state */
+
+        UnsupportedInstruction, /* Instruction depends on an unsupported feature */
+
+        NotImplementedFeature, /* Instruction or feature is not implemented by the emulator */
+
+        InvalidPhysicalMemoryAccess, /* Memory access outside of the program address space */
+
+        UntrackedProcessingUnit, /* Processing unit is not tracked by the MMU */
+
+        TranslationFault, /* Virtual address is not mapped by the stage 1 translation tables */
+    };
+
+} // namespace arm_emu
+
+#endif // !defined(PROGRAMFAULT_H_INCLUDED_5CF6E425_1FA2_46ED_A2C2_FF3127E5BDAE)
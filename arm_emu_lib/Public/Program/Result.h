@@ -25,6 +25,7 @@ namespace arm_emu {
         void                 WaitReady() final;
         void                 WaitForState(IResult::State state) final;
         bool                 CanStepIn() const noexcept final;
+        void                 OnReady(ReadyCallback callback) final;
 
       private:
         class Impl;
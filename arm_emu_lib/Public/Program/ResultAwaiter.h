@@ -0,0 +1,52 @@
+#if !defined(RESULTAWAITER_H_INCLUDED_4442F9A6_2A76_45B6_BF1C_EE206EBCBCEF)
+    #define RESULTAWAITER_H_INCLUDED_4442F9A6_2A76_45B6_BF1C_EE206EBCBCEF
+
+    #include <API/Api.h>
+    #include <Program/IResult.h>
+    #include <atomic>
+    #include <coroutine>
+
+namespace arm_emu {
+
+    /// <summary>
+    /// Lets a coroutine co_await a Result or a ControlledResult, it is resumed with the final frame of the program.
+    /// The coroutine resumes on the thread of the processing unit that ran the program, see IResult::OnReady.
+    /// </summary>
+    class [[nodiscard]] ResultAwaiter {
+      public:
+        explicit ResultAwaiter(IResult& result) noexcept : m_result(result), m_isResumeClaimed(false) {
+        }
+
+        ResultAwaiter(const ResultAwaiter&) = delete;
+        ResultAwaiter& operator=(const ResultAwaiter&) = delete;
+
+        bool await_ready() const noexcept {
+            return m_result.IsReady();
+        }
+
+        bool await_suspend(std::coroutine_handle<> coroutine) {
+            // The callback may run before OnReady returns, whichever of the two comes last resumes the coroutine
+            m_result.OnReady([this, coroutine](IResult::State) {
+                if (m_isResumeClaimed.exchange(true, std::memory_order_acq_rel)) {
+                    coroutine.resume();
+                }
+            });
+            return !m_isResumeClaimed.exchange(true, std::memory_order_acq_rel);
+        }
+
+        IResult::ResultFrame await_resume() const {
+            return m_result.GetResultFrame();
+        }
+
+      private:
+        IResult&            m_result;
+        std::atomic< bool > m_isResumeClaimed;
+    };
+
+    [[nodiscard]] inline ResultAwaiter operator co_await(IResult& result) noexcept {
+        return ResultAwaiter { result };
+    }
+
+} // namespace arm_emu
+
+#endif // !defined(RESULTAWAITER_H_INCLUDED_4442F9A6_2A76_45B6_BF1C_EE206EBCBCEF)
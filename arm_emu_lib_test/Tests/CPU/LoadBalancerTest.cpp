@@ -0,0 +1,66 @@
+#include <Tests/CPU/LoadBalancerTest.h>
+
+BEGIN_NAMESPACE
+
+namespace test {
+
+    LoadBalancerTest::LoadBalancerTest() : m_loads() {
+    }
+
+    LoadBalancerTest::~LoadBalancerTest() = default;
+
+    std::size_t LoadBalancerTest::Select(LoadBalancer& loadBalancer) {
+        return loadBalancer.Select(m_loads.size(), [this](std::size_t unit) { return m_loads.at(unit); });
+    }
+
+    void LoadBalancerTest::CheckLeastLoadedSelection() {
+        LoadBalancer loadBalancer { LoadBalancingPolicy::LeastLoaded };
+
+        // Two cores with two threads each, the first thread of the first core is busy
+        m_loads = { { 1, 1 }, { 0, 1 }, { 0, 0 }, { 0, 0 } };
+        ASSERT_EQ(Select(loadBalancer), 2);
+
+        // An idle thread on a busy core beats a busy one
+        m_loads = { { 2, 3 }, { 1, 3 }, { 1, 2 }, { 1, 2 } };
+        ASSERT_EQ(Select(loadBalancer), 2);
+
+        // Equal loads keep the first unit
+        m_loads = { { 1, 2 }, { 1, 2 }, { 1, 2 }, { 1, 2 } };
+        ASSERT_EQ(Select(loadBalancer), 0);
+
+        m_loads = { { 3, 3 }, { 3, 3 }, { 0, 0 } };
+        ASSERT_EQ(Select(loadBalancer), 2);
+    }
+
+    void LoadBalancerTest::CheckRoundRobinSelection() {
+        LoadBalancer loadBalancer { LoadBalancingPolicy::RoundRobin };
+
+        m_loads = { { 0, 0 }, { 5, 5 }, { 0, 0 } };
+        for (std::size_t i = 0; i < 2 * m_loads.size(); ++i) {
+            ASSERT_EQ(Select(loadBalancer), i % m_loads.size());
+        }
+    }
+
+    void LoadBalancerTest::CheckFirstProcessingUnitSelection() {
+        LoadBalancer loadBalancer { LoadBalancingPolicy::FirstProcessingUnit };
+
+        m_loads = { { 4, 4 }, { 0, 0 } };
+        ASSERT_EQ(Select(loadBalancer), 0);
+        ASSERT_EQ(Select(loadBalancer), 0);
+    }
+
+    TEST_F(LoadBalancerTest, LeastLoadedSelection) {
+        CheckLeastLoadedSelection();
+    }
+
+    TEST_F(LoadBalancerTest, RoundRobinSelection) {
+        CheckRoundRobinSelection();
+    }
+
+    TEST_F(LoadBalancerTest, FirstProcessingUnitSelection) {
+        CheckFirstProcessingUnitSelection();
+    }
+
+} // namespace test
+
+END_NAMESPACE
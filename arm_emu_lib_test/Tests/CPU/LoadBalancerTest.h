@@ -0,0 +1,32 @@
+#if !defined(LOADBALANCERTEST_H_INCLUDED_F715789D_FA4F_43BA_9449_C3921BCF4188)
+    #define LOADBALANCERTEST_H_INCLUDED_F715789D_FA4F_43BA_9449_C3921BCF4188
+
+    #include <GTest/gtest.h>
+
+    #include <API/Api.h>
+    #include <CPU/LoadBalancer.h>
+    #include <vector>
+
+BEGIN_NAMESPACE
+
+namespace test {
+
+    class LoadBalancerTest : public ::testing::Test {
+      protected:
+        LoadBalancerTest();
+        ~LoadBalancerTest();
+
+        void CheckLeastLoadedSelection();
+        void CheckRoundRobinSelection();
+        void CheckFirstProcessingUnitSelection();
+
+        [[nodiscard]] std::size_t Select(LoadBalancer& loadBalancer);
+
+        std::vector< LoadBalancer::UnitLoad > m_loads;
+    };
+
+} // namespace test
+
+END_NAMESPACE
+
+#endif // !defined(LOADBALANCERTEST_H_INCLUDED_F715789D_FA4F_43BA_9449_C3921BCF4188)
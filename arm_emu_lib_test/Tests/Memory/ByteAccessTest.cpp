@@ -0,0 +1,75 @@
+#include <Memory/CacheMemory.h>
+#include <Memory/FlatMemory.h>
+#include <Memory/RandomAccessMemory.h>
+#include <Tests/Memory/ByteAccessTest.h>
+
+BEGIN_NAMESPACE
+
+namespace test {
+
+    ByteAccessTest::ByteAccessTest() = default;
+
+    ByteAccessTest::~ByteAccessTest() = default;
+
+    void ByteAccessTest::CheckAccessWidths(IMemory& memory) {
+        memory.Write< std::uint64_t >(0, 0x0807060504030201);
+        memory.Write< IMemory::Quadword >(16, { 0x1716151413121110, 0x1F1E1D1C1B1A1918 });
+
+        // Data units hold their bytes in little endian order
+        ASSERT_EQ(memory.Read(0), 0x04030201u);
+        ASSERT_EQ(memory.Read(1), 0x08070605u);
+
+        ASSERT_EQ(memory.Read< std::uint8_t >(3), 0x04u);
+        ASSERT_EQ(memory.Read< std::uint16_t >(2), 0x0403u);
+        ASSERT_EQ(memory.Read< std::uint32_t >(4), 0x08070605u);
+        ASSERT_EQ(memory.Read< std::uint64_t >(16), 0x1716151413121110u);
+
+        const auto quadword = memory.Read< IMemory::Quadword >(16);
+        ASSERT_EQ(quadword.m_low, 0x1716151413121110u);
+        ASSERT_EQ(quadword.m_high, 0x1F1E1D1C1B1A1918u);
+
+        // Narrow writes keep the neighbouring bytes of the data unit
+        memory.Write< std::uint8_t >(1, 0xAA);
+        memory.Write< std::uint16_t >(6, 0xBBCC);
+        ASSERT_EQ(memory.Read< std::uint64_t >(0), 0xBBCC06050403AA01u);
+    }
+
+    void ByteAccessTest::CheckUnalignedAccesses(IMemory& memory) {
+        // Crosses a data unit boundary
+        memory.Write< std::uint32_t >(6, 0xDDCCBBAA);
+        ASSERT_EQ(memory.Read< std::uint32_t >(6), 0xDDCCBBAAu);
+        ASSERT_EQ(memory.Read< std::uint16_t >(8), 0xDDCCu);
+
+        // Crosses a cache line boundary
+        constexpr auto lineBytes = ICacheMemory::Cache_line_size * sizeof(IMemory::DataUnit);
+        memory.Write< std::uint64_t >(lineBytes - 3, 0x1122334455667788);
+        ASSERT_EQ(memory.Read< std::uint64_t >(lineBytes - 3), 0x1122334455667788u);
+        ASSERT_EQ(memory.Read< std::uint8_t >(lineBytes), 0x55u);
+    }
+
+    TEST_F(ByteAccessTest, RandomAccessMemory) {
+        RandomAccessMemory memory {};
+        CheckAccessWidths(memory);
+        CheckUnalignedAccesses(memory);
+    }
+
+    TEST_F(ByteAccessTest, FlatMemory) {
+        FlatMemory memory { 1_KB };
+        CheckAccessWidths(memory);
+        CheckUnalignedAccesses(memory);
+    }
+
+    TEST_F(ByteAccessTest, CacheMemory) {
+        RandomAccessMemory ram {};
+        CacheMemory        cache { { CacheWriteStrategy::WriteThrough, CacheMemoryMapping::DirectMapping }, &ram, 1_KB };
+        CheckAccessWidths(cache);
+        CheckUnalignedAccesses(cache);
+
+        // Write through keeps the upstream memory in sync
+        const IMemory& upStream = ram;
+        ASSERT_EQ(upStream.Read< std::uint64_t >(0), 0xBBAA06050403AA01u);
+    }
+
+} // namespace test
+
+END_NAMESPACE
@@ -0,0 +1,26 @@
+#if !defined(BYTEACCESSTEST_H_INCLUDED_E224F44F_75CF_497E_AF9E_D46A3D709E12)
+    #define BYTEACCESSTEST_H_INCLUDED_E224F44F_75CF_497E_AF9E_D46A3D709E12
+
+    #include <GTest/gtest.h>
+
+    #include <API/Api.h>
+    #include <Memory/IMemory.h>
+
+BEGIN_NAMESPACE
+
+namespace test {
+
+    class ByteAccessTest : public ::testing::Test {
+      protected:
+        ByteAccessTest();
+        ~ByteAccessTest();
+
+        void CheckAccessWidths(IMemory& memory);
+        void CheckUnalignedAccesses(IMemory& memory);
+    };
+
+} // namespace test
+
+END_NAMESPACE
+
+#endif // !defined(BYTEACCESSTEST_H_INCLUDED_E224F44F_75CF_497E_AF9E_D46A3D709E12)
@@ -0,0 +1,267 @@
+#include <Memory/CacheCoherenceDomain.h>
+#include <Memory/MemoryWatcher.h>
+#include <Tests/Memory/CacheMemoryTest.h>
+#include <thread>
+#include <vector>
+
+BEGIN_NAMESPACE
+
+namespace test {
+
+    CacheMemoryTest::CacheMemoryTest() : m_ram() {
+        for (IMemory::Address address = 0; address < 4_KB; ++address) {
+            m_ram.Write(address, static_cast< IMemory::DataUnit >(address));
+        }
+    }
+
+    CacheMemoryTest::~CacheMemoryTest() = default;
+
+    std::size_t CacheMemoryTest::PingPong(CacheMemory& cache, std::size_t rounds) {
+        const auto conflictingAddress = cache.Size();
+        for (std::size_t round = 0; round < rounds; ++round) {
+            EXPECT_EQ(cache.Read(1), 1u);
+            EXPECT_EQ(cache.Read(conflictingAddress + 1), conflictingAddress + 1);
+        }
+        return cache.GetMemoryWatcher().GetMissCount();
+    }
+
+    TEST_F(CacheMemoryTest, DirectMappingThrashes) {
+        CacheMemory cache { { CacheWriteStrategy::WriteThrough, CacheMemoryMapping::DirectMapping }, &m_ram, 1_KB };
+        ASSERT_EQ(PingPong(cache, 8), 16u);
+    }
+
+    TEST_F(CacheMemoryTest, SetAssociativeKeepsConflictingLines) {
+        for (const auto policy : { CacheReplacementPolicy::LeastRecentlyUsed,
+                                   CacheReplacementPolicy::PseudoLeastRecentlyUsed, CacheReplacementPolicy::Random }) {
+            CacheMemory cache { { CacheWriteStrategy::WriteThrough, CacheMemoryMapping::SetAssociative, policy, 2 },
+                                &m_ram,
+                                1_KB };
+            ASSERT_EQ(PingPong(cache, 8), 2u);
+        }
+    }
+
+    TEST_F(CacheMemoryTest, LeastRecentlyUsedEviction) {
+        constexpr auto line = ICacheMemory::Cache_line_size;
+        CacheMemory    cache { { CacheWriteStrategy::WriteThrough, CacheMemoryMapping::FullyAssociative,
+                                 CacheReplacementPolicy::LeastRecentlyUsed },
+                            &m_ram,
+                            2 * line };
+
+        (void)cache.Read(0);
+        (void)cache.Read(line);
+        (void)cache.Read(0);
+        // Evicts the line at address line, the least recently used one
+        (void)cache.Read(2 * line);
+        ASSERT_EQ(cache.GetMemoryWatcher().GetMissCount(), 3u);
+        ASSERT_EQ(cache.Read(0), 0u);
+        ASSERT_EQ(cache.GetMemoryWatcher().GetMissCount(), 3u);
+        ASSERT_EQ(cache.Read(line), line);
+        ASSERT_EQ(cache.GetMemoryWatcher().GetMissCount(), 4u);
+    }
+
+    TEST_F(CacheMemoryTest, SetAssociativeWriteThrough) {
+        CacheMemory cache { { CacheWriteStrategy::WriteThrough, CacheMemoryMapping::SetAssociative,
+                              CacheReplacementPolicy::PseudoLeastRecentlyUsed, 4 },
+                            &m_ram,
+                            1_KB };
+
+        (void)cache.Read(5);
+        cache.Write(5, 0xCAFE);
+        cache.Write(2_KB, 0xBEEF);
+        ASSERT_EQ(cache.Read(5), 0xCAFEu);
+        ASSERT_EQ(cache.Read(2_KB), 0xBEEFu);
+
+        const IMemory& upStream = m_ram;
+        ASSERT_EQ(upStream.Read(5), 0xCAFEu);
+        ASSERT_EQ(upStream.Read(2_KB), 0xBEEFu);
+    }
+
+    TEST_F(CacheMemoryTest, WriteBackDefersUpstreamWrites) {
+        for (const auto mapping : { CacheMemoryMapping::DirectMapping, CacheMemoryMapping::SetAssociative }) {
+            CacheMemory    cache { { CacheWriteStrategy::WriteBack, mapping, CacheReplacementPolicy::LeastRecentlyUsed,
+                                     1 },
+                                &m_ram,
+                                1_KB };
+            const IMemory& upStream = m_ram;
+            m_ram.Write(5, 5);
+
+            cache.Write(5, 0xCAFE);
+            ASSERT_EQ(cache.Read(5), 0xCAFEu);
+            ASSERT_EQ(upStream.Read(5), 5u);
+
+            // Evicting the dirty line writes it back
+            (void)cache.Read(1_KB + 5);
+            ASSERT_EQ(upStream.Read(5), 0xCAFEu);
+
+            cache.Write(1_KB + 6, 0xBEEF);
+            cache.FlushCache();
+            ASSERT_EQ(upStream.Read(1_KB + 6), 0xBEEFu);
+
+            // Flushed lines stay cached
+            ASSERT_EQ(cache.Read(1_KB + 6), 0xBEEFu);
+            ASSERT_EQ(cache.GetMemoryWatcher().GetMissCount(), 2u);
+
+            cache.Write(7, 0xF00D);
+            cache.ClearCache();
+            ASSERT_EQ(upStream.Read(7), 0xF00Du);
+        }
+    }
+
+    TEST_F(CacheMemoryTest, BlocksSpanningCacheLines) {
+        for (const auto strategy : { CacheWriteStrategy::WriteThrough, CacheWriteStrategy::WriteBack }) {
+            for (const auto mapping : { CacheMemoryMapping::DirectMapping, CacheMemoryMapping::SetAssociative }) {
+                RandomAccessMemory ram {};
+                ram.WriteBlock(0, m_ram.ReadBlock(0, 1_KB));
+                CacheMemory cache { { strategy, mapping, CacheReplacementPolicy::LeastRecentlyUsed, 2 }, &ram, 1_KB };
+
+                const auto block = cache.ReadBlock(10, 200);
+                ASSERT_EQ(block.Size(), 200u);
+                for (std::size_t idx = 0; idx < block.Size(); ++idx) {
+                    ASSERT_EQ(block.Data()[idx], 10 + idx);
+                }
+
+                cache.WriteBlock(60, DataBlock< IMemory::DataUnit >(100, 0xAB));
+                const auto written = cache.ReadBlock(59, 102);
+                ASSERT_EQ(written.Data()[0], 59u);
+                ASSERT_EQ(written.Data()[1], 0xABu);
+                ASSERT_EQ(written.Data()[100], 0xABu);
+                ASSERT_EQ(written.Data()[101], 160u);
+
+                cache.FlushCache();
+                const IMemory& upStream = ram;
+                ASSERT_EQ(upStream.Read(60), 0xABu);
+                ASSERT_EQ(upStream.Read(159), 0xABu);
+            }
+        }
+    }
+
+    TEST_F(CacheMemoryTest, MissingLinesAreFetchedTogether) {
+        CacheMemory cache { { CacheWriteStrategy::WriteBack, CacheMemoryMapping::SetAssociative }, &m_ram, 1_KB };
+
+        (void)cache.ReadBlock(0, 4 * ICacheMemory::Cache_line_size);
+        ASSERT_EQ(cache.GetMemoryWatcher().GetMissCount(), 4u);
+        ASSERT_EQ(m_ram.GetMemoryWatcher().GetReadBlockCount(), 1u);
+
+        (void)cache.ReadBlock(0, 4 * ICacheMemory::Cache_line_size);
+        ASSERT_EQ(cache.GetMemoryWatcher().GetHitCount(), 4u);
+        ASSERT_EQ(m_ram.GetMemoryWatcher().GetReadBlockCount(), 1u);
+    }
+
+    TEST_F(CacheMemoryTest, ViewsBorrowContiguousStorage) {
+        CacheMemory cache { { CacheWriteStrategy::WriteBack, CacheMemoryMapping::SetAssociative }, &m_ram, 1_KB };
+
+        // A memory allocated up to its full size lends its storage out
+        RandomAccessMemory smallRam { "SmallRam", 1_KB };
+        smallRam.Write(100, 100);
+        const auto ramView = smallRam.ViewBlock(100, 50);
+        ASSERT_FALSE(ramView.IsOwning());
+        ASSERT_EQ(ramView.At(0), 100u);
+
+        // A block within one cache line is viewed in place, a longer one is copied
+        const auto lineView = cache.ViewBlock(ICacheMemory::Cache_line_size + 2, 10);
+        ASSERT_FALSE(lineView.IsOwning());
+        ASSERT_EQ(lineView.At(9), ICacheMemory::Cache_line_size + 11);
+
+        const auto blockView = cache.ViewBlock(10, 2 * ICacheMemory::Cache_line_size);
+        ASSERT_TRUE(blockView.IsOwning());
+        ASSERT_EQ(blockView.Size(), 2 * ICacheMemory::Cache_line_size);
+        ASSERT_EQ(blockView.At(0), 10u);
+
+        const std::array< IMemory::DataUnit, 3 > data { 7, 8, 9 };
+        cache.WriteBlock(ICacheMemory::Cache_line_size - 1, std::span< const IMemory::DataUnit > { data });
+
+        std::array< IMemory::DataUnit, 3 > readBack {};
+        cache.ReadBlock(ICacheMemory::Cache_line_size - 1, std::span< IMemory::DataUnit > { readBack });
+        ASSERT_EQ(readBack, data);
+    }
+
+    TEST_F(CacheMemoryTest, ViewsOfGrowingMemoryAreCopied) {
+        RandomAccessMemory ram { "GrowingRam", 1_MB };
+        ram.Write(10, 42);
+
+        // The storage may still move while it grows, views own a copy until then
+        auto view = ram.ViewBlock(8, 4);
+        ASSERT_TRUE(view.IsOwning());
+
+        const auto movedView = std::move(view);
+        ASSERT_TRUE(movedView.IsOwning());
+        ASSERT_EQ(movedView.Size(), 4u);
+        ASSERT_EQ(movedView.At(2), 42u);
+
+        // Data units past the allocated part of the memory read as empty
+        std::array< IMemory::DataUnit, 3 > readBack { 1, 2, 3 };
+        ram.ReadBlock(1_MB - 3, std::span< IMemory::DataUnit > { readBack });
+        ASSERT_EQ(readBack, (std::array< IMemory::DataUnit, 3 > {}));
+
+        ram.Write(1_MB - 1, 7);
+        const auto grownView = ram.ViewBlock(1_MB - 2, 2);
+        ASSERT_FALSE(grownView.IsOwning());
+        ASSERT_EQ(grownView.At(1), 7u);
+    }
+
+    TEST_F(CacheMemoryTest, SharedCacheSupportsConcurrentAccesses) {
+        constexpr std::size_t       Thread_count = 4;
+        constexpr IMemory::Address Range_size   = 1_KB;
+
+        // Ranges of all threads conflict in the sets of the cache, every access races for them
+        CacheMemory cache { { CacheWriteStrategy::WriteBack, CacheMemoryMapping::SetAssociative,
+                              CacheReplacementPolicy::LeastRecentlyUsed, 2, true },
+                            &m_ram,
+                            Range_size / 4 };
+
+        std::vector< std::thread > threads {};
+        std::vector< std::size_t > mismatches(Thread_count, 0);
+        for (std::size_t threadIdx = 0; threadIdx < Thread_count; ++threadIdx) {
+            threads.emplace_back([&, threadIdx]() {
+                const auto rangeStart = threadIdx * Range_size;
+                for (auto address = rangeStart; address < rangeStart + Range_size; ++address) {
+                    cache.Write(address, static_cast< IMemory::DataUnit >(2 * address));
+                }
+                for (auto address = rangeStart; address < rangeStart + Range_size; ++address) {
+                    mismatches[threadIdx] += cache.Read(address) != 2 * address;
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        cache.FlushCache();
+
+        ASSERT_EQ(mismatches, std::vector< std::size_t >(Thread_count, 0));
+        ASSERT_EQ(cache.GetMemoryWatcher().GetHitCount() + cache.GetMemoryWatcher().GetMissCount(),
+                  2 * Thread_count * Range_size);
+        for (IMemory::Address address = 0; address < Thread_count * Range_size; ++address) {
+            ASSERT_EQ(m_ram.Read(address), 2 * address);
+        }
+    }
+
+    TEST_F(CacheMemoryTest, CoherentCachesSeeSiblingWrites) {
+        for (const auto strategy : { CacheWriteStrategy::WriteBack, CacheWriteStrategy::WriteThrough }) {
+            CacheMemory l2 { { CacheWriteStrategy::WriteBack, CacheMemoryMapping::SetAssociative }, &m_ram, 2_KB };
+
+            CacheCoherenceDomain domain {};
+            CacheMemory::Config  l1Config { strategy, CacheMemoryMapping::DirectMapping };
+            l1Config.m_coherenceDomain = &domain;
+            CacheMemory l1First { l1Config, &l2, 1_KB };
+            CacheMemory l1Second { l1Config, &l2, 1_KB };
+
+            // A read miss downgrades the exclusive copy of the sibling
+            ASSERT_EQ(l1First.Read(10), 10u);
+            ASSERT_EQ(l1Second.Read(10), 10u);
+            ASSERT_EQ(l1First.GetMemoryWatcher().GetDowngradeCount(), 1u);
+
+            // A write drops the copies of the siblings, which then read the written value
+            l1First.Write(10, 42);
+            ASSERT_EQ(l1Second.GetMemoryWatcher().GetInvalidationCount(), 1u);
+            ASSERT_EQ(l1Second.Read(10), 42u);
+
+            const auto expectedWriteBacks = strategy == CacheWriteStrategy::WriteBack ? 1u : 0u;
+            ASSERT_EQ(l1First.GetMemoryWatcher().GetSnoopWriteBackCount(), expectedWriteBacks);
+            ASSERT_EQ(domain.GetReadBroadcastCount(), 3u);
+            ASSERT_EQ(domain.GetInvalidateBroadcastCount(), 1u);
+        }
+    }
+
+} // namespace test
+
+END_NAMESPACE
@@ -0,0 +1,29 @@
+#if !defined(CACHEMEMORYTEST_H_INCLUDED_72D6A1F1_834E_4CAA_9A54_13A2BF8CB741)
+    #define CACHEMEMORYTEST_H_INCLUDED_72D6A1F1_834E_4CAA_9A54_13A2BF8CB741
+
+    #include <GTest/gtest.h>
+
+    #include <API/Api.h>
+    #include <Memory/CacheMemory.h>
+    #include <Memory/RandomAccessMemory.h>
+
+BEGIN_NAMESPACE
+
+namespace test {
+
+    class CacheMemoryTest : public ::testing::Test {
+      protected:
+        CacheMemoryTest();
+        ~CacheMemoryTest();
+
+        // Alternates between two lines mapped to the same set of a cache of given size, returns the miss count
+        std::size_t PingPong(CacheMemory& cache, std::size_t rounds);
+
+        RandomAccessMemory m_ram;
+    };
+
+} // namespace test
+
+END_NAMESPACE
+
+#endif // !defined(CACHEMEMORYTEST_H_INCLUDED_72D6A1F1_834E_4CAA_9A54_13A2BF8CB741)
@@ -0,0 +1,200 @@
+#include <Memory/MemoryManagementUnitProxy.h>
+#include <Tests/Memory/MemoryManagementUnitTest.h>
+
+BEGIN_NAMESPACE
+
+namespace test {
+
+    namespace {
+        constexpr std::uint64_t Table       = 0b11; // Valid table descriptor at levels 0 - 2, page at level 3
+        constexpr std::uint64_t Block       = 0b01; // Valid block descriptor at levels 1 - 2
+        constexpr std::uint64_t Level1Table = 0x1000;
+        constexpr std::uint64_t Level2Table = 0x2000;
+        constexpr std::uint64_t Level3Table = 0x3000;
+        constexpr std::uint64_t Level0Table = 0x4000;
+
+        constexpr IMemory::Address ToUnits(std::uint64_t byteAddress) noexcept {
+            return byteAddress / sizeof(IMemory::DataUnit);
+        }
+    } // namespace
+
+    MemoryManagementUnitTest::MemoryManagementUnitTest() :
+        m_ram("Ram", 4_MB),
+        m_mmu(std::allocate_shared< MemoryManagementUnit >(std::pmr::polymorphic_allocator< MemoryManagementUnit > {})),
+        m_registers(),
+        m_walkCache() {
+        m_mmu->SetPhysicalMemory(&m_ram, 0, 0);
+
+        // 39 bit address space walked from level 1:
+        //   [0, 2 MiB)            2 MiB block at 2 MiB
+        //   [2 MiB, 4 MiB)        level 3 table holding a block encoding
+        //   [4 MiB, 6 MiB)        invalid
+        //   [6 MiB, 8 MiB)        2 MiB block past the end of the physical memory
+        //   [1 GiB, 2 GiB)        1 GiB block at 0
+        WriteDescriptor(Level1Table, 0, Level2Table | Table);
+        WriteDescriptor(Level1Table, 1, 0x0000'0000 | Block);
+        WriteDescriptor(Level2Table, 0, 0x0020'0000 | Block);
+        WriteDescriptor(Level2Table, 1, Level3Table | Table);
+        WriteDescriptor(Level2Table, 3, 0x4000'0000 | Block);
+        WriteDescriptor(Level3Table, 0, 0x0000'8000 | Block);
+
+        // Blocks are reserved at level 0
+        WriteDescriptor(Level0Table, 0, 0x0000'0000 | Block);
+    }
+
+    MemoryManagementUnitTest::~MemoryManagementUnitTest() = default;
+
+    void MemoryManagementUnitTest::WriteDescriptor(std::uint64_t tableAddress, std::uint64_t index,
+                                                   std::uint64_t descriptor) {
+        IMemory& memory = m_ram;
+        memory.Write< std::uint64_t >(tableAddress + index * sizeof(std::uint64_t), descriptor);
+    }
+
+    void MemoryManagementUnitTest::SetTranslation(std::uint64_t tableAddress, std::uint64_t t0sz) {
+        m_registers.m_TTBR0_EL1 = tableAddress;
+        m_registers.m_TCR_EL1   = t0sz;
+        m_registers.m_SCTLR_EL1 = 0b1;
+        m_walkCache.Flush();
+    }
+
+    PageTranslation MemoryManagementUnitTest::Walk(std::uint64_t virtualByteAddress) {
+        return m_mmu->LookupPage(this, ToUnits(virtualByteAddress), m_registers, m_walkCache);
+    }
+
+    TEST_F(MemoryManagementUnitTest, BlockDescriptors) {
+        SetTranslation(Level1Table, MemoryManagementUnit::Demand_paged_T0SZ);
+
+        // The page of the block holding the virtual address is picked
+        auto page = Walk(0x5123);
+        ASSERT_EQ(page.m_fault, TranslationFault::None);
+        ASSERT_EQ(page.m_physicalAddress, ToUnits(0x20'5000));
+        ASSERT_EQ(page.m_unitCount, MemoryManagementUnit::Page_size);
+
+        page = Walk(0x4000'3000);
+        ASSERT_EQ(page.m_fault, TranslationFault::None);
+        ASSERT_EQ(page.m_physicalAddress, ToUnits(0x3000));
+
+        ASSERT_EQ(Walk(0x20'0000).m_fault, TranslationFault::UnmappedVirtualAddress);
+        ASSERT_EQ(Walk(0x40'0000).m_fault, TranslationFault::UnmappedVirtualAddress);
+        ASSERT_EQ(Walk(0x60'0000).m_fault, TranslationFault::InvalidPhysicalMemoryAccess);
+
+        SetTranslation(Level0Table, 16);
+        ASSERT_EQ(Walk(0x1000).m_fault, TranslationFault::UnmappedVirtualAddress);
+    }
+
+    TEST_F(MemoryManagementUnitTest, T0SZLimits) {
+        SetTranslation(Level1Table, MemoryManagementUnit::Demand_paged_T0SZ);
+        ASSERT_EQ(Walk(0x4000'3000).m_fault, TranslationFault::None);
+        ASSERT_EQ(Walk(std::uint64_t { 1 } << 39).m_fault, TranslationFault::UnmappedVirtualAddress);
+
+        // A 25 bit address space starts the walk at level 2
+        SetTranslation(Level2Table, 39);
+        ASSERT_EQ(Walk(0x5000).m_physicalAddress, ToUnits(0x20'5000));
+        ASSERT_EQ(Walk(std::uint64_t { 1 } << 25).m_fault, TranslationFault::UnmappedVirtualAddress);
+
+        // Sizes outside of [16, 39] are not valid for a 4 KiB granule
+        SetTranslation(Level2Table, 40);
+        ASSERT_EQ(Walk(0x5000).m_fault, TranslationFault::UnmappedVirtualAddress);
+        SetTranslation(Level0Table, 15);
+        ASSERT_EQ(Walk(0x1000).m_fault, TranslationFault::UnmappedVirtualAddress);
+    }
+
+    TEST_F(MemoryManagementUnitTest, CrossPageAccesses) {
+        m_mmu->SetPhysicalMemory(&m_ram, 3_MB, 4_MB);
+        m_mmu->AddDemandPagedProcess(this, 4 * MemoryManagementUnit::Page_size);
+
+        MemoryManagementUnitProxy proxy { m_mmu };
+        proxy.Attach(this);
+        ASSERT_TRUE(proxy.SetupTranslationRegisters(m_registers));
+        proxy.AttachRegisters(&m_registers);
+
+        // Touching the second page first puts the frames of the two pages in reverse order
+        const auto second = proxy.TryTranslate(MemoryManagementUnit::Page_size);
+        const auto first  = proxy.TryTranslate(0);
+        ASSERT_EQ(second.m_fault, TranslationFault::None);
+        ASSERT_EQ(first.m_fault, TranslationFault::None);
+        ASSERT_NE(first.m_physicalAddress + MemoryManagementUnit::Page_size, second.m_physicalAddress);
+
+        // Each page of an access crossing them is translated on its own
+        constexpr auto lastUnit = MemoryManagementUnit::Page_size - 1;
+        ASSERT_EQ(proxy.TryTranslate(lastUnit, 2).m_fault, TranslationFault::InvalidPhysicalMemoryAccess);
+        ASSERT_EQ(proxy.TryTranslate(lastUnit).m_physicalAddress, first.m_physicalAddress + lastUnit);
+        ASSERT_EQ(proxy.TryTranslate(lastUnit + 1).m_physicalAddress, second.m_physicalAddress);
+    }
+
+    TEST_F(MemoryManagementUnitTest, TlbHitSkipsWalk) {
+        SetTranslation(Level1Table, MemoryManagementUnit::Demand_paged_T0SZ);
+
+        MemoryManagementUnitProxy proxy { m_mmu };
+        proxy.Attach(this);
+        proxy.AttachRegisters(&m_registers);
+        ASSERT_EQ(proxy.TryTranslate(ToUnits(0x5000)).m_physicalAddress, ToUnits(0x20'5000));
+
+        // Tables are not snooped, the cached translation is used until the TLB is flushed
+        WriteDescriptor(Level2Table, 0, 0x0000'0000 | Block);
+        ASSERT_EQ(proxy.TryTranslate(ToUnits(0x5000)).m_physicalAddress, ToUnits(0x20'5000));
+        ASSERT_EQ(proxy.TryTranslate(ToUnits(0x5FFC)).m_physicalAddress, ToUnits(0x20'5FFC));
+
+        proxy.FlushTlb();
+        ASSERT_EQ(proxy.TryTranslate(ToUnits(0x5000)).m_physicalAddress, ToUnits(0x5000));
+    }
+
+    TEST_F(MemoryManagementUnitTest, TlbGenerationInvalidatesEntries) {
+        SetTranslation(Level1Table, MemoryManagementUnit::Demand_paged_T0SZ);
+
+        MemoryManagementUnitProxy proxy { m_mmu };
+        proxy.Attach(this);
+        proxy.AttachRegisters(&m_registers);
+        ASSERT_EQ(proxy.TryTranslate(ToUnits(0x5000)).m_physicalAddress, ToUnits(0x20'5000));
+
+        // Any mapping change of the MMU makes the cached translations of every proxy stale
+        WriteDescriptor(Level2Table, 0, 0x0000'0000 | Block);
+        m_mmu->AddProcess(&m_registers, 0, MemoryManagementUnit::Page_size);
+        ASSERT_EQ(proxy.TryTranslate(ToUnits(0x5000)).m_physicalAddress, ToUnits(0x5000));
+    }
+
+    TEST_F(MemoryManagementUnitTest, TlbFlushOnTranslationRegisterWrite) {
+        MemoryManagementUnitProxy proxy { m_mmu };
+        proxy.Attach(this);
+        proxy.AttachRegisters(&m_registers);
+
+        // Replays the register write and flush of an MSR to TTBR0_EL1, TCR_EL1 and SCTLR_EL1
+        const auto checkWrite = [&](std::uint64_t& sysRegister, std::uint64_t value, TranslationFault fault,
+                                    IMemory::Address physicalAddress) {
+            SetTranslation(Level1Table, MemoryManagementUnit::Demand_paged_T0SZ);
+            proxy.FlushTlb();
+            ASSERT_EQ(proxy.TryTranslate(ToUnits(0x5000)).m_physicalAddress, ToUnits(0x20'5000));
+
+            sysRegister = value;
+            proxy.FlushTlb();
+
+            const auto translation = proxy.TryTranslate(ToUnits(0x5000));
+            ASSERT_EQ(translation.m_fault, fault);
+            ASSERT_EQ(translation.m_physicalAddress, physicalAddress);
+        };
+
+        // Level 1 entry 0 of these tables is a 1 GiB block at 0
+        checkWrite(m_registers.m_TTBR0_EL1, Level0Table, TranslationFault::None, ToUnits(0x5000));
+        checkWrite(m_registers.m_TCR_EL1, 40, TranslationFault::UnmappedVirtualAddress, 0);
+        // Without stage 1 translation the process has to own a physical range
+        checkWrite(m_registers.m_SCTLR_EL1, 0, TranslationFault::UntrackedProcessingUnit, 0);
+    }
+
+    TEST_F(MemoryManagementUnitTest, TlbPartialPages) {
+        constexpr auto end = MemoryManagementUnit::Page_size + MemoryManagementUnit::Page_size / 2;
+        m_mmu->AddProcess(this, 0, end);
+
+        MemoryManagementUnitProxy proxy { m_mmu };
+        proxy.Attach(this);
+
+        // The entry of the last page only covers the part of it inside the mapping, on a miss and on a hit
+        ASSERT_EQ(proxy.TryTranslate(end, 1).m_fault, TranslationFault::InvalidPhysicalMemoryAccess);
+        ASSERT_EQ(proxy.TryTranslate(end - 1, 1).m_physicalAddress, end - 1);
+        ASSERT_EQ(proxy.TryTranslate(end, 1).m_fault, TranslationFault::InvalidPhysicalMemoryAccess);
+        ASSERT_EQ(proxy.TryTranslate(end - 2, 2).m_fault, TranslationFault::None);
+        ASSERT_EQ(proxy.TryTranslate(end - 1, 2).m_fault, TranslationFault::InvalidPhysicalMemoryAccess);
+    }
+
+} // namespace test
+
+END_NAMESPACE
@@ -0,0 +1,39 @@
+#if !defined(MEMORYMANAGEMENTUNITTEST_H_INCLUDED_60CED4F0_3546_47E9_844D_52AE74B782A2)
+    #define MEMORYMANAGEMENTUNITTEST_H_INCLUDED_60CED4F0_3546_47E9_844D_52AE74B782A2
+
+    #include <GTest/gtest.h>
+
+    #include <API/Api.h>
+    #include <Memory/MemoryManagementUnit.h>
+    #include <Memory/RandomAccessMemory.h>
+    #include <Utility/UniqueRef.h>
+
+BEGIN_NAMESPACE
+
+namespace test {
+
+    class MemoryManagementUnitTest : public ::testing::Test {
+      protected:
+        MemoryManagementUnitTest();
+        ~MemoryManagementUnitTest();
+
+        // Writes entry index of the table at the physical byte address
+        void WriteDescriptor(std::uint64_t tableAddress, std::uint64_t index, std::uint64_t descriptor);
+
+        // Enables stage 1 translation with the tables at the physical byte address, dropping the cached walks
+        void SetTranslation(std::uint64_t tableAddress, std::uint64_t t0sz);
+
+        // Walks the tables for the virtual byte address, without mapping missing pages
+        [[nodiscard]] PageTranslation Walk(std::uint64_t virtualByteAddress);
+
+        RandomAccessMemory                m_ram;
+        SharedRef< MemoryManagementUnit > m_mmu;
+        SystemRegisters                   m_registers;
+        PageWalkCache                     m_walkCache;
+    };
+
+} // namespace test
+
+END_NAMESPACE
+
+#endif // !defined(MEMORYMANAGEMENTUNITTEST_H_INCLUDED_60CED4F0_3546_47E9_844D_52AE74B782A2)
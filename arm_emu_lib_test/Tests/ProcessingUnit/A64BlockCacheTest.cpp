@@ -0,0 +1,78 @@
+#include <Tests/ProcessingUnit/A64BlockCacheTest.h>
+
+BEGIN_NAMESPACE
+
+namespace test {
+
+    namespace {
+        constexpr IMemory::DataUnit MovzX0Imm5  = 0xD28000A0; // MOVZ X0, #5
+        constexpr IMemory::DataUnit AddX0X0Imm1 = 0x91000400; // ADD X0, X0, #1
+        constexpr IMemory::DataUnit CbzX0Plus2  = 0xB4000040; // CBZ X0, #8
+        constexpr IMemory::DataUnit Ret         = 0xD65F03C0; // RET
+    } // namespace
+
+    A64BlockCacheTest::A64BlockCacheTest() : m_programMemory(), m_blockCache() {
+    }
+
+    A64BlockCacheTest::~A64BlockCacheTest() = default;
+
+    void A64BlockCacheTest::CheckBlockDiscovery() {
+        m_programMemory.Write(0, MovzX0Imm5);
+        m_programMemory.Write(1, AddX0X0Imm1);
+        m_programMemory.Write(2, CbzX0Plus2);
+        m_programMemory.Write(3, AddX0X0Imm1);
+        m_programMemory.Write(4, Ret);
+        m_blockCache.Attach(&m_programMemory);
+
+        // The first block runs up to and including the conditional branch
+        auto* entryBlock = m_blockCache.Fetch(0);
+        ASSERT_NE(entryBlock, nullptr);
+        ASSERT_EQ(entryBlock->m_address, 0);
+        ASSERT_EQ(entryBlock->m_instructions.size(), 3);
+        ASSERT_EQ(entryBlock->m_instructions.back().m_instruction.Get(), CbzX0Plus2);
+
+        auto* fallThroughBlock = m_blockCache.Fetch(3);
+        ASSERT_NE(fallThroughBlock, nullptr);
+        ASSERT_EQ(fallThroughBlock->m_instructions.size(), 2);
+
+        // Blocks are only cached for addresses inside the program
+        ASSERT_EQ(m_blockCache.Fetch(m_programMemory.Size()), nullptr);
+    }
+
+    void A64BlockCacheTest::CheckBlockChaining() {
+        m_programMemory.Write(0, MovzX0Imm5);
+        m_programMemory.Write(1, CbzX0Plus2);
+        m_programMemory.Write(2, AddX0X0Imm1);
+        m_programMemory.Write(3, Ret);
+        m_blockCache.Attach(&m_programMemory);
+
+        auto* entryBlock    = m_blockCache.Fetch(0);
+        auto* notTakenBlock = m_blockCache.Fetch(2, entryBlock);
+        auto* takenBlock    = m_blockCache.Fetch(3, entryBlock);
+
+        // Both exits of the entry block are chained, most recent first
+        ASSERT_EQ(entryBlock->m_chains[0].m_address, 3);
+        ASSERT_EQ(entryBlock->m_chains[0].m_block, takenBlock);
+        ASSERT_EQ(entryBlock->m_chains[1].m_address, 2);
+        ASSERT_EQ(entryBlock->m_chains[1].m_block, notTakenBlock);
+        ASSERT_EQ(m_blockCache.Fetch(2, entryBlock), notTakenBlock);
+
+        // Writing to the program drops the blocks along with their chains
+        m_programMemory.Write(2, MovzX0Imm5);
+
+        auto* rediscoveredBlock = m_blockCache.Fetch(2, entryBlock);
+        ASSERT_NE(rediscoveredBlock, nullptr);
+        ASSERT_EQ(rediscoveredBlock->m_instructions.front().m_instruction.Get(), MovzX0Imm5);
+    }
+
+    TEST_F(A64BlockCacheTest, BlockDiscovery) {
+        CheckBlockDiscovery();
+    }
+
+    TEST_F(A64BlockCacheTest, BlockChaining) {
+        CheckBlockChaining();
+    }
+
+} // namespace test
+
+END_NAMESPACE
@@ -0,0 +1,30 @@
+#if !defined(A64BLOCKCACHETEST_H_INCLUDED_268571BF_987E_485E_8901_A0F44F314EA1)
+    #define A64BLOCKCACHETEST_H_INCLUDED_268571BF_987E_485E_8901_A0F44F314EA1
+
+    #include <GTest/gtest.h>
+
+    #include <API/Api.h>
+    #include <Memory/ProgramMemory.h>
+    #include <ProcessingUnit/A64InstructionManager/A64BlockCache.h>
+
+BEGIN_NAMESPACE
+
+namespace test {
+
+    class A64BlockCacheTest : public ::testing::Test {
+      protected:
+        A64BlockCacheTest();
+        ~A64BlockCacheTest();
+
+        void CheckBlockDiscovery();
+        void CheckBlockChaining();
+
+        ProgramMemory m_programMemory;
+        A64BlockCache m_blockCache;
+    };
+
+} // namespace test
+
+END_NAMESPACE
+
+#endif // !defined(A64BLOCKCACHETEST_H_INCLUDED_268571BF_987E_485E_8901_A0F44F314EA1)
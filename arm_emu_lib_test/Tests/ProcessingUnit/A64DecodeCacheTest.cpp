@@ -0,0 +1,72 @@
+
+#include <Memory/MemoryWatcher.h>
+#include <Tests/ProcessingUnit/A64DecodeCacheTest.h>
+#include <variant>
+
+BEGIN_NAMESPACE
+
+namespace test {
+
+    namespace {
+        constexpr IMemory::DataUnit MovzX0Imm5  = 0xD28000A0; // MOVZ X0, #5
+        constexpr IMemory::DataUnit AddX0X0Imm1 = 0x91000400; // ADD X0, X0, #1
+    } // namespace
+
+    A64DecodeCacheTest::A64DecodeCacheTest() : m_programMemory(), m_decodeCache() {
+    }
+
+    A64DecodeCacheTest::~A64DecodeCacheTest() = default;
+
+    void A64DecodeCacheTest::CheckDecodedInstructions() {
+        m_programMemory.Write(0, MovzX0Imm5);
+        m_programMemory.Write(1, AddX0X0Imm1);
+        m_decodeCache.Attach(&m_programMemory);
+
+        const auto& movz = m_decodeCache.Fetch(0);
+        ASSERT_EQ(movz.m_instruction.Get(), MovzX0Imm5);
+        ASSERT_EQ(movz.m_decodeGroup, A64DecodeGroup::DataProcessingImmediate);
+        ASSERT_TRUE(std::holds_alternative< DataProcessingImmediateGroup::MoveWideImmediate >(movz.m_instructionType));
+        ASSERT_EQ(std::get< DataProcessingImmediateGroup::MoveWideImmediate >(movz.m_instructionType),
+                  DataProcessingImmediateGroup::MoveWideImmediate::MOVZ_64BIT);
+
+        const auto& add = m_decodeCache.Fetch(1);
+        ASSERT_TRUE(std::holds_alternative< DataProcessingImmediateGroup::AddSubtractImmediate >(add.m_instructionType));
+        ASSERT_EQ(std::get< DataProcessingImmediateGroup::AddSubtractImmediate >(add.m_instructionType),
+                  DataProcessingImmediateGroup::AddSubtractImmediate::ADDi_64BIT);
+
+        ASSERT_LT(movz.m_instructionIndex, A64InstructionManager::Index_count);
+        ASSERT_LT(add.m_instructionIndex, A64InstructionManager::Index_count);
+        ASSERT_NE(movz.m_instructionIndex, add.m_instructionIndex);
+
+        // A second fetch must be served from the cache without reading the program memory again
+        const IMemory& programMemory = m_programMemory;
+        const auto     readCount     = programMemory.GetMemoryWatcher().GetAllReadCount();
+        static_cast< void >(m_decodeCache.Fetch(0));
+        ASSERT_EQ(programMemory.GetMemoryWatcher().GetAllReadCount(), readCount);
+    }
+
+    void A64DecodeCacheTest::CheckInvalidationOnProgramWrite() {
+        m_programMemory.Write(0, MovzX0Imm5);
+        m_decodeCache.Attach(&m_programMemory);
+
+        ASSERT_TRUE(std::holds_alternative< DataProcessingImmediateGroup::MoveWideImmediate >(
+            m_decodeCache.Fetch(0).m_instructionType));
+
+        m_programMemory.Write(0, AddX0X0Imm1);
+
+        const auto& add = m_decodeCache.Fetch(0);
+        ASSERT_EQ(add.m_instruction.Get(), AddX0X0Imm1);
+        ASSERT_TRUE(std::holds_alternative< DataProcessingImmediateGroup::AddSubtractImmediate >(add.m_instructionType));
+    }
+
+    TEST_F(A64DecodeCacheTest, DecodedInstructions) {
+        CheckDecodedInstructions();
+    }
+
+    TEST_F(A64DecodeCacheTest, InvalidationOnProgramWrite) {
+        CheckInvalidationOnProgramWrite();
+    }
+
+} // namespace test
+
+END_NAMESPACE
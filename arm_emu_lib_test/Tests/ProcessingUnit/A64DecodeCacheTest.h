@@ -0,0 +1,30 @@
+#if !defined(A64DECODECACHETEST_H_INCLUDED_88B43988_A9A9_4373_ABA0_C5F6C038D59C)
+    #define A64DECODECACHETEST_H_INCLUDED_88B43988_A9A9_4373_ABA0_C5F6C038D59C
+
+    #include <GTest/gtest.h>
+
+    #include <API/Api.h>
+    #include <Memory/ProgramMemory.h>
+    #include <ProcessingUnit/A64InstructionManager/A64DecodeCache.h>
+
+BEGIN_NAMESPACE
+
+namespace test {
+
+    class A64DecodeCacheTest : public ::testing::Test {
+      protected:
+        A64DecodeCacheTest();
+        ~A64DecodeCacheTest();
+
+        void CheckDecodedInstructions();
+        void CheckInvalidationOnProgramWrite();
+
+        ProgramMemory  m_programMemory;
+        A64DecodeCache m_decodeCache;
+    };
+
+} // namespace test
+
+END_NAMESPACE
+
+#endif // !defined(A64DECODECACHETEST_H_INCLUDED_88B43988_A9A9_4373_ABA0_C5F6C038D59C)
@@ -0,0 +1,314 @@
+#include <Memory/MemoryWatcher.h>
+#include <Memory/ProgramMemory.h>
+#include <ProcessingUnit/A64Registers/GeneralRegisters.h>
+#include <ProcessingUnit/Structs/ProcessState.h>
+#include <Tests/ProcessingUnit/A64ProcessingUnitTest.h>
+#include <array>
+#include <memory>
+#include <vector>
+
+BEGIN_NAMESPACE
+
+namespace test {
+
+    namespace {
+        constexpr IMemory::Address Process_size = 12_KB;
+
+        constexpr IMemory::DataUnit MovzX0Imm0    = 0xD2800000; // MOVZ X0, #0
+        constexpr IMemory::DataUnit MovzX0Imm42   = 0xD2800540; // MOVZ X0, #42
+        constexpr IMemory::DataUnit MovzX0Imm1FFC = 0xD283FF80; // MOVZ X0, #0x1FFC
+        constexpr IMemory::DataUnit MovzX0Imm2000 = 0xD2840000; // MOVZ X0, #0x2000
+        constexpr IMemory::DataUnit MovzX0Imm8000 = 0xD2F00000; // MOVZ X0, #0x8000, LSL #48
+        constexpr IMemory::DataUnit MovzX1Imm63   = 0xD28007E1; // MOVZ X1, #63
+        constexpr IMemory::DataUnit MovzX1Imm256  = 0xD2802001; // MOVZ X1, #0x100
+        constexpr IMemory::DataUnit MovzX1Imm7788 = 0xD28EF101; // MOVZ X1, #0x7788
+        constexpr IMemory::DataUnit MovnX1Imm8000 = 0x92F00001; // MOVN X1, #0x8000, LSL #48
+        constexpr IMemory::DataUnit MovkX1Imm5566 = 0xF2AAACC1; // MOVK X1, #0x5566, LSL #16
+        constexpr IMemory::DataUnit MovkX1Imm3344 = 0xF2C66881; // MOVK X1, #0x3344, LSL #32
+        constexpr IMemory::DataUnit MovkX1Imm1122 = 0xF2E22441; // MOVK X1, #0x1122, LSL #48
+        constexpr IMemory::DataUnit MovzX2Imm1    = 0xD2800022; // MOVZ X2, #1
+        constexpr IMemory::DataUnit MovzX4Imm4    = 0xD2800084; // MOVZ X4, #4
+        constexpr IMemory::DataUnit MovzW5Imm8000 = 0x52B00005; // MOVZ W5, #0x8000, LSL #16
+        constexpr IMemory::DataUnit MovzX7Imm4000 = 0xD2E80007; // MOVZ X7, #0x4000, LSL #48
+        constexpr IMemory::DataUnit AddsX3X1X2    = 0xAB020023; // ADDS X3, X1, X2
+        constexpr IMemory::DataUnit CcmpX0X0AL    = 0xFA40E000; // CCMP X0, X0, #0, AL
+        constexpr IMemory::DataUnit CcmnX1X2AL    = 0xBA42E020; // CCMN X1, X2, #0, AL
+        constexpr IMemory::DataUnit AsrvX2X0X1    = 0x9AC12802; // ASRV X2, X0, X1
+        constexpr IMemory::DataUnit AsrvX3X0X4    = 0x9AC42803; // ASRV X3, X0, X4
+        constexpr IMemory::DataUnit AsrvW6W5W4    = 0x1AC428A6; // ASRV W6, W5, W4
+        constexpr IMemory::DataUnit AsrvX8X7X4    = 0x9AC428E8; // ASRV X8, X7, X4
+        constexpr IMemory::DataUnit StrX0AtX1     = 0xF9000020; // STR X0, [X1]
+        constexpr IMemory::DataUnit StrX1AtX0     = 0xF9000001; // STR X1, [X0]
+        constexpr IMemory::DataUnit LdrX2AtX1     = 0xF9400022; // LDR X2, [X1]
+        constexpr IMemory::DataUnit Ret           = 0xD65F03C0; // RET
+    } // namespace
+
+    A64ProcessingUnitTest::A64ProcessingUnitTest() :
+        m_ram("Ram", 4_MB),
+        m_l1Cache("L1Cache", { CacheWriteStrategy::WriteThrough, CacheMemoryMapping::DirectMapping }, &m_ram, 64_KB),
+        m_mmu(std::allocate_shared< MemoryManagementUnit >(std::pmr::polymorphic_allocator< MemoryManagementUnit > {})) {
+    }
+
+    A64ProcessingUnitTest::~A64ProcessingUnitTest() = default;
+
+    Program A64ProcessingUnitTest::MakeProgram(std::initializer_list< IMemory::DataUnit > instructions) {
+        const auto size   = instructions.size() * sizeof(IMemory::DataUnit);
+        auto       memory = allocate_unique< IMemory, ProgramMemory >(std::pmr::polymorphic_allocator< ProgramMemory > {},
+                                                                      "Program", size);
+        memory->WriteBlock(0, std::span< const IMemory::DataUnit > { instructions.begin(), instructions.size() });
+        return Program { std::move(memory), 0 };
+    }
+
+    IResult::ResultFrame A64ProcessingUnitTest::RunProgram(A64ProcessingUnit&                         processingUnit,
+                                                           std::initializer_list< IMemory::DataUnit > instructions) {
+        auto result = processingUnit.Run(MakeProgram(instructions));
+        result.WaitReady();
+
+        auto resultFrame = result.GetResultFrame();
+        EXPECT_EQ(result.GetState(), IResult::State::Ready);
+        EXPECT_EQ(resultFrame.GetFault(), ProgramFault::None);
+        return resultFrame;
+    }
+
+    void A64ProcessingUnitTest::CheckFlatMemoryBypassesCaches() {
+        std::vector< IMemory::DataUnit > flatMemory(Process_size, 0);
+
+        // The process is not tracked by the MMU either, any translation would fault
+        A64ProcessingUnit processingUnit { &m_l1Cache, Process_size, MemoryManagementUnitProxy { m_mmu }, flatMemory };
+
+        const auto resultFrame = RunProgram(processingUnit, { MovzX1Imm256, MovzX0Imm42, StrX0AtX1, LdrX2AtX1, Ret });
+        ASSERT_EQ(resultFrame.GetGPRegisterValue(2), 42u);
+
+        // The store landed in the host buffer, the cache never saw an access
+        ASSERT_EQ(flatMemory[0x100 / sizeof(IMemory::DataUnit)], 42u);
+        ASSERT_EQ(flatMemory[0x100 / sizeof(IMemory::DataUnit) + 1], 0u);
+
+        const auto& watcher = m_l1Cache.GetMemoryWatcher();
+        ASSERT_EQ(watcher.GetMemoryAccessCount(), 0u);
+        ASSERT_EQ(watcher.GetHitCount(), 0u);
+        ASSERT_EQ(watcher.GetMissCount(), 0u);
+        ASSERT_EQ(watcher.GetAllUpStreamWriteCount(), 0u);
+    }
+
+    void A64ProcessingUnitTest::CheckPagedProcessMemory() {
+        constexpr auto pageSize = MemoryManagementUnit::Page_size;
+
+        m_mmu->SetPhysicalMemory(&m_ram, 0, m_ram.Size());
+        A64ProcessingUnit processingUnit { &m_l1Cache, 4 * pageSize, MemoryManagementUnitProxy { m_mmu } };
+        m_mmu->AddDemandPagedProcess(&processingUnit, 4 * pageSize);
+
+        // Touches the pages 2 and 0 first, so page 1 gets the frame after the one of page 2. The store at 0x1FFC then
+        // straddles the last unit of page 1 and the first one of page 2.
+        (void)RunProgram(processingUnit, { MovzX0Imm2000, StrX1AtX0, MovzX0Imm0, StrX1AtX0, MovzX1Imm7788,
+                                           MovkX1Imm5566, MovkX1Imm3344, MovkX1Imm1122, MovzX0Imm1FFC, StrX1AtX0,
+                                           Ret });
+
+        SystemRegisters registers {};
+        PageWalkCache   walkCache {};
+        ASSERT_TRUE(m_mmu->SetupTranslationRegisters(&processingUnit, registers));
+
+        std::array< PageTranslation, 4 > pages {};
+        for (std::size_t page = 0; page < pages.size(); ++page) {
+            pages[page] = m_mmu->LookupPage(&processingUnit, page * pageSize, registers, walkCache);
+        }
+        ASSERT_EQ(pages[0].m_fault, TranslationFault::None);
+        ASSERT_EQ(pages[1].m_fault, TranslationFault::None);
+        ASSERT_EQ(pages[2].m_fault, TranslationFault::None);
+        ASSERT_NE(pages[1].m_physicalAddress + pageSize, pages[2].m_physicalAddress);
+
+        // Untouched pages are not mapped, the touched ones hold the stored units and zeros elsewhere
+        ASSERT_EQ(pages[3].m_fault, TranslationFault::UnmappedVirtualAddress);
+        for (std::size_t page = 0; page < 3; ++page) {
+            for (IMemory::Address unit = 0; unit < pageSize; ++unit) {
+                IMemory::DataUnit expected = 0;
+                if (page == 1 && unit == pageSize - 1) {
+                    expected = 0x55667788;
+                } else if (page == 2 && unit == 0) {
+                    expected = 0x11223344;
+                }
+                ASSERT_EQ(m_ram.Read(pages[page].m_physicalAddress + unit), expected);
+            }
+        }
+    }
+
+    void A64ProcessingUnitTest::CheckAddWithCarryFlags() {
+        std::vector< IMemory::DataUnit > flatMemory(Process_size, 0);
+
+        A64ProcessingUnit processingUnit { &m_l1Cache, Process_size, MemoryManagementUnitProxy { m_mmu }, flatMemory };
+
+        // 0 + ~0 + 1 only carries out on the carry in
+        auto resultFrame = RunProgram(processingUnit, { MovzX0Imm0, CcmpX0X0AL, Ret });
+        ASSERT_FALSE(resultFrame.GetN());
+        ASSERT_TRUE(resultFrame.GetZ());
+        ASSERT_TRUE(resultFrame.GetC());
+        ASSERT_FALSE(resultFrame.GetV());
+
+        // INT64_MAX + 1 overflows into the sign bit without a carry out
+        resultFrame = RunProgram(processingUnit, { MovnX1Imm8000, MovzX2Imm1, CcmnX1X2AL, Ret });
+        ASSERT_TRUE(resultFrame.GetN());
+        ASSERT_FALSE(resultFrame.GetZ());
+        ASSERT_FALSE(resultFrame.GetC());
+        ASSERT_TRUE(resultFrame.GetV());
+
+        // The lazily evaluated flags of ADDS agree with AddWithCarry()
+        resultFrame = RunProgram(processingUnit, { MovnX1Imm8000, MovzX2Imm1, AddsX3X1X2, Ret });
+        ASSERT_EQ(resultFrame.GetGPRegisterValue(3), 0x8000000000000000u);
+        ASSERT_TRUE(resultFrame.GetN());
+        ASSERT_FALSE(resultFrame.GetZ());
+        ASSERT_FALSE(resultFrame.GetC());
+        ASSERT_TRUE(resultFrame.GetV());
+    }
+
+    void A64ProcessingUnitTest::CheckArithmeticShiftRight() {
+        std::vector< IMemory::DataUnit > flatMemory(Process_size, 0);
+
+        A64ProcessingUnit processingUnit { &m_l1Cache, Process_size, MemoryManagementUnitProxy { m_mmu }, flatMemory };
+
+        const auto resultFrame =
+            RunProgram(processingUnit, { MovzX0Imm8000, MovzX1Imm63, MovzX4Imm4, MovzW5Imm8000, MovzX7Imm4000,
+                                         AsrvX2X0X1, AsrvX3X0X4, AsrvW6W5W4, AsrvX8X7X4, Ret });
+
+        // Negative values are filled with their sign bit, within the register width only
+        ASSERT_EQ(resultFrame.GetGPRegisterValue(2), 0xFFFFFFFFFFFFFFFFu);
+        ASSERT_EQ(resultFrame.GetGPRegisterValue(3), 0xF800000000000000u);
+        ASSERT_EQ(resultFrame.GetGPRegisterValue(6), 0x00000000F8000000u);
+        ASSERT_EQ(resultFrame.GetGPRegisterValue(8), 0x0400000000000000u);
+    }
+
+    void A64ProcessingUnitTest::CheckCarryFlagInversion() {
+        IProcessingUnit::ProcessState processState {};
+        GPRegisters                   registers { processState };
+
+        // From deferred flags: 0xFFFFFFFFFFFFFFFF + 1 sets Z and C
+        (void)registers.SetNZCVFromAdd(64, ~static_cast< std::uint64_t >(0), 1, false);
+        ASSERT_EQ(registers.NZCV(), 0b0110u);
+        registers.InvertCarryFlag();
+        ASSERT_EQ(registers.NZCV(), 0b0100u);
+        registers.InvertCarryFlag();
+        ASSERT_EQ(registers.NZCV(), 0b0110u);
+
+        // From stored flags, N, Z and V are kept
+        registers.SetNZCV(0b1001);
+        registers.InvertCarryFlag();
+        ASSERT_EQ(registers.NZCV(), 0b1011u);
+    }
+
+    void A64ProcessingUnitTest::CheckJitMatchesInterpreter() {
+        constexpr std::array executionModes { ExecutionMode::Interpreter, ExecutionMode::BlockTranslation,
+                                              ExecutionMode::Jit };
+
+        std::array< IResult::ResultFrame, executionModes.size() >             resultFrames {};
+        std::array< std::vector< IMemory::DataUnit >, executionModes.size() > flatMemories {};
+        for (std::size_t mode = 0; mode < executionModes.size(); ++mode) {
+            flatMemories[mode].resize(Process_size, 0);
+
+            A64ProcessingUnit processingUnit { &m_l1Cache, Process_size, MemoryManagementUnitProxy { m_mmu },
+                                               flatMemories[mode] };
+            processingUnit.SetExecutionMode(executionModes[mode]);
+
+            // Both loops run past the hotness threshold. The first one is translated whole, its loop branch included,
+            // the second one only up to ASRV, the interpreter runs the rest of it.
+            resultFrames[mode] = RunProgram(
+                processingUnit,
+                {
+                    0xD280051C, // MOVZ X28, #40
+                    0xD2808001, // MOVZ X1, #0x400
+                    0xD2800062, // MOVZ X2, #3
+                    0xD2824683, // MOVZ X3, #0x1234
+                    0xF2B579A3, // MOVK X3, #0xABCD, LSL #16
+                    0x928000A4, // MOVN X4, #5
+                    0x91001CA5, // ADD X5, X5, #7
+                    0x510004C6, // SUB W6, W6, #1
+                    0xB14004A7, // ADDS X7, X5, #1, LSL #12
+                    0x92412068, // AND X8, X3, #0x80000000000000FF
+                    0x320004A9, // ORR W9, W5, #0x3
+                    0xD240054A, // EOR X10, X10, #0x3
+                    0xF24004AB, // ANDS X11, X5, #3
+                    0x9B0230AC, // MADD X12, X5, X2, X12
+                    0x1B02B4AD, // MSUB W13, W5, W2, W13
+                    0x9A8505CE, // CSINC X14, X14, X5, EQ
+                    0x5A8410AF, // CSINV W15, W5, W4, NE
+                    0xDA82B4B0, // CSNEG X16, X5, X2, LT
+                    0x8A050C71, // AND X17, X3, X5, LSL #3
+                    0x2A4308B2, // ORR W18, W5, W3, LSR #2
+                    0x8AA50473, // BIC X19, X3, X5, ASR #1
+                    0x2AE51474, // ORN W20, W3, W5, ROR #5
+                    0x6A050075, // ANDS W21, W3, W5
+                    0x0B0310B6, // ADD W22, W5, W3, LSL #4
+                    0xAB571CB7, // ADDS X23, X5, X23, LSR #7
+                    0x934140B8, // SBFM X24, X5, #1, #16
+                    0x330120B9, // BFM W25, W5, #1, #8
+                    0x13012000, // SBFM W0, W0, #1, #8
+                    0xF900042C, // STR X12, [X1, #8]
+                    0x39000C25, // STRB W5, [X1, #3]
+                    0x7900242D, // STRH W13, [X1, #18]
+                    0xB9001426, // STR W6, [X1, #20]
+                    0xF940043A, // LDR X26, [X1, #8]
+                    0x39800C3B, // LDRSB X27, [X1, #3]
+                    0x79C0243D, // LDRSH W29, [X1, #18]
+                    0xB9801420, // LDRSW X0, [X1, #20]
+                    0x39400C29, // LDRB W9, [X1, #3]
+                    0x7940242F, // LDRH W15, [X1, #18]
+                    0x39C05031, // LDRSB W17, [X1, #20]
+                    0x79802832, // LDRSH X18, [X1, #20]
+                    0xB9401433, // LDR W19, [X1, #20]
+                    0xF100079C, // SUBS X28, X28, #1
+                    0x54FFFB81, // B.NE -36
+                    0xD280051C, // MOVZ X28, #40
+                    0x91000CA5, // ADD X5, X5, #3
+                    0x9AC228A6, // ASRV X6, X5, X2
+                    0xD24120E7, // EOR X7, X7, #0x80000000000000FF
+                    0xF100079C, // SUBS X28, X28, #1
+                    0x54FFFF81, // B.NE -4
+                    0xD65F03C0, // RET
+                });
+        }
+
+        const auto& reference = resultFrames[0];
+        ASSERT_EQ(reference.GetGPRegisterValue(5), 40u * 7u + 40u * 3u);
+        ASSERT_EQ(reference.GetGPRegisterValue(28), 0u);
+        ASSERT_EQ(flatMemories[0][0x408 / sizeof(IMemory::DataUnit)],
+                  static_cast< IMemory::DataUnit >(reference.GetGPRegisterValue(12)));
+
+        for (std::size_t mode = 1; mode < executionModes.size(); ++mode) {
+            const auto& resultFrame = resultFrames[mode];
+            for (std::uint8_t loc = 0; loc < 31; ++loc) {
+                ASSERT_EQ(resultFrame.GetGPRegisterValue(loc), reference.GetGPRegisterValue(loc)) << "X" << +loc;
+            }
+            ASSERT_EQ(resultFrame.GetPC(), reference.GetPC());
+            ASSERT_EQ(resultFrame.GetSP(), reference.GetSP());
+            ASSERT_EQ(resultFrame.GetN(), reference.GetN());
+            ASSERT_EQ(resultFrame.GetZ(), reference.GetZ());
+            ASSERT_EQ(resultFrame.GetC(), reference.GetC());
+            ASSERT_EQ(resultFrame.GetV(), reference.GetV());
+            ASSERT_EQ(flatMemories[mode], flatMemories[0]);
+        }
+    }
+
+    TEST_F(A64ProcessingUnitTest, FlatMemoryBypassesCaches) {
+        CheckFlatMemoryBypassesCaches();
+    }
+
+    TEST_F(A64ProcessingUnitTest, PagedProcessMemory) {
+        CheckPagedProcessMemory();
+    }
+
+    TEST_F(A64ProcessingUnitTest, AddWithCarryFlags) {
+        CheckAddWithCarryFlags();
+    }
+
+    TEST_F(A64ProcessingUnitTest, ArithmeticShiftRight) {
+        CheckArithmeticShiftRight();
+    }
+
+    TEST_F(A64ProcessingUnitTest, CarryFlagInversion) {
+        CheckCarryFlagInversion();
+    }
+
+    TEST_F(A64ProcessingUnitTest, JitMatchesInterpreter) {
+        CheckJitMatchesInterpreter();
+    }
+
+} // namespace test
+
+END_NAMESPACE
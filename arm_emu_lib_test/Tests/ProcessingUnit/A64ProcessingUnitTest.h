@@ -0,0 +1,48 @@
+#if !defined(A64PROCESSINGUNITTEST_H_INCLUDED_2F7B7375_0A3E_49D4_92C7_6DDB352373B6)
+    #define A64PROCESSINGUNITTEST_H_INCLUDED_2F7B7375_0A3E_49D4_92C7_6DDB352373B6
+
+    #include <GTest/gtest.h>
+
+    #include <API/Api.h>
+    #include <Memory/CacheMemory.h>
+    #include <Memory/MemoryManagementUnit.h>
+    #include <Memory/RandomAccessMemory.h>
+    #include <ProcessingUnit/A64ProcessingUnit.h>
+    #include <Program/IResult.h>
+    #include <Program/Program.h>
+    #include <Utility/UniqueRef.h>
+    #include <initializer_list>
+
+BEGIN_NAMESPACE
+
+namespace test {
+
+    class A64ProcessingUnitTest : public ::testing::Test {
+      protected:
+        A64ProcessingUnitTest();
+        ~A64ProcessingUnitTest();
+
+        /// @brief Program made of instructions from address 0, it has to end with a RET to the host
+        [[nodiscard]] static Program MakeProgram(std::initializer_list< IMemory::DataUnit > instructions);
+
+        /// @brief Runs a program to its end and checks it did not fault
+        [[nodiscard]] static IResult::ResultFrame RunProgram(A64ProcessingUnit&                         processingUnit,
+                                                             std::initializer_list< IMemory::DataUnit > instructions);
+
+        void CheckFlatMemoryBypassesCaches();
+        void CheckPagedProcessMemory();
+        void CheckAddWithCarryFlags();
+        void CheckArithmeticShiftRight();
+        void CheckCarryFlagInversion();
+        void CheckJitMatchesInterpreter();
+
+        RandomAccessMemory                m_ram;
+        CacheMemory                       m_l1Cache;
+        SharedRef< MemoryManagementUnit > m_mmu;
+    };
+
+} // namespace test
+
+END_NAMESPACE
+
+#endif // !defined(A64PROCESSINGUNITTEST_H_INCLUDED_2F7B7375_0A3E_49D4_92C7_6DDB352373B6)
@@ -0,0 +1,94 @@
+#include <CPU/SystemCreator.h>
+#include <Tests/ProcessingUnit/HostThreadPoolTest.h>
+#include <atomic>
+#include <latch>
+#include <vector>
+
+BEGIN_NAMESPACE
+
+namespace test {
+
+    HostThreadPoolTest::HostThreadPoolTest() = default;
+
+    HostThreadPoolTest::~HostThreadPoolTest() = default;
+
+    void HostThreadPoolTest::CheckAllTasksRun() {
+        constexpr std::size_t Thread_count = 2;
+        constexpr std::size_t Task_count   = 1000;
+
+        std::atomic< std::size_t > runCount { 0 };
+        {
+            HostThreadPool pool { Thread_count };
+            for (std::size_t i = 0; i < Task_count; ++i) {
+                pool.Submit([&runCount]() { runCount.fetch_add(1, std::memory_order_relaxed); });
+            }
+
+            ASSERT_EQ(pool.GetThreadCount(), Thread_count);
+            ASSERT_LE(pool.GetStartedThreadCount(), Thread_count);
+        }
+
+        // Queued tasks are all run before the pool is destroyed
+        ASSERT_EQ(runCount.load(), Task_count);
+    }
+
+    void HostThreadPoolTest::CheckBlockedTask() {
+        HostThreadPool pool { 1 };
+        std::latch     secondTaskRun { 1 };
+
+        // The first task would hold the only thread of the pool forever, were it not marked as blocked
+        std::latch firstTaskDone { 1 };
+        pool.Submit([&]() {
+            HostThreadPool::BlockingScope blocking {};
+            secondTaskRun.wait();
+            firstTaskDone.count_down();
+        });
+        pool.Submit([&]() { secondTaskRun.count_down(); });
+        firstTaskDone.wait();
+
+        ASSERT_EQ(pool.GetStartedThreadCount(), std::size_t { 2 });
+    }
+
+    void HostThreadPoolTest::CheckManyProcessingUnits() {
+        using namespace arm_emu::literals;
+
+        // Far more processing units than host threads, each of them still runs its programs
+        arm_emu::SystemSettings sys {};
+        sys.cpuType         = arm_emu::CPUType::A64;
+        sys.nCores          = 16;
+        sys.nThreadsPerCore = 4;
+        sys.nHostThreads    = 2;
+        sys.memoryModel     = MemoryModel::Flat;
+        sys.StackSize       = 12_KB;
+        sys.RamSize         = 1_MB;
+
+        auto                  m_cpu = arm_emu::SystemCreator::CreateCPU(sys);
+        std::vector< Result > results;
+        for (std::size_t i = 0; i < 256; ++i) {
+            results.push_back(m_cpu->Run(arm_emu::test::GetSampleProgram(0)));
+        }
+
+        for (auto& result : results) {
+            result.WaitReady();
+
+            auto resultFrame = result.GetResultFrame();
+
+            ASSERT_EQ(result.GetState(), IResult::State::Ready);
+            ASSERT_EQ(resultFrame.GetGPRegisterValue(0), 5);
+        }
+    }
+
+    TEST_F(HostThreadPoolTest, AllTasksRun) {
+        CheckAllTasksRun();
+    }
+
+    TEST_F(HostThreadPoolTest, BlockedTask) {
+        CheckBlockedTask();
+    }
+
+    TEST_F(HostThreadPoolTest, ManyProcessingUnits) {
+        CheckManyProcessingUnits();
+    }
+
+} // namespace test
+
+END_NAMESPACE
@@ -0,0 +1,27 @@
+#if !defined(HOSTTHREADPOOLTEST_H_INCLUDED_1B6E4B8E_724B_4071_A967_BF98B2F94A3A)
+    #define HOSTTHREADPOOLTEST_H_INCLUDED_1B6E4B8E_724B_4071_A967_BF98B2F94A3A
+
+    #include <GTest/gtest.h>
+
+    #include <API/Api.h>
+    #include <ProcessingUnit/HostThreadPool.h>
+
+BEGIN_NAMESPACE
+
+namespace test {
+
+    class HostThreadPoolTest : public ::testing::Test {
+      protected:
+        HostThreadPoolTest();
+        ~HostThreadPoolTest();
+
+        void CheckAllTasksRun();
+        void CheckBlockedTask();
+        void CheckManyProcessingUnits();
+    };
+
+} // namespace test
+
+END_NAMESPACE
+
+#endif // !defined(HOSTTHREADPOOLTEST_H_INCLUDED_1B6E4B8E_724B_4071_A967_BF98B2F94A3A)
@@ -0,0 +1,201 @@
+#include <Tests/ProcessingUnit/WorkStealingTest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+BEGIN_NAMESPACE
+
+namespace test {
+
+    namespace {
+        struct FakeWorker final : public WorkStealingDomain::IWorker {
+            explicit FakeWorker(bool isIdle) : m_queue(), m_isIdle(isIdle), m_stolenCount(0), m_wakeUpCount(0) {
+            }
+
+            ProgramQueue& GetProgramQueue() noexcept final {
+                return m_queue;
+            }
+
+            void OnProgramStolen() noexcept final {
+                ++m_stolenCount;
+            }
+
+            bool WakeIfIdle() final {
+                m_wakeUpCount += m_isIdle ? 1 : 0;
+                return m_isIdle;
+            }
+
+            ProgramQueue m_queue;
+            bool         m_isIdle;
+            std::size_t  m_stolenCount;
+            std::size_t  m_wakeUpCount;
+        };
+    } // namespace
+
+    WorkStealingTest::WorkStealingTest() : m_queue(), m_domain() {
+    }
+
+    WorkStealingTest::~WorkStealingTest() = default;
+
+    QueuedProgram WorkStealingTest::MakeProgram(Program::EntryPoint id) {
+        // Entry points tell the programs apart, they are never run
+        return QueuedProgram { Program { nullptr, id }, false, {} };
+    }
+
+    void WorkStealingTest::CheckQueueOrder() {
+        // Enough programs to grow the ring a few times
+        constexpr Program::EntryPoint Program_count = 8 * ProgramQueue::Initial_capacity;
+
+        ASSERT_TRUE(m_queue.IsEmpty());
+        ASSERT_FALSE(m_queue.TryTake().has_value());
+
+        for (Program::EntryPoint id = 0; id < Program_count / 2; ++id) {
+            m_queue.Push(MakeProgram(id));
+        }
+        ASSERT_EQ(m_queue.TryTake()->m_program.GetEntryPoint(), 0);
+        for (Program::EntryPoint id = Program_count / 2; id < Program_count; ++id) {
+            m_queue.Push(MakeProgram(id));
+        }
+        ASSERT_EQ(m_queue.Size(), Program_count - 1);
+
+        for (Program::EntryPoint id = 1; id < Program_count; ++id) {
+            auto program = m_queue.TryTake();
+            ASSERT_TRUE(program.has_value());
+            ASSERT_EQ(program->m_program.GetEntryPoint(), id);
+        }
+        ASSERT_TRUE(m_queue.IsEmpty());
+    }
+
+    void WorkStealingTest::CheckConcurrentTakes() {
+        constexpr std::size_t Program_count = 20000;
+        constexpr std::size_t Taker_count   = 4;
+
+        std::vector< std::atomic< std::size_t > > takeCounts(Program_count);
+        std::atomic< std::size_t >                takenCount { 0 };
+
+        std::vector< std::thread > takers;
+        for (std::size_t i = 0; i < Taker_count; ++i) {
+            takers.emplace_back([&]() {
+                while (takenCount.load() < Program_count) {
+                    if (auto program = m_queue.TryTake()) {
+                        takeCounts[program->m_program.GetEntryPoint()].fetch_add(1);
+                        takenCount.fetch_add(1);
+                    }
+                }
+            });
+        }
+        for (std::size_t id = 0; id < Program_count; ++id) {
+            m_queue.Push(MakeProgram(id));
+        }
+        for (auto& taker : takers) {
+            taker.join();
+        }
+
+        // Every program is taken exactly once
+        for (const auto& takeCount : takeCounts) {
+            ASSERT_EQ(takeCount.load(), 1);
+        }
+        ASSERT_TRUE(m_queue.IsEmpty());
+    }
+
+    void WorkStealingTest::CheckStealOrder() {
+        FakeWorker thief { true }, sibling { false }, remote { false };
+        m_domain.Join(&thief, 0);
+        m_domain.Join(&remote, 1);
+        m_domain.Join(&sibling, 0);
+        ASSERT_EQ(m_domain.GetWorkerCount(), 3);
+
+        remote.m_queue.Push(MakeProgram(1));
+        sibling.m_queue.Push(MakeProgram(2));
+        sibling.m_queue.Push(MakeProgram(3));
+
+        // Programs of the threads of the same core are stolen before those of other cores
+        ASSERT_EQ(m_domain.Steal(&thief)->m_program.GetEntryPoint(), 2);
+        ASSERT_EQ(m_domain.Steal(&thief)->m_program.GetEntryPoint(), 3);
+        ASSERT_EQ(m_domain.Steal(&thief)->m_program.GetEntryPoint(), 1);
+        ASSERT_FALSE(m_domain.Steal(&thief).has_value());
+
+        ASSERT_EQ(sibling.m_stolenCount, 2);
+        ASSERT_EQ(remote.m_stolenCount, 1);
+        ASSERT_EQ(thief.m_stolenCount, 0);
+        ASSERT_EQ(m_domain.GetStealCount(), 3);
+
+        m_domain.Leave(&thief);
+        m_domain.Leave(&remote);
+        m_domain.Leave(&sibling);
+        ASSERT_EQ(m_domain.GetWorkerCount(), 0);
+    }
+
+    void WorkStealingTest::CheckIdleWorkerWakeUp() {
+        FakeWorker busy { false }, remote { true }, sibling { true };
+        m_domain.Join(&busy, 0);
+        m_domain.Join(&remote, 1);
+        m_domain.Join(&sibling, 0);
+
+        // A single idle worker is woken up, on the same core when there is one
+        ASSERT_TRUE(m_domain.WakeIdleWorker(&busy));
+        ASSERT_EQ(sibling.m_wakeUpCount, 1);
+        ASSERT_EQ(remote.m_wakeUpCount, 0);
+
+        sibling.m_isIdle = false;
+        ASSERT_TRUE(m_domain.WakeIdleWorker(&busy));
+        ASSERT_EQ(remote.m_wakeUpCount, 1);
+
+        remote.m_isIdle = false;
+        ASSERT_FALSE(m_domain.WakeIdleWorker(&busy));
+
+        m_domain.Leave(&busy);
+        m_domain.Leave(&remote);
+        m_domain.Leave(&sibling);
+    }
+
+    void WorkStealingTest::CheckBatchWakeUp() {
+        FakeWorker busy { false }, first { true }, second { true }, third { true };
+        m_domain.Join(&busy, 0);
+        m_domain.Join(&first, 0);
+        m_domain.Join(&second, 1);
+        m_domain.Join(&third, 1);
+
+        // A batch wakes up to one idle worker per program in a single pass, each of them once
+        ASSERT_EQ(m_domain.WakeIdleWorkers(2), 2);
+        ASSERT_EQ(first.m_wakeUpCount + second.m_wakeUpCount + third.m_wakeUpCount, 2);
+
+        // More programs than idle workers do not wake any of them twice
+        for (auto* worker : { &first, &second, &third }) {
+            worker->m_wakeUpCount = 0;
+        }
+        ASSERT_EQ(m_domain.WakeIdleWorkers(16), 3);
+        for (const auto* worker : { &first, &second, &third }) {
+            ASSERT_EQ(worker->m_wakeUpCount, 1);
+        }
+        ASSERT_EQ(busy.m_wakeUpCount, 0);
+
+        m_domain.Leave(&busy);
+        m_domain.Leave(&first);
+        m_domain.Leave(&second);
+        m_domain.Leave(&third);
+    }
+
+    TEST_F(WorkStealingTest, QueueOrder) {
+        CheckQueueOrder();
+    }
+
+    TEST_F(WorkStealingTest, ConcurrentTakes) {
+        CheckConcurrentTakes();
+    }
+
+    TEST_F(WorkStealingTest, StealOrder) {
+        CheckStealOrder();
+    }
+
+    TEST_F(WorkStealingTest, IdleWorkerWakeUp) {
+        CheckIdleWorkerWakeUp();
+    }
+
+    TEST_F(WorkStealingTest, BatchWakeUp) {
+        CheckBatchWakeUp();
+    }
+
+} // namespace test
+
+END_NAMESPACE
@@ -0,0 +1,35 @@
+#if !defined(WORKSTEALINGTEST_H_INCLUDED_4099189D_8ADC_490A_BC1F_24B6D9D12B4D)
+    #define WORKSTEALINGTEST_H_INCLUDED_4099189D_8ADC_490A_BC1F_24B6D9D12B4D
+
+    #include <GTest/gtest.h>
+
+    #include <API/Api.h>
+    #include <ProcessingUnit/ProgramQueue.h>
+    #include <ProcessingUnit/WorkStealingDomain.h>
+
+BEGIN_NAMESPACE
+
+namespace test {
+
+    class WorkStealingTest : public ::testing::Test {
+      protected:
+        WorkStealingTest();
+        ~WorkStealingTest();
+
+        void CheckQueueOrder();
+        void CheckConcurrentTakes();
+        void CheckStealOrder();
+        void CheckIdleWorkerWakeUp();
+        void CheckBatchWakeUp();
+
+        [[nodiscard]] static QueuedProgram MakeProgram(Program::EntryPoint id);
+
+        ProgramQueue       m_queue;
+        WorkStealingDomain m_domain;
+    };
+
+} // namespace test
+
+END_NAMESPACE
+
+#endif // !defined(WORKSTEALINGTEST_H_INCLUDED_4099189D_8ADC_490A_BC1F_24B6D9D12B4D)
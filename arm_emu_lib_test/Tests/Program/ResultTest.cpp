@@ -1,10 +1,75 @@
 
+#include <Program/ResultAwaiter.h>
+#include <Program/ResultElementPool.h>
 #include <Tests/Program/ResultTest.h>
+#include <coroutine>
+#include <exception>
+#include <memory_resource>
+#include <optional>
+#include <vector>
 
 BEGIN_NAMESPACE
 
 namespace test {
 
+    namespace {
+        /// @brief Default memory resource while it lives, counts the allocations it forwards to the previous one
+        class CountingResource final : public std::pmr::memory_resource {
+          public:
+            CountingResource() : m_upstream(std::pmr::set_default_resource(this)), m_allocationCount(0) {
+            }
+
+            ~CountingResource() final {
+                std::pmr::set_default_resource(m_upstream);
+            }
+
+            [[nodiscard]] std::size_t GetAllocationCount() const noexcept {
+                return m_allocationCount;
+            }
+
+          private:
+            void* do_allocate(std::size_t bytes, std::size_t alignment) final {
+                ++m_allocationCount;
+                return m_upstream->allocate(bytes, alignment);
+            }
+
+            void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) final {
+                m_upstream->deallocate(ptr, bytes, alignment);
+            }
+
+            [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept final {
+                return this == &other;
+            }
+
+            std::pmr::memory_resource* m_upstream;
+            std::size_t                m_allocationCount;
+        };
+
+        /// @brief Coroutine running eagerly and freeing itself once done, nobody awaits it
+        struct DetachedTask {
+            struct promise_type {
+                DetachedTask get_return_object() noexcept {
+                    return {};
+                }
+                std::suspend_never initial_suspend() noexcept {
+                    return {};
+                }
+                std::suspend_never final_suspend() noexcept {
+                    return {};
+                }
+                void return_void() noexcept {
+                }
+                void unhandled_exception() noexcept {
+                    std::terminate();
+                }
+            };
+        };
+
+        DetachedTask AwaitResult(IResult& result, std::optional< IResult::ResultFrame >& resultFrame) {
+            resultFrame = co_await result;
+        }
+    } // namespace
+
     ResultTest::ResultTest() = default;
 
     ResultTest::~ResultTest() = default;
@@ -68,7 +133,7 @@ namespace test {
         registers.at(1) = Reg1;
         registers.at(4) = Reg4;
 
-        m_resultElement->SetResultFrame({ registers, PCVal, 0, false, false, false, false, {} });
+        m_resultElement->SetResultFrame({ registers, PCVal, 0, false, false, false, false, ProgramFault::None, {} });
         resultFrame = m_resultElement->GetResultFrame();
 
         ASSERT_EQ(m_resultElement->GetState(), IResult::State::Waiting);
@@ -79,10 +144,91 @@ namespace test {
         ASSERT_EQ(resultFrame.GetPC(), PCVal);
     }
 
+    void ResultTest::CheckResultElementPool() {
+        constexpr std::size_t Element_count = 16;
+
+        CountingResource                          resource;
+        std::vector< SharedRef< ResultElement > > elements;
+
+        // What a result element allocates by itself, its interrupts
+        std::size_t allocationCount = resource.GetAllocationCount();
+        { ResultElement element { false }; }
+        const std::size_t elementAllocationCount = resource.GetAllocationCount() - allocationCount;
+
+        // The elements of a batch take a single buffer between them, instead of an allocation each
+        {
+            ResultElementPool pool { Element_count };
+            allocationCount = resource.GetAllocationCount();
+            for (std::size_t i = 0; i < Element_count; ++i) {
+                elements.push_back(pool.Allocate(false));
+            }
+            ASSERT_EQ(resource.GetAllocationCount() - allocationCount, Element_count * elementAllocationCount + 1);
+        }
+
+        // The buffer outlives the pool, the elements are still usable
+        for (auto& element : elements) {
+            element->Signal(IResult::State::Ready);
+            ASSERT_EQ(element->GetState(), IResult::State::Ready);
+        }
+    }
+
     void ResultTest::CheckResult() {
+        constexpr std::uint64_t Reg0 = 5;
+
+        auto   resultElement = std::make_shared< ResultElement >(false);
+        Result result { resultElement };
+
+        // A pending result stores its callbacks, only the end of the program calls them, once each
+        std::vector< IResult::State > states {};
+        result.OnReady([&](IResult::State state) { states.push_back(state); });
+        resultElement->Signal(IResult::State::Running);
+        ASSERT_TRUE(states.empty());
+
+        // The coroutine suspends until the program ends, then resumes with its final frame
+        std::optional< IResult::ResultFrame > resultFrame {};
+        AwaitResult(result, resultFrame);
+        ASSERT_FALSE(resultFrame.has_value());
+
+        GPRegisters::Arch64Registers registers {};
+        registers.at(0) = Reg0;
+        resultElement->SetResultFrame({ registers, 0, 0, false, false, false, false, ProgramFault::None, {} });
+        resultElement->Signal(IResult::State::Ready);
+
+        ASSERT_EQ(states, std::vector< IResult::State > { IResult::State::Ready });
+        ASSERT_TRUE(resultFrame.has_value());
+        ASSERT_EQ(resultFrame->GetGPRegisterValue(0), Reg0);
+
+        resultElement->Signal(IResult::State::Ready);
+        ASSERT_EQ(states.size(), 1u);
+
+        // Once done, callbacks run right away and coroutines do not suspend
+        result.OnReady([&](IResult::State state) { states.push_back(state); });
+        ASSERT_EQ(states.size(), 2u);
+
+        resultFrame.reset();
+        AwaitResult(result, resultFrame);
+        ASSERT_TRUE(resultFrame.has_value());
+        ASSERT_EQ(resultFrame->GetGPRegisterValue(0), Reg0);
     }
 
     void ResultTest::CheckControlledResult() {
+        auto             resultElement = std::make_shared< ResultElement >(true);
+        ControlledResult result { resultElement };
+
+        // Pausing in step in mode does not end the program, an interrupted program does
+        std::vector< IResult::State > states {};
+        result.OnReady([&](IResult::State state) { states.push_back(state); });
+
+        std::optional< IResult::ResultFrame > resultFrame {};
+        AwaitResult(result, resultFrame);
+
+        resultElement->Signal(IResult::State::StepInMode);
+        ASSERT_TRUE(states.empty());
+        ASSERT_FALSE(resultFrame.has_value());
+
+        resultElement->Signal(IResult::State::Interrupted);
+        ASSERT_EQ(states, std::vector< IResult::State > { IResult::State::Interrupted });
+        ASSERT_TRUE(resultFrame.has_value());
     }
 
     TEST_F(ResultTest, TestResultElement) {
@@ -90,6 +236,10 @@ namespace test {
         CheckResultElement(false);
     }
 
+    TEST_F(ResultTest, TestResultElementPool) {
+        CheckResultElementPool();
+    }
+
     TEST_F(ResultTest, TestResult) {
         CheckResult();
     }
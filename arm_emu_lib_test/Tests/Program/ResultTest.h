@@ -18,6 +18,7 @@ namespace test {
         ~ResultTest();
 
         void CheckResultElement(bool stepIn);
+        void CheckResultElementPool();
         void CheckResult();
         void CheckControlledResult();
 
@@ -1,30 +1,100 @@
 
+#include <CPU/A64CPU.h>
 #include <CPU/SystemCreator.h>
 #include <DebugUtils/Log.h>
+#include <Memory/ProgramMemory.h>
+#include <Program/ResultAwaiter.h>
 #include <Tests/Program/SampleProgramTest.h>
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <latch>
+#include <vector>
 
 BEGIN_NAMESPACE
 
 namespace test {
 
+    namespace {
+        /// @brief Coroutine running eagerly and freeing itself once done, nobody awaits it
+        struct DetachedTask {
+            struct promise_type {
+                DetachedTask get_return_object() noexcept {
+                    return {};
+                }
+                std::suspend_never initial_suspend() noexcept {
+                    return {};
+                }
+                std::suspend_never final_suspend() noexcept {
+                    return {};
+                }
+                void return_void() noexcept {
+                }
+                void unhandled_exception() noexcept {
+                    std::terminate();
+                }
+            };
+        };
+
+        DetachedTask AwaitProgram(ICPU& cpu, Program program, std::atomic< std::size_t >& validCount, std::latch& done) {
+            auto result      = cpu.Run(std::move(program));
+            auto resultFrame = co_await result;
+
+            if (result.GetState() == IResult::State::Ready && resultFrame.GetGPRegisterValue(0) == 5 &&
+                resultFrame.GetPC() == std::numeric_limits< std::uint64_t >::max()) {
+                validCount.fetch_add(1, std::memory_order_relaxed);
+            }
+            done.count_down();
+        }
+    } // namespace
+
     SampleProgramTest::SampleProgramTest() = default;
 
     SampleProgramTest::~SampleProgramTest() = default;
 
-    void SampleProgramTest::CheckSampleProgram(std::uint64_t programNumber) {
+    SystemSettings SampleProgramTest::MakeSystemSettings(MemoryModel memoryModel) {
         using namespace arm_emu::literals;
 
         arm_emu::SystemSettings sys {};
         sys.cpuType         = arm_emu::CPUType::A64;
         sys.nCores          = 4;
         sys.nThreadsPerCore = 2;
+        sys.memoryModel     = memoryModel;
         sys.L1CacheSize     = 256_KB;
         sys.L2CacheSize     = 1_MB;
         sys.L3CacheSize     = 12_MB;
         sys.StackSize       = 12_KB;
         sys.RamSize         = 100_MB;
+        return sys;
+    }
 
-        auto m_cpu    = arm_emu::SystemCreator::CreateCPU(sys);
+    void SampleProgramTest::CheckSampleResult(IResult& result) {
+        result.WaitReady();
+
+        auto resultFrame = result.GetResultFrame();
+
+        ASSERT_EQ(result.GetState(), IResult::State::Ready);
+        ASSERT_EQ(resultFrame.GetGPRegisterValue(0), 5);
+        ASSERT_EQ(resultFrame.GetPC(), std::numeric_limits< std::uint64_t >::max());
+    }
+
+    void SampleProgramTest::CheckFaultResult(IResult& result, ProgramFault fault) {
+        result.WaitReady();
+
+        ASSERT_EQ(result.GetState(), IResult::State::Interrupted);
+        ASSERT_EQ(result.GetResultFrame().GetFault(), fault);
+    }
+
+    Program SampleProgramTest::MakeProgram(std::initializer_list< IMemory::DataUnit > instructions) {
+        const auto size   = instructions.size() * sizeof(IMemory::DataUnit);
+        auto       memory = allocate_unique< IMemory, ProgramMemory >(std::pmr::polymorphic_allocator< ProgramMemory > {},
+                                                                      "Program", size);
+        memory->WriteBlock(0, std::span< const IMemory::DataUnit > { instructions.begin(), instructions.size() });
+        return Program { std::move(memory), 0 };
+    }
+
+    void SampleProgramTest::CheckSampleProgram(std::uint64_t programNumber) {
+        auto m_cpu    = arm_emu::SystemCreator::CreateCPU(MakeSystemSettings());
         auto prog     = arm_emu::test::GetSampleProgram(programNumber);
         auto stepCtrl = m_cpu->StepIn(std::move(prog));
 
@@ -40,10 +110,394 @@ namespace test {
         ASSERT_EQ(resultFrame.GetPC(), std::numeric_limits< std::uint64_t >::max());
     }
 
+    void SampleProgramTest::CheckSampleProgramRun(std::uint64_t programNumber, MemoryModel memoryModel) {
+        // Programs that are not stepped into run as chained basic blocks
+        auto m_cpu   = arm_emu::SystemCreator::CreateCPU(MakeSystemSettings(memoryModel));
+        auto prog    = arm_emu::test::GetSampleProgram(programNumber);
+        auto results = m_cpu->Run(std::move(prog));
+
+        CheckSampleResult(results);
+    }
+
+    void SampleProgramTest::CheckSampleProgramRunFor(std::uint64_t programNumber, std::uint64_t instructionBudget) {
+        auto m_cpu    = arm_emu::SystemCreator::CreateCPU(MakeSystemSettings());
+        auto prog     = arm_emu::test::GetSampleProgram(programNumber);
+        auto stepCtrl = m_cpu->StepIn(std::move(prog));
+
+        while (!stepCtrl.CanStepIn())
+            ;
+
+        // The frame of a stride is the one the processing unit published when it stopped
+        auto resultFrame = stepCtrl.RunFor(instructionBudget);
+
+        // Sample program 0 starts with five instructions without a branch, the second one sets X0 to 5. A stride
+        // within them stops right after the last instruction of its budget.
+        constexpr std::uint64_t straightLineCount = 5;
+        if (programNumber == 0 && instructionBudget <= straightLineCount) {
+            ASSERT_EQ(resultFrame.GetPC(), instructionBudget);
+            ASSERT_EQ(resultFrame.GetGPRegisterValue(0), instructionBudget >= 2 ? 5u : 0u);
+        }
+
+        while (stepCtrl.CanStepIn()) {
+            resultFrame = stepCtrl.RunFor(instructionBudget);
+        }
+
+        ASSERT_EQ(resultFrame.GetGPRegisterValue(0), 5);
+        ASSERT_EQ(resultFrame.GetPC(), std::numeric_limits< std::uint64_t >::max());
+    }
+
+    void SampleProgramTest::CheckSampleProgramExecutionModes(std::uint64_t programNumber, MemoryModel memoryModel) {
+        // Both execution modes run the program to the very same final frame
+        std::vector< IResult::ResultFrame > resultFrames;
+        for (const auto executionMode :
+             { ExecutionMode::Interpreter, ExecutionMode::BlockTranslation, ExecutionMode::Jit }) {
+            auto sys          = MakeSystemSettings(memoryModel);
+            sys.executionMode = executionMode;
+
+            auto m_cpu  = arm_emu::SystemCreator::CreateCPU(sys);
+            auto result = m_cpu->Run(arm_emu::test::GetSampleProgram(programNumber));
+
+            CheckSampleResult(result);
+            resultFrames.push_back(result.GetResultFrame());
+        }
+
+        const auto& interpreted = resultFrames.front();
+        const auto& translated  = resultFrames.back();
+        for (std::uint8_t registerLocation = 0; registerLocation < 31; ++registerLocation) {
+            ASSERT_EQ(interpreted.GetGPRegisterValue(registerLocation),
+                      translated.GetGPRegisterValue(registerLocation));
+        }
+        ASSERT_EQ(interpreted.GetPC(), translated.GetPC());
+        ASSERT_EQ(interpreted.GetSP(), translated.GetSP());
+        ASSERT_EQ(interpreted.GetN(), translated.GetN());
+        ASSERT_EQ(interpreted.GetZ(), translated.GetZ());
+        ASSERT_EQ(interpreted.GetC(), translated.GetC());
+        ASSERT_EQ(interpreted.GetV(), translated.GetV());
+    }
+
+    void SampleProgramTest::CheckSampleProgramRunMany(std::uint64_t programNumber, std::size_t programCount,
+                                                      LoadBalancingPolicy loadBalancingPolicy) {
+        auto sys                = MakeSystemSettings();
+        sys.nCores              = 2;
+        sys.loadBalancingPolicy = loadBalancingPolicy;
+
+        // Every program is queued before the first one is waited on, so they spread over the processing units
+        auto                  m_cpu = arm_emu::SystemCreator::CreateCPU(sys);
+        std::vector< Result > results;
+        for (std::size_t i = 0; i < programCount; ++i) {
+            results.push_back(m_cpu->Run(arm_emu::test::GetSampleProgram(programNumber)));
+        }
+
+        for (auto& result : results) {
+            CheckSampleResult(result);
+        }
+    }
+
+    void SampleProgramTest::CheckSampleProgramSpread(std::uint64_t       programNumber,
+                                                     LoadBalancingPolicy loadBalancingPolicy) {
+        auto sys                = MakeSystemSettings();
+        sys.nCores              = 2;
+        sys.loadBalancingPolicy = loadBalancingPolicy;
+
+        // A stepped program holds its processing unit until it is stepped, so one per unit keeps every unit busy
+        A64CPU                          cpu { sys };
+        std::vector< ControlledResult > stepCtrls;
+        for (std::size_t i = 0; i < cpu.GetCoreCount() * cpu.GetThreadsPerCoreCount(); ++i) {
+            stepCtrls.push_back(cpu.StepIn(arm_emu::test::GetSampleProgram(programNumber)));
+        }
+
+        // Every processing unit got exactly one program, none of them was left idle. Programs only move between units
+        // when one is placed behind a running program, so the queue depths are those of the placement.
+        for (std::uint8_t coreIdx = 0; coreIdx < cpu.GetCoreCount(); ++coreIdx) {
+            for (std::uint8_t threadIdx = 0; threadIdx < cpu.GetThreadsPerCoreCount(); ++threadIdx) {
+                EXPECT_EQ(cpu.GetProcessingUnitWatcher(coreIdx, threadIdx).GetQueueDepth(), 1u);
+            }
+        }
+
+        for (auto& stepCtrl : stepCtrls) {
+            while (!stepCtrl.CanStepIn())
+                ;
+            (void)stepCtrl.RunFor(std::numeric_limits< std::uint64_t >::max());
+            CheckSampleResult(stepCtrl);
+        }
+    }
+
+    void SampleProgramTest::CheckSampleProgramRunBatch(std::uint64_t programNumber, std::size_t programCount,
+                                                       LoadBalancingPolicy loadBalancingPolicy) {
+        auto sys                = MakeSystemSettings();
+        sys.nCores              = 2;
+        sys.loadBalancingPolicy = loadBalancingPolicy;
+
+        auto                   m_cpu = arm_emu::SystemCreator::CreateCPU(sys);
+        std::vector< Program > programs;
+        for (std::size_t i = 0; i < programCount; ++i) {
+            programs.push_back(arm_emu::test::GetSampleProgram(programNumber));
+        }
+
+        auto results = m_cpu->RunBatch(programs);
+        ASSERT_EQ(results.size(), programCount);
+
+        for (auto& result : results) {
+            CheckSampleResult(result);
+        }
+    }
+
+    void SampleProgramTest::CheckSampleProgramOnReady(std::uint64_t programNumber, std::size_t programCount) {
+        auto sys   = MakeSystemSettings();
+        sys.nCores = 2;
+
+        auto                   m_cpu = arm_emu::SystemCreator::CreateCPU(sys);
+        std::vector< Program > programs;
+        for (std::size_t i = 0; i < programCount; ++i) {
+            programs.push_back(arm_emu::test::GetSampleProgram(programNumber));
+        }
+
+        // Callbacks registered after a program is done are called right away, the others by its processing unit
+        std::atomic< std::size_t > readyCount { 0 };
+        std::latch                 done { static_cast< std::ptrdiff_t >(programCount) };
+        auto                       results = m_cpu->RunBatch(programs);
+        for (auto& result : results) {
+            result.OnReady([&](IResult::State state) {
+                if (state == IResult::State::Ready) {
+                    readyCount.fetch_add(1, std::memory_order_relaxed);
+                }
+                done.count_down();
+            });
+        }
+        done.wait();
+
+        ASSERT_EQ(readyCount.load(), programCount);
+        for (auto& result : results) {
+            CheckSampleResult(result);
+        }
+    }
+
+    void SampleProgramTest::CheckSampleProgramAwait(std::uint64_t programNumber, std::size_t programCount) {
+        auto sys   = MakeSystemSettings();
+        sys.nCores = 2;
+
+        // A single thread starts every coroutine, none of them blocks it while its program runs
+        auto                       m_cpu = arm_emu::SystemCreator::CreateCPU(sys);
+        std::atomic< std::size_t > validCount { 0 };
+        std::latch                 done { static_cast< std::ptrdiff_t >(programCount) };
+        for (std::size_t i = 0; i < programCount; ++i) {
+            AwaitProgram(*m_cpu, arm_emu::test::GetSampleProgram(programNumber), validCount, done);
+        }
+        done.wait();
+
+        ASSERT_EQ(validCount.load(), programCount);
+    }
+
+    void SampleProgramTest::CheckFaultingProgramRun(std::initializer_list< IMemory::DataUnit > instructions,
+                                                    ProgramFault fault, MemoryModel memoryModel) {
+        auto sys            = MakeSystemSettings(memoryModel);
+        sys.nCores          = 1;
+        sys.nThreadsPerCore = 1;
+
+        // The fault ends the program only, the processing unit runs the next one
+        auto m_cpu  = arm_emu::SystemCreator::CreateCPU(sys);
+        auto result = m_cpu->Run(MakeProgram(instructions));
+        CheckFaultResult(result, fault);
+
+        auto nextResult = m_cpu->Run(arm_emu::test::GetSampleProgram(0));
+        CheckSampleResult(nextResult);
+    }
+
+    void SampleProgramTest::CheckFaultingProgramStepIn(std::initializer_list< IMemory::DataUnit > instructions,
+                                                       ProgramFault                               fault) {
+        auto sys            = MakeSystemSettings();
+        sys.nCores          = 1;
+        sys.nThreadsPerCore = 1;
+
+        auto m_cpu    = arm_emu::SystemCreator::CreateCPU(sys);
+        auto stepCtrl = m_cpu->StepIn(MakeProgram(instructions));
+
+        // Stepping into the faulting instruction releases the stepping thread, it can't step in anymore
+        while (!stepCtrl.CanStepIn())
+            ;
+        while (stepCtrl.CanStepIn()) {
+            stepCtrl.StepIn();
+        }
+        CheckFaultResult(stepCtrl, fault);
+
+        auto nextResult = m_cpu->Run(arm_emu::test::GetSampleProgram(0));
+        CheckSampleResult(nextResult);
+    }
+
+    void SampleProgramTest::CheckFaultingProgramRunBatch(std::initializer_list< IMemory::DataUnit > instructions,
+                                                         ProgramFault fault, std::size_t programCount) {
+        auto sys   = MakeSystemSettings();
+        sys.nCores = 2;
+
+        // Faulting and regular programs alternate, every processing unit gets both
+        auto                   m_cpu = arm_emu::SystemCreator::CreateCPU(sys);
+        std::vector< Program > programs;
+        for (std::size_t i = 0; i < programCount; ++i) {
+            programs.push_back(i % 2 == 0 ? MakeProgram(instructions) : arm_emu::test::GetSampleProgram(0));
+        }
+
+        auto results = m_cpu->RunBatch(programs);
+        ASSERT_EQ(results.size(), programCount);
+
+        for (std::size_t i = 0; i < programCount; ++i) {
+            if (i % 2 == 0) {
+                CheckFaultResult(results[i], fault);
+            } else {
+                CheckSampleResult(results[i]);
+            }
+        }
+    }
+
+    void SampleProgramTest::CheckCompareImmediate64(std::initializer_list< IMemory::DataUnit > instructions, bool n,
+                                                    bool z, bool c, bool v) {
+        for (const auto executionMode :
+             { ExecutionMode::Interpreter, ExecutionMode::BlockTranslation, ExecutionMode::Jit }) {
+            auto sys          = MakeSystemSettings();
+            sys.executionMode = executionMode;
+
+            auto m_cpu  = arm_emu::SystemCreator::CreateCPU(sys);
+            auto result = m_cpu->Run(MakeProgram(instructions));
+            result.WaitReady();
+
+            auto resultFrame = result.GetResultFrame();
+
+            ASSERT_EQ(resultFrame.GetFault(), ProgramFault::None);
+            ASSERT_EQ(result.GetState(), IResult::State::Ready);
+            ASSERT_EQ(resultFrame.GetN(), n);
+            ASSERT_EQ(resultFrame.GetZ(), z);
+            ASSERT_EQ(resultFrame.GetC(), c);
+            ASSERT_EQ(resultFrame.GetV(), v);
+        }
+    }
+
+    void SampleProgramTest::CheckCrossPageAccess(MemoryModel memoryModel) {
+        // Touches the pages at 0x2000 and 0x0 before the one at 0x1000, so demand paging maps the page at 0x1000 to a
+        // frame after the one of the page at 0x2000. The unaligned accesses at 0x1FFC then straddle both frames.
+        // MOV X0, #0x2000; STR X1, [X0]; MOV X0, #0; STR X1, [X0]; MOV X1, #0x1122334455667788;
+        // MOV X0, #0x1FFC; STR X1, [X0]; LDR X2, [X0]; LDR W3, [X0, #4]; RET
+        const std::initializer_list< IMemory::DataUnit > instructions { 0xd2840000, 0xf9000001, 0xd2800000, 0xf9000001,
+                                                                        0xd28ef101, 0xf2aaacc1, 0xf2c66881, 0xf2e22441,
+                                                                        0xd283ff80, 0xf9000001, 0xf9400002, 0xb9400403,
+                                                                        0xd65f03c0 };
+
+        for (const auto executionMode :
+             { ExecutionMode::Interpreter, ExecutionMode::BlockTranslation, ExecutionMode::Jit }) {
+            auto sys          = MakeSystemSettings(memoryModel);
+            sys.executionMode = executionMode;
+
+            auto m_cpu  = arm_emu::SystemCreator::CreateCPU(sys);
+            auto result = m_cpu->Run(MakeProgram(instructions));
+            result.WaitReady();
+
+            auto resultFrame = result.GetResultFrame();
+
+            ASSERT_EQ(resultFrame.GetFault(), ProgramFault::None);
+            ASSERT_EQ(result.GetState(), IResult::State::Ready);
+            ASSERT_EQ(resultFrame.GetGPRegisterValue(2), 0x1122334455667788u);
+            ASSERT_EQ(resultFrame.GetGPRegisterValue(3), 0x11223344u);
+        }
+    }
+
     TEST_F(SampleProgramTest, RunSampleProgram0) {
         CheckSampleProgram(0);
     }
 
+    TEST_F(SampleProgramTest, RunSampleProgram0WithoutStepIn) {
+        CheckSampleProgramRun(0);
+    }
+
+    TEST_F(SampleProgramTest, RunSampleProgram0WithFlatMemory) {
+        CheckSampleProgramRun(0, MemoryModel::Flat);
+    }
+
+    TEST_F(SampleProgramTest, RunSampleProgram0WithPagedMemory) {
+        CheckSampleProgramRun(0, MemoryModel::Paged);
+    }
+
+    TEST_F(SampleProgramTest, RunSampleProgram0InEachExecutionMode) {
+        CheckSampleProgramExecutionModes(0, MemoryModel::CacheHierarchy);
+        CheckSampleProgramExecutionModes(0, MemoryModel::Flat);
+        CheckSampleProgramExecutionModes(0, MemoryModel::Paged);
+    }
+
+    TEST_F(SampleProgramTest, RunSampleProgram0ForInstructionBudget) {
+        CheckSampleProgramRunFor(0, 1);
+        CheckSampleProgramRunFor(0, 3);
+        CheckSampleProgramRunFor(0, std::numeric_limits< std::uint64_t >::max());
+    }
+
+    TEST_F(SampleProgramTest, RunManySampleProgram0) {
+        CheckSampleProgramRunMany(0, 16, LoadBalancingPolicy::LeastLoaded);
+        CheckSampleProgramRunMany(0, 16, LoadBalancingPolicy::RoundRobin);
+        CheckSampleProgramRunMany(0, 16, LoadBalancingPolicy::FirstProcessingUnit);
+    }
+
+    TEST_F(SampleProgramTest, SpreadSampleProgram0) {
+        CheckSampleProgramSpread(0, LoadBalancingPolicy::LeastLoaded);
+        CheckSampleProgramSpread(0, LoadBalancingPolicy::RoundRobin);
+    }
+
+    TEST_F(SampleProgramTest, RunBatchSampleProgram0) {
+        CheckSampleProgramRunBatch(0, 64, LoadBalancingPolicy::LeastLoaded);
+        CheckSampleProgramRunBatch(0, 64, LoadBalancingPolicy::RoundRobin);
+        CheckSampleProgramRunBatch(0, 64, LoadBalancingPolicy::FirstProcessingUnit);
+    }
+
+    TEST_F(SampleProgramTest, OnReadySampleProgram0) {
+        CheckSampleProgramOnReady(0, 64);
+    }
+
+    TEST_F(SampleProgramTest, RunFaultingProgram) {
+        // UDF #0; RET
+        CheckFaultingProgramRun({ 0x00000000, 0xd65f03c0 }, ProgramFault::UndefinedInstruction);
+    }
+
+    TEST_F(SampleProgramTest, RunFlatMemoryOutOfRangeAccess) {
+        // The data space of a processing unit is StackSize bytes, 0x3000
+        // MOV X1, #-4; STR X0, [X1]; RET
+        CheckFaultingProgramRun({ 0x92800061, 0xf9000020, 0xd65f03c0 }, ProgramFault::InvalidPhysicalMemoryAccess,
+                                MemoryModel::Flat);
+        // MOV X1, #0xFFFC0000; LDR X0, [X1]; RET
+        CheckFaultingProgramRun({ 0xd2bfff81, 0xf9400020, 0xd65f03c0 }, ProgramFault::InvalidPhysicalMemoryAccess,
+                                MemoryModel::Flat);
+        // MOV X1, #0x2FFC; STR X0, [X1]; RET
+        CheckFaultingProgramRun({ 0xd285ff81, 0xf9000020, 0xd65f03c0 }, ProgramFault::InvalidPhysicalMemoryAccess,
+                                MemoryModel::Flat);
+    }
+
+    TEST_F(SampleProgramTest, StepInFaultingProgram) {
+        // UDF #0; RET
+        CheckFaultingProgramStepIn({ 0x00000000, 0xd65f03c0 }, ProgramFault::UndefinedInstruction);
+    }
+
+    TEST_F(SampleProgramTest, RunBatchFaultingProgram) {
+        // UDF #0; RET
+        CheckFaultingProgramRunBatch({ 0x00000000, 0xd65f03c0 }, ProgramFault::UndefinedInstruction, 16);
+    }
+
+    TEST_F(SampleProgramTest, CompareImmediate64) {
+        // Like the sample programs, the compares run inside a stack frame: the zero register result lands at SP
+        // SUB SP, SP, #16; MOV X0, #5; CMP X0, #7; ADD SP, SP, #16; RET
+        CheckCompareImmediate64({ 0xd10043ff, 0xd28000a0, 0xf1001c1f, 0x910043ff, 0xd65f03c0 }, true, false, false,
+                                false);
+        // SUB SP, SP, #16; MOV X0, #7; CMP X0, #7; ADD SP, SP, #16; RET
+        CheckCompareImmediate64({ 0xd10043ff, 0xd28000e0, 0xf1001c1f, 0x910043ff, 0xd65f03c0 }, false, true, true,
+                                false);
+        // SUB SP, SP, #16; MOV X0, #0; CMP X0, #1, LSL #12; ADD SP, SP, #16; RET
+        CheckCompareImmediate64({ 0xd10043ff, 0xd2800000, 0xf140041f, 0x910043ff, 0xd65f03c0 }, true, false, false,
+                                false);
+    }
+
+    TEST_F(SampleProgramTest, CrossPageAccess) {
+        CheckCrossPageAccess(MemoryModel::CacheHierarchy);
+        CheckCrossPageAccess(MemoryModel::Flat);
+        CheckCrossPageAccess(MemoryModel::Paged);
+    }
+
+    TEST_F(SampleProgramTest, AwaitSampleProgram0) {
+        CheckSampleProgramAwait(0, 64);
+    }
+
 } // namespace test
 
 END_NAMESPACE
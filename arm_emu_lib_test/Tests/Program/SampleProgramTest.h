@@ -4,7 +4,13 @@
     #include <GTest/gtest.h>
 
     #include <API/Api.h>
+    #include <CPU/LoadBalancingPolicy.h>
+    #include <CPU/MemoryModel.h>
+    #include <CPU/SystemSettings.h>
+    #include <Program/IResult.h>
     #include <Program/Program.h>
+    #include <Program/ProgramFault.h>
+    #include <initializer_list>
 
 BEGIN_NAMESPACE
 
@@ -15,7 +21,38 @@ namespace test {
         SampleProgramTest();
         ~SampleProgramTest();
 
+        /// @brief Settings of the CPU the sample programs run on, tests change only the fields they are about
+        [[nodiscard]] static SystemSettings MakeSystemSettings(MemoryModel memoryModel = MemoryModel::CacheHierarchy);
+
+        /// @brief Waits for a sample program and checks its final frame
+        static void CheckSampleResult(IResult& result);
+
+        /// @brief Waits for a program ending on a fault and checks the fault interrupted it
+        static void CheckFaultResult(IResult& result, ProgramFault fault);
+
+        /// @brief Program made of instructions from address 0, it has to end with a RET to the host
+        [[nodiscard]] static Program MakeProgram(std::initializer_list< IMemory::DataUnit > instructions);
+
         void CheckSampleProgram(std::uint64_t programNumber);
+        void CheckSampleProgramRun(std::uint64_t programNumber,
+                                   MemoryModel   memoryModel = MemoryModel::CacheHierarchy);
+        void CheckSampleProgramRunFor(std::uint64_t programNumber, std::uint64_t instructionBudget);
+        void CheckSampleProgramExecutionModes(std::uint64_t programNumber, MemoryModel memoryModel);
+        void CheckSampleProgramRunMany(std::uint64_t programNumber, std::size_t programCount,
+                                       LoadBalancingPolicy loadBalancingPolicy);
+        void CheckSampleProgramSpread(std::uint64_t programNumber, LoadBalancingPolicy loadBalancingPolicy);
+        void CheckSampleProgramRunBatch(std::uint64_t programNumber, std::size_t programCount,
+                                        LoadBalancingPolicy loadBalancingPolicy);
+        void CheckSampleProgramOnReady(std::uint64_t programNumber, std::size_t programCount);
+        void CheckSampleProgramAwait(std::uint64_t programNumber, std::size_t programCount);
+        void CheckFaultingProgramRun(std::initializer_list< IMemory::DataUnit > instructions, ProgramFault fault,
+                                     MemoryModel memoryModel = MemoryModel::CacheHierarchy);
+        void CheckFaultingProgramStepIn(std::initializer_list< IMemory::DataUnit > instructions, ProgramFault fault);
+        void CheckFaultingProgramRunBatch(std::initializer_list< IMemory::DataUnit > instructions, ProgramFault fault,
+                                          std::size_t programCount);
+        void CheckCompareImmediate64(std::initializer_list< IMemory::DataUnit > instructions, bool n, bool z, bool c,
+                                     bool v);
+        void CheckCrossPageAccess(MemoryModel memoryModel);
 
         Program m_program;
     };